@@ -0,0 +1,521 @@
+"""Benchmarks for the blit, fill, transform and draw hot paths.
+
+Runs against the installed pygame-ce, headless with the dummy video driver.
+Every case is timed once per requested SIMD level by re-running this script
+in a subprocess with the ``PYGAME_SIMD`` environment variable set, so the
+AVX2, SSE2/NEON and non-SIMD variants of the kernels are all measured on the
+same machine.
+
+Results are written as JSON. Two result files can be compared, which prints
+the relative change of every case and exits with an error if any case got
+slower than the given threshold.
+
+::
+
+    python dev.py bench -o before.json
+    # rebuild with your changes
+    python dev.py bench -o after.json
+    python dev.py bench --compare before.json after.json
+
+Use ``--filter`` with a regular expression to run a subset of the cases,
+e.g. ``--filter "^blit/BLEND_RGBA"``.
+"""
+
+import argparse
+import json
+import os
+import platform
+import random
+import re
+import statistics
+import subprocess
+import sys
+import time
+
+SCHEMA_VERSION = 1
+SIMD_LEVELS = ("avx2", "sse2", "none")
+DEFAULT_SIZES = ((64, 64), (256, 256), (1024, 1024))
+SEED = 1234
+
+# name -> (Surface flags, depth)
+FORMATS = {
+    "ARGB8888": ("SRCALPHA", 32),
+    "XRGB8888": (None, 32),
+    "RGB888": (None, 24),
+    "RGB565": (None, 16),
+}
+
+# (source format, destination format) pairs used for blits
+BLIT_PAIRS = (
+    ("ARGB8888", "ARGB8888"),
+    ("ARGB8888", "XRGB8888"),
+    ("XRGB8888", "XRGB8888"),
+    ("RGB888", "RGB888"),
+    ("RGB565", "RGB565"),
+)
+
+# None is a plain blit or fill without special_flags
+BLIT_FLAGS = (
+    None,
+    "BLEND_RGB_ADD",
+    "BLEND_RGB_SUB",
+    "BLEND_RGB_MULT",
+    "BLEND_RGB_MIN",
+    "BLEND_RGB_MAX",
+    "BLEND_RGBA_ADD",
+    "BLEND_RGBA_SUB",
+    "BLEND_RGBA_MULT",
+    "BLEND_RGBA_MIN",
+    "BLEND_RGBA_MAX",
+    "BLEND_PREMULTIPLIED",
+    "BLEND_ALPHA_SDL2",
+)
+
+FILL_FLAGS = (
+    None,
+    "BLEND_ADD",
+    "BLEND_SUB",
+    "BLEND_MULT",
+    "BLEND_MIN",
+    "BLEND_MAX",
+    "BLEND_RGBA_ADD",
+    "BLEND_RGBA_SUB",
+    "BLEND_RGBA_MULT",
+    "BLEND_RGBA_MIN",
+    "BLEND_RGBA_MAX",
+)
+
+
+class Case:
+    """A named benchmark. setup() returns the function that gets timed."""
+
+    def __init__(self, name, setup):
+        self.name = name
+        self.setup = setup
+
+
+def make_surface(pygame, fmt, size):
+    """Returns a surface of the given format filled with reproducible noise"""
+    flags, depth = FORMATS[fmt]
+    surf = pygame.Surface(size, getattr(pygame, flags) if flags else 0, depth)
+    rng = random.Random(f"{SEED}-{fmt}-{size}")
+    noise = pygame.image.frombytes(rng.randbytes(size[0] * size[1] * 4), size, "RGBA")
+    surf.blit(noise, (0, 0))
+    return surf
+
+
+def blit_cases(pygame, sizes):
+    cases = []
+
+    def setup(src_fmt, dst_fmt, size, flag, mode=None):
+        def inner():
+            src = make_surface(pygame, src_fmt, size)
+            dst = make_surface(pygame, dst_fmt, size)
+            if mode == "colorkey":
+                src.set_colorkey(src.get_at((0, 0)))
+            elif mode == "surface_alpha":
+                src.set_alpha(128)
+            flags = getattr(pygame, flag) if flag else 0
+            return lambda: dst.blit(src, (0, 0), special_flags=flags)
+
+        return inner
+
+    for size in sizes:
+        size_name = f"{size[0]}x{size[1]}"
+        for src_fmt, dst_fmt in BLIT_PAIRS:
+            pair = f"{src_fmt}->{dst_fmt}"
+            for flag in BLIT_FLAGS:
+                cases.append(
+                    Case(
+                        f"blit/{flag or 'none'}/{pair}/{size_name}",
+                        setup(src_fmt, dst_fmt, size, flag),
+                    )
+                )
+            if src_fmt != "ARGB8888":
+                for mode in ("colorkey", "surface_alpha"):
+                    cases.append(
+                        Case(
+                            f"blit/{mode}/{pair}/{size_name}",
+                            setup(src_fmt, dst_fmt, size, None, mode),
+                        )
+                    )
+    return cases
+
+
+def fill_cases(pygame, sizes):
+    cases = []
+
+    def setup(fmt, size, flag):
+        def inner():
+            surf = make_surface(pygame, fmt, size)
+            flags = getattr(pygame, flag) if flag else 0
+            color = (40, 90, 160, 200)
+            return lambda: surf.fill(color, None, flags)
+
+        return inner
+
+    for size in sizes:
+        for fmt in FORMATS:
+            for flag in FILL_FLAGS:
+                cases.append(
+                    Case(
+                        f"fill/{flag or 'none'}/{fmt}/{size[0]}x{size[1]}",
+                        setup(fmt, size, flag),
+                    )
+                )
+    return cases
+
+
+def transform_cases(pygame, sizes):
+    tf = pygame.transform
+    ops = {
+        "smoothscale_down": lambda s: tf.smoothscale(s, halve(s)),
+        "smoothscale_up": lambda s: tf.smoothscale(s, double(s)),
+        "scale_down": lambda s: tf.scale(s, halve(s)),
+        "scale_up": lambda s: tf.scale(s, double(s)),
+        "rotate": lambda s: tf.rotate(s, 33),
+        "rotozoom": lambda s: tf.rotozoom(s, 33, 0.75),
+        "flip": lambda s: tf.flip(s, True, True),
+        "grayscale": tf.grayscale,
+        "invert": tf.invert,
+        "box_blur": lambda s: tf.box_blur(s, 4),
+        "gaussian_blur": lambda s: tf.gaussian_blur(s, 4),
+        "laplacian": tf.laplacian,
+        "average_color": tf.average_color,
+        "premul_alpha": lambda s: s.premul_alpha(),
+    }
+    cases = []
+
+    def setup(fmt, size, op):
+        def inner():
+            surf = make_surface(pygame, fmt, size)
+            return lambda: op(surf)
+
+        return inner
+
+    for size in sizes:
+        for fmt in FORMATS:
+            for name, op in ops.items():
+                cases.append(
+                    Case(
+                        f"transform/{name}/{fmt}/{size[0]}x{size[1]}",
+                        setup(fmt, size, op),
+                    )
+                )
+    return cases
+
+
+def draw_cases(pygame, sizes):
+    draw = pygame.draw
+    color = (200, 120, 40)
+
+    def star(w, h, points=10):
+        rng = random.Random(SEED)
+        return [
+            (
+                w / 2 + w / 2 * rng.uniform(0.3, 1) * cos_sin[0],
+                h / 2 + h / 2 * rng.uniform(0.3, 1) * cos_sin[1],
+            )
+            for cos_sin in (
+                pygame.Vector2(1, 0).rotate(360 / points * i) for i in range(points)
+            )
+        ]
+
+    ops = {
+        "line": lambda s, w, h, pts: draw.line(s, color, (0, 0), (w - 1, h - 1)),
+        "line_wide": lambda s, w, h, pts: draw.line(
+            s, color, (0, 0), (w - 1, h - 1), 5
+        ),
+        "aaline": lambda s, w, h, pts: draw.aaline(s, color, (0, 0), (w - 1, h / 3)),
+        "lines": lambda s, w, h, pts: draw.lines(s, color, True, pts, 3),
+        "aalines": lambda s, w, h, pts: draw.aalines(s, color, True, pts),
+        "rect": lambda s, w, h, pts: draw.rect(s, color, (w / 8, h / 8, w / 2, h / 2)),
+        "rect_outline": lambda s, w, h, pts: draw.rect(
+            s, color, (w / 8, h / 8, w / 2, h / 2), 3
+        ),
+        "circle": lambda s, w, h, pts: draw.circle(s, color, (w / 2, h / 2), w / 3),
+        "circle_outline": lambda s, w, h, pts: draw.circle(
+            s, color, (w / 2, h / 2), w / 3, 3
+        ),
+        "aacircle": lambda s, w, h, pts: draw.aacircle(s, color, (w / 2, h / 2), w / 3),
+        "ellipse": lambda s, w, h, pts: draw.ellipse(s, color, (0, h / 4, w, h / 2)),
+        "arc": lambda s, w, h, pts: draw.arc(s, color, (0, 0, w, h), 0.3, 4, 3),
+        "polygon": lambda s, w, h, pts: draw.polygon(s, color, pts),
+    }
+    cases = []
+
+    def setup(fmt, size, op):
+        def inner():
+            surf = make_surface(pygame, fmt, size)
+            w, h = size
+            pts = star(w, h)
+            return lambda: op(surf, w, h, pts)
+
+        return inner
+
+    for size in sizes:
+        for fmt in FORMATS:
+            for name, op in ops.items():
+                cases.append(
+                    Case(
+                        f"draw/{name}/{fmt}/{size[0]}x{size[1]}",
+                        setup(fmt, size, op),
+                    )
+                )
+    return cases
+
+
+def halve(surf):
+    return max(surf.get_width() // 2, 1), max(surf.get_height() // 2, 1)
+
+
+def double(surf):
+    return surf.get_width() * 2, surf.get_height() * 2
+
+
+def all_cases(pygame, sizes):
+    return (
+        blit_cases(pygame, sizes)
+        + fill_cases(pygame, sizes)
+        + transform_cases(pygame, sizes)
+        + draw_cases(pygame, sizes)
+    )
+
+
+def time_case(func, number, repeat, min_time):
+    """Returns (number, per call times) like timeit.Timer.repeat"""
+    if not number:
+        # calibrate like timeit.Timer.autorange
+        number = 1
+        while True:
+            start = time.perf_counter()
+            for _ in range(number):
+                func()
+            if time.perf_counter() - start >= min_time:
+                break
+            number *= 2
+
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        for _ in range(number):
+            func()
+        times.append((time.perf_counter() - start) / number)
+    return number, times
+
+
+def run_worker(args):
+    """Runs the benchmarks in this process and prints the results as JSON"""
+    import pygame
+
+    pygame.display.init()
+    if hasattr(pygame.transform, "set_num_threads"):
+        pygame.transform.set_num_threads(args.threads)
+
+    pattern = re.compile(args.filter) if args.filter else None
+    results = []
+    for case in all_cases(pygame, args.sizes):
+        if pattern and not pattern.search(case.name):
+            continue
+        try:
+            func = case.setup()
+            func()
+        except (pygame.error, ValueError, TypeError) as e:
+            # combination not supported by this build, e.g. a format
+            print(f"skipping {case.name}: {e}", file=sys.stderr)
+            continue
+
+        number, times = time_case(func, args.number, args.repeat, args.min_time)
+        results.append(
+            {
+                "name": case.name,
+                "simd": args.simd_level,
+                "number": number,
+                "min": min(times),
+                "median": statistics.median(times),
+                "mean": statistics.fmean(times),
+                "stdev": statistics.stdev(times) if len(times) > 1 else 0.0,
+            }
+        )
+        if args.verbose:
+            print(
+                f"{args.simd_level:>4} {case.name:<55} {min(times) * 1e6:12.2f} us",
+                file=sys.stderr,
+            )
+
+    meta = {
+        "pygame": pygame.version.ver,
+        "sdl": ".".join(str(v) for v in pygame.version.SDL),
+        "python": platform.python_version(),
+        "implementation": platform.python_implementation(),
+        "platform": platform.platform(),
+        "machine": platform.machine(),
+        "cpu_instruction_sets": pygame.system.get_cpu_instruction_sets(),
+    }
+    json.dump({"meta": meta, "results": results}, sys.stdout)
+
+
+def run(args):
+    """Runs one worker per SIMD level and merges their results"""
+    env = dict(os.environ)
+    env["SDL_VIDEODRIVER"] = "dummy"
+    env["SDL_AUDIODRIVER"] = "disk"
+    env["PYGAME_HIDE_SUPPORT_PROMPT"] = "1"
+
+    output = {
+        "schema": SCHEMA_VERSION,
+        "created": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+        "settings": {
+            "sizes": [list(size) for size in args.sizes],
+            "repeat": args.repeat,
+            "number": args.number,
+            "min_time": args.min_time,
+            "threads": args.threads,
+            "filter": args.filter,
+        },
+        "meta": None,
+        "results": [],
+    }
+    for level in args.simd:
+        env["PYGAME_SIMD"] = level
+        cmd = [sys.executable, os.path.abspath(__file__), "--worker", level]
+        cmd += ["--sizes"] + [f"{w}x{h}" for w, h in args.sizes]
+        cmd += ["--repeat", str(args.repeat), "--min-time", str(args.min_time)]
+        cmd += ["--number", str(args.number), "--threads", str(args.threads)]
+        if args.filter:
+            cmd += ["--filter", args.filter]
+        if args.verbose:
+            cmd.append("--verbose")
+
+        print(f"Running benchmarks with PYGAME_SIMD={level}", file=sys.stderr)
+        proc = subprocess.run(cmd, env=env, stdout=subprocess.PIPE, check=True)
+        worker = json.loads(proc.stdout)
+        output["meta"] = worker["meta"]
+        output["results"] += worker["results"]
+
+    text = json.dumps(output, indent=2)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(text + "\n")
+        print(f"Wrote {len(output['results'])} results to {args.output}")
+    else:
+        print(text)
+
+
+def compare(args):
+    """Prints the change between two result files, returns the exit code"""
+    tables = []
+    for path in args.compare:
+        with open(path, encoding="utf-8") as f:
+            data = json.load(f)
+        if data.get("schema") != SCHEMA_VERSION:
+            sys.exit(f"{path}: unsupported schema {data.get('schema')}")
+        tables.append({(r["name"], r["simd"]): r["min"] for r in data["results"]})
+
+    old, new = tables
+    regressions = 0
+    for key in sorted(old.keys() & new.keys()):
+        change = new[key] / old[key] - 1 if old[key] else 0.0
+        marker = ""
+        if change > args.threshold:
+            marker = "  <-- slower"
+            regressions += 1
+        elif change < -args.threshold:
+            marker = "  faster"
+        print(
+            f"{key[1]:>4} {key[0]:<55} {old[key] * 1e6:12.2f} us "
+            f"{new[key] * 1e6:12.2f} us {change:+8.1%}{marker}"
+        )
+    for key in sorted(old.keys() ^ new.keys()):
+        print(f"{key[1]:>4} {key[0]:<55} only in one of the files")
+
+    print(f"{regressions} case(s) slower by more than {args.threshold:.0%}")
+    return 1 if regressions else 0
+
+
+def parse_size(text):
+    w, _, h = text.lower().partition("x")
+    return int(w), int(h or w)
+
+
+def parse_args(argv=None):
+    parser = argparse.ArgumentParser(
+        description=__doc__.split("\n", 1)[0],
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+    )
+    parser.add_argument(
+        "-o", "--output", help="File to write the JSON results to (default: stdout)"
+    )
+    parser.add_argument(
+        "--simd",
+        type=lambda s: s.split(","),
+        default=list(SIMD_LEVELS),
+        help=(
+            "Comma separated PYGAME_SIMD levels to run, out of "
+            f"{', '.join(SIMD_LEVELS)} (default: all)"
+        ),
+    )
+    parser.add_argument(
+        "--sizes",
+        nargs="+",
+        type=parse_size,
+        default=list(DEFAULT_SIZES),
+        help="Surface sizes like 256x256 (default: 64x64 256x256 1024x1024)",
+    )
+    parser.add_argument("--filter", help="Only run cases matching this regex")
+    parser.add_argument(
+        "--repeat", type=int, default=5, help="Timings per case (default: 5)"
+    )
+    parser.add_argument(
+        "--number",
+        type=int,
+        default=0,
+        help="Calls per timing, 0 calibrates it per case (default: 0)",
+    )
+    parser.add_argument(
+        "--min-time",
+        type=float,
+        default=0.02,
+        help="Seconds per timing when calibrating (default: 0.02)",
+    )
+    parser.add_argument(
+        "--threads",
+        type=int,
+        default=1,
+        help="pygame.transform.set_num_threads value (default: 1)",
+    )
+    parser.add_argument(
+        "--compare",
+        nargs=2,
+        metavar=("OLD", "NEW"),
+        help="Compare two result files instead of running benchmarks",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="Relative slowdown reported as a regression (default: 0.1)",
+    )
+    parser.add_argument("-v", "--verbose", action="store_true")
+    parser.add_argument("--worker", dest="simd_level", help=argparse.SUPPRESS)
+
+    args = parser.parse_args(argv)
+    for level in args.simd:
+        if level not in SIMD_LEVELS:
+            parser.error(f"unknown SIMD level {level!r}")
+    return args
+
+
+def main(argv=None):
+    args = parse_args(argv)
+    if args.compare:
+        return compare(args)
+    if args.simd_level:
+        run_worker(args)
+    else:
+        run(args)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
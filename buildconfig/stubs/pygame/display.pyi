@@ -57,6 +57,7 @@ from typing import Literal, overload
 
 from pygame._sdl2 import Window
 from pygame.constants import FULLSCREEN
+from pygame.rect import Rect
 from pygame.surface import Surface
 from pygame.typing import (
     ColorLike,
@@ -302,6 +303,71 @@ def flip() -> None:
     swap.
     """
 
+class DirtyRegion:
+    """Collect and merge the changed areas of the display.
+
+    A ``DirtyRegion`` gathers the rects of the display Surface that changed
+    during a frame, for games that only redraw part of the screen. Passing it
+    to :func:`pygame.display.update` then uploads fewer, bigger rects than the
+    raw list would, and never the same pixel twice.
+
+    Rects are merged when the region is read. Rects that overlap are always
+    merged, so the rects of a region never overlap. Rects that do not overlap
+    are merged when the rect covering both of them is not much bigger than
+    their summed area, a tolerance of ``0.25`` allows the merged rect to cover
+    up to 25% more pixels. A bigger tolerance gives fewer rects that cover more
+    pixels, ``0`` only joins rects that line up exactly.
+
+    If ``clip`` is given, added rects are clipped to it. Rects with no area are
+    ignored.
+
+    .. code-block:: python
+
+        region = pygame.display.DirtyRegion()
+        while running:
+            region.extend(group.draw(screen))
+            pygame.display.update(region)
+            region.clear()
+
+    .. versionadded:: 3.0.0
+    """
+
+    def __init__(
+        self, tolerance: float = 0.25, clip: RectLike | None = None
+    ) -> None: ...
+    def __len__(self) -> int: ...
+    def add(self, rect: RectLike, /) -> None:
+        """Add a changed area to the region."""
+
+    def extend(self, rects: Iterable[RectLike | None], /) -> None:
+        """Add several changed areas to the region.
+
+        ``None`` items are skipped, so the return value of
+        :meth:`pygame.sprite.Group.draw` can be passed directly.
+        """
+
+    def clear(self) -> None:
+        """Empty the region."""
+
+    def get_rects(self) -> list[Rect]:
+        """Get the merged rects of the region.
+
+        The rects never overlap. ``len(region)`` is the number of rects this
+        would return.
+        """
+
+    @property
+    def area(self) -> int:
+        """The number of pixels covered by the region (**read-only**).
+
+        Comparing it with the size of the display helps deciding if a full
+        :func:`pygame.display.flip` is cheaper.
+        """
+
+    @property
+    def tolerance(self) -> float:
+        """How many extra pixels a merge may cover (**read-only**)."""
+
 @overload
 def update() -> None: ...
 @overload
@@ -309,6 +375,8 @@ def update(rectangle: RectLike | None, /) -> None: ...
 @overload
 def update(rectangles: Iterable[RectLike | None], /) -> None: ...
 @overload
+def update(region: DirtyRegion, /) -> None: ...
+@overload
 def update(x: float, y: float, w: float, h: float, /) -> None: ...
 @overload
 def update(xy: Point, wh: Point, /) -> None: ...
@@ -337,10 +405,14 @@ def update(*args):  # type: ignore
     If passing an iterable of rectangles it is safe to include None
     values in the list, which will be skipped.
 
+    Passing a :class:`DirtyRegion` updates its merged rects, which avoids
+    uploading overlapping areas more than once. The region is left as is.
+
     This call cannot be used on ``pygame.OPENGL`` displays and will generate an
     exception.
 
     .. versionchanged:: 2.5.1 Added support for passing an iterable, previously only sequence was allowed
+    .. versionchanged:: 3.0.0 Added support for passing a :class:`DirtyRegion`
     """
 
 def get_driver() -> str:
@@ -17,7 +17,11 @@ All the drawing functions accept a color argument that is compatible with
 
 A color's alpha value will be written directly into the surface (if the
 surface contains pixel alphas), but the draw function will not draw
-transparently.
+transparently. The exception is drawing with ``blend=True``, which :func:`rect`,
+:func:`polygon`, :func:`circle`, :func:`line` and :func:`lines` accept: the
+shape is then antialiased and blended into the surface with the color's alpha,
+the way a blit of a surface with per pixel alpha would be, without the need of
+an intermediate surface.
 
 These functions temporarily lock the surface they are operating on. Many
 sequential drawing calls can be sped up by locking and unlocking the surface
@@ -28,8 +32,11 @@ object around the draw calls (see :func:`pygame.Surface.lock` and
     See the :mod:`pygame.gfxdraw` module for alternative draw methods.
 """
 
-from typing import overload
+from typing import Literal, overload
 
+from typing_extensions import Buffer
+
+from pygame.mask import Mask
 from pygame.rect import Rect
 from pygame.surface import Surface
 from pygame.typing import ColorLike, Point, RectLike, SequenceLike
@@ -44,6 +51,8 @@ def rect(
     border_top_right_radius: int = -1,
     border_bottom_left_radius: int = -1,
     border_bottom_right_radius: int = -1,
+    *,
+    blend: bool = False,
 ) -> Rect:
     """Draw a rectangle.
 
@@ -80,6 +89,11 @@ def rect(
             | If sum of radii on the same side of the rectangle is greater than the rect size the radii
             | will get scaled
 
+    :param bool blend: (optional, keyword only) if ``True`` the rectangle is
+        antialiased and blended into the surface using the color's alpha
+        (default is ``False``), the corners of the rectangle are pixel
+        corners so only rounded corners have partially covered pixels
+
     :returns: a rect bounding the changed pixels, if nothing is drawn the
         bounding rect's position will be the position of the given ``rect``
         parameter and its width and height will be 0
@@ -95,6 +109,7 @@ def rect(
         Drawing rects with width now draws the width correctly inside the
         rect's area, rather than using an internal call to draw.lines(),
         which had half the width spill outside the rect area.
+    .. versionchanged:: 3.0.0 Added the ``blend`` argument.
     """
 
 def polygon(
@@ -102,6 +117,8 @@ def polygon(
     color: ColorLike,
     points: SequenceLike[Point],
     width: int = 0,
+    *,
+    blend: bool = False,
 ) -> Rect:
     """Draw a polygon.
 
@@ -130,6 +147,12 @@ def polygon(
                 how the thickness for edge lines grow, refer to the ``width`` notes
                 of the :func:`pygame.draw.line` function.
 
+    :param bool blend: (optional, keyword only) if ``True`` the polygon is
+        antialiased and blended into the surface using the color's alpha
+        (default is ``False``), the points are the centers of pixels like in
+        :func:`aalines` and parts of the polygon that overlap are only drawn
+        once
+
     :returns: a rect bounding the changed pixels, if nothing is drawn the
         bounding rect's position will be the position of the first point in the
         ``points`` parameter (float values will be truncated) and its width and
@@ -144,6 +167,7 @@ def polygon(
         For an aapolygon, use :func:`aalines()` with ``closed=True``.
 
     .. versionchangedold:: 2.0.0 Added support for keyword arguments.
+    .. versionchanged:: 3.0.0 Added the ``blend`` argument.
     """
 
 def circle(
@@ -156,6 +180,8 @@ def circle(
     draw_top_left: bool = False,
     draw_bottom_left: bool = False,
     draw_bottom_right: bool = False,
+    *,
+    blend: bool = False,
 ) -> Rect:
     """Draw a circle.
 
@@ -194,6 +220,10 @@ def circle(
 
             | If any quadrants are set to True, only they will be drawn, otherwise the entire circle will be drawn.
 
+    :param bool blend: (optional, keyword only) if ``True`` the circle is
+        antialiased and blended into the surface using the color's alpha
+        (default is ``False``)
+
     :returns: a rect bounding the changed pixels, if nothing is drawn the
         bounding rect's position will be the ``center`` parameter value (float
         values will be truncated) and its width and height will be 0
@@ -208,6 +238,7 @@ def circle(
         Floats, and Vector2 are accepted for the ``center`` param.
         The drawing algorithm was improved to look more like a circle.
     .. versionchangedold:: 2.0.0.dev8 Added support for drawing circle quadrants.
+    .. versionchanged:: 3.0.0 Added the ``blend`` argument.
     """
 
 def aacircle(
@@ -365,6 +396,8 @@ def line(
     start_pos: Point,
     end_pos: Point,
     width: int = 1,
+    *,
+    blend: bool = False,
 ) -> Rect:
     """Draw a straight line.
 
@@ -400,6 +433,11 @@ def line(
             (vertical-ish) will have 1 more pixel of thickness to the right of
             the original line (in the x direction).
 
+    :param bool blend: (optional, keyword only) if ``True`` the line is
+        antialiased and blended into the surface using the color's alpha
+        (default is ``False``), thick lines are then exactly ``width`` wide,
+        centered on the line between the centers of the end pixels
+
     :returns: a rect bounding the changed pixels, if nothing is drawn the
         bounding rect's position will be the ``start_pos`` parameter value (float
         values will be truncated) and its width and height will be 0
@@ -409,6 +447,7 @@ def line(
         two numbers
 
     .. versionchangedold:: 2.0.0 Added support for keyword arguments.
+    .. versionchanged:: 3.0.0 Added the ``blend`` argument.
     """
 
 def lines(
@@ -417,12 +456,16 @@ def lines(
     closed: bool,
     points: SequenceLike[Point],
     width: int = 1,
+    *,
+    blend: bool = False,
+    joint: Literal["miter", "round", "bevel"] | None = None,
 ) -> Rect:
     """Draw multiple contiguous straight line segments.
 
     Draws a sequence of contiguous straight lines on the given surface. There are
-    no endcaps or miter joints. For thick lines the ends are squared off.
-    Drawing thick lines with sharp corners can have undesired looking results.
+    no endcaps. For thick lines the ends are squared off. Without a ``joint``
+    each line segment is drawn on its own, so drawing thick lines with sharp
+    corners can have undesired looking results.
 
     :param Surface surface: surface to draw on
     :param color: color to draw with, the alpha value is optional if using a
@@ -448,6 +491,19 @@ def lines(
                 When using ``width`` values ``> 1`` refer to the ``width`` notes
                 of :func:`line` for details on how thick lines grow.
 
+    :param bool blend: (optional, keyword only) if ``True`` the lines are
+        antialiased and blended into the surface using the color's alpha
+        (default is ``False``), where the line segments overlap they are
+        only drawn once
+    :param joint: (optional, keyword only) how the line segments are joined,
+        ``'miter'`` extends their outer edges until they meet (corners sharper
+        than about 29 degrees are beveled instead), ``'round'`` rounds them off
+        and ``'bevel'`` cuts them straight across. The whole path is then
+        filled as one shape, so no pixel is drawn twice and long paths of many
+        points are drawn a lot faster than segment by segment. If ``None``
+        (the default) each segment is drawn on its own
+    :type joint: str or None
+
     :returns: a rect bounding the changed pixels, if nothing is drawn the
         bounding rect's position will be the position of the first point in the
         ``points`` parameter (float values will be truncated) and its width and
@@ -455,10 +511,12 @@ def lines(
     :rtype: Rect
 
     :raises ValueError: if ``len(points) < 2`` (must have at least 2 points)
+        or ``joint`` is not one of the names above
     :raises TypeError: if ``points`` is not a sequence or ``points`` does not
         contain number pairs
 
     .. versionchangedold:: 2.0.0 Added support for keyword arguments.
+    .. versionchanged:: 3.0.0 Added the ``blend`` and ``joint`` arguments.
     """
 
 def aaline(
@@ -519,6 +577,9 @@ def aalines(
     color: ColorLike,
     closed: bool,
     points: SequenceLike[Point],
+    *,
+    width: int = 1,
+    joint: Literal["miter", "round", "bevel"] | None = None,
 ) -> Rect:
     """Draw multiple contiguous straight antialiased line segments.
 
@@ -540,6 +601,17 @@ def aalines(
         additionally if the ``closed`` parameter is ``True`` another line segment
         will be drawn from ``(x3, y3)`` to ``(x1, y1)``
     :type points: tuple(point) or list(point)
+    :param int width: (optional, keyword only) used for line thickness
+
+            | if width >= 1, used for line thickness (default is 1)
+            | if width < 1, lines of width == 1 will be drawn
+
+    :param joint: (optional, keyword only) how the line segments are joined,
+        one of ``'miter'``, ``'round'`` or ``'bevel'`` as for :func:`lines`.
+        The whole path is then antialiased as one shape, so the joints are
+        not blended twice. If ``None`` (the default) each segment is drawn
+        on its own
+    :type joint: str or None
 
     :returns: a rect bounding the changed pixels, if nothing is drawn the
         bounding rect's position will be the position of the first point in the
@@ -548,6 +620,7 @@ def aalines(
     :rtype: Rect
 
     :raises ValueError: if ``len(points) < 2`` (must have at least 2 points)
+        or ``joint`` is not one of the names above
     :raises TypeError: if ``points`` is not a sequence or ``points`` does not
         contain number pairs
 
@@ -555,13 +628,26 @@ def aalines(
     .. versionchanged:: 2.4.0 Removed deprecated ``blend`` argument
     .. versionchanged:: 2.5.0 ``blend`` argument re-added for backcompat, but will
         always raise a deprecation exception when used
+    .. versionchanged:: 3.0.0 Added the ``width`` and ``joint`` arguments.
     """
 
-def flood_fill(surface: Surface, color: ColorLike | Surface, start_pos: Point) -> Rect:
+def flood_fill(
+    surface: Surface,
+    color: ColorLike | Surface,
+    start_pos: Point,
+    *,
+    tolerance: int = 0,
+    mask: Mask | None = None,
+) -> Rect:
     """Fill an enclosed, same color area, on a surface.
 
     Replace the color of a cluster of connected same-color pixels, beginning
     from the starting position, with a repeating pattern or solid single color.
+    Only the pixels inside the surface's clip area are filled.
+
+    The area is filled a horizontal run of pixels at a time, which keeps the
+    memory needed proportional to the number of runs still to be visited
+    rather than the size of the surface.
 
     :param Surface surface: surface to draw on
     :param color: color, or surface pattern, to draw with. The alpha value is optional if using a
@@ -571,11 +657,81 @@ def flood_fill(surface: Surface, color: ColorLike | Surface, start_pos: Point) -
        e.g. ``(x, y)``
     :type start_pos: tuple(int or float, int or float) or
        list(int or float, int or float) or Vector2(int or float, int or float)
+    :param int tolerance: (optional, keyword only) how far, from 0 to 255,
+       each of the red, green, blue and alpha values of a pixel may be from
+       the color of the starting pixel for the pixel to be filled. With the
+       default of 0 only pixels of exactly the same color are filled
+    :param mask: (optional, keyword only) a mask of the same size as the
+       surface in which the bits of the filled pixels are set, the other bits
+       are left as they are. Clear the mask beforehand (see
+       :meth:`pygame.mask.Mask.clear`) to get the area of this fill alone
+    :type mask: :class:`pygame.mask.Mask` or None
 
     :returns: a rect bounding the changed pixels, if nothing is drawn the
        bounding rect's position will be the position of the starting point
        and its width and height will be 0
     :rtype: Rect
 
+    :raises ValueError: if ``tolerance`` is not in the range 0 to 255 or the
+       mask is not the same size as the surface
+
     .. versionadded:: 2.5.6
+    .. versionchanged:: 3.0.0 Added the ``tolerance`` and ``mask`` arguments.
+    """
+
+def many(
+    surface: Surface,
+    kind: Literal["line", "aaline", "rect", "circle"],
+    color: ColorLike | SequenceLike[ColorLike],
+    params: Buffer,
+    width: int | None = None,
+) -> Rect:
+    """Draw many shapes of one kind in a single call.
+
+    Draws a batch of lines, antialiased lines, rectangles or circles on the
+    given surface. The surface is locked only once and the colors are mapped
+    before drawing, which makes this much faster than calling the matching
+    function once per shape when drawing thousands of small shapes, e.g.
+    particles or debug overlays.
+
+    Each shape is drawn the same way as the function of the same name draws
+    it, and is clipped to the surface's clip area on its own.
+
+    :param Surface surface: surface to draw on
+    :param str kind: the kind of shapes to draw, one of:
+
+        | ``"line"``, 4 numbers per shape: ``x1, y1, x2, y2``, see :func:`line`
+        | ``"aaline"``, 4 numbers per shape: ``x1, y1, x2, y2``, see
+          :func:`aaline`
+        | ``"rect"``, 4 numbers per shape: ``x, y, width, height``, see
+          :func:`rect` (without border radius)
+        | ``"circle"``, 3 numbers per shape: ``x, y, radius``, see
+          :func:`circle` (without quadrants)
+
+    :param color: color to draw all the shapes with, or a sequence of colors
+        with one color for each shape. A value that is a valid color is
+        always used as a single color.
+    :type color: :data:`pygame.typing.ColorLike` or a sequence of them
+    :param params: the numbers of all the shapes, one shape after the other,
+        as any C contiguous buffer of numbers (e.g. an ``array.array`` or a
+        numpy array of shape ``(n, 4)``). The item format must be one of
+        ``'h'``, ``'i'``, ``'l'``, ``'q'``, ``'f'`` or ``'d'``. Floats are
+        truncated to ints, except for ``"aaline"``.
+    :param int width: (optional) the width used for all the shapes, as the
+        ``width`` argument of the matching function. Defaults to 1 for
+        ``"line"`` and ``"aaline"``, and to 0 (filled) for ``"rect"`` and
+        ``"circle"``.
+
+    :returns: a rect bounding the changed pixels of all the shapes, if
+        nothing is drawn the bounding rect's position will be the position of
+        the first shape (or ``(0, 0)`` if there are no shapes) and its width
+        and height will be 0
+    :rtype: Rect
+
+    :raises ValueError: if ``kind`` is unknown, or the ``params`` buffer does
+        not hold a whole number of shapes or has an unsupported format
+    :raises TypeError: if ``params`` is not a buffer, or ``color`` is neither
+        a color nor a sequence of one color per shape
+
+    .. versionadded:: 3.0.0
     """
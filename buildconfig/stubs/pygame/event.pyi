@@ -1,3 +1,5 @@
+import sys
+from collections.abc import Iterator
 from typing import Any, ClassVar, TypeAlias, final
 
 from pygame.typing import SequenceLike
@@ -33,6 +35,16 @@ class Event(_GenericEvent):
 class EventType(_GenericEvent):
     pass
 
+@final
+class EventArray:
+    def __len__(self) -> int: ...
+    def __getitem__(self, index: int, /) -> Event: ...
+    def __iter__(self) -> Iterator[Event]: ...
+    if sys.version_info >= (3, 12):
+        def __buffer__(self, flags: int, /) -> memoryview: ...
+        def __release_buffer__(self, view: memoryview, /) -> None: ...
+    def field(self, name: str, /) -> memoryview: ...
+
 _EventTypes: TypeAlias = int | SequenceLike[int]
 
 def pump() -> None: ...
@@ -41,6 +53,11 @@ def get(
     pump: bool = True,
     exclude: _EventTypes | None = None,
 ) -> list[Event]: ...
+def get_array(
+    eventtype: _EventTypes | None = None,
+    pump: bool = True,
+    exclude: _EventTypes | None = None,
+) -> EventArray: ...
 def poll() -> Event: ...
 def wait(timeout: int = 0) -> Event: ...
 def peek(eventtype: _EventTypes | None = None, pump: bool = True) -> bool: ...
@@ -49,6 +66,8 @@ def event_name(type: int, /) -> str: ...
 def set_blocked(type: _EventTypes | None, /) -> None: ...
 def set_allowed(type: _EventTypes | None, /) -> None: ...
 def get_blocked(type: _EventTypes, /) -> bool: ...
+def set_coalescing(coalesce: bool, /) -> None: ...
+def get_coalescing() -> bool: ...
 def set_grab(grab: bool, /) -> None: ...
 def get_grab() -> bool: ...
 def post(event: Event, /) -> bool: ...
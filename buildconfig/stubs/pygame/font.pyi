@@ -120,6 +120,41 @@ class Font:
         bgcolor: ColorLike | None = None,
         wraplength: int = 0,
     ) -> Surface: ...
+    def set_render_cache(self, size: int, shared: bool = False) -> None:
+        """
+        Cache rendered text surfaces.
+
+        Keeps the last ``size`` surfaces made by :meth:`render` and hands them
+        out again when the same text is rendered with the same arguments, which
+        saves redrawing labels and HUD text that rarely change from frame to
+        frame. When the cache is full, the least recently used surface is
+        dropped. A ``size`` of 0, the default for new fonts, turns the cache off
+        and frees it.
+
+        By default every call gets its own copy of the cached surface, which is
+        still much cheaper than rendering the text again. With ``shared=True``
+        the cached surface itself is returned, so it must not be modified.
+
+        Any change to the rendering state of the font, like :attr:`bold`,
+        :attr:`point_size`, :attr:`outline`, :attr:`align`, :meth:`set_linesize`,
+        :meth:`set_script` or :meth:`set_direction`, empties the cache.
+
+        .. versionadded:: 3.0.0
+        """
+
+    def get_render_cache_stats(self, reset: bool = False) -> dict[str, int]:
+        """
+        Get the counters of the render cache.
+
+        Returns a dict with the number of cache ``"hits"``, ``"misses"`` and
+        ``"evictions"`` of least recently used surfaces, along with the current
+        ``"size"`` and the ``"limit"`` set by :meth:`set_render_cache`. If
+        ``reset`` is true, the hit, miss and eviction counters start again
+        from 0 after being read.
+
+        .. versionadded:: 3.0.0
+        """
+
     def size(self, text: str | bytes, /) -> tuple[int, int]:
         """
         Determine the amount of space needed to render text.
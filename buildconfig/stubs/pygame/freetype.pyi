@@ -132,6 +132,10 @@ class Font:
     def origin(self) -> bool: ...
     @origin.setter
     def origin(self, value: bool) -> None: ...
+    @property
+    def cache_budget(self) -> int: ...
+    @cache_budget.setter
+    def cache_budget(self, value: int) -> None: ...
     def __init__(
         self,
         file: FileLike | None,
@@ -193,6 +197,32 @@ class Font:
         size: float = 0,
         invert: bool = False,
     ) -> Rect: ...
+    def render_atlas(
+        self,
+        text: str | None,
+        fgcolor: ColorLike | None = None,
+        style: int = STYLE_DEFAULT,
+        rotation: int = 0,
+        size: float = 0,
+    ) -> tuple[Surface, list[tuple[Rect, tuple[int, int]]]]: ...
+    def render_atlas_to(
+        self,
+        surf: Surface,
+        dest: RectLike,
+        text: str | None,
+        fgcolor: ColorLike | None = None,
+        style: int = STYLE_DEFAULT,
+        rotation: int = 0,
+        size: float = 0,
+    ) -> Rect: ...
+    def preload(
+        self,
+        text: str,
+        style: int = STYLE_DEFAULT,
+        rotation: int = 0,
+        size: float = 0,
+    ) -> int: ...
+    def get_cache_stats(self, reset: bool = False) -> dict[str, int]: ...
 
 # keep in sync with freetype.py
 __all__ = [
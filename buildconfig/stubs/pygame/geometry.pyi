@@ -1,4 +1,4 @@
-from collections.abc import Callable
+from collections.abc import Callable, Hashable
 from typing import Protocol, TypeAlias, overload
 
 from pygame import FRect, Rect
@@ -200,3 +200,19 @@ class Line:
     def flip_ab(self) -> Line: ...
     def flip_ab_ip(self) -> None: ...
     def project(self, point: Point, clamp: bool = False) -> tuple[float, float]: ...
+
+class SpatialHash:
+    def __init__(self, cell_size: float = 64) -> None: ...
+    @property
+    def cell_size(self) -> float: ...
+    def __len__(self) -> int: ...
+    def __contains__(self, key: Hashable, /) -> bool: ...
+    def insert(self, key: Hashable, rect: RectLike | None = None) -> None: ...
+    def remove(self, key: Hashable, /) -> None: ...
+    def clear(self) -> None: ...
+    def query(self, rect: RectLike, /) -> list[Hashable]: ...
+    @overload
+    def query_point(self, x: float, y: float, /) -> list[Hashable]: ...
+    @overload
+    def query_point(self, point: Point, /) -> list[Hashable]: ...
+    def pairs(self) -> list[tuple[Hashable, Hashable]]: ...
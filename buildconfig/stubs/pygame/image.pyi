@@ -62,10 +62,11 @@ following formats.
 .. versionaddedold:: 1.8 Saving PNG and JPEG files.
 """
 
+from collections.abc import Iterable
 from typing import Literal, TypeAlias
 
 from pygame.surface import Surface
-from pygame.typing import FileLike, IntPoint, Point
+from pygame.typing import FileLike, IntPoint, Point, _PathLike
 from typing_extensions import (
     Buffer,  # collections.abc 3.12
     deprecated,  # added in 3.13
@@ -158,6 +159,62 @@ def load_animation(file: FileLike, namehint: str = "") -> list[tuple[Surface, fl
     .. versionadded:: 2.5.4
     """
 
+def load_async(files: Iterable[_PathLike], convert: bool = True) -> AsyncLoad:
+    """Load images from files on background threads.
+
+    Starts loading the given files and returns at once, with an
+    :class:`AsyncLoad` object to collect the Surfaces from when they are ready.
+    The files are decoded on a small pool of worker threads, so a game can
+    stream in images while its main loop keeps running. Only file paths
+    (strings, bytes or pathlib.Path objects) can be loaded this way, not
+    file-like objects.
+
+    With ``convert=True``, the default, and once a display mode is set, each
+    image is also converted on the worker the way
+    :func:`pygame.Surface.convert()` would, or like
+    :func:`pygame.Surface.convert_alpha()` if it has per pixel alpha, so the
+    Surfaces are ready to be blitted to the display. Otherwise they keep the
+    format they were loaded with, like :func:`pygame.image.load()`.
+
+    ::
+
+        pending = pygame.image.load_async(["grass.png", "rock.png"])
+        while running:
+            ...
+            if pending is not None and pending.done():
+                grass, rock = pending.result()
+                pending = None
+
+    .. versionadded:: 3.0.0
+    """
+
+class AsyncLoad:
+    """Images being loaded by :func:`pygame.image.load_async()`.
+
+    Returned by :func:`pygame.image.load_async()`, this can't be created
+    directly.
+
+    .. versionadded:: 3.0.0
+    """
+
+    def done(self) -> bool:
+        """Test if all of the images have been loaded.
+
+        Returns ``True`` once every file has been loaded (or failed to load), so
+        that :meth:`result` returns without waiting.
+        """
+
+    def result(self) -> list[Surface]:
+        """Get the loaded images.
+
+        Waits for every file to be loaded, with the GIL released, and returns
+        a list with a Surface for each file, in the order they were given.
+        Calling it again returns the same list.
+
+        If any file could not be loaded, ``pygame.error`` is raised with the
+        reason for the first of them.
+        """
+
 def save(surface: Surface, file: FileLike, namehint: str = "") -> None:
     """Save an image to file (or file-like object).
 
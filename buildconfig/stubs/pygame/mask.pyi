@@ -85,6 +85,30 @@ def from_threshold(
     :rtype: Mask
     """
 
+def get_num_threads() -> int:
+    """Return the number of threads connected component searches may use.
+
+    Returns the value last set with :func:`set_num_threads`. The default is 1,
+    which keeps all the work on the calling thread.
+
+    .. versionadded:: 3.0.0
+    """
+
+def set_num_threads(count: int) -> None:
+    """Set the number of threads connected component searches may use.
+
+    When ``count`` is greater than 1, :meth:`Mask.connected_component`,
+    :meth:`Mask.connected_components`, :meth:`Mask.connected_component_stats`
+    and :meth:`Mask.get_bounding_rects` split tall masks into horizontal strips
+    that are labelled in parallel and then joined. The results are identical
+    to a single threaded search.
+
+    A ``count`` of 0 uses the number of logical CPUs. The value is capped at 64.
+    A ValueError is raised if ``count`` is negative.
+
+    .. versionadded:: 3.0.0
+    """
+
 class Mask:
     """Pygame object for representing 2D bitmasks.
 
@@ -484,6 +508,35 @@ class Mask:
             component is calculated.
         """
 
+    def connected_component_stats(
+        self, minimum: int = 0
+    ) -> list[tuple[int, Rect, tuple[int, int]]]:
+        """Returns the size, bounding rect and centroid of connected components.
+
+        Gathers the statistics of every connected component in a single pass,
+        without creating a :class:`Mask` for each of them, which makes it much
+        cheaper than :meth:`connected_components` on large masks.
+
+        :param int minimum: (optional) indicates the minimum number of bits (to
+            filter out noise) per connected component (default is 0, which equates
+            to no minimum and is equivalent to setting it to 1, as a connected
+            component must have at least 1 bit set)
+
+        :returns: a list with an ``(area, rect, centroid)`` tuple for each
+            connected component, in the same order as
+            :meth:`connected_components`. ``area`` is the number of bits set,
+            ``rect`` the bounding rect and ``centroid`` the same point as
+            :meth:`centroid` would give for a mask of the component alone. An
+            empty list is returned if the mask has no bits set
+        :rtype: list[tuple[int, Rect, tuple[int, int]]]
+
+        .. note::
+            See :meth:`connected_component` for details on how a connected
+            component is calculated.
+
+        .. versionadded:: 3.0.0
+        """
+
     def get_bounding_rects(self) -> list[Rect]:
         """Returns a list of bounding rects of connected components.
 
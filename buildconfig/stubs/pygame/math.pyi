@@ -88,7 +88,7 @@ Conversion can be combined with swizzling or slicing to create a new order
 .. versionchanged:: 2.1.4 `round` returns a new vector with components rounded to the specified digits.
 """
 
-from collections.abc import Collection, Iterator
+from collections.abc import Collection, Iterable, Iterator
 from typing import (
     Any,
     ClassVar,
@@ -101,7 +101,7 @@ from typing import (
 )
 
 from pygame.typing import SequenceLike
-from typing_extensions import deprecated  # added in 3.13
+from typing_extensions import Buffer, Self, deprecated  # added in 3.13
 
 def clamp(value: float, min: float, max: float, /) -> float:
     """Returns value clamped to min and max.
@@ -113,6 +113,7 @@ def clamp(value: float, min: float, max: float, /) -> float:
     """
 
 _TVec = TypeVar("_TVec", bound=_GenericVector)
+_V = TypeVar("_V", "Vector2", "Vector3")
 
 # not implemented in code, only implemented here for ease of implementing
 # typestubs. Contains attributes/methods common to Vector2 and Vector3
@@ -419,6 +420,39 @@ class Vector3(_GenericVector):
     @overload
     def update(self, x: float = 0, y: float = 0, z: float = 0) -> None: ...
 
+# not implemented in code, contains the methods common to Vector2Array and
+# Vector3Array
+class _GenericVectorArray(Generic[_V]):
+    def __init__(
+        self, size_or_iterable: int | Iterable[SequenceLike[float]]
+    ) -> None: ...
+    def __len__(self) -> int: ...
+    def __getitem__(self, index: SupportsIndex, /) -> _V: ...
+    def __setitem__(
+        self, index: SupportsIndex, value: SequenceLike[float], /
+    ) -> None: ...
+    def __iter__(self) -> Iterator[_V]: ...
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+    def __release_buffer__(self, view: memoryview, /) -> None: ...
+    def add_ip(self, other: Self | SequenceLike[float], /) -> None: ...
+    def sub_ip(self, other: Self | SequenceLike[float], /) -> None: ...
+    def scale_ip(self, factor: float | Buffer, /) -> None: ...
+    def dot(self, other: Self | SequenceLike[float], /) -> list[float]: ...
+    def normalize_ip(self) -> None: ...
+    @overload
+    def clamp_magnitude_ip(self, max_length: float, /) -> None: ...
+    @overload
+    def clamp_magnitude_ip(self, min_length: float, max_length: float, /) -> None: ...
+    def lerp_ip(self, other: Self | SequenceLike[float], t: float, /) -> None: ...
+
+class Vector2Array(_GenericVectorArray[Vector2]):
+    def rotate_ip(self, angle: float, /) -> None: ...
+    def rotate_rad_ip(self, angle: float, /) -> None: ...
+
+class Vector3Array(_GenericVectorArray[Vector3]):
+    def rotate_ip(self, angle: float, axis: SequenceLike[float], /) -> None: ...
+    def rotate_rad_ip(self, angle: float, axis: SequenceLike[float], /) -> None: ...
+
 def lerp(a: float, b: float, value: float, do_clamp: bool = True, /) -> float:
     """Returns value linearly interpolated between a and b.
 
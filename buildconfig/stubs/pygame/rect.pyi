@@ -1,7 +1,8 @@
 import sys
-from collections.abc import Callable, Collection, Iterator
+from collections.abc import Callable, Collection, Iterable, Iterator
 from typing import (
     ClassVar,
+    Generic,
     Literal,
     SupportsIndex,
     TypeVar,
@@ -9,7 +10,7 @@ from typing import (
 )
 
 from pygame.typing import Point, RectLike, SequenceLike
-from typing_extensions import deprecated  # added in 3.13
+from typing_extensions import Buffer, deprecated  # added in 3.13
 
 if sys.version_info >= (3, 11):
     from typing import Self
@@ -23,6 +24,8 @@ _K = TypeVar("_K")
 _V = TypeVar("_V")
 _T = TypeVar("_T")
 
+_R = TypeVar("_R", "Rect", "FRect")
+
 _RectTypeCompatible_co = TypeVar(
     "_RectTypeCompatible_co", bound=RectLike, covariant=True
 )
@@ -303,3 +306,33 @@ class RectType(Rect): ...
 
 @deprecated("Use `FRect` instead (FRectType is an old alias)")
 class FRectType(FRect): ...
+
+class _GenericRectArray(Generic[_R]):
+    def __init__(self, size_or_iterable: int | Iterable[RectLike]) -> None: ...
+    def __len__(self) -> int: ...
+    def __getitem__(self, index: SupportsIndex, /) -> _R: ...
+    def __setitem__(self, index: SupportsIndex, value: RectLike, /) -> None: ...
+    def __iter__(self) -> Iterator[_R]: ...
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+    def __release_buffer__(self, view: memoryview, /) -> None: ...
+    def move_ip(self, x: float | Buffer, y: float | Buffer, /) -> None: ...
+    @overload
+    def clamp_ip(self, rect: RectLike, /) -> None: ...
+    @overload
+    def clamp_ip(self, left_top: Point, width_height: Point, /) -> None: ...
+    @overload
+    def clamp_ip(
+        self, left: float, top: float, width: float, height: float, /
+    ) -> None: ...
+    @overload
+    def colliderect(self, rect: RectLike, /) -> list[int]: ...
+    @overload
+    def colliderect(self, left_top: Point, width_height: Point, /) -> list[int]: ...
+    @overload
+    def colliderect(
+        self, left: float, top: float, width: float, height: float, /
+    ) -> list[int]: ...
+    def collidearray(self, other: Self, /) -> list[tuple[int, int]]: ...
+
+class RectArray(_GenericRectArray[Rect]): ...
+class FRectArray(_GenericRectArray[FRect]): ...
@@ -21,6 +21,7 @@ if sys.version_info >= (3, 11):
 else:
     from typing_extensions import Self
 
+from pygame.geometry import SpatialHash
 from pygame.mask import Mask
 from pygame.rect import FRect, Rect
 from pygame.surface import Surface
@@ -196,6 +197,7 @@ def spritecollide(
     group: AbstractGroup[_SpriteT],
     dokill: bool,
     collided: Callable[[_HasRectT, _SpriteT], bool] | None = None,
+    index: SpatialHash | None = None,
 ) -> list[_SpriteT]: ...
 def groupcollide(
     groupa: AbstractGroup[_SpriteT],
@@ -203,9 +205,11 @@ def groupcollide(
     dokilla: bool,
     dokillb: bool,
     collided: Callable[[_SpriteT, _SpriteT2], bool] | None = None,
+    index: SpatialHash | None = None,
 ) -> dict[_SpriteT, list[_SpriteT2]]: ...
 def spritecollideany(
     sprite: _HasRectT,
     group: AbstractGroup[_SpriteT],
     collided: Callable[[_HasRectT, _SpriteT], bool] | None = None,
+    index: SpatialHash | None = None,
 ) -> _SpriteT | None: ...
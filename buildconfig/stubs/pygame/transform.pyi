@@ -154,8 +154,8 @@ def smoothscale_by(
     .. versionadded:: 2.1.3
     """
 
-def get_smoothscale_backend() -> Literal["GENERIC", "SSE2", "NEON"]:
-    """Return smoothscale filter version in use: 'GENERIC', 'MMX', 'SSE', 'SSE2', or 'NEON'.
+def get_smoothscale_backend() -> Literal["GENERIC", "SSE2", "AVX2", "NEON"]:
+    """Return smoothscale filter version in use: 'GENERIC', 'MMX', 'SSE', 'SSE2', 'AVX2', or 'NEON'.
 
     Shows whether or not smoothscale is using SIMD acceleration.
     If no acceleration is available then "GENERIC" is returned. The level of
@@ -164,10 +164,37 @@ def get_smoothscale_backend() -> Literal["GENERIC", "SSE2", "NEON"]:
     This function is provided for pygame testing and debugging.
 
     .. versionchanged:: 2.4.0 Added SSE2 and NEON backends, MMX and SSE are deprecated.
+    .. versionchanged:: 3.0.0 Added AVX2 backend, preferred over SSE2 when available.
     """
 
-def set_smoothscale_backend(backend: Literal["GENERIC", "SSE2", "NEON"]) -> None:
-    """Set smoothscale filter version to one of: 'GENERIC', 'MMX', 'SSE', 'SSE2', or 'NEON'.
+def get_num_threads() -> int:
+    """Return the number of threads scale and smoothscale may use.
+
+    Returns the value last set with :func:`set_num_threads`. The default is 1,
+    which keeps all scaling on the calling thread.
+
+    .. versionadded:: 3.0.0
+    """
+
+def set_num_threads(count: int) -> None:
+    """Set the number of threads scale and smoothscale may use.
+
+    When ``count`` is greater than 1, :func:`scale`, :func:`scale_by` and
+    :func:`smoothscale` split large surfaces into bands that are processed in
+    parallel. Small surfaces are still handled on the calling thread, as the
+    cost of starting threads would outweigh the gain. The output is identical
+    to single threaded scaling.
+
+    A ``count`` of 0 uses the number of logical CPUs. The value is capped at 64.
+    A ValueError is raised if ``count`` is negative.
+
+    .. versionadded:: 3.0.0
+    """
+
+def set_smoothscale_backend(
+    backend: Literal["GENERIC", "SSE2", "AVX2", "NEON"],
+) -> None:
+    """Set smoothscale filter version to one of: 'GENERIC', 'MMX', 'SSE', 'SSE2', 'AVX2', or 'NEON'.
 
     Sets smoothscale acceleration. Takes a string argument. A value of 'GENERIC'
     turns off acceleration. A value error is raised if type is not
@@ -178,6 +205,7 @@ def set_smoothscale_backend(backend: Literal["GENERIC", "SSE2", "NEON"]) -> None
     be reported. Use this function as a temporary fix only.
 
     .. versionchanged:: 2.4.0 Added SSE2 and NEON backends, MMX and SSE are deprecated.
+    .. versionchanged:: 3.0.0 Added AVX2 backend, preferred over SSE2 when available.
     """
 
 def chop(surface: Surface, rect: RectLike) -> Surface:
@@ -228,6 +256,9 @@ def box_blur(
 
     .. versionchanged:: 2.5.0
         A surface with either width or height equal to 0 won't raise a ``ValueError``
+
+    .. versionchanged:: 3.0.0
+        Uses SSE2 or AVX2 when available for 32 bit surfaces. Results are unchanged.
     """
 
 def gaussian_blur(
@@ -259,6 +290,9 @@ def gaussian_blur(
 
     .. versionchanged:: 2.5.0
         A surface with either width or height equal to 0 won't raise a ``ValueError``
+
+    .. versionchanged:: 3.0.0
+        Uses SSE2 or AVX2 when available for 32 bit surfaces. Results are unchanged.
     """
 
 def average_surfaces(
@@ -421,6 +421,12 @@ class Dev:
             pprint("Running tests (with all modules)")
             cmd_run([self.py, "-m", "pygame.tests"])
 
+    def cmd_bench(self):
+        bench_args = self.args.get("bench_args", [])
+
+        pprint("Running benchmarks")
+        cmd_run([self.py, "benchmarks/bench.py", *bench_args])
+
     def cmd_all(self):
         self.cmd_format()
         self.cmd_docs()
@@ -534,6 +540,16 @@ class Dev:
             ),
         )
 
+        # Bench command
+        # any arguments unknown to dev.py are passed on to benchmarks/bench.py
+        subparsers.add_parser(
+            "bench",
+            help=(
+                "Run the blit/fill/transform/draw benchmarks, see "
+                "'python benchmarks/bench.py -h' for the arguments"
+            ),
+        )
+
         # Lint command
         subparsers.add_parser("lint", help="Lint code")
 
@@ -559,7 +575,11 @@ class Dev:
             ),
         )
 
-        args = parser.parse_args()
+        args, unknown = parser.parse_known_args()
+        if args.command == "bench":
+            args.bench_args = unknown
+        elif unknown:
+            parser.error(f"unrecognized arguments: {' '.join(unknown)}")
         self.args = vars(args)
 
     def prep_env(self):
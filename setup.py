@@ -76,7 +76,9 @@ import distutils
 
 import distutils.ccompiler
 
-avx2_filenames = ['simd_blitters_avx2', 'simd_transform_avx2', 'simd_surface_fill_avx2']
+avx2_filenames = ['simd_blitters_avx2', 'simd_transform_avx2', 'simd_surface_fill_avx2',
+                  'simd_rect_avx2', 'simd_math_avx2', 'simd_bitmask_avx2',
+                  'simd_draw_avx2']
 
 compiler_options = {
     'unix': ('-mavx2',),
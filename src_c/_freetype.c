@@ -89,6 +89,10 @@ _ftfont_render_to(pgFontObject *, PyObject *, PyObject *);
 static PyObject *
 _ftfont_render_raw(pgFontObject *, PyObject *, PyObject *);
 static PyObject *
+_ftfont_render_atlas(pgFontObject *, PyObject *, PyObject *);
+static PyObject *
+_ftfont_render_atlas_to(pgFontObject *, PyObject *, PyObject *);
+static PyObject *
 _ftfont_render_raw_to(pgFontObject *, PyObject *, PyObject *);
 static PyObject *
 _ftfont_getsizedascender(pgFontObject *, PyObject *);
@@ -100,6 +104,10 @@ static PyObject *
 _ftfont_getsizedglyphheight(pgFontObject *, PyObject *);
 static PyObject *
 _ftfont_getsizes(pgFontObject *, PyObject *);
+static PyObject *
+_ftfont_preload(pgFontObject *, PyObject *, PyObject *);
+static PyObject *
+_ftfont_getcachestats(pgFontObject *, PyObject *, PyObject *);
 
 /* static PyObject *_ftfont_copy(pgFontObject *); */
 
@@ -149,6 +157,10 @@ _ftfont_setbgcolor(pgFontObject *, PyObject *, void *);
 
 static PyObject *
 _ftfont_getresolution(pgFontObject *, void *);
+static PyObject *
+_ftfont_getcachebudget(pgFontObject *, void *);
+static int
+_ftfont_setcachebudget(pgFontObject *, PyObject *, void *);
 
 static PyObject *
 _ftfont_getfontmetric(pgFontObject *, void *);
@@ -549,6 +561,14 @@ static PyMethodDef _ftfont_methods[] = {
      METH_VARARGS | METH_KEYWORDS, DOC_FREETYPE_FONT_RENDERRAW},
     {"render_raw_to", (PyCFunction)_ftfont_render_raw_to,
      METH_VARARGS | METH_KEYWORDS, DOC_FREETYPE_FONT_RENDERRAWTO},
+    {"render_atlas", (PyCFunction)_ftfont_render_atlas,
+     METH_VARARGS | METH_KEYWORDS, DOC_FREETYPE_FONT_RENDERATLAS},
+    {"render_atlas_to", (PyCFunction)_ftfont_render_atlas_to,
+     METH_VARARGS | METH_KEYWORDS, DOC_FREETYPE_FONT_RENDERATLASTO},
+    {"preload", (PyCFunction)_ftfont_preload, METH_VARARGS | METH_KEYWORDS,
+     DOC_FREETYPE_FONT_PRELOAD},
+    {"get_cache_stats", (PyCFunction)_ftfont_getcachestats,
+     METH_VARARGS | METH_KEYWORDS, DOC_FREETYPE_FONT_GETCACHESTATS},
 
     {0, 0, 0, 0}};
 
@@ -614,6 +634,8 @@ static PyGetSetDef _ftfont_getsets[] = {
      DOC_FREETYPE_FONT_BGCOLOR, 0},
     {"origin", (getter)_ftfont_getrender_flag, (setter)_ftfont_setrender_flag,
      DOC_FREETYPE_FONT_ORIGIN, (void *)FT_RFLAG_ORIGIN},
+    {"cache_budget", (getter)_ftfont_getcachebudget,
+     (setter)_ftfont_setcachebudget, DOC_FREETYPE_FONT_CACHEBUDGET, 0},
 #if defined(PGFT_DEBUG_CACHE)
     {"_debug_cache_stats", (getter)_ftfont_getdebugcachestats, 0,
      "_debug cache fields as a tuple", 0},
@@ -1232,6 +1254,46 @@ _ftfont_getresolution(pgFontObject *self, void *closure)
     return PyLong_FromUnsignedLong((unsigned long)self->resolution);
 }
 
+/** glyph cache budget attribute */
+static PyObject *
+_ftfont_getcachebudget(pgFontObject *self, void *closure)
+{
+    if (!FreetypeFont_GenerationCheck(self)) {
+        RAISE_FREETYPE_QUIT_ERROR(NULL);
+    }
+
+    ASSERT_SELF_IS_ALIVE(self);
+    return PyLong_FromSize_t(PGFT_FONT_CACHE(self).max_bytes);
+}
+
+static int
+_ftfont_setcachebudget(pgFontObject *self, PyObject *value, void *closure)
+{
+    if (!FreetypeFont_GenerationCheck(self)) {
+        RAISE_FREETYPE_QUIT_ERROR(-1);
+    }
+
+    Py_ssize_t max_bytes;
+
+    DEL_ATTR_NOT_SUPPORTED_CHECK("cache_budget", value);
+
+    if (!pgFont_IS_ALIVE(self)) {
+        PyErr_SetString(PyExc_RuntimeError, MODULE_NAME "." FONT_TYPE_NAME
+                        " instance is not initialized");
+        return -1;
+    }
+    max_bytes = PyLong_AsSsize_t(value);
+    if (max_bytes == -1 && PyErr_Occurred()) {
+        return -1;
+    }
+    if (max_bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "cache_budget must be >= 0");
+        return -1;
+    }
+    _PGFT_Cache_SetBudget(&PGFT_FONT_CACHE(self), (size_t)max_bytes);
+    return 0;
+}
+
 /** text rotation attribute */
 static PyObject *
 _ftfont_getrotation(pgFontObject *self, void *closure)
@@ -1339,11 +1401,9 @@ _ftfont_getdebugcachestats(pgFontObject *self, void *closure)
      */
     const FontCache *cache = &PGFT_FONT_CACHE(self);
 
-    return Py_BuildValue("kkkkk", (unsigned long)cache->_debug_count,
-                         (unsigned long)cache->_debug_delete_count,
-                         (unsigned long)cache->_debug_access,
-                         (unsigned long)cache->_debug_hit,
-                         (unsigned long)cache->_debug_miss);
+    return Py_BuildValue("kkkkk", (unsigned long)cache->count,
+                         cache->evictions, cache->hits + cache->misses,
+                         cache->hits, cache->misses);
 }
 #endif
 
@@ -1679,6 +1739,86 @@ error:
     return 0;
 }
 
+static PyObject *
+_ftfont_preload(pgFontObject *self, PyObject *args, PyObject *kwds)
+{
+    if (!FreetypeFont_GenerationCheck(self)) {
+        RAISE_FREETYPE_QUIT_ERROR(NULL);
+    }
+
+    /* keyword list */
+    static char *kwlist[] = {"text", "style", "rotation", "size", 0};
+
+    /* input arguments */
+    PyObject *textobj;
+    PGFT_String *text;
+    Scale_t face_size = FACE_SIZE_NONE;
+    Angle_t rotation = self->rotation;
+    int style = FT_STYLE_DEFAULT;
+
+    /* internal */
+    FontRenderMode render;
+    Py_ssize_t count;
+
+    ASSERT_SELF_IS_ALIVE(self);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|iO&O&", kwlist, &textobj,
+                                     &style, obj_to_rotation,
+                                     (void *)&rotation, obj_to_scale,
+                                     (void *)&face_size)) {
+        return 0;
+    }
+
+    text = _PGFT_EncodePyString(textobj, self->render_flags & FT_RFLAG_UCS4);
+    if (!text) {
+        return 0;
+    }
+
+    if (_PGFT_BuildRenderMode(self->freetype, self, &render, face_size, style,
+                              rotation)) {
+        free_string(text);
+        return 0;
+    }
+
+    count = _PGFT_PreloadGlyphs(self->freetype, self, &render, text);
+    free_string(text);
+    if (count < 0) {
+        return 0;
+    }
+    return PyLong_FromSsize_t(count);
+}
+
+static PyObject *
+_ftfont_getcachestats(pgFontObject *self, PyObject *args, PyObject *kwds)
+{
+    if (!FreetypeFont_GenerationCheck(self)) {
+        RAISE_FREETYPE_QUIT_ERROR(NULL);
+    }
+
+    static char *kwlist[] = {"reset", 0};
+    int reset = 0;
+    FontCache *cache;
+    PyObject *stats;
+
+    ASSERT_SELF_IS_ALIVE(self);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|p", kwlist, &reset)) {
+        return 0;
+    }
+
+    cache = &PGFT_FONT_CACHE(self);
+    stats = Py_BuildValue(
+        "{s:k,s:k,s:k,s:k,s:n,s:n}", "hits", cache->hits, "misses",
+        cache->misses, "evictions", cache->evictions, "glyphs",
+        (unsigned long)cache->count, "resident_bytes",
+        (Py_ssize_t)cache->resident_bytes, "budget",
+        (Py_ssize_t)cache->max_bytes);
+    if (stats && reset) {
+        _PGFT_Cache_ResetStats(cache);
+    }
+    return stats;
+}
+
 static PyObject *
 _ftfont_render_raw(pgFontObject *self, PyObject *args, PyObject *kwds)
 {
@@ -2080,6 +2220,203 @@ error:
     return 0;
 }
 
+/* Shared by render_atlas and render_atlas_to: packs the glyphs of the text
+ * into the atlas of the font and returns where they go */
+static int
+_ftfont_atlas_quads(pgFontObject *self, PyObject *textobj,
+                    PyObject *fg_color_obj, int style, Angle_t rotation,
+                    Scale_t face_size, int x, int y, AtlasQuad **quads,
+                    int *count, SDL_Rect *r)
+{
+    PGFT_String *text = 0;
+    FontColor fg_color;
+    FontRenderMode render;
+    int result;
+
+    if (fg_color_obj && fg_color_obj != Py_None) {
+        if (!pg_RGBAFromObjEx(fg_color_obj, (Uint8 *)&fg_color,
+                              PG_COLOR_HANDLE_ALL)) {
+            /* Exception already set for us */
+            return -1;
+        }
+    }
+    else {
+        fg_color.r = self->fgcolor[0];
+        fg_color.g = self->fgcolor[1];
+        fg_color.b = self->fgcolor[2];
+        fg_color.a = self->fgcolor[3];
+    }
+
+    /* Encode text */
+    if (textobj != Py_None) {
+        text =
+            _PGFT_EncodePyString(textobj, self->render_flags & FT_RFLAG_UCS4);
+        if (!text) {
+            return -1;
+        }
+    }
+
+    if (_PGFT_BuildRenderMode(self->freetype, self, &render, face_size, style,
+                              rotation)) {
+        free_string(text);
+        return -1;
+    }
+
+    result = _PGFT_Render_Atlas(self->freetype, self, &render, text,
+                                &fg_color, x, y, quads, count, r);
+    free_string(text);
+    return result;
+}
+
+static PyObject *
+_ftfont_render_atlas(pgFontObject *self, PyObject *args, PyObject *kwds)
+{
+    if (!FreetypeFont_GenerationCheck(self)) {
+        RAISE_FREETYPE_QUIT_ERROR(NULL);
+    }
+
+    /* keyword list */
+    static char *kwlist[] = {"text", "fgcolor", "style", "rotation",
+                             "size", 0};
+
+    /* input arguments */
+    PyObject *textobj = 0;
+    Scale_t face_size = FACE_SIZE_NONE;
+    PyObject *fg_color_obj = 0;
+    Angle_t rotation = self->rotation;
+    int style = FT_STYLE_DEFAULT;
+
+    /* output arguments */
+    AtlasQuad *quads = 0;
+    int count = 0;
+    int i;
+    SDL_Rect r;
+    PyObject *atlas_obj;
+    PyObject *quad_list = 0;
+    PyObject *item;
+    PyObject *rect_obj;
+
+    ASSERT_SELF_IS_ALIVE(self);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|OiO&O&", kwlist,
+                                     /* required */
+                                     &textobj,
+                                     /* optional */
+                                     &fg_color_obj, &style, obj_to_rotation,
+                                     (void *)&rotation, obj_to_scale,
+                                     (void *)&face_size)) {
+        return 0;
+    }
+
+    if (_ftfont_atlas_quads(self, textobj, fg_color_obj, style, rotation,
+                            face_size, 0, 0, &quads, &count, &r)) {
+        return 0;
+    }
+
+    atlas_obj = _PGFT_Atlas_GetSurface(&self->_internals->glyph_atlas);
+    if (!atlas_obj) {
+        goto error;
+    }
+
+    quad_list = PyList_New(count);
+    if (!quad_list) {
+        goto error;
+    }
+    for (i = 0; i < count; ++i) {
+        rect_obj = pgRect_New(&quads[i].area);
+        if (!rect_obj) {
+            goto error;
+        }
+        item = Py_BuildValue("(N(ii))", rect_obj, quads[i].x, quads[i].y);
+        if (!item) {
+            goto error;
+        }
+        PyList_SET_ITEM(quad_list, i, item);
+    }
+    _PGFT_free(quads);
+
+    return Py_BuildValue("(ON)", atlas_obj, quad_list);
+
+error:
+    _PGFT_free(quads);
+    Py_XDECREF(quad_list);
+    return 0;
+}
+
+static PyObject *
+_ftfont_render_atlas_to(pgFontObject *self, PyObject *args, PyObject *kwds)
+{
+    if (!FreetypeFont_GenerationCheck(self)) {
+        RAISE_FREETYPE_QUIT_ERROR(NULL);
+    }
+
+    /* keyword list */
+    static char *kwlist[] = {"surf",  "dest",     "text", "fgcolor",
+                             "style", "rotation", "size", 0};
+
+    /* input arguments */
+    PyObject *surface_obj = 0;
+    PyObject *textobj = 0;
+    Scale_t face_size = FACE_SIZE_NONE;
+    PyObject *dest = 0;
+    int xpos = 0;
+    int ypos = 0;
+    PyObject *fg_color_obj = 0;
+    Angle_t rotation = self->rotation;
+    int style = FT_STYLE_DEFAULT;
+
+    /* output arguments */
+    AtlasQuad *quads = 0;
+    int count = 0;
+    int i;
+    SDL_Rect r;
+    SDL_Rect dest_rect;
+    PyObject *atlas_obj;
+
+    ASSERT_SELF_IS_ALIVE(self);
+
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwds, "O!OO|OiO&O&", kwlist,
+            /* required */
+            &pgSurface_Type, &surface_obj, &dest, &textobj,
+            /* optional */
+            &fg_color_obj, &style, obj_to_rotation, (void *)&rotation,
+            obj_to_scale, (void *)&face_size)) {
+        return 0;
+    }
+
+    if (parse_dest(dest, &xpos, &ypos)) {
+        return 0;
+    }
+
+    if (!pgSurface_AsSurface(surface_obj)) {
+        return RAISE(pgExc_SDLError, "display Surface quit");
+    }
+
+    if (_ftfont_atlas_quads(self, textobj, fg_color_obj, style, rotation,
+                            face_size, xpos, ypos, &quads, &count, &r)) {
+        return 0;
+    }
+
+    /* one pass of plain blits from the shared atlas, no rasterizing */
+    atlas_obj = self->_internals->glyph_atlas.surface;
+    for (i = 0; i < count; ++i) {
+        dest_rect.x = quads[i].x;
+        dest_rect.y = quads[i].y;
+        dest_rect.w = quads[i].area.w;
+        dest_rect.h = quads[i].area.h;
+        if (pgSurface_Blit((pgSurfaceObject *)surface_obj,
+                           (pgSurfaceObject *)atlas_obj, &dest_rect,
+                           &quads[i].area, 0)) {
+            _PGFT_free(quads);
+            return 0;
+        }
+    }
+    _PGFT_free(quads);
+
+    return pgRect_New(&r);
+}
+
 /****************************************************
  * C API CALLS
  ****************************************************/
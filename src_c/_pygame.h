@@ -90,6 +90,10 @@
 
 #define PG_UpdateWindowSurface SDL_UpdateWindowSurface
 
+#define PG_AtomicInt SDL_AtomicInt
+#define PG_GetAtomicInt SDL_GetAtomicInt
+#define PG_SetAtomicInt SDL_SetAtomicInt
+
 /* Emulating SDL2 SDL_LockMutex API. In SDL3, it returns void. */
 static inline int
 PG_LockMutex(SDL_mutex *mutex)
@@ -230,6 +234,10 @@ PG_UpdateWindowSurface(SDL_Window *window)
     return SDL_UpdateWindowSurface(window) == 0;
 }
 
+#define PG_AtomicInt SDL_atomic_t
+#define PG_GetAtomicInt SDL_AtomicGet
+#define PG_SetAtomicInt SDL_AtomicSet
+
 static inline int
 PG_LockMutex(SDL_mutex *mutex)
 {
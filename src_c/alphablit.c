@@ -1721,13 +1721,13 @@ premul_surf_color_by_alpha(SDL_Surface *src, SDL_Surface *dst)
         return 0;
     }
 #if defined(__SSE2__)
-    if ((PG_SURF_BytesPerPixel(src) == 4) && SDL_HasSSE2()) {
+    if ((PG_SURF_BytesPerPixel(src) == 4) && pg_HasSSE_NEON()) {
         premul_surf_color_by_alpha_sse2(src, src_format, dst);
         return 0;
     }
 #endif /* __SSE2__*/
 #if PG_ENABLE_ARM_NEON
-    if ((PG_SURF_BytesPerPixel(src) == 4) && SDL_HasNEON()) {
+    if ((PG_SURF_BytesPerPixel(src) == 4) && pg_HasSSE_NEON()) {
         premul_surf_color_by_alpha_sse2(src, src_format, dst);
         return 0;
     }
@@ -25,6 +25,13 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if !defined(__EMSCRIPTEN__)
+#include "simd_bitmask.h"
+#define BITMASK_SIMD 1
+#else
+#define BITMASK_SIMD 0
+#endif /* __EMSCRIPTEN__ */
+
 #ifndef INLINE
 #warning No INLINE definition in bitmask.h, performance may suffer.
 #endif
@@ -98,6 +105,165 @@ positive_modulo(int dividend, int divisor)
     return (result >= 0) ? result : result + divisor;
 }
 
+#if BITMASK_SIMD
+/* Strips shorter than this stay on the scalar loops, the call to a SIMD
+ * kernel would cost more than it saves */
+#define BITMASK_SIMD_MIN_WORDS 16
+
+#define BITMASK_SIMD_NONE 0
+#define BITMASK_SIMD_SSE2 1
+#define BITMASK_SIMD_AVX2 2
+
+/* The best kernels the CPU supports, looked up on first use */
+static int
+simd_backend(void)
+{
+    static int backend = -1;
+
+    if (backend < 0) {
+        if (_pg_bitmask_has_avx2()) {
+            backend = BITMASK_SIMD_AVX2;
+        }
+        else if (_pg_bitmask_HasSSE_NEON()) {
+            backend = BITMASK_SIMD_SSE2;
+        }
+        else {
+            backend = BITMASK_SIMD_NONE;
+        }
+    }
+    return backend;
+}
+
+#define STRIP_BACKEND(n) \
+    ((n) >= BITMASK_SIMD_MIN_WORDS ? simd_backend() : BITMASK_SIMD_NONE)
+#else
+#define STRIP_BACKEND(n) 0
+#endif /* BITMASK_SIMD */
+
+/* Word strip operations, a strip being the n words of one column of a mask.
+ * Each combines a[i] with (b[i] << lshift) >> rshift, see simd_bitmask.h,
+ * and hands long strips to the SIMD kernels. */
+static INLINE int
+strip_overlap(const BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+              int rshift)
+{
+    int i;
+
+    switch (STRIP_BACKEND(n)) {
+#if BITMASK_SIMD
+        case BITMASK_SIMD_AVX2:
+            return bitmask_strip_overlap_avx2(a, b, n, lshift, rshift);
+        case BITMASK_SIMD_SSE2:
+            return bitmask_strip_overlap_sse2(a, b, n, lshift, rshift);
+#endif /* BITMASK_SIMD */
+        default:
+            break;
+    }
+    for (i = 0; i < n; i++) {
+        if (a[i] & ((b[i] << lshift) >> rshift)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static INLINE unsigned int
+strip_count(const BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+            int rshift)
+{
+    unsigned int count = 0;
+    int i;
+
+    switch (STRIP_BACKEND(n)) {
+#if BITMASK_SIMD
+        case BITMASK_SIMD_AVX2:
+            return bitmask_strip_count_avx2(a, b, n, lshift, rshift);
+        case BITMASK_SIMD_SSE2:
+            return bitmask_strip_count_sse2(a, b, n, lshift, rshift);
+#endif /* BITMASK_SIMD */
+        default:
+            break;
+    }
+    for (i = 0; i < n; i++) {
+        count += bitcount(a[i] & ((b[i] << lshift) >> rshift));
+    }
+    return count;
+}
+
+static INLINE void
+strip_or(BITMASK_W *a, const BITMASK_W *b, int n, int lshift, int rshift)
+{
+    int i;
+
+    switch (STRIP_BACKEND(n)) {
+#if BITMASK_SIMD
+        case BITMASK_SIMD_AVX2:
+            bitmask_strip_or_avx2(a, b, n, lshift, rshift);
+            return;
+        case BITMASK_SIMD_SSE2:
+            bitmask_strip_or_sse2(a, b, n, lshift, rshift);
+            return;
+#endif /* BITMASK_SIMD */
+        default:
+            break;
+    }
+    for (i = 0; i < n; i++) {
+        a[i] |= (b[i] << lshift) >> rshift;
+    }
+}
+
+static INLINE void
+strip_andnot(BITMASK_W *a, const BITMASK_W *b, int n, int lshift, int rshift)
+{
+    int i;
+
+    switch (STRIP_BACKEND(n)) {
+#if BITMASK_SIMD
+        case BITMASK_SIMD_AVX2:
+            bitmask_strip_andnot_avx2(a, b, n, lshift, rshift);
+            return;
+        case BITMASK_SIMD_SSE2:
+            bitmask_strip_andnot_sse2(a, b, n, lshift, rshift);
+            return;
+#endif /* BITMASK_SIMD */
+        default:
+            break;
+    }
+    for (i = 0; i < n; i++) {
+        a[i] &= ~((b[i] << lshift) >> rshift);
+    }
+}
+
+static INLINE void
+strip_and(BITMASK_W *c, const BITMASK_W *a, const BITMASK_W *b, int n,
+          int lshift, int rshift, int accumulate)
+{
+    int i;
+
+    switch (STRIP_BACKEND(n)) {
+#if BITMASK_SIMD
+        case BITMASK_SIMD_AVX2:
+            bitmask_strip_and_avx2(c, a, b, n, lshift, rshift, accumulate);
+            return;
+        case BITMASK_SIMD_SSE2:
+            bitmask_strip_and_sse2(c, a, b, n, lshift, rshift, accumulate);
+            return;
+#endif /* BITMASK_SIMD */
+        default:
+            break;
+    }
+    if (accumulate) {
+        for (i = 0; i < n; i++) {
+            c[i] |= a[i] & ((b[i] << lshift) >> rshift);
+        }
+    }
+    else {
+        for (i = 0; i < n; i++) {
+            c[i] = a[i] & ((b[i] << lshift) >> rshift);
+        }
+    }
+}
+
 bitmask_t *
 bitmask_create(int w, int h)
 {
@@ -232,20 +398,13 @@ bitmask_invert(bitmask_t *m)
 unsigned int
 bitmask_count(bitmask_t *m)
 {
-    BITMASK_W *pixels;
-    unsigned int tot = 0;
-
     if (!m->w || !m->h) {
-        return tot;
-    }
-
-    for (pixels = m->bits;
-         pixels < (m->bits + m->h * ((m->w - 1) / BITMASK_W_LEN + 1));
-         pixels++) {
-        tot += bitcount(*pixels);
+        return 0;
     }
 
-    return tot;
+    /* a & a is a */
+    return strip_count(m->bits, m->bits,
+                       m->h * ((m->w - 1) / BITMASK_W_LEN + 1), 0, 0);
 }
 
 int
@@ -254,8 +413,8 @@ bitmask_overlap(const bitmask_t *a, const bitmask_t *b, int xoffset,
 {
     const BITMASK_W *a_entry, *a_end;
     const BITMASK_W *b_entry;
-    const BITMASK_W *ap, *app, *bp;
     unsigned int shift, rshift, i, astripes, bstripes;
+    int n;
 
     /* Return if no overlap or one mask has a width/height of 0. */
     if ((xoffset >= a->w) || (yoffset >= a->h) || (yoffset <= -b->h) ||
@@ -276,8 +435,11 @@ bitmask_overlap(const bitmask_t *a, const bitmask_t *b, int xoffset,
             a_end = a_entry + MIN(b->h + yoffset, a->h);
             b_entry = b->bits - yoffset;
         }
+        n = (int)(a_end - a_entry);
         shift = xoffset & BITMASK_W_MASK;
         if (shift) {
+            /* (*ap >> shift) & *bp is the same test as *ap & (*bp << shift),
+               and likewise for the word of the next stripe */
             rshift = BITMASK_W_LEN - shift;
             astripes = ((unsigned int)(a->w - 1)) / BITMASK_W_LEN -
                        (unsigned int)xoffset / BITMASK_W_LEN;
@@ -285,36 +447,23 @@ bitmask_overlap(const bitmask_t *a, const bitmask_t *b, int xoffset,
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (ap = a_entry, app = ap + a->h, bp = b_entry;
-                         ap < a_end;) {
-                        if ((*ap++ >> shift) & *bp ||
-                            (*app++ << rshift) & *bp++) {
-                            return 1;
-                        }
+                    if (strip_overlap(a_entry, b_entry, n, shift, 0) ||
+                        strip_overlap(a_entry + a->h, b_entry, n, 0, rshift)) {
+                        return 1;
                     }
                     a_entry += a->h;
-                    a_end += a->h;
                     b_entry += b->h;
                 }
-                for (ap = a_entry, bp = b_entry; ap < a_end;) {
-                    if ((*ap++ >> shift) & *bp++) {
-                        return 1;
-                    }
-                }
-                return 0;
+                return strip_overlap(a_entry, b_entry, n, shift, 0);
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (ap = a_entry, app = ap + a->h, bp = b_entry;
-                         ap < a_end;) {
-                        if ((*ap++ >> shift) & *bp ||
-                            (*app++ << rshift) & *bp++) {
-                            return 1;
-                        }
+                    if (strip_overlap(a_entry, b_entry, n, shift, 0) ||
+                        strip_overlap(a_entry + a->h, b_entry, n, 0, rshift)) {
+                        return 1;
                     }
                     a_entry += a->h;
-                    a_end += a->h;
                     b_entry += b->h;
                 }
                 return 0;
@@ -325,13 +474,10 @@ bitmask_overlap(const bitmask_t *a, const bitmask_t *b, int xoffset,
         {
             astripes = (MIN(b->w, a->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (ap = a_entry, bp = b_entry; ap < a_end;) {
-                    if (*ap++ & *bp++) {
-                        return 1;
-                    }
+                if (strip_overlap(a_entry, b_entry, n, 0, 0)) {
+                    return 1;
                 }
                 a_entry += a->h;
-                a_end += a->h;
                 b_entry += b->h;
             }
             return 0;
@@ -489,9 +635,10 @@ int
 bitmask_overlap_area(const bitmask_t *a, const bitmask_t *b, int xoffset,
                      int yoffset)
 {
-    const BITMASK_W *a_entry, *a_end, *b_entry, *ap, *bp;
+    const BITMASK_W *a_entry, *a_end, *b_entry;
     unsigned int shift, rshift, i, astripes, bstripes;
     unsigned int count = 0;
+    int n;
 
     /* Return if no overlap or one mask has a width/height of 0. */
     if ((xoffset >= a->w) || (yoffset >= a->h) || (yoffset <= -b->h) ||
@@ -511,36 +658,34 @@ bitmask_overlap_area(const bitmask_t *a, const bitmask_t *b, int xoffset,
             a_end = a_entry + MIN(b->h + yoffset, a->h);
             b_entry = b->bits - yoffset;
         }
+        n = (int)(a_end - a_entry);
         shift = xoffset & BITMASK_W_MASK;
         if (shift) {
+            /* The bits of ((*ap >> shift) | (*(ap + a->h) << rshift)) & *bp
+               are those of *ap & (*bp << shift) and of
+               *(ap + a->h) & (*bp >> rshift), which never share a bit */
             rshift = BITMASK_W_LEN - shift;
             astripes = (a->w - 1) / BITMASK_W_LEN - xoffset / BITMASK_W_LEN;
             bstripes = (b->w - 1) / BITMASK_W_LEN + 1;
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        count += bitcount(
-                            ((*ap >> shift) | (*(ap + a->h) << rshift)) & *bp);
-                    }
+                    count += strip_count(a_entry, b_entry, n, shift, 0);
+                    count +=
+                        strip_count(a_entry + a->h, b_entry, n, 0, rshift);
                     a_entry += a->h;
-                    a_end += a->h;
                     b_entry += b->h;
                 }
-                for (ap = a_entry, bp = b_entry; ap < a_end;) {
-                    count += bitcount((*ap++ >> shift) & *bp++);
-                }
+                count += strip_count(a_entry, b_entry, n, shift, 0);
                 return count;
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        count += bitcount(
-                            ((*ap >> shift) | (*(ap + a->h) << rshift)) & *bp);
-                    }
+                    count += strip_count(a_entry, b_entry, n, shift, 0);
+                    count +=
+                        strip_count(a_entry + a->h, b_entry, n, 0, rshift);
                     a_entry += a->h;
-                    a_end += a->h;
                     b_entry += b->h;
                 }
                 return count;
@@ -551,12 +696,9 @@ bitmask_overlap_area(const bitmask_t *a, const bitmask_t *b, int xoffset,
         {
             astripes = (MIN(b->w, a->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (ap = a_entry, bp = b_entry; ap < a_end;) {
-                    count += bitcount(*ap++ & *bp++);
-                }
+                count += strip_count(a_entry, b_entry, n, 0, 0);
 
                 a_entry += a->h;
-                a_end += a->h;
                 b_entry += b->h;
             }
             return count;
@@ -577,10 +719,10 @@ void
 bitmask_overlap_mask(const bitmask_t *a, const bitmask_t *b, bitmask_t *c,
                      int xoffset, int yoffset)
 {
-    const BITMASK_W *a_entry, *ap;
-    const BITMASK_W *b_entry, *bp;
+    const BITMASK_W *a_entry;
+    const BITMASK_W *b_entry;
     BITMASK_W *c_entry, *cp;
-    int shift, rshift, i, astripes, bstripes;
+    int shift, rshift, i, astripes, bstripes, n;
 
     /* Return if no overlap or one mask has a width/height of 0. */
     if ((xoffset >= a->w) || (yoffset >= a->h) || (yoffset <= -b->h) ||
@@ -590,18 +732,16 @@ bitmask_overlap_mask(const bitmask_t *a, const bitmask_t *b, bitmask_t *c,
     }
 
     if (xoffset >= 0) {
-        const BITMASK_W *a_end;
-
         if (yoffset >= 0) {
             a_entry = a->bits + a->h * (xoffset / BITMASK_W_LEN) + yoffset;
             c_entry = c->bits + c->h * (xoffset / BITMASK_W_LEN) + yoffset;
-            a_end = a_entry + MIN(b->h, a->h - yoffset);
+            n = MIN(b->h, a->h - yoffset);
             b_entry = b->bits;
         }
         else {
             a_entry = a->bits + a->h * (xoffset / BITMASK_W_LEN);
             c_entry = c->bits + c->h * (xoffset / BITMASK_W_LEN);
-            a_end = a_entry + MIN(b->h + yoffset, a->h);
+            n = MIN(b->h + yoffset, a->h);
             b_entry = b->bits - yoffset;
         }
         shift = xoffset & BITMASK_W_MASK;
@@ -612,47 +752,30 @@ bitmask_overlap_mask(const bitmask_t *a, const bitmask_t *b, bitmask_t *c,
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (ap = a_entry, bp = b_entry, cp = c_entry; ap < a_end;
-                         ap++, bp++, cp++) {
-                        *cp |= *ap & (*bp << shift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, shift, 0, 1);
 
                     /* The c_entry (output mask) must advance with a_entry. */
                     a_entry += a->h;
-                    a_end += a->h;
                     c_entry += c->h;
 
-                    for (ap = a_entry, bp = b_entry, cp = c_entry; ap < a_end;
-                         ap++, bp++, cp++) {
-                        *cp |= *ap & (*bp >> rshift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, 0, rshift, 1);
 
                     b_entry += b->h;
                 }
 
                 /* This is the '.. zig' to handle the remaining bits. */
-                for (ap = a_entry, bp = b_entry, cp = c_entry; ap < a_end;
-                     ap++, bp++, cp++) {
-                    *cp |= *ap & (*bp << shift);
-                }
+                strip_and(c_entry, a_entry, b_entry, n, shift, 0, 1);
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (ap = a_entry, bp = b_entry, cp = c_entry; ap < a_end;
-                         ap++, bp++, cp++) {
-                        *cp |= *ap & (*bp << shift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, shift, 0, 1);
 
                     /* The c_entry (output mask) must advance with a_entry. */
                     a_entry += a->h;
-                    a_end += a->h;
                     c_entry += c->h;
 
-                    for (ap = a_entry, bp = b_entry, cp = c_entry; ap < a_end;
-                         ap++, bp++, cp++) {
-                        *cp |= *ap & (*bp >> rshift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, 0, rshift, 1);
 
                     b_entry += b->h;
                 }
@@ -663,32 +786,26 @@ bitmask_overlap_mask(const bitmask_t *a, const bitmask_t *b, bitmask_t *c,
         {
             astripes = (MIN(b->w, a->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (ap = a_entry, bp = b_entry, cp = c_entry; ap < a_end;
-                     ap++, bp++, cp++) {
-                    *cp = *ap & *bp;
-                }
+                strip_and(c_entry, a_entry, b_entry, n, 0, 0, 0);
                 a_entry += a->h;
                 c_entry += c->h;
-                a_end += a->h;
                 b_entry += b->h;
             }
         }
     }
     else {
-        const BITMASK_W *b_end;
-
         xoffset *= -1;
         yoffset *= -1;
 
         if (yoffset >= 0) {
             b_entry = b->bits + b->h * (xoffset / BITMASK_W_LEN) + yoffset;
-            b_end = b_entry + MIN(a->h, b->h - yoffset);
+            n = MIN(a->h, b->h - yoffset);
             a_entry = a->bits;
             c_entry = c->bits;
         }
         else {
             b_entry = b->bits + b->h * (xoffset / BITMASK_W_LEN);
-            b_end = b_entry + MIN(a->h + yoffset, b->h);
+            n = MIN(a->h + yoffset, b->h);
             a_entry = a->bits - yoffset;
             c_entry = c->bits - yoffset;
         }
@@ -700,37 +817,20 @@ bitmask_overlap_mask(const bitmask_t *a, const bitmask_t *b, bitmask_t *c,
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (bp = b_entry, ap = a_entry, cp = c_entry; bp < b_end;
-                         bp++, ap++, cp++) {
-                        *cp = *ap & (*bp >> shift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, 0, shift, 0);
                     b_entry += b->h;
-                    b_end += b->h;
-                    for (bp = b_entry, ap = a_entry, cp = c_entry; bp < b_end;
-                         bp++, ap++, cp++) {
-                        *cp |= *ap & (*bp << rshift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, rshift, 0, 1);
                     a_entry += a->h;
                     c_entry += c->h;
                 }
-                for (bp = b_entry, ap = a_entry, cp = c_entry; bp < b_end;
-                     bp++, ap++, cp++) {
-                    *cp = *ap & (*bp >> shift);
-                }
+                strip_and(c_entry, a_entry, b_entry, n, 0, shift, 0);
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (bp = b_entry, ap = a_entry, cp = c_entry; bp < b_end;
-                         bp++, ap++, cp++) {
-                        *cp = *ap & (*bp >> shift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, 0, shift, 0);
                     b_entry += b->h;
-                    b_end += b->h;
-                    for (bp = b_entry, ap = a_entry, cp = c_entry; bp < b_end;
-                         bp++, ap++, cp++) {
-                        *cp |= *ap & (*bp << rshift);
-                    }
+                    strip_and(c_entry, a_entry, b_entry, n, rshift, 0, 1);
                     a_entry += a->h;
                     c_entry += c->h;
                 }
@@ -741,12 +841,8 @@ bitmask_overlap_mask(const bitmask_t *a, const bitmask_t *b, bitmask_t *c,
         {
             astripes = (MIN(a->w, b->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (bp = b_entry, ap = a_entry, cp = c_entry; bp < b_end;
-                     bp++, ap++, cp++) {
-                    *cp = *ap & *bp;
-                }
+                strip_and(c_entry, a_entry, b_entry, n, 0, 0, 0);
                 b_entry += b->h;
-                b_end += b->h;
                 a_entry += a->h;
                 c_entry += c->h;
             }
@@ -774,9 +870,9 @@ bitmask_overlap_mask(const bitmask_t *a, const bitmask_t *b, bitmask_t *c,
 void
 bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
 {
-    BITMASK_W *a_entry, *a_end, *ap;
-    const BITMASK_W *b_entry, *bp;
-    int shift, rshift, i, astripes, bstripes;
+    BITMASK_W *a_entry;
+    const BITMASK_W *b_entry;
+    int shift, rshift, i, astripes, bstripes, n;
 
     /* Return if no overlap or one mask has a width/height of 0. */
     if ((xoffset >= a->w) || (yoffset >= a->h) || (yoffset <= -b->h) ||
@@ -787,12 +883,12 @@ bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
     if (xoffset >= 0) {
         if (yoffset >= 0) {
             a_entry = a->bits + a->h * (xoffset / BITMASK_W_LEN) + yoffset;
-            a_end = a_entry + MIN(b->h, a->h - yoffset);
+            n = MIN(b->h, a->h - yoffset);
             b_entry = b->bits;
         }
         else {
             a_entry = a->bits + a->h * (xoffset / BITMASK_W_LEN);
-            a_end = a_entry + MIN(b->h + yoffset, a->h);
+            n = MIN(b->h + yoffset, a->h);
             b_entry = b->bits - yoffset;
         }
         shift = xoffset & BITMASK_W_MASK;
@@ -803,31 +899,19 @@ bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap |= (*bp << shift);
-                    }
+                    strip_or(a_entry, b_entry, n, shift, 0);
                     a_entry += a->h;
-                    a_end += a->h;
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap |= (*bp >> rshift);
-                    }
+                    strip_or(a_entry, b_entry, n, 0, rshift);
                     b_entry += b->h;
                 }
-                for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                    *ap |= (*bp << shift);
-                }
+                strip_or(a_entry, b_entry, n, shift, 0);
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap |= (*bp << shift);
-                    }
+                    strip_or(a_entry, b_entry, n, shift, 0);
                     a_entry += a->h;
-                    a_end += a->h;
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap |= (*bp >> rshift);
-                    }
+                    strip_or(a_entry, b_entry, n, 0, rshift);
                     b_entry += b->h;
                 }
             }
@@ -837,29 +921,24 @@ bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
         {
             astripes = (MIN(b->w, a->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                    *ap |= *bp;
-                }
+                strip_or(a_entry, b_entry, n, 0, 0);
                 a_entry += a->h;
-                a_end += a->h;
                 b_entry += b->h;
             }
         }
     }
     else {
-        const BITMASK_W *b_end;
-
         xoffset *= -1;
         yoffset *= -1;
 
         if (yoffset >= 0) {
             b_entry = b->bits + b->h * (xoffset / BITMASK_W_LEN) + yoffset;
-            b_end = b_entry + MIN(a->h, b->h - yoffset);
+            n = MIN(a->h, b->h - yoffset);
             a_entry = a->bits;
         }
         else {
             b_entry = b->bits + b->h * (xoffset / BITMASK_W_LEN);
-            b_end = b_entry + MIN(a->h + yoffset, b->h);
+            n = MIN(a->h + yoffset, b->h);
             a_entry = a->bits - yoffset;
         }
         shift = xoffset & BITMASK_W_MASK;
@@ -870,31 +949,19 @@ bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap |= (*bp >> shift);
-                    }
+                    strip_or(a_entry, b_entry, n, 0, shift);
                     b_entry += b->h;
-                    b_end += b->h;
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap |= (*bp << rshift);
-                    }
+                    strip_or(a_entry, b_entry, n, rshift, 0);
                     a_entry += a->h;
                 }
-                for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                    *ap |= (*bp >> shift);
-                }
+                strip_or(a_entry, b_entry, n, 0, shift);
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap |= (*bp >> shift);
-                    }
+                    strip_or(a_entry, b_entry, n, 0, shift);
                     b_entry += b->h;
-                    b_end += b->h;
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap |= (*bp << rshift);
-                    }
+                    strip_or(a_entry, b_entry, n, rshift, 0);
                     a_entry += a->h;
                 }
             }
@@ -904,11 +971,8 @@ bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
         {
             astripes = (MIN(a->w, b->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                    *ap |= *bp;
-                }
+                strip_or(a_entry, b_entry, n, 0, 0);
                 b_entry += b->h;
-                b_end += b->h;
                 a_entry += a->h;
             }
         }
@@ -918,7 +982,7 @@ bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
     /* Zero out bits outside the mask rectangle (to the right), if there
      is a chance we were drawing there. */
     if (xoffset + b->w > a->w) {
-        BITMASK_W edgemask;
+        BITMASK_W *ap, *a_end, edgemask;
         int n = (a->w - 1) / BITMASK_W_LEN;
 
         shift = positive_modulo(BITMASK_W_LEN - a->w, (int)BITMASK_W_LEN);
@@ -935,9 +999,9 @@ bitmask_draw(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
 void
 bitmask_erase(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
 {
-    BITMASK_W *a_entry, *ap;
-    const BITMASK_W *b_entry, *bp;
-    int shift, rshift, i, astripes, bstripes;
+    BITMASK_W *a_entry;
+    const BITMASK_W *b_entry;
+    int shift, rshift, i, astripes, bstripes, n;
 
     /* Return if no overlap or one mask has a width/height of 0. */
     if ((xoffset >= a->w) || (yoffset >= a->h) || (yoffset <= -b->h) ||
@@ -946,16 +1010,14 @@ bitmask_erase(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
     }
 
     if (xoffset >= 0) {
-        const BITMASK_W *a_end;
-
         if (yoffset >= 0) {
             a_entry = a->bits + a->h * (xoffset / BITMASK_W_LEN) + yoffset;
-            a_end = a_entry + MIN(b->h, a->h - yoffset);
+            n = MIN(b->h, a->h - yoffset);
             b_entry = b->bits;
         }
         else {
             a_entry = a->bits + a->h * (xoffset / BITMASK_W_LEN);
-            a_end = a_entry + MIN(b->h + yoffset, a->h);
+            n = MIN(b->h + yoffset, a->h);
             b_entry = b->bits - yoffset;
         }
         shift = xoffset & BITMASK_W_MASK;
@@ -966,63 +1028,46 @@ bitmask_erase(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap &= ~(*bp << shift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, shift, 0);
                     a_entry += a->h;
-                    a_end += a->h;
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap &= ~(*bp >> rshift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, 0, rshift);
                     b_entry += b->h;
                 }
-                for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                    *ap &= ~(*bp << shift);
-                }
+                strip_andnot(a_entry, b_entry, n, shift, 0);
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap &= ~(*bp << shift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, shift, 0);
                     a_entry += a->h;
-                    a_end += a->h;
-                    for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                        *ap &= ~(*bp >> rshift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, 0, rshift);
                     b_entry += b->h;
                 }
             }
         }
         else /* xoffset is a multiple of the stripe width,
-              and the above routines won't work. */
+                and the above routines won't work. */
         {
             astripes = (MIN(b->w, a->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (ap = a_entry, bp = b_entry; ap < a_end; ap++, bp++) {
-                    *ap &= ~*bp;
-                }
+                strip_andnot(a_entry, b_entry, n, 0, 0);
                 a_entry += a->h;
-                a_end += a->h;
                 b_entry += b->h;
             }
         }
     }
     else {
-        const BITMASK_W *b_end;
-
         xoffset *= -1;
         yoffset *= -1;
 
         if (yoffset >= 0) {
             b_entry = b->bits + b->h * (xoffset / BITMASK_W_LEN) + yoffset;
-            b_end = b_entry + MIN(a->h, b->h - yoffset);
+            n = MIN(a->h, b->h - yoffset);
             a_entry = a->bits;
         }
         else {
             b_entry = b->bits + b->h * (xoffset / BITMASK_W_LEN);
-            b_end = b_entry + MIN(a->h + yoffset, b->h);
+            n = MIN(a->h + yoffset, b->h);
             a_entry = a->bits - yoffset;
         }
         shift = xoffset & BITMASK_W_MASK;
@@ -1033,31 +1078,19 @@ bitmask_erase(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
             if (bstripes > astripes) /* zig-zag .. zig*/
             {
                 for (i = 0; i < astripes; i++) {
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap &= ~(*bp >> shift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, 0, shift);
                     b_entry += b->h;
-                    b_end += b->h;
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap &= ~(*bp << rshift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, rshift, 0);
                     a_entry += a->h;
                 }
-                for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                    *ap &= ~(*bp >> shift);
-                }
+                strip_andnot(a_entry, b_entry, n, 0, shift);
             }
             else /* zig-zag */
             {
                 for (i = 0; i < bstripes; i++) {
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap &= ~(*bp >> shift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, 0, shift);
                     b_entry += b->h;
-                    b_end += b->h;
-                    for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                        *ap &= ~(*bp << rshift);
-                    }
+                    strip_andnot(a_entry, b_entry, n, rshift, 0);
                     a_entry += a->h;
                 }
             }
@@ -1067,11 +1100,8 @@ bitmask_erase(bitmask_t *a, const bitmask_t *b, int xoffset, int yoffset)
         {
             astripes = (MIN(a->w, b->w - xoffset) - 1) / BITMASK_W_LEN + 1;
             for (i = 0; i < astripes; i++) {
-                for (bp = b_entry, ap = a_entry; bp < b_end; bp++, ap++) {
-                    *ap &= ~*bp;
-                }
+                strip_andnot(a_entry, b_entry, n, 0, 0);
                 b_entry += b->h;
-                b_end += b->h;
                 a_entry += a->h;
             }
         }
@@ -1124,7 +1154,9 @@ void
 bitmask_convolve(const bitmask_t *a, const bitmask_t *b, bitmask_t *output,
                  int xoffset, int yoffset)
 {
-    int x, y;
+    const BITMASK_W *bp;
+    BITMASK_W word;
+    int x, y, stripe, stripes;
 
     if (!a->h || !a->w || !b->h || !b->w || !output->h || !output->w) {
         return;
@@ -1133,11 +1165,84 @@ bitmask_convolve(const bitmask_t *a, const bitmask_t *b, bitmask_t *output,
     xoffset += b->w - 1;
     yoffset += b->h - 1;
 
-    for (y = 0; y < b->h; y++) {
-        for (x = 0; x < b->w; x++) {
-            if (bitmask_getbit(b, x, y)) {
+    /* Draw a once for every bit set in b, skipping whole empty words */
+    stripes = (b->w - 1) / BITMASK_W_LEN + 1;
+    for (stripe = 0, bp = b->bits; stripe < stripes; stripe++) {
+        for (y = 0; y < b->h; y++, bp++) {
+            for (word = *bp; word; word &= word - 1) {
+                x = stripe * BITMASK_W_LEN + firstsetbit(word);
+                if (x >= b->w) {
+                    break;
+                }
                 bitmask_draw(output, a, xoffset - x, yoffset - y);
             }
         }
     }
 }
+
+void
+bitmask_coarsen_area(const bitmask_t *m, bitmask_t *c, int x, int y, int w,
+                     int h)
+{
+    const BITMASK_W tile_bits = BITMASK_N(BITMASK_TILE) - 1;
+    const BITMASK_W *strip;
+    BITMASK_W acc;
+    int tx, ty, tx_end, ty_end, row, row_end, stripe;
+
+    if (x < 0) {
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        h += y;
+        y = 0;
+    }
+    w = MIN(w, m->w - x);
+    h = MIN(h, m->h - y);
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    tx_end = (x + w - 1) / BITMASK_TILE + 1;
+    ty_end = (y + h - 1) / BITMASK_TILE + 1;
+    for (ty = y / BITMASK_TILE; ty < ty_end; ty++) {
+        row_end = MIN((ty + 1) * BITMASK_TILE, m->h);
+        tx = x / BITMASK_TILE;
+        while (tx < tx_end) {
+            /* OR the rows of the tiles together once per word, then look at
+             * the bits of each tile in that word */
+            stripe = tx * BITMASK_TILE / BITMASK_W_LEN;
+            strip = m->bits + stripe * m->h;
+            for (acc = 0, row = ty * BITMASK_TILE; row < row_end; row++) {
+                acc |= strip[row];
+            }
+            for (; tx < tx_end && tx * BITMASK_TILE / BITMASK_W_LEN == stripe;
+                 tx++) {
+                if ((acc >> (tx * BITMASK_TILE & BITMASK_W_MASK)) &
+                    tile_bits) {
+                    bitmask_setbit(c, tx, ty);
+                }
+                else {
+                    bitmask_clearbit(c, tx, ty);
+                }
+            }
+        }
+    }
+}
+
+int
+bitmask_coarse_overlap(const bitmask_t *ca, const bitmask_t *cb, int tile,
+                       int xoffset, int yoffset)
+{
+    /* A tile of b lands on tile q of a, or straddles tiles q and q + 1 when
+     * the offset is not a multiple of the tile size */
+    int xr = positive_modulo(xoffset, tile);
+    int yr = positive_modulo(yoffset, tile);
+    int xq = xoffset / tile - (xoffset < 0 && xr);
+    int yq = yoffset / tile - (yoffset < 0 && yr);
+
+    return bitmask_overlap(ca, cb, xq, yq) ||
+           (xr && bitmask_overlap(ca, cb, xq + 1, yq)) ||
+           (yr && bitmask_overlap(ca, cb, xq, yq + 1)) ||
+           (xr && yr && bitmask_overlap(ca, cb, xq + 1, yq + 1));
+}
@@ -2226,6 +2226,355 @@ pg_num_displays(PyObject *self, PyObject *_null)
     return PyLong_FromLong(ret);
 }
 
+/* DirtyRegion, collects the areas of the screen that changed in a frame.
+ *
+ * Rects are appended as they come and merged lazily, the first time the
+ * region is read. Merging keeps the rects disjoint and also joins rects whose
+ * bounding box is at most `tolerance` bigger than their summed area, so a
+ * burst of small neighbouring rects turns into a few big ones. */
+typedef struct {
+    PyObject_HEAD SDL_Rect *rects;
+    int count;
+    int capacity;
+    int merged;
+    int has_clip;
+    SDL_Rect clip;
+    double tolerance;
+} pgDirtyRegionObject;
+
+static PyTypeObject pgDirtyRegion_Type;
+
+#define pgDirtyRegion_Check(o) PyObject_TypeCheck(o, &pgDirtyRegion_Type)
+
+static int
+_pg_dirty_compare(const void *a, const void *b)
+{
+    const SDL_Rect *ra = (const SDL_Rect *)a, *rb = (const SDL_Rect *)b;
+    if (ra->x != rb->x) {
+        return ra->x < rb->x ? -1 : 1;
+    }
+    return (ra->y > rb->y) - (ra->y < rb->y);
+}
+
+static int
+_pg_dirty_should_merge(const SDL_Rect *a, const SDL_Rect *b, double tolerance)
+{
+    Sint64 ax1 = (Sint64)a->x + a->w, ay1 = (Sint64)a->y + a->h;
+    Sint64 bx1 = (Sint64)b->x + b->w, by1 = (Sint64)b->y + b->h;
+    Sint64 width, height;
+
+    /* overlapping rects always merge, so the region stays disjoint */
+    if (a->x < bx1 && b->x < ax1 && a->y < by1 && b->y < ay1) {
+        return 1;
+    }
+    width = MAX(ax1, bx1) - MIN(a->x, b->x);
+    height = MAX(ay1, by1) - MIN(a->y, b->y);
+    return (double)width * height <=
+           ((double)a->w * a->h + (double)b->w * b->h) * (1.0 + tolerance);
+}
+
+/* Joins rects until no pair overlaps or passes the tolerance test.
+ *
+ * Each pass sorts by x and compares every rect with the ones starting before
+ * its reach. Two rects a gap g apart have a bounding box of at least
+ * (w1 + w2 + g) * max(h1, h2), which only passes the test when
+ * g <= tolerance * (w1 + w2), so rects further than that can be skipped. A
+ * pass only misses rects that a merge grew into from the left, passes repeat
+ * until one merges nothing. */
+static void
+_pg_dirty_merge(pgDirtyRegionObject *self)
+{
+    SDL_Rect *rects = self->rects, *a, *b;
+    int i, j, count, max_w, merges = 1;
+    Sint64 x1, y1, reach;
+
+    while (merges && self->count > 1) {
+        merges = 0;
+        count = self->count;
+        qsort(rects, count, sizeof(SDL_Rect), _pg_dirty_compare);
+
+        max_w = 0;
+        for (i = 0; i < count; i++) {
+            max_w = MAX(max_w, rects[i].w);
+        }
+
+        for (i = 0; i < count; i++) {
+            a = &rects[i];
+            if (!a->w) {
+                continue;
+            }
+            for (j = i + 1; j < count; j++) {
+                b = &rects[j];
+                reach = (Sint64)a->x + a->w +
+                        (Sint64)(self->tolerance * ((double)a->w + max_w));
+                if (b->x > reach) {
+                    break;
+                }
+                if (!b->w || !_pg_dirty_should_merge(a, b, self->tolerance)) {
+                    continue;
+                }
+                /* a->x is already the smallest, as the rects are sorted */
+                x1 = MAX((Sint64)a->x + a->w, (Sint64)b->x + b->w);
+                y1 = MAX((Sint64)a->y + a->h, (Sint64)b->y + b->h);
+                a->y = MIN(a->y, b->y);
+                a->w = (int)(x1 - a->x);
+                a->h = (int)(y1 - a->y);
+                max_w = MAX(max_w, a->w);
+                b->w = 0;
+                merges++;
+            }
+        }
+
+        for (i = j = 0; i < count; i++) {
+            if (rects[i].w) {
+                rects[j++] = rects[i];
+            }
+        }
+        self->count = j;
+    }
+    self->merged = 1;
+}
+
+static int
+_pg_dirty_add(pgDirtyRegionObject *self, SDL_Rect *rect)
+{
+    SDL_Rect r = *rect, clipped;
+
+    if (r.w < 0) {
+        r.x += r.w;
+        r.w = -r.w;
+    }
+    if (r.h < 0) {
+        r.y += r.h;
+        r.h = -r.h;
+    }
+    if (self->has_clip) {
+        if (!SDL_IntersectRect(&r, &self->clip, &clipped)) {
+            return 0;
+        }
+        r = clipped;
+    }
+    if (r.w <= 0 || r.h <= 0) {
+        return 0;
+    }
+
+    if (self->count == self->capacity) {
+        int capacity = self->capacity ? self->capacity * 2 : 32;
+        SDL_Rect *rects = PyMem_Resize(self->rects, SDL_Rect, capacity);
+        if (!rects) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        self->rects = rects;
+        self->capacity = capacity;
+    }
+    self->rects[self->count++] = r;
+    self->merged = 0;
+    return 0;
+}
+
+static PyObject *
+pg_dirty_region_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    pgDirtyRegionObject *self = (pgDirtyRegionObject *)type->tp_alloc(type, 0);
+    if (self) {
+        self->tolerance = 0.25;
+        self->merged = 1;
+    }
+    return (PyObject *)self;
+}
+
+static int
+pg_dirty_region_init(pgDirtyRegionObject *self, PyObject *args,
+                     PyObject *kwds)
+{
+    double tolerance = 0.25;
+    PyObject *clipobj = Py_None;
+    SDL_Rect *clip, temp;
+    static char *keywords[] = {"tolerance", "clip", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|dO", keywords, &tolerance,
+                                     &clipobj)) {
+        return -1;
+    }
+    if (!(tolerance >= 0.0)) {
+        PyErr_SetString(PyExc_ValueError, "tolerance must not be negative");
+        return -1;
+    }
+
+    self->has_clip = 0;
+    if (clipobj != Py_None) {
+        if (!(clip = pgRect_FromObject(clipobj, &temp))) {
+            PyErr_SetString(PyExc_TypeError, "clip must be a rect or None");
+            return -1;
+        }
+        self->clip = *clip;
+        pgRect_Normalize(&self->clip);
+        self->has_clip = 1;
+    }
+    self->tolerance = tolerance;
+    self->count = 0;
+    self->merged = 1;
+    return 0;
+}
+
+static void
+pg_dirty_region_dealloc(pgDirtyRegionObject *self)
+{
+    PyMem_Free(self->rects);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *
+pg_dirty_region_add(pgDirtyRegionObject *self, PyObject *arg)
+{
+    SDL_Rect *rect, temp;
+
+    if (!(rect = pgRect_FromObject(arg, &temp))) {
+        return RAISE(PyExc_TypeError, "Argument must be rect style object");
+    }
+    if (_pg_dirty_add(self, rect)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_dirty_region_extend(pgDirtyRegionObject *self, PyObject *arg)
+{
+    PyObject *iterable, *item;
+    SDL_Rect *rect, temp;
+
+    if (!(iterable = PyObject_GetIter(arg))) {
+        return NULL;
+    }
+    while ((item = PyIter_Next(iterable))) {
+        if (item == Py_None) {
+            Py_DECREF(item);
+            continue;
+        }
+        rect = pgRect_FromObject(item, &temp);
+        Py_DECREF(item);
+        if (!rect) {
+            Py_DECREF(iterable);
+            return RAISE(PyExc_TypeError,
+                         "Argument must be an iterable of rect style objects");
+        }
+        if (_pg_dirty_add(self, rect)) {
+            Py_DECREF(iterable);
+            return NULL;
+        }
+    }
+    Py_DECREF(iterable);
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_dirty_region_clear(pgDirtyRegionObject *self, PyObject *_null)
+{
+    self->count = 0;
+    self->merged = 1;
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_dirty_region_get_rects(pgDirtyRegionObject *self, PyObject *_null)
+{
+    PyObject *list, *rect;
+    int i;
+
+    if (!self->merged) {
+        _pg_dirty_merge(self);
+    }
+    if (!(list = PyList_New(self->count))) {
+        return NULL;
+    }
+    for (i = 0; i < self->count; i++) {
+        if (!(rect = pgRect_New(&self->rects[i]))) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        PyList_SET_ITEM(list, i, rect);
+    }
+    return list;
+}
+
+static PyObject *
+pg_dirty_region_get_area(pgDirtyRegionObject *self, void *closure)
+{
+    long long area = 0;
+    int i;
+
+    if (!self->merged) {
+        _pg_dirty_merge(self);
+    }
+    for (i = 0; i < self->count; i++) {
+        area += (long long)self->rects[i].w * self->rects[i].h;
+    }
+    return PyLong_FromLongLong(area);
+}
+
+static PyObject *
+pg_dirty_region_get_tolerance(pgDirtyRegionObject *self, void *closure)
+{
+    return PyFloat_FromDouble(self->tolerance);
+}
+
+static Py_ssize_t
+pg_dirty_region_length(pgDirtyRegionObject *self)
+{
+    if (!self->merged) {
+        _pg_dirty_merge(self);
+    }
+    return self->count;
+}
+
+static PyObject *
+pg_dirty_region_repr(pgDirtyRegionObject *self)
+{
+    return PyUnicode_FromFormat("<DirtyRegion(%zd rects)>",
+                                pg_dirty_region_length(self));
+}
+
+static PyMethodDef pg_dirty_region_methods[] = {
+    {"add", (PyCFunction)pg_dirty_region_add, METH_O,
+     DOC_DISPLAY_DIRTYREGION_ADD},
+    {"extend", (PyCFunction)pg_dirty_region_extend, METH_O,
+     DOC_DISPLAY_DIRTYREGION_EXTEND},
+    {"clear", (PyCFunction)pg_dirty_region_clear, METH_NOARGS,
+     DOC_DISPLAY_DIRTYREGION_CLEAR},
+    {"get_rects", (PyCFunction)pg_dirty_region_get_rects, METH_NOARGS,
+     DOC_DISPLAY_DIRTYREGION_GETRECTS},
+    {NULL, NULL, 0, NULL}};
+
+static PyGetSetDef pg_dirty_region_getsets[] = {
+    {"area", (getter)pg_dirty_region_get_area, NULL,
+     DOC_DISPLAY_DIRTYREGION_AREA, NULL},
+    {"tolerance", (getter)pg_dirty_region_get_tolerance, NULL,
+     DOC_DISPLAY_DIRTYREGION_TOLERANCE, NULL},
+    {NULL, 0, NULL, NULL, NULL}};
+
+static PySequenceMethods pg_dirty_region_as_sequence = {
+    .sq_length = (lenfunc)pg_dirty_region_length,
+};
+
+static PyTypeObject pgDirtyRegion_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.display.DirtyRegion",
+    .tp_basicsize = sizeof(pgDirtyRegionObject),
+    .tp_dealloc = (destructor)pg_dirty_region_dealloc,
+    .tp_repr = (reprfunc)pg_dirty_region_repr,
+    .tp_as_sequence = &pg_dirty_region_as_sequence,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_doc = DOC_DISPLAY_DIRTYREGION,
+    .tp_methods = pg_dirty_region_methods,
+    .tp_getset = pg_dirty_region_getsets,
+    .tp_init = (initproc)pg_dirty_region_init,
+    .tp_new = pg_dirty_region_new,
+};
+
 /*BAD things happen when out-of-bound rects go to updaterect*/
 static SDL_Rect *
 pg_screencroprect(SDL_Rect *r, int w, int h, SDL_Rect *cur)
@@ -2278,6 +2627,37 @@ pg_update(PyObject *self, PyObject *arg)
         Py_RETURN_NONE;
     }
 
+    if (PyTuple_GET_SIZE(arg) == 1 &&
+        pgDirtyRegion_Check(PyTuple_GET_ITEM(arg, 0))) {
+        pgDirtyRegionObject *region =
+            (pgDirtyRegionObject *)PyTuple_GET_ITEM(arg, 0);
+        SDL_Rect *rects;
+        int i, count = 0;
+
+        if (!region->merged) {
+            _pg_dirty_merge(region);
+        }
+        if (!region->count) {
+            Py_RETURN_NONE;
+        }
+        if (!(rects = PyMem_New(SDL_Rect, region->count))) {
+            return PyErr_NoMemory();
+        }
+        for (i = 0; i < region->count; i++) {
+            if (pg_screencroprect(&region->rects[i], wide, high,
+                                  &rects[count])) {
+                count++;
+            }
+        }
+        if (count) {
+            Py_BEGIN_ALLOW_THREADS;
+            SDL_UpdateWindowSurfaceRects(win, rects, count);
+            Py_END_ALLOW_THREADS;
+        }
+        PyMem_Free(rects);
+        Py_RETURN_NONE;
+    }
+
     gr = pgRect_FromObject(arg, &temp);
     if (gr) {
         SDL_Rect sdlr;
@@ -3896,6 +4276,9 @@ MODINIT_DEFINE(display)
     if (PyType_Ready(&pgVidInfo_Type) < 0) {
         return NULL;
     }
+    if (PyType_Ready(&pgDirtyRegion_Type) < 0) {
+        return NULL;
+    }
 
     /* create the module */
     module = PyModule_Create(&_module);
@@ -3911,5 +4294,10 @@ MODINIT_DEFINE(display)
     state->using_gl = 0;
     state->auto_resize = SDL_TRUE;
 
+    if (PyModule_AddType(module, &pgDirtyRegion_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
     return module;
 }
@@ -6,7 +6,7 @@
 #define DOC_DISPLAY_SETMODE "set_mode(size=(0, 0), flags=0, depth=0, display=0, vsync=0) -> Surface\nInitialize a window or screen for display."
 #define DOC_DISPLAY_GETSURFACE "get_surface() -> Surface | None\nGet a reference to the currently set display surface."
 #define DOC_DISPLAY_FLIP "flip() -> None\nUpdate the full display Surface to the screen."
-#define DOC_DISPLAY_UPDATE "update() -> None\nupdate(rectangle, /) -> None\nupdate(rectangles, /) -> None\nupdate(x, y, w, h, /) -> None\nupdate(xy, wh, /) -> None\nUpdate all, or a portion, of the display. For non-OpenGL displays."
+#define DOC_DISPLAY_UPDATE "update() -> None\nupdate(rectangle, /) -> None\nupdate(rectangles, /) -> None\nupdate(region, /) -> None\nupdate(x, y, w, h, /) -> None\nupdate(xy, wh, /) -> None\nUpdate all, or a portion, of the display. For non-OpenGL displays."
 #define DOC_DISPLAY_GETDRIVER "get_driver() -> str\nGet the name of the pygame display backend."
 #define DOC_DISPLAY_INFO "Info() -> _VidInfo\nCreate a video display information object."
 #define DOC_DISPLAY_GETWMINFO "get_wm_info() -> dict[str, int]\nGet information about the current windowing system."
@@ -35,3 +35,10 @@
 #define DOC_DISPLAY_GETCURRENTREFRESHRATE "get_current_refresh_rate() -> int\nReturns the screen refresh rate or 0 if unknown."
 #define DOC_DISPLAY_GETDESKTOPREFRESHRATES "get_desktop_refresh_rates() -> list[int]\nReturns the screen refresh rates for all displays (in windowed mode)."
 #define DOC_DISPLAY_MESSAGEBOX "message_box(title, message=None, message_type='info', parent_window=None, buttons=('OK', ), return_button=0, escape_button=None) -> int\nCreate a native GUI message box."
+#define DOC_DISPLAY_DIRTYREGION "DirtyRegion(tolerance=0.25, clip=None) -> DirtyRegion\nCollect and merge the changed areas of the display."
+#define DOC_DISPLAY_DIRTYREGION_ADD "add(rect, /) -> None\nAdd a changed area to the region."
+#define DOC_DISPLAY_DIRTYREGION_EXTEND "extend(rects, /) -> None\nAdd several changed areas to the region."
+#define DOC_DISPLAY_DIRTYREGION_CLEAR "clear() -> None\nEmpty the region."
+#define DOC_DISPLAY_DIRTYREGION_GETRECTS "get_rects() -> list[Rect]\nGet the merged rects of the region."
+#define DOC_DISPLAY_DIRTYREGION_AREA "area -> int\nThe number of pixels covered by the region (**read-only**)."
+#define DOC_DISPLAY_DIRTYREGION_TOLERANCE "tolerance -> float\nHow many extra pixels a merge may cover (**read-only**)."
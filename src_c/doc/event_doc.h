@@ -2,6 +2,7 @@
 #define DOC_EVENT "pygame module for interacting with events and queues"
 #define DOC_EVENT_PUMP "pump() -> None\ninternally process pygame event handlers"
 #define DOC_EVENT_GET "get(eventtype=None) -> Eventlist\nget(eventtype=None, pump=True) -> Eventlist\nget(eventtype=None, pump=True, exclude=None) -> Eventlist\nget events from the queue"
+#define DOC_EVENT_GETARRAY "get_array(eventtype=None, pump=True, exclude=None) -> EventArray\nget events from the queue as an EventArray"
 #define DOC_EVENT_POLL "poll() -> Event instance\nget a single event from the queue"
 #define DOC_EVENT_WAIT "wait() -> Event instance\nwait(timeout) -> Event instance\nwait for a single event from the queue"
 #define DOC_EVENT_PEEK "peek(eventtype=None) -> bool\npeek(eventtype=None, pump=True) -> bool\ntest if event types are waiting on the queue"
@@ -10,6 +11,8 @@
 #define DOC_EVENT_SETBLOCKED "set_blocked(type, /) -> None\nset_blocked(typelist, /) -> None\nset_blocked(None) -> None\ncontrol which events are blocked on the queue"
 #define DOC_EVENT_SETALLOWED "set_allowed(type, /) -> None\nset_allowed(typelist, /) -> None\nset_allowed(None) -> None\ncontrol which events are allowed on the queue"
 #define DOC_EVENT_GETBLOCKED "get_blocked(type, /) -> bool\nget_blocked(typelist, /) -> bool\ntest if a type of event is blocked from the queue"
+#define DOC_EVENT_SETCOALESCING "set_coalescing(bool, /) -> None\ncontrol merging of motion events before they reach the queue"
+#define DOC_EVENT_GETCOALESCING "get_coalescing() -> bool\ntest if motion events are merged before they reach the queue"
 #define DOC_EVENT_SETGRAB "set_grab(bool, /) -> None\ncontrol the sharing of input devices with other applications"
 #define DOC_EVENT_GETGRAB "get_grab() -> bool\ntest if the program is sharing input devices"
 #define DOC_EVENT_POST "post(event, /) -> bool\nplace a new event on the queue"
@@ -17,3 +20,5 @@
 #define DOC_EVENT_EVENT "Event(type, dict) -> Event\nEvent(type, **attributes) -> Event\npygame object for representing events"
 #define DOC_EVENT_EVENT_TYPE "type -> int\nevent type identifier."
 #define DOC_EVENT_EVENT_DICT "__dict__ -> dict\nevent attribute dictionary"
+#define DOC_EVENT_EVENTARRAY "EventArray -> sequence of Event\npygame object holding the events taken by get_array"
+#define DOC_EVENT_EVENTARRAY_FIELD "field(name, /) -> memoryview\nget one field of every event as a memoryview"
@@ -19,6 +19,8 @@
 #define DOC_FONT_FONT_POINTSIZE "point_size -> int\nGets or sets the font's point size."
 #define DOC_FONT_FONT_OUTLINE "outline -> int\nGets or sets the font's outline thickness (pixels)."
 #define DOC_FONT_FONT_RENDER "render(text, antialias, color, bgcolor=None, wraplength=0) -> Surface\nDraw text on a new Surface."
+#define DOC_FONT_FONT_SETRENDERCACHE "set_render_cache(size, shared=False) -> None\nCache rendered text surfaces."
+#define DOC_FONT_FONT_GETRENDERCACHESTATS "get_render_cache_stats(reset=False) -> dict[str, int]\nGet the counters of the render cache."
 #define DOC_FONT_FONT_SIZE "size(text, /) -> tuple[int, int]\nDetermine the amount of space needed to render text."
 #define DOC_FONT_FONT_SETUNDERLINE "set_underline(value, /) -> None\nControl if text is rendered with an underline."
 #define DOC_FONT_FONT_GETUNDERLINE "get_underline() -> bool\nCheck if text will be rendered with an underline."
@@ -30,6 +30,10 @@
 #define DOC_FREETYPE_FONT_RENDERTO "render_to(surf, dest, text, fgcolor=None, bgcolor=None, style=STYLE_DEFAULT, rotation=0, size=0) -> Rect\nRender text onto an existing surface"
 #define DOC_FREETYPE_FONT_RENDERRAW "render_raw(text, style=STYLE_DEFAULT, rotation=0, size=0, invert=False) -> (bytes, (int, int))\nReturn rendered text as a string of bytes"
 #define DOC_FREETYPE_FONT_RENDERRAWTO "render_raw_to(array, text, dest=None, style=STYLE_DEFAULT, rotation=0, size=0, invert=False) -> Rect\nRender text into an array of ints"
+#define DOC_FREETYPE_FONT_RENDERATLAS "render_atlas(text, fgcolor=None, style=STYLE_DEFAULT, rotation=0, size=0) -> (Surface, list[(Rect, (int, int))])\nReturn text as glyphs packed in a shared atlas surface"
+#define DOC_FREETYPE_FONT_RENDERATLASTO "render_atlas_to(surf, dest, text, fgcolor=None, style=STYLE_DEFAULT, rotation=0, size=0) -> Rect\nBlit text onto a surface from the glyph atlas"
+#define DOC_FREETYPE_FONT_PRELOAD "preload(text, style=STYLE_DEFAULT, rotation=0, size=0) -> int\nLoad glyphs into the glyph cache ahead of rendering"
+#define DOC_FREETYPE_FONT_GETCACHESTATS "get_cache_stats(reset=False) -> dict\nReturn glyph cache statistics"
 #define DOC_FREETYPE_FONT_STYLE "style -> int\nThe font's style flags"
 #define DOC_FREETYPE_FONT_UNDERLINE "underline -> bool\nThe state of the font's underline style flag"
 #define DOC_FREETYPE_FONT_STRONG "strong -> bool\nThe state of the font's strong style flag"
@@ -48,6 +52,7 @@
 #define DOC_FREETYPE_FONT_FGCOLOR "fgcolor -> Color\ndefault foreground color"
 #define DOC_FREETYPE_FONT_BGCOLOR "bgcolor -> Color\ndefault background color"
 #define DOC_FREETYPE_FONT_ORIGIN "origin -> bool\nFont render to text origin mode"
+#define DOC_FREETYPE_FONT_CACHEBUDGET "cache_budget -> int\nMemory budget of the glyph cache, in bytes"
 #define DOC_FREETYPE_FONT_PAD "pad -> bool\npadded boundary mode"
 #define DOC_FREETYPE_FONT_UCS4 "ucs4 -> bool\nEnable UCS-4 mode"
 #define DOC_FREETYPE_FONT_RESOLUTION "resolution -> int\nPixel resolution in dots per inch"
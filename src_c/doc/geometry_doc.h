@@ -46,3 +46,11 @@
 #define DOC_LINE_FLIPAB "flip_ab() -> Line\nflips the line a and b points"
 #define DOC_LINE_FLIPABIP "flip_ab_ip() -> None\nflips the line a and b points, in place"
 #define DOC_LINE_PROJECT "project(point: tuple[float, float], clamp=False) -> tuple[float, float]\nprojects the line onto the given line"
+#define DOC_SPATIALHASH "SpatialHash(cell_size=64) -> SpatialHash\npygame object for quickly finding overlapping rects"
+#define DOC_SPATIALHASH_CELLSIZE "cell_size -> float\nthe width and height of the grid cells"
+#define DOC_SPATIALHASH_INSERT "insert(key, rect=None) -> None\nadds or moves an entry"
+#define DOC_SPATIALHASH_REMOVE "remove(key) -> None\nremoves an entry"
+#define DOC_SPATIALHASH_CLEAR "clear() -> None\nremoves every entry"
+#define DOC_SPATIALHASH_QUERY "query(rect) -> list\nfinds the entries overlapping a rect"
+#define DOC_SPATIALHASH_QUERYPOINT "query_point((x, y)) -> list\nquery_point(x, y) -> list\nfinds the entries containing a point"
+#define DOC_SPATIALHASH_PAIRS "pairs() -> list[tuple]\nfinds every pair of overlapping entries"
@@ -3,6 +3,10 @@
 #define DOC_IMAGE_LOAD "load(file, namehint='') -> Surface\nLoad new image from a file (or file-like object)."
 #define DOC_IMAGE_LOADSIZEDSVG "load_sized_svg(file, size) -> Surface\nLoad an SVG image from a file (or file-like object) with the given size."
 #define DOC_IMAGE_LOADANIMATION "load_animation(file, namehint='') -> list[tuple[Surface, float]]\nLoad an animation (GIF/WEBP) from a file (or file-like object) as a list of frames."
+#define DOC_IMAGE_LOADASYNC "load_async(files, convert=True) -> AsyncLoad\nLoad images from files on background threads."
+#define DOC_IMAGE_ASYNCLOAD "AsyncLoad\nImages being loaded by :func:`pygame.image.load_async()`."
+#define DOC_IMAGE_ASYNCLOAD_DONE "done() -> bool\nTest if all of the images have been loaded."
+#define DOC_IMAGE_ASYNCLOAD_RESULT "result() -> list[Surface]\nGet the loaded images."
 #define DOC_IMAGE_SAVE "save(surface, file, namehint='') -> None\nSave an image to file (or file-like object)."
 #define DOC_IMAGE_GETSDLIMAGEVERSION "get_sdl_image_version(linked=True) -> tuple[int, int, int] | None\nGet version number of the SDL_Image library being used."
 #define DOC_IMAGE_GETEXTENDED "get_extended() -> bool\nTest if extended image formats can be loaded."
@@ -2,6 +2,8 @@
 #define DOC_MASK "Pygame module for image masks."
 #define DOC_MASK_FROMSURFACE "from_surface(surface, threshold=127) -> Mask\nCreates a Mask from the given surface."
 #define DOC_MASK_FROMTHRESHOLD "from_threshold(surface, color, threshold=(0, 0, 0, 255), othersurface=None, palette_colors=1) -> Mask\nCreates a mask by thresholding Surfaces."
+#define DOC_MASK_GETNUMTHREADS "get_num_threads() -> int\nReturn the number of threads connected component searches may use."
+#define DOC_MASK_SETNUMTHREADS "set_num_threads(count) -> None\nSet the number of threads connected component searches may use."
 #define DOC_MASK_MASK "Mask(size, fill=False) -> Mask\nPygame object for representing 2D bitmasks."
 #define DOC_MASK_MASK_COPY "copy() -> Mask\nReturns a new copy of the mask."
 #define DOC_MASK_MASK_GETSIZE "get_size() -> tuple[int, int]\nReturns the size of the mask."
@@ -24,5 +26,6 @@
 #define DOC_MASK_MASK_CONVOLVE "convolve(other, output=None, offset=(0, 0)) -> Mask\nReturns the convolution of this mask with another mask."
 #define DOC_MASK_MASK_CONNECTEDCOMPONENT "connected_component(pos=...) -> Mask\nReturns a mask containing a connected component."
 #define DOC_MASK_MASK_CONNECTEDCOMPONENTS "connected_components(minimum=0) -> list[Mask]\nReturns a list of masks of connected components."
+#define DOC_MASK_MASK_CONNECTEDCOMPONENTSTATS "connected_component_stats(minimum=0) -> list[tuple[int, Rect, tuple[int, int]]]\nReturns the size, bounding rect and centroid of connected components."
 #define DOC_MASK_MASK_GETBOUNDINGRECTS "get_bounding_rects() -> list[Rect]\nReturns a list of bounding rects of connected components."
 #define DOC_MASK_MASK_TOSURFACE "to_surface(surface=None, setsurface=None, unsetsurface=None, setcolor=(255, 255, 255, 255), unsetcolor=(0, 0, 0, 255), dest=(0, 0), area=None) -> Surface\nReturns a surface with the mask drawn on it."
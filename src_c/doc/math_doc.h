@@ -92,3 +92,13 @@
 #define DOC_MATH_VECTOR3_CLAMPMAGNITUDEIP "clamp_magnitude_ip(max_length, /) -> None\nclamp_magnitude_ip(min_length, max_length, /) -> None\nClamps the vector's magnitude between max_length and min_length"
 #define DOC_MATH_VECTOR3_UPDATE "update() -> None\nupdate(int) -> None\nupdate(float) -> None\nupdate(Vector3) -> None\nupdate(x, y, z) -> None\nupdate((x, y, z)) -> None\nSets the coordinates of the vector."
 #define DOC_MATH_VECTOR3_EPSILON "Determines the tolerance of vector calculations."
+#define DOC_MATH_VECTOR2ARRAY "Vector2Array(size_or_iterable) -> Vector2Array\nVector3Array(size_or_iterable) -> Vector3Array\nfixed size array of vectors for bulk math"
+#define DOC_MATH_VECTOR2ARRAY_ADDIP "add_ip(other, /) -> None\nadds a vector array or a single vector to every element in place"
+#define DOC_MATH_VECTOR2ARRAY_SUBIP "sub_ip(other, /) -> None\nsubtracts a vector array or a single vector from every element in place"
+#define DOC_MATH_VECTOR2ARRAY_SCALEIP "scale_ip(factor, /) -> None\nmultiplies every element by a number or by per element factors in place"
+#define DOC_MATH_VECTOR2ARRAY_DOT "dot(other, /) -> list[float]\ncalculates the dot product of every element"
+#define DOC_MATH_VECTOR2ARRAY_NORMALIZEIP "normalize_ip() -> None\nnormalizes every element in place"
+#define DOC_MATH_VECTOR2ARRAY_CLAMPMAGNITUDEIP "clamp_magnitude_ip(max_length, /) -> None\nclamp_magnitude_ip(min_length, max_length, /) -> None\nclamps the magnitude of every element in place"
+#define DOC_MATH_VECTOR2ARRAY_LERPIP "lerp_ip(other, t, /) -> None\nlinearly interpolates every element towards other in place"
+#define DOC_MATH_VECTOR2ARRAY_ROTATEIP "rotate_ip(angle, /) -> None\nrotate_ip(angle, axis, /) -> None\nrotates every element by an angle in degrees in place"
+#define DOC_MATH_VECTOR2ARRAY_ROTATERADIP "rotate_rad_ip(angle, /) -> None\nrotate_rad_ip(angle, axis, /) -> None\nrotates every element by an angle in radians in place"
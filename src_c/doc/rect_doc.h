@@ -28,3 +28,8 @@
 #define DOC_RECT_COLLIDEOBJECTSALL "collideobjectsall(rect_list) -> objects\ncollideobjectsall(obj_list, key=func) -> objects\ntest if all objects in a list intersect"
 #define DOC_RECT_COLLIDEDICT "collidedict(rect_dict) -> (key, value)\ncollidedict(rect_dict) -> None\ncollidedict(rect_dict, values=False) -> (key, value)\ncollidedict(rect_dict, values=False) -> None\ntest if one rectangle in a dictionary intersects"
 #define DOC_RECT_COLLIDEDICTALL "collidedictall(rect_dict) -> [(key, value), ...]\ncollidedictall(rect_dict, values=False) -> [(key, value), ...]\ntest if all rectangles in a dictionary intersect"
+#define DOC_RECT_RECTARRAY "RectArray(size_or_iterable) -> RectArray\nFRectArray(size_or_iterable) -> FRectArray\nfixed size array of rects for batch operations"
+#define DOC_RECT_RECTARRAY_MOVEIP "move_ip(x, y, /) -> None\nmoves all the rects, in place"
+#define DOC_RECT_RECTARRAY_CLAMPIP "clamp_ip(rect, /) -> None\nmoves all the rects inside another, in place"
+#define DOC_RECT_RECTARRAY_COLLIDERECT "colliderect(rect, /) -> list[int]\nindices of the rects that overlap a rect"
+#define DOC_RECT_RECTARRAY_COLLIDEARRAY "collidearray(other, /) -> list[tuple[int, int]]\npairs of colliding rects between two arrays"
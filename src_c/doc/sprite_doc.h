@@ -47,11 +47,11 @@
 #define DOC_SPRITE_LAYEREDDIRTY_SETTIMINGTRESHOLD "set_timing_treshold(time_ms) -> None\nsets the threshold in milliseconds"
 #define DOC_SPRITE_LAYEREDDIRTY_SETTIMINGTHRESHOLD "set_timing_threshold(time_ms) -> None\nsets the threshold in milliseconds"
 #define DOC_SPRITE_GROUPSINGLE "GroupSingle(sprite=None) -> GroupSingle\nGroup container that holds a single sprite."
-#define DOC_SPRITE_SPRITECOLLIDE "spritecollide(sprite, group, dokill, collided = None) -> Sprite_list\nFind sprites in a group that intersect another sprite."
+#define DOC_SPRITE_SPRITECOLLIDE "spritecollide(sprite, group, dokill, collided = None, index = None) -> Sprite_list\nFind sprites in a group that intersect another sprite."
 #define DOC_SPRITE_COLLIDERECT "collide_rect(left, right) -> bool\nCollision detection between two sprites, using rects."
 #define DOC_SPRITE_COLLIDERECTRATIO "collide_rect_ratio(ratio) -> collided_callable\nCollision detection between two sprites, using rects scaled to a ratio."
 #define DOC_SPRITE_COLLIDECIRCLE "collide_circle(left, right) -> bool\nCollision detection between two sprites, using circles."
 #define DOC_SPRITE_COLLIDECIRCLERATIO "collide_circle_ratio(ratio) -> collided_callable\nCollision detection between two sprites, using circles scaled to a ratio."
 #define DOC_SPRITE_COLLIDEMASK "collide_mask(sprite1, sprite2) -> (int, int)\ncollide_mask(sprite1, sprite2) -> None\nCollision detection between two sprites, using masks."
-#define DOC_SPRITE_GROUPCOLLIDE "groupcollide(group1, group2, dokill1, dokill2, collided = None) -> Sprite_dict\nFind all sprites that collide between two groups."
-#define DOC_SPRITE_SPRITECOLLIDEANY "spritecollideany(sprite, group, collided = None) -> Sprite\nspritecollideany(sprite, group, collided = None) -> None\nSimple test if a sprite intersects anything in a group."
+#define DOC_SPRITE_GROUPCOLLIDE "groupcollide(group1, group2, dokill1, dokill2, collided = None, index = None) -> Sprite_dict\nFind all sprites that collide between two groups."
+#define DOC_SPRITE_SPRITECOLLIDEANY "spritecollideany(sprite, group, collided = None, index = None) -> Sprite\nspritecollideany(sprite, group, collided = None, index = None) -> None\nSimple test if a sprite intersects anything in a group."
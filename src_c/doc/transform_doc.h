@@ -8,8 +8,10 @@
 #define DOC_TRANSFORM_SCALE2X "scale2x(surface, dest_surface=None) -> Surface\nSpecialized image doubler."
 #define DOC_TRANSFORM_SMOOTHSCALE "smoothscale(surface, size, dest_surface=None) -> Surface\nScale a surface to an arbitrary size smoothly."
 #define DOC_TRANSFORM_SMOOTHSCALEBY "smoothscale_by(surface, factor, dest_surface=None) -> Surface\nResize to new resolution, using scalar(s)."
-#define DOC_TRANSFORM_GETSMOOTHSCALEBACKEND "get_smoothscale_backend() -> Literal['GENERIC', 'SSE2', 'NEON']\nReturn smoothscale filter version in use: 'GENERIC', 'MMX', 'SSE', 'SSE2', or 'NEON'."
-#define DOC_TRANSFORM_SETSMOOTHSCALEBACKEND "set_smoothscale_backend(backend) -> None\nSet smoothscale filter version to one of: 'GENERIC', 'MMX', 'SSE', 'SSE2', or 'NEON'."
+#define DOC_TRANSFORM_GETSMOOTHSCALEBACKEND "get_smoothscale_backend() -> Literal['GENERIC', 'SSE2', 'AVX2', 'NEON']\nReturn smoothscale filter version in use: 'GENERIC', 'MMX', 'SSE', 'SSE2', 'AVX2', or 'NEON'."
+#define DOC_TRANSFORM_SETSMOOTHSCALEBACKEND "set_smoothscale_backend(backend) -> None\nSet smoothscale filter version to one of: 'GENERIC', 'MMX', 'SSE', 'SSE2', 'AVX2', or 'NEON'."
+#define DOC_TRANSFORM_GETNUMTHREADS "get_num_threads() -> int\nReturn the number of threads scale and smoothscale may use."
+#define DOC_TRANSFORM_SETNUMTHREADS "set_num_threads(count) -> None\nSet the number of threads scale and smoothscale may use."
 #define DOC_TRANSFORM_CHOP "chop(surface, rect) -> Surface\nGets a copy of an image with an interior area removed."
 #define DOC_TRANSFORM_LAPLACIAN "laplacian(surface, dest_surface=None) -> Surface\nFind edges in a surface."
 #define DOC_TRANSFORM_BOXBLUR "box_blur(surface, radius, repeat_edge_pixels=True, dest_surface=None) -> Surface\nBlur a surface using box blur."
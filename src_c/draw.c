@@ -27,8 +27,19 @@
 
 #include "pgcompat.h"
 
+#include "surface.h"
+
+#include "include/pygame_mask.h"
+
 #include "doc/draw_doc.h"
 
+#if !defined(__EMSCRIPTEN__)
+#include "simd_draw.h"
+#define DRAW_SIMD 1
+#else
+#define DRAW_SIMD 0
+#endif /* __EMSCRIPTEN__ */
+
 #include <limits.h>  // for CHAR_BIT
 #include <math.h>
 
@@ -57,6 +68,10 @@ draw_aaline_width(SDL_Surface *surf, SDL_Rect surf_clip_rect,
                   float from_y, float to_x, float to_y, int width,
                   int *drawn_area);
 static void
+draw_aalines(SDL_Surface *surf, SDL_Rect surf_clip_rect,
+             PG_PixelFormat *surf_format, Uint32 color, float *xlist,
+             float *ylist, Py_ssize_t length, int closed, int *drawn_area);
+static void
 draw_arc(SDL_Surface *surf, SDL_Rect surf_clip_rect, int x_center,
          int y_center, int radius1, int radius2, int width, double angle_start,
          double angle_stop, Uint32 color, int *drawn_area);
@@ -110,10 +125,58 @@ draw_round_rect(SDL_Surface *surf, SDL_Rect surf_clip_rect, int x1, int y1,
 
 static int
 flood_fill_inner(SDL_Surface *surf, int x1, int y1, Uint32 new_color,
-                 SDL_Surface *pattern, int *drawn_area);
+                 SDL_Surface *pattern, int tolerance, bitmask_t *mask,
+                 int *drawn_area);
 
 static void
 unsafe_set_at(SDL_Surface *surf, int x, int y, Uint32 color);
+static void
+drawhorzline(SDL_Surface *surf, Uint32 color, int x1, int y1, int x2);
+static void
+add_line_to_drawn_list(int x1, int y1, int x2, int y2, int *pts);
+
+/* An edge of the outline of a shape drawn with blend=True */
+typedef struct {
+    float x1, y1, x2, y2;
+} pg_aa_edge;
+
+/* The outline of a shape drawn with blend=True, see aa_add_edge() */
+typedef struct {
+    pg_aa_edge *edges;
+    Py_ssize_t num_edges, size;
+    float start_x, start_y; /* first point of the current contour */
+    float last_x, last_y;
+    int in_contour, failed;
+} pg_aa_path;
+
+static void
+aa_close(pg_aa_path *path);
+static void
+aa_move_to(pg_aa_path *path, float x, float y);
+static void
+aa_line_to(pg_aa_path *path, float x, float y);
+static void
+aa_reverse_from(pg_aa_path *path, Py_ssize_t first);
+static void
+aa_add_line(pg_aa_path *path, float x1, float y1, float x2, float y2,
+            float width);
+static void
+aa_add_round_rect(pg_aa_path *path, float x, float y, float w, float h,
+                  float top_left, float top_right, float bottom_left,
+                  float bottom_right);
+static void
+aa_add_circle(pg_aa_path *path, float x0, float y0, float radius,
+              float width, int top_right, int top_left, int bottom_left,
+              int bottom_right);
+static void
+aa_add_polyline(pg_aa_path *path, float *xs, float *ys, Py_ssize_t n,
+                int closed, float width, int joint);
+static int
+draw_aa_path(SDL_Surface *surf, SDL_Rect surf_clip_rect, pg_aa_path *path,
+             const Uint8 rgba[4], int *drawn_area);
+static int
+draw_path_aliased(SDL_Surface *surf, SDL_Rect surf_clip_rect,
+                  pg_aa_path *path, Uint32 color, int *drawn_area);
 
 // validation of a draw color
 #define CHECK_LOAD_COLOR(colorobj)                       \
@@ -122,6 +185,54 @@ unsafe_set_at(SDL_Surface *surf, int x, int y, Uint32 color);
         return NULL;                                     \
     }
 
+/* The color to draw with blend=True. Unlike the mapped color, this keeps
+ * the alpha of the color on surfaces without per pixel alpha. */
+static int
+get_blend_rgba(PyObject *colorobj, SDL_Surface *surf, Uint32 color,
+               Uint8 rgba[4])
+{
+    if (PyLong_Check(colorobj)) {
+        PG_PixelFormat *surf_format = PG_GetSurfaceFormat(surf);
+        if (surf_format == NULL) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            return 0;
+        }
+        PG_GetRGBA(color, surf_format, PG_GetSurfacePalette(surf), &rgba[0],
+                   &rgba[1], &rgba[2], &rgba[3]);
+        return 1;
+    }
+    return pg_RGBAFromObjEx(colorobj, rgba, PG_COLOR_HANDLE_STR);
+}
+
+/* How lines() and aalines() join the segments of a polyline, indexes
+ * into joint_names. JOINT_NONE draws the segments one by one. */
+#define JOINT_NONE -1
+#define JOINT_MITER 0
+#define JOINT_ROUND 1
+#define JOINT_BEVEL 2
+
+static const char *joint_names[] = {"miter", "round", "bevel"};
+
+/* Sets *joint from the name of a joint, or NULL for JOINT_NONE. Returns 0
+ * with an exception set if the name is unknown. */
+static int
+get_joint(const char *name, int *joint)
+{
+    if (name == NULL) {
+        *joint = JOINT_NONE;
+        return 1;
+    }
+    for (*joint = 0; *joint < (int)SDL_arraysize(joint_names); (*joint)++) {
+        if (!strcmp(name, joint_names[*joint])) {
+            return 1;
+        }
+    }
+    PyErr_Format(PyExc_ValueError,
+                 "unknown joint '%s', must be 'miter', 'round' or 'bevel'",
+                 name);
+    return 0;
+}
+
 /* Definition of functions that get called in Python */
 
 /* Draws an antialiased line on the given surface.
@@ -233,14 +344,16 @@ line(PyObject *self, PyObject *arg, PyObject *kwargs)
     int startx, starty, endx, endy;
     Uint32 color;
     int width = 1; /* Default width. */
+    int blend = 0, failed = 0;
+    Uint8 rgba[4];
     int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
                          INT_MIN}; /* Used to store bounding box values */
-    static char *keywords[] = {"surface", "color", "start_pos",
-                               "end_pos", "width", NULL};
+    static char *keywords[] = {"surface", "color", "start_pos", "end_pos",
+                               "width",   "blend", NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OOO|i", keywords,
+    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OOO|i$p", keywords,
                                      &pgSurface_Type, &surfobj, &colorobj,
-                                     &start, &end, &width)) {
+                                     &start, &end, &width, &blend)) {
         return NULL; /* Exception already set. */
     }
 
@@ -260,6 +373,10 @@ line(PyObject *self, PyObject *arg, PyObject *kwargs)
 
     CHECK_LOAD_COLOR(colorobj)
 
+    if (blend && !get_blend_rgba(colorobj, surf, color, rgba)) {
+        return NULL;
+    }
+
     if (!pg_TwoIntsFromObj(start, &startx, &starty)) {
         return RAISE(PyExc_TypeError, "invalid start_pos argument");
     }
@@ -276,13 +393,26 @@ line(PyObject *self, PyObject *arg, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
 
-    draw_line_width(surf, surf_clip_rect, color, startx, starty, endx, endy,
-                    width, drawn_area);
+    if (blend) {
+        pg_aa_path path = {NULL};
+
+        aa_add_line(&path, (float)startx, (float)starty, (float)endx,
+                    (float)endy, (float)width);
+        failed = draw_aa_path(surf, surf_clip_rect, &path, rgba, drawn_area);
+    }
+    else {
+        draw_line_width(surf, surf_clip_rect, color, startx, starty, endx,
+                        endy, width, drawn_area);
+    }
 
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
 
+    if (failed) {
+        return NULL; /* Exception already set. */
+    }
+
     /* Compute return rect. */
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
@@ -307,25 +437,27 @@ aalines(PyObject *self, PyObject *arg, PyObject *kwargs)
     PyObject *points, *item = NULL;
     SDL_Surface *surf = NULL;
     Uint32 color;
-    float pts[4];
-    float pts_prev[4];
     float x, y;
     int l, t;
-    int extra_px;
-    int disable_endpoints;
-    int steep_prev;
-    int steep_curr;
     PyObject *blend = NULL;
     int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
                          INT_MIN}; /* Used to store bounding box values */
-    int result, closed;
+    int result, closed, joint, failed = 0;
+    int width = 1; /* Default width. */
+    const char *jointname = NULL;
+    Uint8 rgba[4];
     Py_ssize_t loop, length;
-    static char *keywords[] = {"surface", "color", "closed",
-                               "points",  "blend", NULL};
+    static char *keywords[] = {"surface", "color", "closed", "points",
+                               "blend",   "width", "joint",  NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OpO|O", keywords,
+    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OpO|O$iz", keywords,
                                      &pgSurface_Type, &surfobj, &colorobj,
-                                     &closed, &points, &blend)) {
+                                     &closed, &points, &blend, &width,
+                                     &jointname)) {
+        return NULL; /* Exception already set. */
+    }
+
+    if (!get_joint(jointname, &joint)) {
         return NULL; /* Exception already set. */
     }
 
@@ -360,6 +492,10 @@ aalines(PyObject *self, PyObject *arg, PyObject *kwargs)
 
     CHECK_LOAD_COLOR(colorobj)
 
+    if (joint != JOINT_NONE && !get_blend_rgba(colorobj, surf, color, rgba)) {
+        return NULL;
+    }
+
     if (!PySequence_Check(points)) {
         return RAISE(PyExc_TypeError,
                      "points argument must be a sequence of number pairs");
@@ -405,98 +541,29 @@ aalines(PyObject *self, PyObject *arg, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
 
-    /* first line - if open, add endpoint pixels.*/
-    pts[0] = xlist[0];
-    pts[1] = ylist[0];
-    pts[2] = xlist[1];
-    pts[3] = ylist[1];
-
-    /* Previous points.
-     * Used to compare previous and current line.*/
-    pts_prev[0] = pts[0];
-    pts_prev[1] = pts[1];
-    pts_prev[2] = pts[2];
-    pts_prev[3] = pts[3];
-    steep_prev =
-        fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
-    steep_curr = fabs(xlist[2] - pts[2]) < fabs(ylist[2] - pts[1]);
-    extra_px = steep_prev > steep_curr;
-    disable_endpoints =
-        !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
-    if (closed) {
-        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
-                    pts[2], pts[3], drawn_area, disable_endpoints,
-                    disable_endpoints, extra_px);
-    }
-    else {
-        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
-                    pts[2], pts[3], drawn_area, 0, disable_endpoints,
-                    extra_px);
-    }
-
-    for (loop = 2; loop < length - 1; ++loop) {
-        pts[0] = xlist[loop - 1];
-        pts[1] = ylist[loop - 1];
-        pts[2] = xlist[loop];
-        pts[3] = ylist[loop];
+    if (joint != JOINT_NONE) {
+        /* The stroke is one shape, blended once where segments overlap */
+        pg_aa_path path = {NULL};
 
-        /* Comparing previous and current line.
-         * If one is steep and other is not, extra pixel must be drawn.*/
-        steep_prev =
-            fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
-        steep_curr = fabs(pts[2] - pts[0]) < fabs(pts[3] - pts[1]);
-        extra_px = steep_prev != steep_curr;
-        disable_endpoints =
-            !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
-        pts_prev[0] = pts[0];
-        pts_prev[1] = pts[1];
-        pts_prev[2] = pts[2];
-        pts_prev[3] = pts[3];
-        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
-                    pts[2], pts[3], drawn_area, disable_endpoints,
-                    disable_endpoints, extra_px);
+        aa_add_polyline(&path, xlist, ylist, length, closed,
+                        (float)MAX(width, 1), joint);
+        failed = draw_aa_path(surf, surf_clip_rect, &path, rgba, drawn_area);
     }
-
-    /* Last line - if open, add endpoint pixels. */
-    pts[0] = xlist[length - 2];
-    pts[1] = ylist[length - 2];
-    pts[2] = xlist[length - 1];
-    pts[3] = ylist[length - 1];
-    steep_prev =
-        fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
-    steep_curr = fabs(pts[2] - pts[0]) < fabs(pts[3] - pts[1]);
-    extra_px = steep_prev != steep_curr;
-    disable_endpoints =
-        !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
-    pts_prev[0] = pts[0];
-    pts_prev[1] = pts[1];
-    pts_prev[2] = pts[2];
-    pts_prev[3] = pts[3];
-    if (closed) {
-        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
-                    pts[2], pts[3], drawn_area, disable_endpoints,
-                    disable_endpoints, extra_px);
+    else if (width > 1) {
+        for (loop = 1; loop < length; ++loop) {
+            draw_aaline_width(surf, surf_clip_rect, surf_format, color,
+                              xlist[loop - 1], ylist[loop - 1], xlist[loop],
+                              ylist[loop], width, drawn_area);
+        }
+        if (closed && length > 2) {
+            draw_aaline_width(surf, surf_clip_rect, surf_format, color,
+                              xlist[length - 1], ylist[length - 1], xlist[0],
+                              ylist[0], width, drawn_area);
+        }
     }
     else {
-        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
-                    pts[2], pts[3], drawn_area, disable_endpoints, 0,
-                    extra_px);
-    }
-
-    if (closed && length > 2) {
-        pts[0] = xlist[length - 1];
-        pts[1] = ylist[length - 1];
-        pts[2] = xlist[0];
-        pts[3] = ylist[0];
-        steep_prev =
-            fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
-        steep_curr = fabs(pts[2] - pts[0]) < fabs(pts[3] - pts[1]);
-        extra_px = steep_prev != steep_curr;
-        disable_endpoints =
-            !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
-        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
-                    pts[2], pts[3], drawn_area, disable_endpoints,
-                    disable_endpoints, extra_px);
+        draw_aalines(surf, surf_clip_rect, surf_format, color, xlist, ylist,
+                     length, closed, drawn_area);
     }
 
     PyMem_Free(points_buf);
@@ -505,6 +572,10 @@ aalines(PyObject *self, PyObject *arg, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
 
+    if (failed) {
+        return NULL; /* Exception already set. */
+    }
+
     /* Compute return rect. */
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
@@ -532,15 +603,24 @@ lines(PyObject *self, PyObject *arg, PyObject *kwargs)
     int x, y, closed, result;
     int *xlist = NULL, *ylist = NULL;
     int width = 1; /* Default width. */
+    int blend = 0, failed = 0, joint;
+    const char *jointname = NULL;
+    Uint8 rgba[4];
+    float *fpoints;
     Py_ssize_t loop, length;
     int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
                          INT_MIN}; /* Used to store bounding box values */
-    static char *keywords[] = {"surface", "color", "closed",
-                               "points",  "width", NULL};
+    static char *keywords[] = {"surface", "color", "closed", "points",
+                               "width",   "blend", "joint",  NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OpO|i", keywords,
+    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OpO|i$pz", keywords,
                                      &pgSurface_Type, &surfobj, &colorobj,
-                                     &closed, &points, &width)) {
+                                     &closed, &points, &width, &blend,
+                                     &jointname)) {
+        return NULL; /* Exception already set. */
+    }
+
+    if (!get_joint(jointname, &joint)) {
         return NULL; /* Exception already set. */
     }
 
@@ -560,6 +640,10 @@ lines(PyObject *self, PyObject *arg, PyObject *kwargs)
 
     CHECK_LOAD_COLOR(colorobj)
 
+    if (blend && !get_blend_rgba(colorobj, surf, color, rgba)) {
+        return NULL;
+    }
+
     if (!PySequence_Check(points)) {
         return RAISE(PyExc_TypeError,
                      "points argument must be a sequence of number pairs");
@@ -616,16 +700,61 @@ lines(PyObject *self, PyObject *arg, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
 
-    for (loop = 1; loop < length; ++loop) {
-        draw_line_width(surf, surf_clip_rect, color, xlist[loop - 1],
-                        ylist[loop - 1], xlist[loop], ylist[loop], width,
-                        drawn_area);
+    if (joint != JOINT_NONE) {
+        /* The stroke is one shape, filled once where segments overlap */
+        pg_aa_path path = {NULL};
+
+        fpoints = PyMem_New(float, length * 2);
+        if (fpoints == NULL) {
+            PyErr_NoMemory();
+            failed = -1;
+        }
+        else {
+            for (loop = 0; loop < length; ++loop) {
+                fpoints[loop] = (float)xlist[loop];
+                fpoints[length + loop] = (float)ylist[loop];
+            }
+            aa_add_polyline(&path, fpoints, fpoints + length, length, closed,
+                            (float)width, joint);
+            PyMem_Free(fpoints);
+            if (blend) {
+                failed = draw_aa_path(surf, surf_clip_rect, &path, rgba,
+                                      drawn_area);
+            }
+            else {
+                failed = draw_path_aliased(surf, surf_clip_rect, &path,
+                                           color, drawn_area);
+            }
+        }
+    }
+    else if (blend) {
+        /* All the lines are one shape, so their overlaps blend once */
+        pg_aa_path path = {NULL};
+
+        for (loop = 1; loop < length; ++loop) {
+            aa_add_line(&path, (float)xlist[loop - 1], (float)ylist[loop - 1],
+                        (float)xlist[loop], (float)ylist[loop],
+                        (float)width);
+        }
+        if (closed && length > 2) {
+            aa_add_line(&path, (float)xlist[length - 1],
+                        (float)ylist[length - 1], (float)xlist[0],
+                        (float)ylist[0], (float)width);
+        }
+        failed = draw_aa_path(surf, surf_clip_rect, &path, rgba, drawn_area);
     }
+    else {
+        for (loop = 1; loop < length; ++loop) {
+            draw_line_width(surf, surf_clip_rect, color, xlist[loop - 1],
+                            ylist[loop - 1], xlist[loop], ylist[loop], width,
+                            drawn_area);
+        }
 
-    if (closed && length > 2) {
-        draw_line_width(surf, surf_clip_rect, color, xlist[length - 1],
-                        ylist[length - 1], xlist[0], ylist[0], width,
-                        drawn_area);
+        if (closed && length > 2) {
+            draw_line_width(surf, surf_clip_rect, color, xlist[length - 1],
+                            ylist[length - 1], xlist[0], ylist[0], width,
+                            drawn_area);
+        }
     }
 
     PyMem_Free(xlist);
@@ -635,6 +764,10 @@ lines(PyObject *self, PyObject *arg, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
 
+    if (failed) {
+        return NULL; /* Exception already set. */
+    }
+
     /* Compute return rect. */
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
@@ -814,6 +947,8 @@ circle(PyObject *self, PyObject *args, PyObject *kwargs)
     int posx, posy, radius;
     int width = 0; /* Default values. */
     int top_right = 0, top_left = 0, bottom_left = 0, bottom_right = 0;
+    int blend = 0, failed = 0;
+    Uint8 rgba[4];
     int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
                          INT_MIN}; /* Used to store bounding box values */
     static char *keywords[] = {"surface",
@@ -825,12 +960,13 @@ circle(PyObject *self, PyObject *args, PyObject *kwargs)
                                "draw_top_left",
                                "draw_bottom_left",
                                "draw_bottom_right",
+                               "blend",
                                NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O!OOO|iiiii", keywords,
-                                     &pgSurface_Type, &surfobj, &colorobj,
-                                     &posobj, &radiusobj, &width, &top_right,
-                                     &top_left, &bottom_left, &bottom_right)) {
+    if (!PyArg_ParseTupleAndKeywords(
+            args, kwargs, "O!OOO|iiiii$p", keywords, &pgSurface_Type,
+            &surfobj, &colorobj, &posobj, &radiusobj, &width, &top_right,
+            &top_left, &bottom_left, &bottom_right, &blend)) {
         return NULL; /* Exception already set. */
     }
 
@@ -861,6 +997,10 @@ circle(PyObject *self, PyObject *args, PyObject *kwargs)
 
     CHECK_LOAD_COLOR(colorobj)
 
+    if (blend && !get_blend_rgba(colorobj, surf, color, rgba)) {
+        return NULL;
+    }
+
     if (radius < 1 || width < 0) {
         return pgRect_New4(posx, posy, 0, 0);
     }
@@ -880,8 +1020,16 @@ circle(PyObject *self, PyObject *args, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
 
-    if ((top_right == 0 && top_left == 0 && bottom_left == 0 &&
-         bottom_right == 0)) {
+    if (blend) {
+        pg_aa_path path = {NULL};
+
+        aa_add_circle(&path, (float)posx, (float)posy, (float)radius,
+                      (float)width, top_right, top_left, bottom_left,
+                      bottom_right);
+        failed = draw_aa_path(surf, surf_clip_rect, &path, rgba, drawn_area);
+    }
+    else if ((top_right == 0 && top_left == 0 && bottom_left == 0 &&
+              bottom_right == 0)) {
         if (!width || width == radius) {
             draw_circle_filled(surf, surf_clip_rect, posx, posy, radius, color,
                                drawn_area);
@@ -904,6 +1052,9 @@ circle(PyObject *self, PyObject *args, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    if (failed) {
+        return NULL; /* Exception already set. */
+    }
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
         return pgRect_New4(drawn_area[0], drawn_area[1],
@@ -1058,28 +1209,40 @@ polygon(PyObject *self, PyObject *arg, PyObject *kwargs)
     Uint32 color;
     int width = 0; /* Default width. */
     int x, y, result, l, t;
+    int blend = 0, failed = 0;
+    Uint8 rgba[4];
     int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
                          INT_MIN}; /* Used to store bounding box values */
     Py_ssize_t loop, length;
-    static char *keywords[] = {"surface", "color", "points", "width", NULL};
+    static char *keywords[] = {"surface", "color", "points",
+                               "width",   "blend", NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OO|i", keywords,
+    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OO|i$p", keywords,
                                      &pgSurface_Type, &surfobj, &colorobj,
-                                     &points, &width)) {
+                                     &points, &width, &blend)) {
         return NULL; /* Exception already set. */
     }
 
     if (width) {
         PyObject *ret = NULL;
+        PyObject *lines_kwargs = NULL;
         PyObject *args =
             Py_BuildValue("(OOiOi)", surfobj, colorobj, 1, points, width);
 
         if (!args) {
             return NULL; /* Exception already set. */
         }
+        if (blend) {
+            lines_kwargs = Py_BuildValue("{s:O}", "blend", Py_True);
+            if (!lines_kwargs) {
+                Py_DECREF(args);
+                return NULL; /* Exception already set. */
+            }
+        }
 
-        ret = lines(NULL, args, NULL);
+        ret = lines(NULL, args, lines_kwargs);
         Py_DECREF(args);
+        Py_XDECREF(lines_kwargs);
         return ret;
     }
 
@@ -1099,6 +1262,10 @@ polygon(PyObject *self, PyObject *arg, PyObject *kwargs)
 
     CHECK_LOAD_COLOR(colorobj)
 
+    if (blend && !get_blend_rgba(colorobj, surf, color, rgba)) {
+        return NULL;
+    }
+
     if (!PySequence_Check(points)) {
         return RAISE(PyExc_TypeError,
                      "points argument must be a sequence of number pairs");
@@ -1144,7 +1311,17 @@ polygon(PyObject *self, PyObject *arg, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
 
-    if (length != 3) {
+    if (blend) {
+        /* Points are pixel centers, like in aalines() */
+        pg_aa_path path = {NULL};
+
+        aa_move_to(&path, xlist[0] + 0.5f, ylist[0] + 0.5f);
+        for (loop = 1; loop < length; ++loop) {
+            aa_line_to(&path, xlist[loop] + 0.5f, ylist[loop] + 0.5f);
+        }
+        failed = draw_aa_path(surf, surf_clip_rect, &path, rgba, drawn_area);
+    }
+    else if (length != 3) {
         draw_fillpoly(surf, surf_clip_rect, xlist, ylist, length, color,
                       drawn_area);
     }
@@ -1157,6 +1334,10 @@ polygon(PyObject *self, PyObject *arg, PyObject *kwargs)
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
 
+    if (failed) {
+        return NULL; /* Exception already set. */
+    }
+
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
         return pgRect_New4(drawn_area[0], drawn_area[1],
@@ -1168,6 +1349,92 @@ polygon(PyObject *self, PyObject *arg, PyObject *kwargs)
     }
 }
 
+/* rect() with blend=True. The corners of the rect are pixel corners, so
+ * rects without rounded corners are drawn without partial pixels. */
+static PyObject *
+rect_blend(pgSurfaceObject *surfobj, SDL_Rect surf_clip_rect,
+           PyObject *colorobj, Uint32 color, SDL_Rect *rect, int width,
+           int radius, int top_left, int top_right, int bottom_left,
+           int bottom_right)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(surfobj);
+    pg_aa_path path = {NULL};
+    Uint8 rgba[4];
+    int x = rect->x, y = rect->y, w = rect->w, h = rect->h, failed;
+    float q_top, q_left, q_bottom, q_right, f;
+    Py_ssize_t first;
+    int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
+                         INT_MIN}; /* Used to store bounding box values */
+
+    if (!get_blend_rgba(colorobj, surf, color, rgba)) {
+        return NULL;
+    }
+
+    if (w < 0) {
+        x += w;
+        w = -w;
+    }
+    if (h < 0) {
+        y += h;
+        h = -h;
+    }
+    if (w == 0 || h == 0) {
+        return pgRect_New4(rect->x, rect->y, 0, 0);
+    }
+
+    /* Radii as in draw_round_rect() */
+    top_left = MAX(top_left < 0 ? radius : top_left, 0);
+    top_right = MAX(top_right < 0 ? radius : top_right, 0);
+    bottom_left = MAX(bottom_left < 0 ? radius : bottom_left, 0);
+    bottom_right = MAX(bottom_right < 0 ? radius : bottom_right, 0);
+    if ((top_left + top_right) > w || (bottom_left + bottom_right) > w ||
+        (top_left + bottom_left) > h || (top_right + bottom_right) > h) {
+        q_top = w / (float)(top_left + top_right);
+        q_left = h / (float)(top_left + bottom_left);
+        q_bottom = w / (float)(bottom_left + bottom_right);
+        q_right = h / (float)(top_right + bottom_right);
+        f = MIN(MIN(MIN(q_top, q_left), q_bottom), q_right);
+        top_left = (int)(top_left * f);
+        top_right = (int)(top_right * f);
+        bottom_left = (int)(bottom_left * f);
+        bottom_right = (int)(bottom_right * f);
+    }
+
+    aa_add_round_rect(&path, (float)x, (float)y, (float)w, (float)h,
+                      (float)top_left, (float)top_right, (float)bottom_left,
+                      (float)bottom_right);
+    if (width > 0 && width < w - width && width < h - width) {
+        first = path.num_edges;
+        aa_add_round_rect(&path, (float)x + width, (float)y + width,
+                          (float)w - 2.0f * width, (float)h - 2.0f * width,
+                          (float)MAX(top_left - width, 0),
+                          (float)MAX(top_right - width, 0),
+                          (float)MAX(bottom_left - width, 0),
+                          (float)MAX(bottom_right - width, 0));
+        aa_reverse_from(&path, first);
+    }
+
+    if (!pgSurface_Lock(surfobj)) {
+        PyMem_Free(path.edges);
+        return RAISE(PyExc_RuntimeError, "error locking surface");
+    }
+    failed = draw_aa_path(surf, surf_clip_rect, &path, rgba, drawn_area);
+    if (!pgSurface_Unlock(surfobj)) {
+        return RAISE(PyExc_RuntimeError, "error unlocking surface");
+    }
+    if (failed) {
+        return NULL; /* Exception already set. */
+    }
+
+    if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
+        drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
+        return pgRect_New4(drawn_area[0], drawn_area[1],
+                           drawn_area[2] - drawn_area[0] + 1,
+                           drawn_area[3] - drawn_area[1] + 1);
+    }
+    return pgRect_New4(rect->x, rect->y, 0, 0);
+}
+
 static PyObject *
 rect(PyObject *self, PyObject *args, PyObject *kwargs)
 {
@@ -1179,6 +1446,7 @@ rect(PyObject *self, PyObject *args, PyObject *kwargs)
     int width = 0, radius = 0; /* Default values. */
     int top_left_radius = -1, top_right_radius = -1, bottom_left_radius = -1,
         bottom_right_radius = -1;
+    int blend = 0;
     SDL_Rect sdlrect;
     SDL_Rect clipped;
     int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
@@ -1192,11 +1460,13 @@ rect(PyObject *self, PyObject *args, PyObject *kwargs)
                                "border_top_right_radius",
                                "border_bottom_left_radius",
                                "border_bottom_right_radius",
+                               "blend",
                                NULL};
     if (!PyArg_ParseTupleAndKeywords(
-            args, kwargs, "O!OO|iiiiii", keywords, &pgSurface_Type, &surfobj,
-            &colorobj, &rectobj, &width, &radius, &top_left_radius,
-            &top_right_radius, &bottom_left_radius, &bottom_right_radius)) {
+            args, kwargs, "O!OO|iiiiii$p", keywords, &pgSurface_Type,
+            &surfobj, &colorobj, &rectobj, &width, &radius, &top_left_radius,
+            &top_right_radius, &bottom_left_radius, &bottom_right_radius,
+            &blend)) {
         return NULL; /* Exception already set. */
     }
 
@@ -1224,6 +1494,12 @@ rect(PyObject *self, PyObject *args, PyObject *kwargs)
         return pgRect_New4(rect->x, rect->y, 0, 0);
     }
 
+    if (blend) {
+        return rect_blend(surfobj, surf_clip_rect, colorobj, color, rect,
+                          width, radius, top_left_radius, top_right_radius,
+                          bottom_left_radius, bottom_right_radius);
+    }
+
     /* If there isn't any rounded rect-ness OR the rect is really thin in one
        direction. The "really thin in one direction" check is necessary because
        draw_round_rect fails (draws something bad) on rects with a dimension
@@ -1298,14 +1574,36 @@ rect(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 }
 
+/* Returns 1 if obj is a pygame.mask.Mask, else 0 with an exception set.
+ * The mask module is only imported once a mask is passed. */
+static int
+flood_fill_check_mask(PyObject *obj)
+{
+    int result;
+
+    if (!PYGAMEAPI_IS_IMPORTED(mask)) {
+        import_pygame_mask();
+        if (PyErr_Occurred()) {
+            return 0;
+        }
+    }
+    result = pgMask_Check(obj);
+    if (result == 0) {
+        PyErr_Format(PyExc_TypeError, "mask must be a Mask, not %.200s",
+                     Py_TYPE(obj)->tp_name);
+    }
+    return result == 1;
+}
+
 static PyObject *
 flood_fill(PyObject *self, PyObject *arg, PyObject *kwargs)
 {
     pgSurfaceObject *surfobj;
     pgSurfaceObject *pat_surfobj = NULL;
-    PyObject *colorobj, *start;
+    PyObject *colorobj, *start, *maskobj = Py_None;
     SDL_Surface *surf = NULL;
-    int startx, starty;
+    bitmask_t *mask = NULL;
+    int startx, starty, tolerance = 0;
     Uint32 color;
     SDL_Surface *pattern = NULL;
     SDL_bool did_lock_surf = SDL_FALSE;
@@ -1314,11 +1612,12 @@ flood_fill(PyObject *self, PyObject *arg, PyObject *kwargs)
 
     int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
                          INT_MIN}; /* Used to store bounding box values */
-    static char *keywords[] = {"surface", "color", "start_pos", NULL};
+    static char *keywords[] = {"surface",   "color", "start_pos",
+                               "tolerance", "mask",  NULL};
 
-    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OO", keywords,
+    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!OO|$iO", keywords,
                                      &pgSurface_Type, &surfobj, &colorobj,
-                                     &start)) {
+                                     &start, &tolerance, &maskobj)) {
         return NULL; /* Exception already set. */
     }
 
@@ -1331,8 +1630,28 @@ flood_fill(PyObject *self, PyObject *arg, PyObject *kwargs)
                             PG_SURF_BytesPerPixel(surf));
     }
 
-    if (pgSurface_Check(colorobj)) {
-        pat_surfobj = ((pgSurfaceObject *)colorobj);
+    if (tolerance < 0 || tolerance > 255) {
+        return RAISE(PyExc_ValueError, "tolerance must be in range 0-255");
+    }
+
+    if (maskobj != Py_None) {
+        if (!flood_fill_check_mask(maskobj)) {
+            return NULL; /* Exception already set. */
+        }
+        mask = pgMask_AsBitmap(maskobj);
+        if (mask->w != surf->w || mask->h != surf->h) {
+            return RAISE(PyExc_ValueError,
+                         "mask must be the same size as the surface");
+        }
+    }
+
+    if (pgSurface_Check(colorobj)) {
+        pat_surfobj = ((pgSurfaceObject *)colorobj);
+
+        if (pat_surfobj->surf == NULL || !pat_surfobj->surf->w ||
+            !pat_surfobj->surf->h) {
+            return RAISE(PyExc_ValueError, "pattern surface is empty");
+        }
 
         pattern = PG_ConvertSurface(pat_surfobj->surf, surf->format);
 
@@ -1349,12 +1668,14 @@ flood_fill(PyObject *self, PyObject *arg, PyObject *kwargs)
     }
 
     if (!pg_TwoIntsFromObj(start, &startx, &starty)) {
+        SDL_FreeSurface(pattern);
         return RAISE(PyExc_TypeError, "invalid start_pos argument");
     }
 
     if (SDL_MUSTLOCK(surf)) {
         did_lock_surf = SDL_TRUE;
         if (!pgSurface_Lock(surfobj)) {
+            SDL_FreeSurface(pattern);
             return RAISE(PyExc_RuntimeError, "error locking surface");
         }
     }
@@ -1364,24 +1685,29 @@ flood_fill(PyObject *self, PyObject *arg, PyObject *kwargs)
             if (did_lock_surf) {
                 pgSurface_Unlock(surfobj);
             }
+            SDL_FreeSurface(pattern);
             return RAISE(PyExc_RuntimeError, "error locking pattern surface");
         }
     }
 
-    flood_fill_result =
-        flood_fill_inner(surf, startx, starty, color, pattern, drawn_area);
+    flood_fill_result = flood_fill_inner(surf, startx, starty, color, pattern,
+                                         tolerance, mask, drawn_area);
 
-    /* no allocated pattern surface to free */
+    if (mask != NULL && drawn_area[0] != INT_MAX) {
+        pgMask_Changed(maskobj);
+    }
 
     if (did_lock_pat) {
         if (!pgSurface_Unlock(pat_surfobj)) {
             if (did_lock_surf) {
                 pgSurface_Unlock(surfobj);
             }
+            SDL_FreeSurface(pattern);
             return RAISE(PyExc_RuntimeError,
                          "error unlocking pattern surface");
         }
     }
+    SDL_FreeSurface(pattern);
     if (did_lock_surf) {
         if (!pgSurface_Unlock(surfobj)) {
             return RAISE(PyExc_RuntimeError, "error unlocking surface");
@@ -1403,44 +1729,366 @@ flood_fill(PyObject *self, PyObject *arg, PyObject *kwargs)
         return pgRect_New4(startx, starty, 0, 0);
     }
 }
-/* Functions used in drawing algorithms */
 
-static void
-swap(float *a, float *b)
+/* Shapes drawn by many(), indexes into many_kinds */
+#define MANY_LINE 0
+#define MANY_AALINE 1
+#define MANY_RECT 2
+#define MANY_CIRCLE 3
+
+static const struct {
+    const char *name;
+    int num_params;    /* numbers per shape in the params buffer */
+    int default_width; /* width used when none is passed */
+} many_kinds[] = {
+    {"line", 4, 1},
+    {"aaline", 4, 1},
+    {"rect", 4, 0},
+    {"circle", 3, 0},
+};
+
+/* Number i of a params buffer, format is one of MANY_PARAM_FORMATS */
+#define MANY_PARAM_FORMATS "hilqfd"
+
+static double
+many_param(const void *buf, char format, Py_ssize_t i)
 {
-    float temp = *a;
-    *a = *b;
-    *b = temp;
+    switch (format) {
+        case 'h':
+            return ((const short *)buf)[i];
+        case 'i':
+            return ((const int *)buf)[i];
+        case 'l':
+            return (double)((const long *)buf)[i];
+        case 'q':
+            return (double)((const long long *)buf)[i];
+        case 'f':
+            return ((const float *)buf)[i];
+        default: /* 'd' */
+            return ((const double *)buf)[i];
+    }
 }
 
-#define WORD_BITS (CHAR_BIT * sizeof(unsigned int))
-
-struct point2d {
-    Uint32 x;
-    Uint32 y;
-};
+/* Size of the C type many_param() reads a param of the given format as */
+static Py_ssize_t
+many_param_size(char format)
+{
+    switch (format) {
+        case 'h':
+            return sizeof(short);
+        case 'i':
+            return sizeof(int);
+        case 'l':
+            return sizeof(long);
+        case 'q':
+            return sizeof(long long);
+        case 'f':
+            return sizeof(float);
+        default: /* 'd' */
+            return sizeof(double);
+    }
+}
 
-static inline void
-_bitarray_set(unsigned int *bitarray, size_t idx, SDL_bool value)
+/* Truncates a param to an int, the way the other functions take floats */
+static int
+many_int_param(const void *buf, char format, Py_ssize_t i)
 {
-    const unsigned int mask = (1u << (idx % WORD_BITS));
-    if (value) {
-        bitarray[idx / WORD_BITS] |= mask;
+    double value = many_param(buf, format, i);
+
+    if (value != value) {
+        return 0; /* NaN */
     }
-    else {
-        bitarray[idx / WORD_BITS] &= ~mask;
+    if (value <= INT_MIN) {
+        return INT_MIN;
     }
+    if (value >= INT_MAX) {
+        return INT_MAX;
+    }
+    return (int)value;
 }
 
-static inline SDL_bool
-_bitarray_get(unsigned int *bitarray, size_t idx)
+/* Draws many shapes of one kind on the given surface, taking the position
+ * and size of each from a buffer of numbers. The surface is locked once.
+ *
+ * Returns a Rect bounding the drawn area of all the shapes.
+ */
+static PyObject *
+many(PyObject *self, PyObject *arg, PyObject *kwargs)
 {
-    if (bitarray[idx / WORD_BITS] & (1u << (idx % WORD_BITS))) {
-        return SDL_TRUE;
+    pgSurfaceObject *surfobj;
+    PyObject *colorobj, *paramsobj, *widthobj = Py_None, *item;
+    SDL_Surface *surf = NULL;
+    PG_PixelFormat *surf_format = NULL;
+    const char *kindname, *format;
+    int kind, k, width, result = 1;
+    Py_ssize_t i, num_shapes;
+    Uint32 color = 0, *colors = NULL;
+    Py_buffer view;
+    int drawn_area[4] = {INT_MAX, INT_MAX, INT_MIN,
+                         INT_MIN}; /* Used to store bounding box values */
+    static char *keywords[] = {"surface", "kind",  "color",
+                               "params",  "width", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "O!sOO|O", keywords,
+                                     &pgSurface_Type, &surfobj, &kindname,
+                                     &colorobj, &paramsobj, &widthobj)) {
+        return NULL; /* Exception already set. */
     }
-    else {
-        return SDL_FALSE;
+
+    for (kind = 0; kind < (int)SDL_arraysize(many_kinds); kind++) {
+        if (!strcmp(kindname, many_kinds[kind].name)) {
+            break;
+        }
+    }
+    if (kind == (int)SDL_arraysize(many_kinds)) {
+        return PyErr_Format(PyExc_ValueError,
+                            "unknown kind '%s', must be 'line', 'aaline', "
+                            "'rect' or 'circle'",
+                            kindname);
+    }
+    k = many_kinds[kind].num_params;
+
+    if (widthobj == Py_None) {
+        width = many_kinds[kind].default_width;
+    }
+    else if (!pg_IntFromObj(widthobj, &width)) {
+        return RAISE(PyExc_TypeError, "width argument must be an int");
+    }
+
+    surf = pgSurface_AsSurface(surfobj);
+    SURF_INIT_CHECK(surf)
+
+    if (PG_SURF_BytesPerPixel(surf) <= 0 || PG_SURF_BytesPerPixel(surf) > 4) {
+        return PyErr_Format(PyExc_ValueError,
+                            "unsupported surface bit depth (%d) for drawing",
+                            PG_SURF_BytesPerPixel(surf));
+    }
+
+    SDL_Rect surf_clip_rect;
+    if (!PG_GetSurfaceClipRect(surf, &surf_clip_rect)) {
+        return RAISE(pgExc_SDLError, SDL_GetError());
+    }
+
+    if (kind == MANY_AALINE) {
+        surf_format = PG_GetSurfaceFormat(surf);
+        if (surf_format == NULL) {
+            return RAISE(pgExc_SDLError, SDL_GetError());
+        }
+    }
+
+    if (!PyObject_CheckBuffer(paramsobj)) {
+        return RAISE(PyExc_TypeError,
+                     "params argument must be a buffer of numbers");
+    }
+    if (PyObject_GetBuffer(paramsobj, &view,
+                           PyBUF_C_CONTIGUOUS | PyBUF_FORMAT)) {
+        return NULL;
+    }
+    format = view.format ? view.format : "B";
+    if (format[0] == '@' || format[0] == '=') {
+        format++;
+    }
+    if (format[0] == '\0' || format[1] != '\0' ||
+        !strchr(MANY_PARAM_FORMATS, format[0])) {
+        PyErr_Format(PyExc_ValueError,
+                     "params buffer format must be one of 'h', 'i', 'l', "
+                     "'q', 'f' or 'd', not '%s'",
+                     format);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    /* With '=' the items have the standard sizes of the struct module,
+     * which the native C types don't always have */
+    if (view.itemsize != many_param_size(format[0])) {
+        PyErr_Format(PyExc_ValueError,
+                     "params buffer items of format '%s' must be %zd bytes, "
+                     "not %zd",
+                     view.format, many_param_size(format[0]), view.itemsize);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    if ((view.len / view.itemsize) % k != 0 ||
+        (view.ndim > 1 && view.shape[view.ndim - 1] != k)) {
+        PyErr_Format(PyExc_ValueError,
+                     "params buffer must hold %d numbers for each %s", k,
+                     kindname);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    num_shapes = view.len / view.itemsize / k;
+
+    /* Map all the colors first, so nothing is drawn if one is invalid */
+    if (!pg_MappedColorFromObj(colorobj, surf, &color, PG_COLOR_HANDLE_ALL)) {
+        PyErr_Clear();
+        if (!PySequence_Check(colorobj) ||
+            PySequence_Size(colorobj) != num_shapes) {
+            PyErr_Format(PyExc_TypeError,
+                         "color argument must be a color or a sequence of "
+                         "colors, one for each of the %zd shapes",
+                         num_shapes);
+            PyBuffer_Release(&view);
+            return NULL;
+        }
+        colors = PyMem_New(Uint32, MAX(num_shapes, 1));
+        if (colors == NULL) {
+            PyBuffer_Release(&view);
+            return PyErr_NoMemory();
+        }
+        for (i = 0; i < num_shapes && result; i++) {
+            if (!(item = PySequence_GetItem(colorobj, i))) {
+                result = 0;
+                break;
+            }
+            result = pg_MappedColorFromObj(item, surf, &colors[i],
+                                           PG_COLOR_HANDLE_ALL);
+            Py_DECREF(item);
+        }
+        if (!result) {
+            PyMem_Free(colors);
+            PyBuffer_Release(&view);
+            return NULL;
+        }
+    }
+
+    if (!pgSurface_Lock(surfobj)) {
+        PyMem_Free(colors);
+        PyBuffer_Release(&view);
+        return RAISE(PyExc_RuntimeError, "error locking surface");
+    }
+
+    for (i = 0; i < num_shapes; i++) {
+        Py_ssize_t p = i * k;
+        Uint32 shape_color = colors ? colors[i] : color;
+
+        switch (kind) {
+            case MANY_LINE:
+                if (width < 1) {
+                    break;
+                }
+                draw_line_width(surf, surf_clip_rect, shape_color,
+                                many_int_param(view.buf, format[0], p),
+                                many_int_param(view.buf, format[0], p + 1),
+                                many_int_param(view.buf, format[0], p + 2),
+                                many_int_param(view.buf, format[0], p + 3),
+                                width, drawn_area);
+                break;
+
+            case MANY_AALINE: {
+                float startx = (float)many_param(view.buf, format[0], p);
+                float starty = (float)many_param(view.buf, format[0], p + 1);
+                float endx = (float)many_param(view.buf, format[0], p + 2);
+                float endy = (float)many_param(view.buf, format[0], p + 3);
+
+                if (width > 1) {
+                    draw_aaline_width(surf, surf_clip_rect, surf_format,
+                                      shape_color, startx, starty, endx, endy,
+                                      width, drawn_area);
+                }
+                else {
+                    draw_aaline(surf, surf_clip_rect, surf_format,
+                                shape_color, startx, starty, endx, endy,
+                                drawn_area, 0, 0, 0);
+                }
+                break;
+            }
+
+            case MANY_RECT: {
+                SDL_Rect sdlrect, clipped;
+                int y;
+
+                sdlrect.x = many_int_param(view.buf, format[0], p);
+                sdlrect.y = many_int_param(view.buf, format[0], p + 1);
+                sdlrect.w = many_int_param(view.buf, format[0], p + 2);
+                sdlrect.h = many_int_param(view.buf, format[0], p + 3);
+                if (width < 0 ||
+                    !SDL_IntersectRect(&sdlrect, &surf_clip_rect, &clipped)) {
+                    break;
+                }
+                /* Same as rect() without a border radius */
+                if (width > 0 && (width * 2) < clipped.w &&
+                    (width * 2) < clipped.h) {
+                    draw_rect(surf, surf_clip_rect, sdlrect.x, sdlrect.y,
+                              sdlrect.x + sdlrect.w - 1,
+                              sdlrect.y + sdlrect.h - 1, width, shape_color);
+                }
+                else {
+                    for (y = clipped.y; y < clipped.y + clipped.h; y++) {
+                        drawhorzline(surf, shape_color, clipped.x, y,
+                                     clipped.x + clipped.w - 1);
+                    }
+                }
+                add_line_to_drawn_list(clipped.x, clipped.y,
+                                       clipped.x + clipped.w - 1,
+                                       clipped.y + clipped.h - 1, drawn_area);
+                break;
+            }
+
+            default: /* MANY_CIRCLE */ {
+                int posx = many_int_param(view.buf, format[0], p);
+                int posy = many_int_param(view.buf, format[0], p + 1);
+                int radius = many_int_param(view.buf, format[0], p + 2);
+                int circle_width = MIN(width, radius);
+
+                /* Same as circle() without quadrants */
+                if (radius < 1 || width < 0 ||
+                    posx > surf_clip_rect.x + surf_clip_rect.w + radius ||
+                    posx < surf_clip_rect.x - radius ||
+                    posy > surf_clip_rect.y + surf_clip_rect.h + radius ||
+                    posy < surf_clip_rect.y - radius) {
+                    break;
+                }
+                if (!circle_width || circle_width == radius) {
+                    draw_circle_filled(surf, surf_clip_rect, posx, posy,
+                                       radius, shape_color, drawn_area);
+                }
+                else if (circle_width == 1) {
+                    draw_circle_bresenham_thin(surf, surf_clip_rect, posx,
+                                               posy, radius, shape_color,
+                                               drawn_area);
+                }
+                else {
+                    draw_circle_bresenham(surf, surf_clip_rect, posx, posy,
+                                          radius, circle_width, shape_color,
+                                          drawn_area);
+                }
+                break;
+            }
+        }
+    }
+
+    PyMem_Free(colors);
+
+    if (!pgSurface_Unlock(surfobj)) {
+        PyBuffer_Release(&view);
+        return RAISE(PyExc_RuntimeError, "error unlocking surface");
+    }
+
+    if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
+        drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
+        PyBuffer_Release(&view);
+        return pgRect_New4(drawn_area[0], drawn_area[1],
+                           drawn_area[2] - drawn_area[0] + 1,
+                           drawn_area[3] - drawn_area[1] + 1);
     }
+    else if (num_shapes) {
+        int x = many_int_param(view.buf, format[0], 0);
+        int y = many_int_param(view.buf, format[0], 1);
+
+        PyBuffer_Release(&view);
+        return pgRect_New4(x, y, 0, 0);
+    }
+    PyBuffer_Release(&view);
+    return pgRect_New4(0, 0, 0, 0);
+}
+
+/* Functions used in drawing algorithms */
+
+static void
+swap(float *a, float *b)
+{
+    float temp = *a;
+    *a = *b;
+    *b = temp;
 }
 
 static int
@@ -1838,20 +2486,63 @@ draw_aaline(SDL_Surface *surf, SDL_Rect surf_clip_rect,
     }
 }
 
+#if DRAW_SIMD
+#define DRAW_SIMD_NONE 0
+#define DRAW_SIMD_SSE2 1
+#define DRAW_SIMD_AVX2 2
+
+/* Spans shorter than this many bytes are not worth building a pattern */
+#define DRAW_SIMD_MIN_SPAN 32
+
+/* The best span kernels the CPU supports, looked up on first use */
+static int
+draw_simd_backend(void)
+{
+    static int backend = -1;
+
+    if (backend < 0) {
+        if (_pg_draw_has_avx2()) {
+            backend = DRAW_SIMD_AVX2;
+        }
+        else if (_pg_draw_HasSSE_NEON()) {
+            backend = DRAW_SIMD_SSE2;
+        }
+        else {
+            backend = DRAW_SIMD_NONE;
+        }
+    }
+    return backend;
+}
+#endif /* DRAW_SIMD */
+
 static void
 drawhorzline(SDL_Surface *surf, Uint32 color, int x1, int y1, int x2)
 {
     Uint8 *pixel, *end;
+    int bpp = PG_SURF_BytesPerPixel(surf);
 
     pixel = ((Uint8 *)surf->pixels) + surf->pitch * y1;
-    end = pixel + x2 * PG_SURF_BytesPerPixel(surf);
-    pixel += x1 * PG_SURF_BytesPerPixel(surf);
-    switch (PG_SURF_BytesPerPixel(surf)) {
-        case 1:
-            for (; pixel <= end; ++pixel) {
-                *pixel = (Uint8)color;
-            }
-            break;
+    end = pixel + x2 * bpp;
+    pixel += x1 * bpp;
+
+    if (bpp == 1) {
+        memset(pixel, (Uint8)color, x2 - x1 + 1);
+        return;
+    }
+#if DRAW_SIMD
+    if ((x2 - x1 + 1) * bpp >= DRAW_SIMD_MIN_SPAN) {
+        switch (draw_simd_backend()) {
+            case DRAW_SIMD_AVX2:
+                draw_span_fill_avx2(pixel, bpp, x2 - x1 + 1, color);
+                return;
+            case DRAW_SIMD_SSE2:
+                draw_span_fill_sse2(pixel, bpp, x2 - x1 + 1, color);
+                return;
+        }
+    }
+#endif /* DRAW_SIMD */
+
+    switch (bpp) {
         case 2:
             for (; pixel <= end; pixel += 2) {
                 *(Uint16 *)pixel = (Uint16)color;
@@ -2043,8 +2734,10 @@ draw_filltri(SDL_Surface *surf, SDL_Rect surf_clip_rect, int *xlist,
     float d1 = (float)((p2x - p0x) / ((p2y - p0y) + 1e-17));
     float d2 = (float)((p1x - p0x) / ((p1y - p0y) + 1e-17));
     float d3 = (float)((p2x - p1x) / ((p2y - p1y) + 1e-17));
-    int y;
-    for (y = p0y; y <= p2y; y++) {
+    /* Rows outside the clip area would not draw anything */
+    int y = MAX(p0y, surf_clip_rect.y);
+    int y_end = MIN(p2y, surf_clip_rect.y + surf_clip_rect.h - 1);
+    for (; y <= y_end; y++) {
         int x1 = p0x + (int)((y - p0y) * d1);
 
         int x2;
@@ -2446,239 +3139,572 @@ draw_aaline_width(SDL_Surface *surf, SDL_Rect surf_clip_rect,
     }
 }
 
-/* Algorithm modified from
- * https://rosettacode.org/wiki/Bitmap/Bresenham%27s_line_algorithm
- */
+/* Draws the 1 pixel wide antialiased segments of a polyline through the
+ * given points, taking care of the pixels where they meet */
 static void
-draw_line(SDL_Surface *surf, SDL_Rect surf_clip_rect, int x1, int y1, int x2,
-          int y2, Uint32 color, int *drawn_area)
+draw_aalines(SDL_Surface *surf, SDL_Rect surf_clip_rect,
+             PG_PixelFormat *surf_format, Uint32 color, float *xlist,
+             float *ylist, Py_ssize_t length, int closed, int *drawn_area)
 {
-    int dx, dy, err, e2, sx, sy;
-    if (x1 == x2 && y1 == y2) { /* Single point */
-        set_and_check_rect(surf, surf_clip_rect, x1, y1, color, drawn_area);
-        return;
-    }
-    if (y1 == y2) { /* Horizontal line */
-        dx = (x1 < x2) ? 1 : -1;
-        for (sx = 0; sx <= abs(x1 - x2); sx++) {
-            set_and_check_rect(surf, surf_clip_rect, x1 + dx * sx, y1, color,
-                               drawn_area);
-        }
+    float pts[4];
+    float pts_prev[4];
+    int extra_px;
+    int disable_endpoints;
+    int steep_prev;
+    int steep_curr;
+    Py_ssize_t loop;
 
-        return;
-    }
-    if (x1 == x2) { /* Vertical line */
-        dy = (y1 < y2) ? 1 : -1;
-        for (sy = 0; sy <= abs(y1 - y2); sy++) {
-            set_and_check_rect(surf, surf_clip_rect, x1, y1 + dy * sy, color,
-                               drawn_area);
-        }
-        return;
-    }
-    dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
-    dy = abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
-    err = (dx > dy ? dx : -dy) / 2;
-    while (x1 != x2 || y1 != y2) {
-        set_and_check_rect(surf, surf_clip_rect, x1, y1, color, drawn_area);
-        e2 = err;
-        if (e2 > -dx) {
-            err -= dy;
-            x1 += sx;
-        }
-        if (e2 < dy) {
-            err += dx;
-            y1 += sy;
-        }
-    }
-    set_and_check_rect(surf, surf_clip_rect, x2, y2, color, drawn_area);
-}
+    /* first line - if open, add endpoint pixels.*/
+    pts[0] = xlist[0];
+    pts[1] = ylist[0];
+    pts[2] = xlist[1];
+    pts[3] = ylist[1];
 
-#define SURF_GET_AT_FORMAT(p_color, p_surf, p_x, p_y, p_pixels, p_pix)       \
-    switch (PG_SURF_BytesPerPixel(p_surf)) {                                 \
-        case 1:                                                              \
-            p_color = (Uint32) *                                             \
-                      ((Uint8 *)(p_pixels) + (p_y) * p_surf->pitch + (p_x)); \
-            break;                                                           \
-        case 2:                                                              \
-            p_color =                                                        \
-                (Uint32) *                                                   \
-                ((Uint16 *)((p_pixels) + (p_y) * p_surf->pitch) + (p_x));    \
-            break;                                                           \
-        case 3:                                                              \
-            p_pix =                                                          \
-                ((Uint8 *)(p_pixels + (p_y) * p_surf->pitch) + (p_x) * 3);   \
-            p_color = (SDL_BYTEORDER == SDL_LIL_ENDIAN)                      \
-                          ? (p_pix[0]) + (p_pix[1] << 8) + (p_pix[2] << 16)  \
-                          : (p_pix[2]) + (p_pix[1] << 8) + (p_pix[0] << 16); \
-            break;                                                           \
-        default: /* case 4: */                                               \
-            p_color =                                                        \
-                *((Uint32 *)(p_pixels + (p_y) * p_surf->pitch) + (p_x));     \
-            break;                                                           \
+    /* Previous points.
+     * Used to compare previous and current line.*/
+    pts_prev[0] = pts[0];
+    pts_prev[1] = pts[1];
+    pts_prev[2] = pts[2];
+    pts_prev[3] = pts[3];
+    steep_prev =
+        fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
+    steep_curr = fabs(xlist[2] - pts[2]) < fabs(ylist[2] - pts[1]);
+    extra_px = steep_prev > steep_curr;
+    disable_endpoints =
+        !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
+    if (closed) {
+        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
+                    pts[2], pts[3], drawn_area, disable_endpoints,
+                    disable_endpoints, extra_px);
     }
-
-static int
-flood_fill_inner(SDL_Surface *surf, int x1, int y1, Uint32 new_color,
-                 SDL_Surface *pattern, int *drawn_area)
-{
-    // breadth first flood fill, like graph search
-    SDL_Rect cliprect;
-    size_t mask_idx;
-    if (!PG_GetSurfaceClipRect(surf, &cliprect)) {
-        PyErr_SetString(pgExc_SDLError, SDL_GetError());
-        return -1;
+    else {
+        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
+                    pts[2], pts[3], drawn_area, 0, disable_endpoints,
+                    extra_px);
     }
-    size_t frontier_bufsize = 8, frontier_size = 1, next_frontier_size = 0;
 
-    // Instead of a queue, we use two arrays and swap them between steps.
-    // This makes implementation easier, especially memory management.
-    struct point2d *frontier =
-        malloc(frontier_bufsize * sizeof(struct point2d));
-    if (frontier == NULL) {
-        PyErr_NoMemory();
-        return -1;
-    }
+    for (loop = 2; loop < length - 1; ++loop) {
+        pts[0] = xlist[loop - 1];
+        pts[1] = ylist[loop - 1];
+        pts[2] = xlist[loop];
+        pts[3] = ylist[loop];
 
-    struct point2d *frontier_next =
-        malloc(frontier_bufsize * sizeof(struct point2d));
+        /* Comparing previous and current line.
+         * If one is steep and other is not, extra pixel must be drawn.*/
+        steep_prev =
+            fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
+        steep_curr = fabs(pts[2] - pts[0]) < fabs(pts[3] - pts[1]);
+        extra_px = steep_prev != steep_curr;
+        disable_endpoints =
+            !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
+        pts_prev[0] = pts[0];
+        pts_prev[1] = pts[1];
+        pts_prev[2] = pts[2];
+        pts_prev[3] = pts[3];
+        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
+                    pts[2], pts[3], drawn_area, disable_endpoints,
+                    disable_endpoints, extra_px);
+    }
 
-    if (frontier_next == NULL) {
-        free(frontier);
-        PyErr_NoMemory();
-        return -1;
+    /* Last line - if open, add endpoint pixels. */
+    pts[0] = xlist[length - 2];
+    pts[1] = ylist[length - 2];
+    pts[2] = xlist[length - 1];
+    pts[3] = ylist[length - 1];
+    steep_prev =
+        fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
+    steep_curr = fabs(pts[2] - pts[0]) < fabs(pts[3] - pts[1]);
+    extra_px = steep_prev != steep_curr;
+    disable_endpoints =
+        !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
+    pts_prev[0] = pts[0];
+    pts_prev[1] = pts[1];
+    pts_prev[2] = pts[2];
+    pts_prev[3] = pts[3];
+    if (closed) {
+        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
+                    pts[2], pts[3], drawn_area, disable_endpoints,
+                    disable_endpoints, extra_px);
+    }
+    else {
+        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
+                    pts[2], pts[3], drawn_area, disable_endpoints, 0,
+                    extra_px);
     }
 
-    // 2D bitmask for queued nodes
-    // we could check drawn color, but that doesnt work for patterns
-    size_t mask_size = (size_t)cliprect.w * (size_t)cliprect.h;
-    size_t mask_words = (mask_size + WORD_BITS - 1) / WORD_BITS;
-    unsigned int *mask = calloc(mask_words, sizeof(unsigned int));
+    if (closed && length > 2) {
+        pts[0] = xlist[length - 1];
+        pts[1] = ylist[length - 1];
+        pts[2] = xlist[0];
+        pts[3] = ylist[0];
+        steep_prev =
+            fabs(pts_prev[2] - pts_prev[0]) < fabs(pts_prev[3] - pts_prev[1]);
+        steep_curr = fabs(pts[2] - pts[0]) < fabs(pts[3] - pts[1]);
+        extra_px = steep_prev != steep_curr;
+        disable_endpoints =
+            !((roundf(pts[2]) == pts[2]) && (roundf(pts[3]) == pts[3]));
+        draw_aaline(surf, surf_clip_rect, surf_format, color, pts[0], pts[1],
+                    pts[2], pts[3], drawn_area, disable_endpoints,
+                    disable_endpoints, extra_px);
+    }
+}
 
-    if (mask == NULL) {
-        free(frontier);
-        free(frontier_next);
-        PyErr_NoMemory();
-        return -1;
+/* Algorithm modified from
+ * https://rosettacode.org/wiki/Bitmap/Bresenham%27s_line_algorithm
+ */
+static void
+draw_line(SDL_Surface *surf, SDL_Rect surf_clip_rect, int x1, int y1, int x2,
+          int y2, Uint32 color, int *drawn_area)
+{
+    int dx, dy, err, e2, sx, sy;
+    if (x1 == x2 && y1 == y2) { /* Single point */
+        set_and_check_rect(surf, surf_clip_rect, x1, y1, color, drawn_area);
+        return;
+    }
+    if (y1 == y2) { /* Horizontal line */
+        dx = (x1 < x2) ? 1 : -1;
+        for (sx = 0; sx <= abs(x1 - x2); sx++) {
+            set_and_check_rect(surf, surf_clip_rect, x1 + dx * sx, y1, color,
+                               drawn_area);
+        }
+
+        return;
+    }
+    if (x1 == x2) { /* Vertical line */
+        dy = (y1 < y2) ? 1 : -1;
+        for (sy = 0; sy <= abs(y1 - y2); sy++) {
+            set_and_check_rect(surf, surf_clip_rect, x1, y1 + dy * sy, color,
+                               drawn_area);
+        }
+        return;
+    }
+    dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
+    dy = abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
+    err = (dx > dy ? dx : -dy) / 2;
+    while (x1 != x2 || y1 != y2) {
+        set_and_check_rect(surf, surf_clip_rect, x1, y1, color, drawn_area);
+        e2 = err;
+        if (e2 > -dx) {
+            err -= dy;
+            x1 += sx;
+        }
+        if (e2 < dy) {
+            err += dx;
+            y1 += sy;
+        }
     }
-    Uint32 old_color = 0;
-    Uint8 *pix;
+    set_and_check_rect(surf, surf_clip_rect, x2, y2, color, drawn_area);
+}
 
-    // Von Neumann neighbourhood
-    int VN_X[] = {0, 0, 1, -1};
-    int VN_Y[] = {1, -1, 0, 0};
+/* Seed of the scanline flood fill: the pixels x1 to x2 of row y are next to
+ * a run filled in row y - dy, the filled pixels of row y spreading from them
+ * are still to be found. */
+typedef struct {
+    int y, x1, x2, dy;
+} pg_ff_seed;
+
+/* The runs filled so far in a row, as sorted first, last pairs. */
+typedef struct {
+    int *runs;
+    int num_runs, size;
+} pg_ff_row;
+
+typedef struct {
+    SDL_Rect clip;
+    PG_PixelFormat *format;
+    SDL_Palette *palette;
+    int bpp;
+    Uint32 target;
+    int tolerance;
+    Uint8 rgba[4];
+    int byte_channels;
+    /* Only kept if filled pixels can still match the target, NULL if the
+     * fill itself tells them apart. */
+    pg_ff_row *rows;
+    pg_ff_seed *seeds;
+    int num_seeds, seeds_size;
+} pg_flood_fill;
 
-    if (!(x1 >= cliprect.x && x1 < (cliprect.x + cliprect.w) &&
-          y1 >= cliprect.y && y1 < (cliprect.y + cliprect.h))) {
-        // not an error, but nothing to do here
-        goto flood_fill_finished;
+static Uint32
+ff_get_pixel(const Uint8 *row, int bpp, int x)
+{
+    const Uint8 *pix;
+
+    switch (bpp) {
+        case 1:
+            return row[x];
+        case 2:
+            return ((const Uint16 *)row)[x];
+        case 3:
+            pix = row + x * 3;
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            return pix[0] + (pix[1] << 8) + (pix[2] << 16);
+#else
+            return pix[2] + (pix[1] << 8) + (pix[0] << 16);
+#endif
+        default: /* case 4: */
+            return ((const Uint32 *)row)[x];
     }
+}
 
-    SURF_GET_AT_FORMAT(old_color, surf, x1, y1, (Uint8 *)surf->pixels, pix);
+/* Returns 1 if pixel is close enough to the target color to be filled */
+static int
+ff_match_pixel(pg_flood_fill *ff, Uint32 pixel)
+{
+    Uint8 rgba[4];
+    int i;
 
-    if (pattern == NULL && old_color == new_color) {
-        // not an error, but nothing to do here
-        goto flood_fill_finished;
+    if (pixel == ff->target) {
+        return 1;
     }
+    if (!ff->tolerance) {
+        return 0;
+    }
+    if (ff->byte_channels) {
+        rgba[0] = (Uint8)(pixel >> ff->format->Rshift);
+        rgba[1] = (Uint8)(pixel >> ff->format->Gshift);
+        rgba[2] = (Uint8)(pixel >> ff->format->Bshift);
+        rgba[3] = ff->format->Amask ? (Uint8)(pixel >> ff->format->Ashift)
+                                    : 255;
+    }
+    else {
+        PG_GetRGBA(pixel, ff->format, ff->palette, rgba, rgba + 1, rgba + 2,
+                   rgba + 3);
+    }
+    for (i = 0; i < 4; i++) {
+        if (abs(rgba[i] - ff->rgba[i]) > ff->tolerance) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int
+ff_match(pg_flood_fill *ff, const Uint8 *row, int x)
+{
+    return ff_match_pixel(ff, ff_get_pixel(row, ff->bpp, x));
+}
 
-    frontier[0].x = x1;
-    frontier[0].y = y1;
+/* Returns the last pixel from x on, up to last, that is part of the area
+ * to fill. Pixel x must be part of it. Exact matches of 4 byte pixels,
+ * the common case, are compared without unpacking the pixels. */
+static int
+ff_run_end(pg_flood_fill *ff, const Uint8 *row, int x, int last)
+{
+    const Uint32 *pixels = (const Uint32 *)row;
 
-    // mark starting point already queued
-    mask_idx = (y1 - cliprect.y) * cliprect.w + (x1 - cliprect.x);
-    _bitarray_set(mask, mask_idx, SDL_TRUE);
+    if (ff->bpp == 4 && !ff->tolerance) {
+        while (x < last && pixels[x + 1] == ff->target) {
+            x++;
+        }
+        return x;
+    }
+    while (x < last && ff_match(ff, row, x + 1)) {
+        x++;
+    }
+    return x;
+}
 
-    while (frontier_size != 0) {
-        next_frontier_size = 0;
+/* Same as ff_run_end(), going left down to first */
+static int
+ff_run_start(pg_flood_fill *ff, const Uint8 *row, int x, int first)
+{
+    const Uint32 *pixels = (const Uint32 *)row;
 
-        for (size_t i = 0; i < frontier_size; i++) {
-            unsigned int x = frontier[i].x;
-            unsigned int y = frontier[i].y;
+    if (ff->bpp == 4 && !ff->tolerance) {
+        while (x > first && pixels[x - 1] == ff->target) {
+            x--;
+        }
+        return x;
+    }
+    while (x > first && ff_match(ff, row, x - 1)) {
+        x--;
+    }
+    return x;
+}
 
-            Uint32 current_color = 0;
+/* Finds the pixels of row y not filled yet around x. Returns 0 if x itself
+ * is filled, setting *last to the end of its run, else 1 with *first and
+ * *last bounding the unfilled gap x lies in (clipped). */
+static int
+ff_unfilled_gap(pg_flood_fill *ff, int x, int y, int *first, int *last)
+{
+    pg_ff_row *row;
+    int lo = 0, hi, mid;
+
+    *first = ff->clip.x;
+    *last = ff->clip.x + ff->clip.w - 1;
+    if (ff->rows == NULL) {
+        return 1;
+    }
+    row = ff->rows + (y - ff->clip.y);
+    hi = row->num_runs;
+    /* First run ending at or after x */
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (row->runs[mid * 2 + 1] < x) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+    if (lo < row->num_runs && row->runs[lo * 2] <= x) {
+        *last = row->runs[lo * 2 + 1];
+        return 0;
+    }
+    if (lo > 0) {
+        *first = row->runs[lo * 2 - 1] + 1;
+    }
+    if (lo < row->num_runs) {
+        *last = row->runs[lo * 2] - 1;
+    }
+    return 1;
+}
 
-            SURF_GET_AT_FORMAT(current_color, surf, x, y,
-                               (Uint8 *)surf->pixels, pix);
+/* Records x1 to x2 of row y as filled, merging it with the runs it touches.
+ * The pixels must not be filled yet. Returns -1 if out of memory. */
+static int
+ff_add_run(pg_flood_fill *ff, int x1, int x2, int y)
+{
+    pg_ff_row *row = ff->rows + (y - ff->clip.y);
+    int i, merge_prev, merge_next;
+    int *runs;
 
-            if (current_color != old_color) {
-                continue;
-            }
+    for (i = 0; i < row->num_runs && row->runs[i * 2] < x1; i++) {
+    }
+    merge_prev = i > 0 && row->runs[i * 2 - 1] + 1 == x1;
+    merge_next = i < row->num_runs && row->runs[i * 2] == x2 + 1;
 
-            if (pattern != NULL) {
-                SURF_GET_AT_FORMAT(new_color, pattern, x % pattern->w,
-                                   y % pattern->h, (Uint8 *)pattern->pixels,
-                                   pix);
+    if (merge_prev && merge_next) {
+        row->runs[i * 2 - 1] = row->runs[i * 2 + 1];
+        memmove(row->runs + i * 2, row->runs + i * 2 + 2,
+                (row->num_runs - i - 1) * 2 * sizeof(int));
+        row->num_runs--;
+    }
+    else if (merge_prev) {
+        row->runs[i * 2 - 1] = x2;
+    }
+    else if (merge_next) {
+        row->runs[i * 2] = x1;
+    }
+    else {
+        if (row->num_runs == row->size) {
+            runs = row->runs;
+            row->size = row->size ? row->size * 2 : 4;
+            PyMem_Resize(runs, int, row->size * 2);
+            if (runs == NULL) {
+                return -1;
             }
+            row->runs = runs;
+        }
+        memmove(row->runs + i * 2 + 2, row->runs + i * 2,
+                (row->num_runs - i) * 2 * sizeof(int));
+        row->runs[i * 2] = x1;
+        row->runs[i * 2 + 1] = x2;
+        row->num_runs++;
+    }
+    return 0;
+}
 
-            // clipping and color mapping have already happened here
-            unsafe_set_at(surf, x, y, new_color);
-            add_pixel_to_drawn_list(x, y, drawn_area);
+/* Returns -1 if out of memory. Seeds off the clip rect are dropped. */
+static int
+ff_push_seed(pg_flood_fill *ff, int y, int x1, int x2, int dy)
+{
+    pg_ff_seed *seeds = ff->seeds;
 
-            for (int n = 0; n < 4; n++) {
-                long nx = x + VN_X[n];
-                long ny = y + VN_Y[n];
+    if (y < ff->clip.y || y >= ff->clip.y + ff->clip.h) {
+        return 0;
+    }
+    if (ff->num_seeds == ff->seeds_size) {
+        ff->seeds_size = ff->seeds_size ? ff->seeds_size * 2 : 64;
+        PyMem_Resize(seeds, pg_ff_seed, ff->seeds_size);
+        if (seeds == NULL) {
+            return -1;
+        }
+        ff->seeds = seeds;
+    }
+    ff->seeds[ff->num_seeds].y = y;
+    ff->seeds[ff->num_seeds].x1 = x1;
+    ff->seeds[ff->num_seeds].x2 = x2;
+    ff->seeds[ff->num_seeds].dy = dy;
+    ff->num_seeds++;
+    return 0;
+}
 
-                if (!(nx >= cliprect.x && nx < cliprect.x + cliprect.w &&
-                      ny >= cliprect.y && ny < cliprect.y + cliprect.h)) {
-                    continue;
-                }
+/* Copies the pattern, tiled from the surface origin, to x1 to x2 of row y */
+static void
+ff_pattern_span(SDL_Surface *surf, SDL_Surface *pattern, int x1, int x2,
+                int y)
+{
+    int bpp = PG_SURF_BytesPerPixel(surf);
+    Uint8 *dst = (Uint8 *)surf->pixels + y * surf->pitch;
+    Uint8 *src = (Uint8 *)pattern->pixels + (y % pattern->h) * pattern->pitch;
+    int x = x1, count;
 
-                mask_idx = (ny - cliprect.y) * cliprect.w + (nx - cliprect.x);
-                if (_bitarray_get(mask, mask_idx)) {
-                    continue;
-                }
+    while (x <= x2) {
+        count = MIN(pattern->w - x % pattern->w, x2 - x + 1);
+        memcpy(dst + x * bpp, src + (x % pattern->w) * bpp, count * bpp);
+        x += count;
+    }
+}
 
-                // only queue node once
-                _bitarray_set(mask, mask_idx, SDL_TRUE);
+/* Sets the bits x1 to x2 of row y in mask, a word at a time */
+static void
+ff_mask_span(bitmask_t *mask, int x1, int x2, int y)
+{
+    int word;
+    BITMASK_W bits;
 
-                if (next_frontier_size == frontier_bufsize) {
-                    // grow frontier arrays
-                    struct point2d *old_buf = frontier_next;
+    for (word = x1 / BITMASK_W_LEN; word <= x2 / BITMASK_W_LEN; word++) {
+        bits = ~(BITMASK_W)0;
+        if (word == x1 / BITMASK_W_LEN) {
+            bits &= ~(BITMASK_W)0 << (x1 & BITMASK_W_MASK);
+        }
+        if (word == x2 / BITMASK_W_LEN) {
+            bits &= ~(BITMASK_W)0 >>
+                    (BITMASK_W_LEN - 1 - (x2 & BITMASK_W_MASK));
+        }
+        mask->bits[word * mask->h + y] |= bits;
+    }
+}
 
-                    frontier_bufsize *= 4;
+/* Fills the area of pixels connected to (x1, y1) that match its color (to
+ * within tolerance per RGBA channel) with new_color, or the pattern if
+ * given, and sets their bits in mask if given. This is the span fill of
+ * Heckbert (Graphics Gems, 1990): every run of matching pixels is found
+ * and written whole, runs above and below are reached through seeds
+ * pushed on a stack, so memory grows with the number of pending runs
+ * rather than the size of the surface. Returns -1 with an exception set
+ * on error. */
+static int
+flood_fill_inner(SDL_Surface *surf, int x1, int y1, Uint32 new_color,
+                 SDL_Surface *pattern, int tolerance, bitmask_t *mask,
+                 int *drawn_area)
+{
+    pg_flood_fill ff;
+    pg_ff_seed seed;
+    Uint8 *row;
+    int x, y, first, last, start, end, i, result = 0;
 
-                    frontier_next =
-                        realloc(frontier_next,
-                                frontier_bufsize * sizeof(struct point2d));
-                    if (frontier_next == NULL) {
-                        free(mask);
-                        free(frontier);
-                        free(old_buf);
-                        PyErr_NoMemory();
-                        return -1;
-                    }
+    memset(&ff, 0, sizeof(ff));
+    if (!PG_GetSurfaceClipRect(surf, &ff.clip)) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return -1;
+    }
+    ff.format = PG_GetSurfaceFormat(surf);
+    ff.palette = PG_GetSurfacePalette(surf);
+    ff.bpp = PG_SURF_BytesPerPixel(surf);
+    ff.tolerance = tolerance;
+    if (ff.format == NULL) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return -1;
+    }
 
-                    old_buf = frontier;
-                    frontier = realloc(
-                        frontier, frontier_bufsize * sizeof(struct point2d));
-                    if (frontier == NULL) {
-                        free(old_buf);
-                        free(mask);
-                        free(frontier_next);
-                        PyErr_NoMemory();
-                        return -1;
-                    }
-                }
+    if (!(x1 >= ff.clip.x && x1 < (ff.clip.x + ff.clip.w) &&
+          y1 >= ff.clip.y && y1 < (ff.clip.y + ff.clip.h))) {
+        // not an error, but nothing to do here
+        return 0;
+    }
+
+    ff.target = ff_get_pixel((Uint8 *)surf->pixels + y1 * surf->pitch,
+                             ff.bpp, x1);
+    PG_GetRGBA(ff.target, ff.format, ff.palette, ff.rgba, ff.rgba + 1,
+               ff.rgba + 2, ff.rgba + 3);
+    ff.byte_channels = ff.bpp == 4 && PG_FORMAT_R_LOSS(ff.format) == 0 &&
+                       PG_FORMAT_G_LOSS(ff.format) == 0 &&
+                       PG_FORMAT_B_LOSS(ff.format) == 0 &&
+                       (!ff.format->Amask || PG_FORMAT_A_LOSS(ff.format) == 0);
+
+    /* Unless a pixel stops matching once filled, the filled runs have to
+     * be remembered to know where the fill has been. */
+    if (pattern != NULL || ff_match_pixel(&ff, new_color)) {
+        if (pattern == NULL && mask == NULL && !tolerance &&
+            new_color == ff.target) {
+            // not an error, but nothing to do here
+            return 0;
+        }
+        ff.rows = PyMem_New(pg_ff_row, ff.clip.h);
+        if (ff.rows == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memset(ff.rows, 0, ff.clip.h * sizeof(pg_ff_row));
+    }
+
+    /* Row y1 is scanned first, as if reached from below, then the row
+     * below it. */
+    if (ff_push_seed(&ff, y1 + 1, x1, x1, 1) ||
+        ff_push_seed(&ff, y1, x1, x1, -1)) {
+        result = -1;
+        goto flood_fill_finished;
+    }
 
-                frontier_next[next_frontier_size].x = nx;
-                frontier_next[next_frontier_size].y = ny;
-                next_frontier_size++;
+    while (ff.num_seeds) {
+        seed = ff.seeds[--ff.num_seeds];
+        y = seed.y;
+        row = (Uint8 *)surf->pixels + y * surf->pitch;
+
+        for (x = seed.x1; x <= seed.x2; x = end + 2) {
+            /* Find the next run starting at or after x */
+            if (!ff_unfilled_gap(&ff, x, y, &first, &last)) {
+                end = last - 1;
+                continue;
+            }
+            if (!ff_match(&ff, row, x)) {
+                end = x - 1;
+                continue;
+            }
+            /* Only the first run can extend past the left of the seed, the
+             * others start right after a pixel that does not match. */
+            start = x == seed.x1 ? ff_run_start(&ff, row, x, first) : x;
+            end = ff_run_end(&ff, row, x, last);
+
+            if (ff.rows != NULL && ff_add_run(&ff, start, end, y)) {
+                result = -1;
+                goto flood_fill_finished;
+            }
+            if (pattern != NULL) {
+                ff_pattern_span(surf, pattern, start, end, y);
+            }
+            else if (new_color != ff.target || ff.tolerance) {
+                drawhorzline(surf, new_color, start, y, end);
+            }
+            if (mask != NULL) {
+                ff_mask_span(mask, start, end, y);
+            }
+            add_pixel_to_drawn_list(start, y, drawn_area);
+            add_pixel_to_drawn_list(end, y, drawn_area);
+
+            /* Carry on past the run, and back where it overhangs the row
+             * the seed came from. */
+            if (ff_push_seed(&ff, y + seed.dy, start, end, seed.dy) ||
+                (start < seed.x1 &&
+                 ff_push_seed(&ff, y - seed.dy, start, seed.x1 - 1,
+                              -seed.dy)) ||
+                (end > seed.x2 &&
+                 ff_push_seed(&ff, y - seed.dy, seed.x2 + 1, end,
+                              -seed.dy))) {
+                result = -1;
+                goto flood_fill_finished;
             }
         }
-        // swap buffers
-        struct point2d *temp_buf;
-        temp_buf = frontier;
-        frontier = frontier_next;
-        frontier_next = temp_buf;
-
-        frontier_size = next_frontier_size;
     }
 
 flood_fill_finished:
-    free(frontier);
-    free(mask);
-    free(frontier_next);
-    return 0;
+    if (result == -1) {
+        PyErr_NoMemory();
+    }
+    if (ff.rows != NULL) {
+        for (i = 0; i < ff.clip.h; i++) {
+            PyMem_Free(ff.rows[i].runs);
+        }
+        PyMem_Free(ff.rows);
+    }
+    PyMem_Free(ff.seeds);
+    return result;
 }
+
 static int
 check_pixel_in_arc(int x, int y, double min_dotproduct, double invsqr_radius1,
                    double invsqr_radius2, double invsqr_inner_radius1,
@@ -3843,6 +4869,45 @@ draw_ellipse_thickness(SDL_Surface *surf, SDL_Rect surf_clip_rect, int x0,
     }
 }
 
+/* A non horizontal edge of a polygon, from (x1, y1) to (x2, y2) with
+ * y1 < y2. It is crossed by the scanlines y1 to y_last, see
+ * draw_fillpoly(). */
+typedef struct {
+    int x1, y1, x2, y2;
+    int y_last;
+    Py_ssize_t index; /* order of the edge in the polygon */
+} pg_poly_edge;
+
+static int
+compare_poly_edge(const void *a, const void *b)
+{
+    const pg_poly_edge *ea = (const pg_poly_edge *)a;
+    const pg_poly_edge *eb = (const pg_poly_edge *)b;
+
+    if (ea->y1 != eb->y1) {
+        return (ea->y1 > eb->y1) - (ea->y1 < eb->y1);
+    }
+    return (ea->index > eb->index) - (ea->index < eb->index);
+}
+
+static void
+sort_intersections(int *x, int n)
+{
+    int i, j, temp;
+
+    if (n > 16) {
+        qsort(x, n, sizeof(int), compare_int);
+        return;
+    }
+    for (i = 1; i < n; i++) {
+        temp = x[i];
+        for (j = i; j > 0 && x[j - 1] > temp; j--) {
+            x[j] = x[j - 1];
+        }
+        x[j] = temp;
+    }
+}
+
 static void
 draw_fillpoly(SDL_Surface *surf, SDL_Rect surf_clip_rect, int *point_x,
               int *point_y, Py_ssize_t num_points, Uint32 color,
@@ -3853,17 +4918,16 @@ draw_fillpoly(SDL_Surface *surf, SDL_Rect surf_clip_rect, int *point_x,
      * num_points : the number of points
      */
     Py_ssize_t i, i_previous;  // i_previous is the index of the point before i
-    int y, miny, maxy;
-    int x1, y1;
-    int x2, y2;
+    Py_ssize_t num_edges = 0, num_active = 0, next_edge = 0;
+    int y, miny, maxy, y_end;
     float intersect;
+    pg_poly_edge *edges, *edge;
+    /* active are the edges crossed by the current scanline, in the order
+     * of the polygon */
+    pg_poly_edge **active;
     /* x_intersect are the x-coordinates of intersections of the polygon
      * with some horizontal line */
-    int *x_intersect = PyMem_New(int, num_points);
-    if (x_intersect == NULL) {
-        PyErr_NoMemory();
-        return;
-    }
+    int *x_intersect;
 
     /* Determine Y maxima */
     miny = point_y[0];
@@ -3885,55 +4949,101 @@ draw_fillpoly(SDL_Surface *surf, SDL_Rect surf_clip_rect, int *point_x,
         }
         drawhorzlineclipbounding(surf, surf_clip_rect, color, minx, miny, maxx,
                                  drawn_area);
+        return;
+    }
+
+    edges = PyMem_New(pg_poly_edge, num_points);
+    active = PyMem_New(pg_poly_edge *, num_points);
+    x_intersect = PyMem_New(int, num_points);
+    if (edges == NULL || active == NULL || x_intersect == NULL) {
+        PyMem_Free(edges);
+        PyMem_Free(active);
         PyMem_Free(x_intersect);
+        PyErr_NoMemory();
         return;
     }
 
+    /* Build the edge table, sorted by the first scanline of each edge.
+     * Horizontal edges have to be handled as special case (below). */
+    for (i = 0; (i < num_points); i++) {
+        i_previous = ((i) ? (i - 1) : (num_points - 1));
+        if (point_y[i_previous] == point_y[i]) {
+            continue;
+        }
+        edge = &edges[num_edges++];
+        if (point_y[i_previous] < point_y[i]) {
+            edge->x1 = point_x[i_previous];
+            edge->y1 = point_y[i_previous];
+            edge->x2 = point_x[i];
+            edge->y2 = point_y[i];
+        }
+        else {
+            edge->x1 = point_x[i];
+            edge->y1 = point_y[i];
+            edge->x2 = point_x[i_previous];
+            edge->y2 = point_y[i_previous];
+        }
+        // the lower end is excluded, unless it is on the lowest line (maxy)
+        edge->y_last = (edge->y2 == maxy) ? maxy : edge->y2 - 1;
+        edge->index = i;
+    }
+    qsort(edges, num_edges, sizeof(pg_poly_edge), compare_poly_edge);
+
     /* Draw, scanning y
      * ----------------
      * The algorithm uses a horizontal line (y) that moves from top to the
-     * bottom of the polygon:
+     * bottom of the polygon, only over the rows of the clip area:
      *
-     * 1. search intersections with the border lines
-     * 2. sort intersections (x_intersect)
+     * 1. add the edges starting on this line to the active edges, and drop
+     *    the ones that ended above it
+     * 2. find the intersections with the active edges and sort them
+     *    (x_intersect)
      * 3. each two x-coordinates in x_intersect are then inside the polygon
-     *    (draw line for a pair of two such points)
+     *    (draw a span for a pair of two such points)
      */
-    for (y = miny; (y <= maxy); y++) {
+    y = MAX(miny, surf_clip_rect.y);
+    y_end = MIN(maxy, surf_clip_rect.y + surf_clip_rect.h - 1);
+    for (; (y <= y_end); y++) {
         // n_intersections is the number of intersections with the polygon
         int n_intersections = 0;
-        for (i = 0; (i < num_points); i++) {
-            i_previous = ((i) ? (i - 1) : (num_points - 1));
-
-            y1 = point_y[i_previous];
-            y2 = point_y[i];
-            if (y1 < y2) {
-                x1 = point_x[i_previous];
-                x2 = point_x[i];
+        Py_ssize_t n_kept = 0;
+
+        for (; next_edge < num_edges && edges[next_edge].y1 <= y;
+             next_edge++) {
+            edge = &edges[next_edge];
+            if (edge->y_last < y) {
+                continue;  // entirely above the clip area
             }
-            else if (y1 > y2) {
-                y2 = point_y[i_previous];
-                y1 = point_y[i];
-                x2 = point_x[i_previous];
-                x1 = point_x[i];
+            /* keep the active edges in the order of the polygon, the
+             * rounding of each intersection depends on it */
+            for (i = num_active; i > 0 && active[i - 1]->index > edge->index;
+                 i--) {
+                active[i] = active[i - 1];
             }
-            else {  // y1 == y2 : has to be handled as special case (below)
+            active[i] = edge;
+            num_active++;
+        }
+
+        for (i = 0; (i < num_active); i++) {
+            edge = active[i];
+            if (edge->y_last < y) {
                 continue;
             }
-            if (((y >= y1) && (y < y2)) || ((y == maxy) && (y2 == maxy))) {
-                // add intersection if y crosses the edge (excluding the lower
-                // end), or when we are on the lowest line (maxy)
-                intersect = (y - y1) * (x2 - x1) / (float)(y2 - y1);
-                if (n_intersections % 2 == 0) {
-                    intersect = (float)floor(intersect);
-                }
-                else {
-                    intersect = (float)ceil(intersect);
-                }
-                x_intersect[n_intersections++] = (int)intersect + x1;
+            active[n_kept++] = edge;
+
+            intersect = (y - edge->y1) * (edge->x2 - edge->x1) /
+                        (float)(edge->y2 - edge->y1);
+            if (n_intersections % 2 == 0) {
+                intersect = (float)floor(intersect);
             }
+            else {
+                intersect = (float)ceil(intersect);
+            }
+            x_intersect[n_intersections++] = (int)intersect + edge->x1;
         }
-        qsort(x_intersect, n_intersections, sizeof(int), compare_int);
+        num_active = n_kept;
+
+        sort_intersections(x_intersect, n_intersections);
         for (i = 0; (i < n_intersections); i += 2) {
             drawhorzlineclipbounding(surf, surf_clip_rect, color,
                                      x_intersect[i], y, x_intersect[i + 1],
@@ -3959,6 +5069,8 @@ draw_fillpoly(SDL_Surface *surf, SDL_Rect surf_clip_rect, int *point_x,
                                      y, point_x[i_previous], drawn_area);
         }
     }
+    PyMem_Free(edges);
+    PyMem_Free(active);
     PyMem_Free(x_intersect);
 }
 
@@ -4116,6 +5228,931 @@ draw_round_rect(SDL_Surface *surf, SDL_Rect surf_clip_rect, int x1, int y1,
     }
 }
 
+/* The outline of a shape drawn with blend=True is kept as a list of edges
+ * in raster coordinates, where pixel (x, y) covers [x, x + 1) x [y, y + 1).
+ * Contours are closed by aa_close(), horizontal edges are dropped as they
+ * cover nothing. */
+static void
+aa_add_edge(pg_aa_path *path, float x1, float y1, float x2, float y2)
+{
+    pg_aa_edge *edges;
+    Py_ssize_t size;
+
+    if (y1 == y2 || path->failed) {
+        return;
+    }
+    if (path->num_edges == path->size) {
+        size = path->size ? path->size * 2 : 32;
+        edges = PyMem_Realloc(path->edges, size * sizeof(pg_aa_edge));
+        if (edges == NULL) {
+            path->failed = 1;
+            return;
+        }
+        path->edges = edges;
+        path->size = size;
+    }
+    edges = path->edges + path->num_edges++;
+    edges->x1 = x1;
+    edges->y1 = y1;
+    edges->x2 = x2;
+    edges->y2 = y2;
+}
+
+static void
+aa_close(pg_aa_path *path)
+{
+    if (path->in_contour) {
+        aa_add_edge(path, path->last_x, path->last_y, path->start_x,
+                    path->start_y);
+        path->in_contour = 0;
+    }
+}
+
+static void
+aa_move_to(pg_aa_path *path, float x, float y)
+{
+    aa_close(path);
+    path->start_x = path->last_x = x;
+    path->start_y = path->last_y = y;
+    path->in_contour = 1;
+}
+
+static void
+aa_line_to(pg_aa_path *path, float x, float y)
+{
+    aa_add_edge(path, path->last_x, path->last_y, x, y);
+    path->last_x = x;
+    path->last_y = y;
+}
+
+/* Closes the current contour and flips all edges added since edge first,
+ * so the area they outline is cut out of the shape instead. */
+static void
+aa_reverse_from(pg_aa_path *path, Py_ssize_t first)
+{
+    Py_ssize_t i;
+    float temp;
+
+    aa_close(path);
+    for (i = first; i < path->num_edges; i++) {
+        temp = path->edges[i].x1;
+        path->edges[i].x1 = path->edges[i].x2;
+        path->edges[i].x2 = temp;
+        temp = path->edges[i].y1;
+        path->edges[i].y1 = path->edges[i].y2;
+        path->edges[i].y2 = temp;
+    }
+}
+
+/* Continues the contour along an arc of the circle around (cx, cy), from
+ * angle start to stop (clockwise on the surface). The segments stray at
+ * most a twentieth of a pixel from the circle. */
+static void
+aa_arc_to(pg_aa_path *path, double cx, double cy, double radius,
+          double start, double stop)
+{
+    double full_steps = 8, angle;
+    int i, steps;
+
+    if (radius > 0.05) {
+        full_steps = MAX(8, ceil(M_PI / acos(1 - 0.05 / radius)));
+    }
+    steps = (int)ceil(MIN(full_steps, 16384) * fabs(stop - start) /
+                      (2 * M_PI));
+    steps = MAX(steps, 1);
+    for (i = 0; i <= steps; i++) {
+        angle = start + (stop - start) * i / steps;
+        aa_line_to(path, (float)(cx + radius * cos(angle)),
+                   (float)(cy + radius * sin(angle)));
+    }
+}
+
+/* Adds a line between the pixel centers of (x1, y1) and (x2, y2) as a
+ * rectangle of the given width. Its ends are pushed out by half a pixel to
+ * cover the end pixels, like draw_line_width does. All lines are outlined
+ * in the same direction, so overlapping lines are drawn once. */
+static void
+aa_add_line(pg_aa_path *path, float x1, float y1, float x2, float y2,
+            float width)
+{
+    float dx = x2 - x1, dy = y2 - y1;
+    float length = sqrtf(dx * dx + dy * dy), nx, ny;
+
+    if (length == 0) {
+        dx = 1;
+        dy = 0;
+    }
+    else {
+        dx /= length;
+        dy /= length;
+    }
+    nx = -dy * width / 2;
+    ny = dx * width / 2;
+    x1 += 0.5f - dx / 2;
+    y1 += 0.5f - dy / 2;
+    x2 += 0.5f + dx / 2;
+    y2 += 0.5f + dy / 2;
+
+    aa_move_to(path, x1 + nx, y1 + ny);
+    aa_line_to(path, x2 + nx, y2 + ny);
+    aa_line_to(path, x2 - nx, y2 - ny);
+    aa_line_to(path, x1 - nx, y1 - ny);
+    aa_close(path);
+}
+
+/* Adds the outline of the rect with rounded corners (a radius of 0 is a
+ * square corner). */
+static void
+aa_add_round_rect(pg_aa_path *path, float x, float y, float w, float h,
+                  float top_left, float top_right, float bottom_left,
+                  float bottom_right)
+{
+    aa_move_to(path, x + top_left, y);
+    aa_arc_to(path, x + w - top_right, y + top_right, top_right, -M_PI / 2,
+              0);
+    aa_arc_to(path, x + w - bottom_right, y + h - bottom_right, bottom_right,
+              0, M_PI / 2);
+    aa_arc_to(path, x + bottom_left, y + h - bottom_left, bottom_left,
+              M_PI / 2, M_PI);
+    aa_arc_to(path, x + top_left, y + top_left, top_left, M_PI,
+              3 * M_PI / 2);
+    aa_close(path);
+}
+
+/* Adds a circle around (x0, y0), or a ring if width is less than the
+ * radius. Like draw_circle_quadrant, only the quadrants asked for are drawn
+ * if any is. */
+static void
+aa_add_circle(pg_aa_path *path, float x0, float y0, float radius,
+              float width, int top_right, int top_left, int bottom_left,
+              int bottom_right)
+{
+    /* Start angles of the quadrants, in the order of the arguments */
+    static const double starts[4] = {-M_PI / 2, M_PI, M_PI / 2, 0};
+    int quadrants[4] = {top_right, top_left, bottom_left, bottom_right};
+    float inner = width > 0 && width < radius ? radius - width : 0;
+    Py_ssize_t first;
+    int i;
+
+    if (!top_right && !top_left && !bottom_left && !bottom_right) {
+        aa_move_to(path, x0 + radius, y0);
+        aa_arc_to(path, x0, y0, radius, 0, 2 * M_PI);
+        if (inner > 0) {
+            aa_close(path);
+            first = path->num_edges;
+            aa_move_to(path, x0 + inner, y0);
+            aa_arc_to(path, x0, y0, inner, 0, 2 * M_PI);
+            aa_reverse_from(path, first);
+        }
+        aa_close(path);
+        return;
+    }
+
+    for (i = 0; i < 4; i++) {
+        if (!quadrants[i]) {
+            continue;
+        }
+        aa_move_to(path, (float)(x0 + radius * cos(starts[i])),
+                   (float)(y0 + radius * sin(starts[i])));
+        aa_arc_to(path, x0, y0, radius, starts[i], starts[i] + M_PI / 2);
+        if (inner > 0) {
+            aa_arc_to(path, x0, y0, inner, starts[i] + M_PI / 2, starts[i]);
+        }
+        else {
+            aa_line_to(path, x0, y0);
+        }
+        aa_close(path);
+    }
+}
+
+/* Longest miter, as a multiple of the width, before a miter joint is
+ * beveled instead. This is the default miter limit of SVG. */
+#define AA_MITER_LIMIT 4.0f
+
+/* Adds the joint between a segment going along (dx0, dy0) and the next
+ * one going along (dx1, dy1) (unit vectors) at (x, y). Only the wedge on
+ * the outer side of the turn is added, the segments already overlap on
+ * the inner side. */
+static void
+aa_add_joint(pg_aa_path *path, float x, float y, float dx0, float dy0,
+             float dx1, float dy1, float half, int joint)
+{
+    float cross = dx0 * dy1 - dy0 * dx1, dot = dx0 * dx1 + dy0 * dy1;
+    float side = cross > 0 ? -half : half, ax, ay, bx, by;
+    double start, sweep;
+    Py_ssize_t first;
+
+    /* Outer corners of the two segments */
+    ax = x - dy0 * side;
+    ay = y + dx0 * side;
+    bx = x - dy1 * side;
+    by = y + dx1 * side;
+
+    if (joint != JOINT_ROUND && cross == 0) {
+        /* Straight on, or turning back with nothing to fill */
+        return;
+    }
+
+    aa_close(path);
+    first = path->num_edges;
+    aa_move_to(path, x, y);
+    aa_line_to(path, ax, ay);
+    if (joint == JOINT_ROUND) {
+        start = atan2(ay - y, ax - x);
+        sweep = atan2(by - y, bx - x) - start;
+        if (sweep > M_PI) {
+            sweep -= 2 * M_PI;
+        }
+        else if (sweep < -M_PI) {
+            sweep += 2 * M_PI;
+        }
+        aa_arc_to(path, x, y, half, start, start + sweep);
+        cross = (float)sweep;
+    }
+    else {
+        if (joint == JOINT_MITER &&
+            1 + dot >= 2 / (AA_MITER_LIMIT * AA_MITER_LIMIT)) {
+            aa_line_to(path, x + (ax + bx - 2 * x) / (1 + dot),
+                       y + (ay + by - 2 * y) / (1 + dot));
+        }
+        aa_line_to(path, bx, by);
+    }
+    /* Outline it the way aa_add_line() outlines lines */
+    if (cross > 0) {
+        aa_reverse_from(path, first);
+    }
+    aa_close(path);
+}
+
+/* Adds the polyline through the pixel centers of the n points in xs, ys as
+ * one stroke of the given width, the segments meeting at joints of the
+ * given kind. Open ends are pushed out by half a pixel like aa_add_line()
+ * does. Repeated points are dropped from xs, ys. */
+static void
+aa_add_polyline(pg_aa_path *path, float *xs, float *ys, Py_ssize_t n,
+                int closed, float width, int joint)
+{
+    float half = width / 2, dx, dy, length, prev_dx = 0, prev_dy = 0;
+    float first_dx = 0, first_dy = 0, x1, y1, x2, y2;
+    Py_ssize_t i, m = 1, num_segments;
+
+    for (i = 1; i < n; i++) {
+        if (xs[i] != xs[m - 1] || ys[i] != ys[m - 1]) {
+            xs[m] = xs[i];
+            ys[m] = ys[i];
+            m++;
+        }
+    }
+    if (m > 1 && xs[m - 1] == xs[0] && ys[m - 1] == ys[0]) {
+        m--;
+        closed = 1;
+    }
+    if (m == 1) {
+        aa_add_line(path, xs[0], ys[0], xs[0], ys[0], width);
+        return;
+    }
+    closed = closed && m > 2;
+    num_segments = closed ? m : m - 1;
+
+    for (i = 0; i < num_segments; i++) {
+        x1 = xs[i] + 0.5f;
+        y1 = ys[i] + 0.5f;
+        x2 = xs[(i + 1) % m] + 0.5f;
+        y2 = ys[(i + 1) % m] + 0.5f;
+        dx = x2 - x1;
+        dy = y2 - y1;
+        length = sqrtf(dx * dx + dy * dy);
+        dx /= length;
+        dy /= length;
+
+        if (i > 0) {
+            aa_add_joint(path, x1, y1, prev_dx, prev_dy, dx, dy, half,
+                         joint);
+        }
+        else {
+            first_dx = dx;
+            first_dy = dy;
+        }
+        if (!closed && i == 0) {
+            x1 -= dx / 2;
+            y1 -= dy / 2;
+        }
+        if (!closed && i == num_segments - 1) {
+            x2 += dx / 2;
+            y2 += dy / 2;
+        }
+        aa_move_to(path, x1 - dy * half, y1 + dx * half);
+        aa_line_to(path, x2 - dy * half, y2 + dx * half);
+        aa_line_to(path, x2 + dy * half, y2 - dx * half);
+        aa_line_to(path, x1 + dy * half, y1 - dx * half);
+        aa_close(path);
+
+        prev_dx = dx;
+        prev_dy = dy;
+    }
+    if (closed) {
+        aa_add_joint(path, xs[0] + 0.5f, ys[0] + 0.5f, prev_dx, prev_dy,
+                     first_dx, first_dy, half, joint);
+    }
+}
+
+/* An edge clipped to the columns drawn, from top (x1, y1) to bottom
+ * (x2, y2). dir is the sign its coverage is added with. */
+typedef struct {
+    float x1, y1, x2, y2;
+    float dxdy, dir;
+} pg_aa_raster_edge;
+
+static int
+compare_aa_raster_edge(const void *a, const void *b)
+{
+    const pg_aa_raster_edge *ea = (const pg_aa_raster_edge *)a;
+    const pg_aa_raster_edge *eb = (const pg_aa_raster_edge *)b;
+
+    return (ea->y1 > eb->y1) - (ea->y1 < eb->y1);
+}
+
+static void
+aa_add_raster_edge(pg_aa_raster_edge *edges, Py_ssize_t *num_edges, float x1,
+                   float y1, float x2, float y2, float dir)
+{
+    pg_aa_raster_edge *edge;
+
+    if (y1 == y2) {
+        return;
+    }
+    edge = edges + (*num_edges)++;
+    if (y1 > y2) {
+        edge->x1 = x2;
+        edge->y1 = y2;
+        edge->x2 = x1;
+        edge->y2 = y1;
+        dir = -dir;
+    }
+    else {
+        edge->x1 = x1;
+        edge->y1 = y1;
+        edge->x2 = x2;
+        edge->y2 = y2;
+    }
+    edge->dxdy = (edge->x2 - edge->x1) / (edge->y2 - edge->y1);
+    edge->dir = dir;
+}
+
+/* Moves edge into columns [0, width], splitting it where it crosses the
+ * sides. The parts outside become vertical edges on the side: that covers
+ * the columns right of them the same way, which is all that matters. */
+static void
+aa_clip_edge(pg_aa_raster_edge *edges, Py_ssize_t *num_edges,
+             const pg_aa_edge *edge, float left, float width)
+{
+    float x1 = edge->x1 - left, y1 = edge->y1;
+    float x2 = edge->x2 - left, y2 = edge->y2;
+    float t[4], temp, xa, ya, xb, yb;
+    int i, n = 0;
+
+    t[n++] = 0;
+    if ((x1 < 0) != (x2 < 0)) {
+        t[n++] = -x1 / (x2 - x1);
+    }
+    if ((x1 > width) != (x2 > width)) {
+        t[n++] = (width - x1) / (x2 - x1);
+    }
+    if (n == 3 && t[1] > t[2]) {
+        temp = t[1];
+        t[1] = t[2];
+        t[2] = temp;
+    }
+    t[n++] = 1;
+
+    xa = x1;
+    ya = y1;
+    for (i = 1; i < n; i++) {
+        if (i == n - 1) {
+            xb = x2;
+            yb = y2;
+        }
+        else {
+            xb = x1 + (x2 - x1) * t[i];
+            yb = y1 + (y2 - y1) * t[i];
+        }
+        aa_add_raster_edge(edges, num_edges, MIN(MAX(xa, 0), width), ya,
+                           MIN(MAX(xb, 0), width), yb, 1);
+        xa = xb;
+        ya = yb;
+    }
+}
+
+/* Cells lo to hi of a row, changed by an edge */
+typedef struct {
+    int lo, hi;
+} pg_aa_span;
+
+/* Adds the coverage of the part of an edge within a single row, going
+ * from x1 to x2 and d pixels down (negative going up), to cells. Cell i
+ * gets the change in coverage from pixel i - 1 to pixel i, as in the
+ * accumulation rasterizer of font-rs. */
+static void
+aa_accumulate(float *cells, float x1, float x2, float d, pg_aa_span *span)
+{
+    float x_min = MIN(x1, x2), x_max = MAX(x1, x2);
+    float floor_min = floorf(x_min), ceil_max = ceilf(x_max);
+    int i_min = (int)floor_min, i_max = (int)ceil_max, i;
+    float f, s, f_min, a_min, f_max, a_max, a_next, a_last;
+
+    span->lo = i_min;
+    if (i_max <= i_min + 1) {
+        /* Within one pixel, split by the mean distance into it */
+        f = (x1 + x2) / 2 - floor_min;
+        cells[i_min] += d - d * f;
+        cells[i_min + 1] += d * f;
+        span->hi = i_min + 1;
+        return;
+    }
+
+    s = 1 / (x_max - x_min);
+    f_min = x_min - floor_min;
+    a_min = s * (1 - f_min) * (1 - f_min) / 2;
+    f_max = x_max - ceil_max + 1;
+    a_max = s * f_max * f_max / 2;
+    cells[i_min] += d * a_min;
+    if (i_max == i_min + 2) {
+        cells[i_min + 1] += d * (1 - a_min - a_max);
+    }
+    else {
+        a_next = s * (1.5f - f_min);
+        cells[i_min + 1] += d * (a_next - a_min);
+        for (i = i_min + 2; i < i_max - 1; i++) {
+            cells[i] += d * s;
+        }
+        a_last = a_next + (i_max - i_min - 3) * s;
+        cells[i_max - 1] += d * (1 - a_last - a_max);
+    }
+    cells[i_max] += d * a_max;
+    span->hi = i_max;
+}
+
+static int
+compare_aa_span(const void *a, const void *b)
+{
+    const pg_aa_span *sa = (const pg_aa_span *)a;
+    const pg_aa_span *sb = (const pg_aa_span *)b;
+
+    return (sa->lo > sb->lo) - (sa->lo < sb->lo);
+}
+
+/* Sorts the spans of a row and merges the overlapping ones, returns how
+ * many are left */
+static Py_ssize_t
+merge_aa_spans(pg_aa_span *spans, Py_ssize_t n)
+{
+    Py_ssize_t i, j, merged = 0;
+    pg_aa_span temp;
+
+    if (n == 0) {
+        return 0;
+    }
+    if (n > 16) {
+        qsort(spans, n, sizeof(pg_aa_span), compare_aa_span);
+    }
+    else {
+        for (i = 1; i < n; i++) {
+            temp = spans[i];
+            for (j = i; j > 0 && spans[j - 1].lo > temp.lo; j--) {
+                spans[j] = spans[j - 1];
+            }
+            spans[j] = temp;
+        }
+    }
+    for (i = 1; i < n; i++) {
+        if (spans[i].lo <= spans[merged].hi) {
+            spans[merged].hi = MAX(spans[merged].hi, spans[i].hi);
+        }
+        else {
+            spans[++merged] = spans[i];
+        }
+    }
+    return merged + 1;
+}
+
+/* Blends rgba into pixel (x, y) with the ALPHA_BLEND equation blits use,
+ * alpha replacing the color's own. */
+static void
+aa_blend_pixel(SDL_Surface *surf, PG_PixelFormat *surf_format,
+               SDL_Palette *palette, int x, int y, const Uint8 rgba[4],
+               Uint8 alpha)
+{
+    int bpp = PG_SURF_BytesPerPixel(surf);
+    Uint8 *pixels = (Uint8 *)surf->pixels + y * surf->pitch + x * bpp;
+    Uint32 pixel;
+    Uint8 r, g, b, a;
+    int dR, dG, dB, dA;
+
+    if (bpp == 1) {
+        pixel = *pixels;
+    }
+    else {
+        GET_PIXEL(pixel, bpp, pixels);
+    }
+    PG_GetRGBA(pixel, surf_format, palette, &r, &g, &b, &a);
+    dR = r;
+    dG = g;
+    dB = b;
+    dA = a;
+    ALPHA_BLEND(rgba[0], rgba[1], rgba[2], alpha, dR, dG, dB, dA);
+    unsafe_set_at(surf, x, y,
+                  PG_MapRGBA(surf_format, palette, (Uint8)dR, (Uint8)dG,
+                             (Uint8)dB, (Uint8)dA));
+}
+
+/* Blends rgba with alpha into pixels x1 to x2 of row y. simd_keep is the
+ * union of the channel masks if the span_blend kernels can be used on the
+ * surface, 0 otherwise. */
+static void
+aa_blend_span(SDL_Surface *surf, PG_PixelFormat *surf_format,
+              SDL_Palette *palette, int x1, int x2, int y,
+              const Uint8 rgba[4], Uint8 alpha, Uint32 simd_keep)
+{
+    int x;
+
+    if (alpha == 255) {
+        /* Blending an opaque color is writing it */
+        drawhorzline(surf,
+                     PG_MapRGBA(surf_format, palette, rgba[0], rgba[1],
+                                rgba[2], 255),
+                     x1, y, x2);
+        return;
+    }
+#if DRAW_SIMD
+    if (simd_keep && x2 - x1 >= 3) {
+        Uint32 *row =
+            (Uint32 *)((Uint8 *)surf->pixels + y * surf->pitch) + x1;
+        Uint32 color = PG_MapRGBA(surf_format, palette, rgba[0], rgba[1],
+                                  rgba[2], alpha);
+
+        switch (draw_simd_backend()) {
+            case DRAW_SIMD_AVX2:
+                draw_span_blend_avx2(row, x2 - x1 + 1, color, alpha,
+                                     surf_format->Amask, simd_keep);
+                return;
+            case DRAW_SIMD_SSE2:
+                draw_span_blend_sse2(row, x2 - x1 + 1, color, alpha,
+                                     surf_format->Amask, simd_keep);
+                return;
+            default:
+                break;
+        }
+    }
+#endif /* DRAW_SIMD */
+    for (x = x1; x <= x2; x++) {
+        aa_blend_pixel(surf, surf_format, palette, x, y, rgba, alpha);
+    }
+}
+
+static int
+aa_is_byte_mask(Uint32 mask)
+{
+    return mask == 0xFFu || mask == 0xFF00u || mask == 0xFF0000u ||
+           mask == 0xFF000000u;
+}
+
+/* Alpha to blend a pixel with from its accumulated coverage */
+#define AA_ALPHA(acc, alpha)                 \
+    (fabsf(acc) >= 1.0f ? (alpha)            \
+                        : (Uint8)(fabsf(acc) * (alpha) + 0.5f))
+
+/* Fills the shape outlined by path, blending rgba into every pixel by the
+ * fraction of it the shape covers. Rows are rasterized one at a time from
+ * the edges crossing them, overlapping parts of the shape are covered
+ * once. Only the cells the edges change are summed pixel by pixel, the
+ * coverage between them is constant and blended a span at a time. Returns
+ * -1 with an exception set if out of memory. */
+static int
+aa_fill_path(SDL_Surface *surf, SDL_Rect surf_clip_rect, pg_aa_path *path,
+             const Uint8 rgba[4], int *drawn_area)
+{
+    PG_PixelFormat *surf_format = PG_GetSurfaceFormat(surf);
+    SDL_Palette *palette = PG_GetSurfacePalette(surf);
+    pg_aa_raster_edge *edges, *edge, **active;
+    pg_aa_span *spans;
+    float min_x, max_x, min_y, max_y, *cells;
+    float y_top, y_bottom, x_top, x_bottom, acc;
+    Py_ssize_t i, num_edges = 0, num_active = 0, next_edge = 0, num_spans;
+    int left, right, top, bottom, width, x, y, span_end, gap_end;
+    Uint8 alpha;
+    Uint32 simd_keep = 0;
+
+    aa_close(path);
+    if (path->failed) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (path->num_edges == 0 || rgba[3] == 0 || surf_format == NULL) {
+        return 0;
+    }
+
+    min_x = max_x = path->edges[0].x1;
+    min_y = max_y = path->edges[0].y1;
+    for (i = 0; i < path->num_edges; i++) {
+        min_x = MIN(min_x, MIN(path->edges[i].x1, path->edges[i].x2));
+        max_x = MAX(max_x, MAX(path->edges[i].x1, path->edges[i].x2));
+        min_y = MIN(min_y, MIN(path->edges[i].y1, path->edges[i].y2));
+        max_y = MAX(max_y, MAX(path->edges[i].y1, path->edges[i].y2));
+    }
+    if (min_x >= surf_clip_rect.x + surf_clip_rect.w ||
+        max_x <= surf_clip_rect.x ||
+        min_y >= surf_clip_rect.y + surf_clip_rect.h ||
+        max_y <= surf_clip_rect.y) {
+        return 0;
+    }
+    left = min_x > surf_clip_rect.x ? (int)floorf(min_x) : surf_clip_rect.x;
+    right = max_x < surf_clip_rect.x + surf_clip_rect.w
+                ? (int)ceilf(max_x)
+                : surf_clip_rect.x + surf_clip_rect.w;
+    top = min_y > surf_clip_rect.y ? (int)floorf(min_y) : surf_clip_rect.y;
+    bottom = max_y < surf_clip_rect.y + surf_clip_rect.h
+                 ? (int)ceilf(max_y)
+                 : surf_clip_rect.y + surf_clip_rect.h;
+    width = right - left;
+
+    /* Each edge is split in at most three by clipping */
+    edges = PyMem_New(pg_aa_raster_edge, path->num_edges * 3);
+    active = PyMem_New(pg_aa_raster_edge *, path->num_edges * 3);
+    spans = PyMem_New(pg_aa_span, path->num_edges * 3);
+    cells = PyMem_New(float, width + 2);
+    if (edges == NULL || active == NULL || spans == NULL || cells == NULL) {
+        PyMem_Free(edges);
+        PyMem_Free(active);
+        PyMem_Free(spans);
+        PyMem_Free(cells);
+        PyErr_NoMemory();
+        return -1;
+    }
+    memset(cells, 0, (width + 2) * sizeof(float));
+
+    for (i = 0; i < path->num_edges; i++) {
+        aa_clip_edge(edges, &num_edges, path->edges + i, (float)left,
+                     (float)width);
+    }
+    qsort(edges, num_edges, sizeof(pg_aa_raster_edge),
+          compare_aa_raster_edge);
+
+    if (PG_SURF_BytesPerPixel(surf) == 4 &&
+        aa_is_byte_mask(surf_format->Rmask) &&
+        aa_is_byte_mask(surf_format->Gmask) &&
+        aa_is_byte_mask(surf_format->Bmask) &&
+        (!surf_format->Amask || aa_is_byte_mask(surf_format->Amask))) {
+        simd_keep = surf_format->Rmask | surf_format->Gmask |
+                    surf_format->Bmask | surf_format->Amask;
+    }
+
+    for (y = top; y < bottom; y++) {
+        while (next_edge < num_edges && edges[next_edge].y1 < y + 1) {
+            active[num_active++] = edges + next_edge++;
+        }
+
+        num_spans = 0;
+        for (i = 0; i < num_active;) {
+            edge = active[i];
+            if (edge->y2 <= y) {
+                active[i] = active[--num_active];
+                continue;
+            }
+            y_top = MAX(edge->y1, (float)y);
+            y_bottom = MIN(edge->y2, (float)(y + 1));
+            x_top = edge->x1 + (y_top - edge->y1) * edge->dxdy;
+            x_bottom = edge->x1 + (y_bottom - edge->y1) * edge->dxdy;
+            /* Rounding can step outside the columns */
+            x_top = MIN(MAX(x_top, 0), (float)width);
+            x_bottom = MIN(MAX(x_bottom, 0), (float)width);
+            aa_accumulate(cells, x_top, x_bottom,
+                          (y_bottom - y_top) * edge->dir, spans + num_spans++);
+            i++;
+        }
+        num_spans = merge_aa_spans(spans, num_spans);
+
+        acc = 0;
+        for (i = 0; i < num_spans; i++) {
+            span_end = MIN(spans[i].hi, width - 1);
+            for (x = spans[i].lo; x <= span_end; x++) {
+                acc += cells[x];
+                alpha = AA_ALPHA(acc, rgba[3]);
+                if (alpha) {
+                    aa_blend_pixel(surf, surf_format, palette, left + x, y,
+                                   rgba, alpha);
+                    add_pixel_to_drawn_list(left + x, y, drawn_area);
+                }
+            }
+            memset(cells + spans[i].lo, 0,
+                   (spans[i].hi - spans[i].lo + 1) * sizeof(float));
+
+            /* Nothing changes up to the next span, past the last one the
+             * contours have all been crossed back out */
+            if (i + 1 == num_spans) {
+                break;
+            }
+            gap_end = spans[i + 1].lo - 1;
+            alpha = AA_ALPHA(acc, rgba[3]);
+            if (alpha && x <= gap_end) {
+                aa_blend_span(surf, surf_format, palette, left + x,
+                              left + gap_end, y, rgba, alpha, simd_keep);
+                add_line_to_drawn_list(left + x, y, left + gap_end, y,
+                                       drawn_area);
+            }
+        }
+    }
+
+    PyMem_Free(edges);
+    PyMem_Free(active);
+    PyMem_Free(spans);
+    PyMem_Free(cells);
+    return 0;
+}
+
+/* Draws the shape outlined by path and frees the path */
+static int
+draw_aa_path(SDL_Surface *surf, SDL_Rect surf_clip_rect, pg_aa_path *path,
+             const Uint8 rgba[4], int *drawn_area)
+{
+    int result = aa_fill_path(surf, surf_clip_rect, path, rgba, drawn_area);
+
+    PyMem_Free(path->edges);
+    path->edges = NULL;
+    path->num_edges = path->size = 0;
+    return result;
+}
+
+/* First row at or below top whose middle edge may cross, bottom if it
+ * starts below the rows */
+#define FILL_PATH_FIRST_ROW(edge, top, bottom)                        \
+    ((int)MIN(MAX(ceilf((edge).y1 - 0.5f), (float)(top)), (float)(bottom)))
+
+/* An active edge of fill_path_aliased(), crossing the middle of the
+ * current row at x */
+typedef struct {
+    float x;
+    const pg_aa_raster_edge *edge;
+} pg_path_crossing;
+
+/* Fills the shape outlined by path with color, without antialiasing: the
+ * pixels whose centers are inside the shape (nonzero winding) are set,
+ * each row a span at a time. The edges are bucketed by the first row they
+ * cross, and the active edges kept in the order they cross the row, which
+ * barely changes from one row to the next. So no step costs more than a
+ * pass over the edges, even for paths with many thousands of them.
+ * Returns -1 with an exception set if out of memory. */
+static int
+fill_path_aliased(SDL_Surface *surf, SDL_Rect surf_clip_rect,
+                  pg_aa_path *path, Uint32 color, int *drawn_area)
+{
+    pg_aa_raster_edge *edges;
+    const pg_aa_raster_edge *edge, **sorted;
+    pg_path_crossing *active, temp;
+    Py_ssize_t i, j, num_edges = 0, num_active = 0, n, *row_ends;
+    float min_y, max_y, y_mid, left, right;
+    int top, bottom, y, x1, x2, winding;
+
+    aa_close(path);
+    if (path->failed) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (path->num_edges == 0) {
+        return 0;
+    }
+
+    min_y = max_y = path->edges[0].y1;
+    for (i = 0; i < path->num_edges; i++) {
+        min_y = MIN(min_y, MIN(path->edges[i].y1, path->edges[i].y2));
+        max_y = MAX(max_y, MAX(path->edges[i].y1, path->edges[i].y2));
+    }
+    if (min_y >= surf_clip_rect.y + surf_clip_rect.h ||
+        max_y <= surf_clip_rect.y) {
+        return 0;
+    }
+    /* Rows whose middle is within the shape's height */
+    top = (int)MAX(ceilf(min_y - 0.5f), (float)surf_clip_rect.y);
+    bottom = (int)MIN(ceilf(max_y - 0.5f),
+                      (float)(surf_clip_rect.y + surf_clip_rect.h));
+    if (top >= bottom) {
+        return 0;
+    }
+    left = (float)surf_clip_rect.x;
+    right = (float)(surf_clip_rect.x + surf_clip_rect.w);
+
+    edges = PyMem_New(pg_aa_raster_edge, path->num_edges);
+    sorted = PyMem_New(const pg_aa_raster_edge *, path->num_edges);
+    active = PyMem_New(pg_path_crossing, path->num_edges);
+    row_ends = PyMem_New(Py_ssize_t, bottom - top);
+    if (edges == NULL || sorted == NULL || active == NULL ||
+        row_ends == NULL) {
+        PyMem_Free(edges);
+        PyMem_Free(sorted);
+        PyMem_Free(active);
+        PyMem_Free(row_ends);
+        PyErr_NoMemory();
+        return -1;
+    }
+    memset(row_ends, 0, (bottom - top) * sizeof(Py_ssize_t));
+
+    /* Counting sort of the edges by their first row, edges that cross no
+     * row middle are left out. Afterwards the edges of row y are the ones
+     * from row_ends[y - top - 1] to row_ends[y - top]. */
+    for (i = 0; i < path->num_edges; i++) {
+        aa_add_raster_edge(edges, &num_edges, path->edges[i].x1,
+                           path->edges[i].y1, path->edges[i].x2,
+                           path->edges[i].y2, 1);
+    }
+    for (i = 0; i < num_edges; i++) {
+        y = FILL_PATH_FIRST_ROW(edges[i], top, bottom);
+        if (y < bottom && edges[i].y2 > y + 0.5f) {
+            row_ends[y - top]++;
+        }
+    }
+    for (n = 0, y = 0; y < bottom - top; y++) {
+        n += row_ends[y];
+        row_ends[y] = n - row_ends[y];
+    }
+    for (i = 0; i < num_edges; i++) {
+        y = FILL_PATH_FIRST_ROW(edges[i], top, bottom);
+        if (y < bottom && edges[i].y2 > y + 0.5f) {
+            sorted[row_ends[y - top]++] = edges + i;
+        }
+    }
+
+    for (y = top; y < bottom; y++) {
+        y_mid = y + 0.5f;
+
+        /* Drop the edges that ended, move the others down to this row */
+        n = 0;
+        for (i = 0; i < num_active; i++) {
+            edge = active[i].edge;
+            if (edge->y2 > y_mid) {
+                active[n].edge = edge;
+                active[n++].x = edge->x1 + (y_mid - edge->y1) * edge->dxdy;
+            }
+        }
+        for (i = y > top ? row_ends[y - top - 1] : 0; i < row_ends[y - top];
+             i++) {
+            edge = sorted[i];
+            active[n].edge = edge;
+            active[n++].x = edge->x1 + (y_mid - edge->y1) * edge->dxdy;
+        }
+        num_active = n;
+
+        /* Insertion sort, the edges are mostly in order already */
+        for (i = 1; i < num_active; i++) {
+            temp = active[i];
+            for (j = i; j > 0 && active[j - 1].x > temp.x; j--) {
+                active[j] = active[j - 1];
+            }
+            active[j] = temp;
+        }
+
+        /* Crossing i goes into the shape, j back out of it */
+        for (i = 0; i < num_active; i = j + 1) {
+            winding = (int)active[i].edge->dir;
+            for (j = i + 1; j < num_active; j++) {
+                winding += (int)active[j].edge->dir;
+                if (!winding) {
+                    break;
+                }
+            }
+            if (j == num_active) {
+                break;
+            }
+            /* Pixels with their middle in [x_i, x_j) */
+            x1 = (int)MIN(MAX(ceilf(active[i].x - 0.5f), left), right);
+            x2 = (int)MIN(MAX(ceilf(active[j].x - 0.5f), left), right) - 1;
+            if (x1 <= x2) {
+                drawhorzline(surf, color, x1, y, x2);
+                add_line_to_drawn_list(x1, y, x2, y, drawn_area);
+            }
+        }
+    }
+
+    PyMem_Free(edges);
+    PyMem_Free(sorted);
+    PyMem_Free(active);
+    PyMem_Free(row_ends);
+    return 0;
+}
+
+/* Draws the shape outlined by path without antialiasing and frees the
+ * path */
+static int
+draw_path_aliased(SDL_Surface *surf, SDL_Rect surf_clip_rect,
+                  pg_aa_path *path, Uint32 color, int *drawn_area)
+{
+    int result =
+        fill_path_aliased(surf, surf_clip_rect, path, color, drawn_area);
+
+    PyMem_Free(path->edges);
+    path->edges = NULL;
+    path->num_edges = path->size = 0;
+    return result;
+}
+
 /* List of python functions */
 static PyMethodDef _draw_methods[] = {
     {"aaline", (PyCFunction)aaline, METH_VARARGS | METH_KEYWORDS,
@@ -4137,6 +6174,7 @@ static PyMethodDef _draw_methods[] = {
     {"polygon", (PyCFunction)polygon, METH_VARARGS | METH_KEYWORDS,
      DOC_DRAW_POLYGON},
     {"rect", (PyCFunction)rect, METH_VARARGS | METH_KEYWORDS, DOC_DRAW_RECT},
+    {"many", (PyCFunction)many, METH_VARARGS | METH_KEYWORDS, DOC_DRAW_MANY},
 
     {NULL, NULL, 0, NULL}};
 
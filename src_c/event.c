@@ -99,6 +99,39 @@ static SDL_TimerID _pg_repeat_timer = 0;
 static SDL_Event _pg_repeat_event;
 static SDL_Event _pg_last_keydown_event = {0};
 
+/* The last EventArray from get_array(), see _pg_event_array_take() */
+static PyObject *_pg_event_array_cache = NULL;
+
+/* Blocked event types from PGPOST_EVENTBEGIN on, one bit per type. SDL never
+ * touches the state of these (the proxy and user events), so this mirrors
+ * it exactly and the event filter does not have to ask SDL for every event.
+ * See _pg_event_enabled() and _pg_set_event_enabled() */
+static Uint32 _pg_blocked_types[(PG_NUMEVENTS - PGPOST_EVENTBEGIN + 31) / 32];
+/* Whether a pseudo-blocked event type is blocked, if not the queue does not
+ * have to be filtered on every pump */
+static int _pg_window_events_blocked = 0;
+
+/* Input coalescing, see pg_event_set_coalescing(). The filter holds back
+ * the last motion event in _pg_coalesce_event and merges motion from the
+ * same device into it, until another event comes in or the queue is
+ * pumped. _pg_coalesce_pushed is the held back event on its way to the
+ * queue, so that the filter lets it through and gives it back the
+ * timestamp SDL_PushEvent() replaced, _pg_coalesce_pushed_time. */
+static int _pg_coalesce_motion = 0;
+static SDL_Event _pg_coalesce_event = {0};
+static SDL_Event *_pg_coalesce_pushed = NULL;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+static Uint64 _pg_coalesce_pushed_time = 0;
+#else
+static Uint32 _pg_coalesce_pushed_time = 0;
+#endif
+/* Mirrors the state above for the checks made on every event and pump
+ * without the mutex. Only written with the mutex held, see
+ * _pg_coalesce_sync_state() */
+#define PG_COALESCE_ON 1
+#define PG_COALESCE_HELD 2
+static PG_AtomicInt _pg_coalesce_state;
+
 /* Not used as text, acts as an array of bools */
 static char pressed_keys[SDL_NUM_SCANCODES] = {0};
 static char released_keys[SDL_NUM_SCANCODES] = {0};
@@ -141,6 +174,77 @@ _pg_pgevent_proxify(Uint32 type);
 static Uint32
 _pg_pgevent_deproxify(Uint32 type);
 
+/* PG_EventEnabled, for the types in _pg_blocked_types without asking SDL */
+static int
+_pg_event_enabled(Uint32 type)
+{
+    if (type >= PGPOST_EVENTBEGIN && type < PG_NUMEVENTS) {
+        type -= PGPOST_EVENTBEGIN;
+        return !(_pg_blocked_types[type / 32] & (1u << (type % 32)));
+    }
+    return PG_EventEnabled(type) != SDL_FALSE;
+}
+
+static void
+_pg_update_window_events_blocked(void)
+{
+    Uint32 type;
+    int blocked = 0;
+
+    for (type = PGPOST_WINDOWSHOWN; type <= PGPOST_WINDOWDISPLAYCHANGED;
+         type++) {
+        blocked |= !_pg_event_enabled(type);
+    }
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    /* Window events that have no proxy are blocked as they are */
+    for (type = SDL_EVENT_WINDOW_FIRST; type <= SDL_EVENT_WINDOW_LAST;
+         type++) {
+        blocked |= !PG_EventEnabled(type);
+    }
+#endif
+    _pg_window_events_blocked = blocked;
+}
+
+static void
+_pg_set_event_enabled(Uint32 type, SDL_bool enabled)
+{
+    Uint32 bit = type - PGPOST_EVENTBEGIN;
+
+    PG_SetEventEnabled(type, enabled);
+    if (type >= PGPOST_EVENTBEGIN && type < PG_NUMEVENTS) {
+        if (enabled) {
+            _pg_blocked_types[bit / 32] &= ~(1u << (bit % 32));
+        }
+        else {
+            _pg_blocked_types[bit / 32] |= 1u << (bit % 32);
+        }
+    }
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    if ((type >= PGPOST_WINDOWSHOWN && type <= PGPOST_WINDOWDISPLAYCHANGED) ||
+        (type >= SDL_EVENT_WINDOW_FIRST && type <= SDL_EVENT_WINDOW_LAST)) {
+#else
+    if (type >= PGPOST_WINDOWSHOWN && type <= PGPOST_WINDOWDISPLAYCHANGED) {
+#endif
+        _pg_update_window_events_blocked();
+    }
+}
+
+/* Reads the state of the types in _pg_blocked_types back from SDL, which
+ * resets it when its event subsystem is restarted */
+static void
+_pg_sync_blocked_types(void)
+{
+    Uint32 type;
+
+    memset(_pg_blocked_types, 0, sizeof(_pg_blocked_types));
+    for (type = 0; type < PG_NUMEVENTS - PGPOST_EVENTBEGIN; type++) {
+        if (PG_EventEnabled(PGPOST_EVENTBEGIN + type) == SDL_FALSE) {
+            _pg_blocked_types[type / 32] |= 1u << (type % 32);
+        }
+    }
+    _pg_update_window_events_blocked();
+}
+
 #if SDL_VERSION_ATLEAST(3, 0, 0)
 static Uint32
 _pg_repeat_callback(void *param, SDL_TimerID timerID, Uint32 interval)
@@ -169,7 +273,7 @@ _pg_repeat_callback(Uint32 interval, void *param)
      * this to go through our event filter.
      * Because this doesn't go through our filter we have to check event
      * blocking beforehand. */
-    if (PG_EventEnabled(_pg_pgevent_proxify(repeat_event_copy.type))) {
+    if (_pg_event_enabled(_pg_pgevent_proxify(repeat_event_copy.type))) {
         SDL_PeepEvents(&repeat_event_copy, 1, SDL_ADDEVENT, 0, 0);
     }
     return repeat_interval_copy;
@@ -344,7 +448,7 @@ _pg_get_event_unicode(SDL_Event *event)
         if (scanunicode[i].key == event->key.keysym.scancode) {
 #endif
             if (event->type == SDL_KEYUP ||
-                PG_EventEnabled(_pg_pgevent_proxify(SDL_KEYUP)) == SDL_FALSE) {
+                !_pg_event_enabled(_pg_pgevent_proxify(SDL_KEYUP))) {
                 /* mark the position as free real estate for other
                  * events to occupy. */
                 scanunicode[i].key = 0;
@@ -516,7 +620,7 @@ static int SDLCALL
 _pg_filter_blocked_events(void *_, SDL_Event *event)
 {
     if (_pg_event_psuedo_block(event)) {
-        return PG_EventEnabled(_pg_pgevent_proxify(_pg_pgevent_type(event)));
+        return _pg_event_enabled(_pg_pgevent_proxify(_pg_pgevent_type(event)));
     }
     return 1;
 }
@@ -555,6 +659,139 @@ _pg_remove_pending_VIDEOEXPOSE(void *userdata, SDL_Event *event)
     return 1;
 }
 
+/* Whether the motion event b can be merged into a, the one before it: they
+ * come from the same device (and finger or axis) */
+static int
+_pg_can_coalesce(SDL_Event *a, SDL_Event *b)
+{
+    if (a->type != b->type) {
+        return 0;
+    }
+    switch (a->type) {
+        case SDL_MOUSEMOTION:
+            return a->motion.which == b->motion.which &&
+                   a->motion.windowID == b->motion.windowID &&
+                   a->motion.state == b->motion.state;
+        case SDL_JOYAXISMOTION:
+            return a->jaxis.which == b->jaxis.which &&
+                   a->jaxis.axis == b->jaxis.axis;
+        case SDL_FINGERMOTION:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            return a->tfinger.touchID == b->tfinger.touchID &&
+                   a->tfinger.fingerID == b->tfinger.fingerID;
+#else
+            return a->tfinger.touchId == b->tfinger.touchId &&
+                   a->tfinger.fingerId == b->tfinger.fingerId;
+#endif
+    }
+    return 0;
+}
+
+/* Updates _pg_coalesce_state, the mutex must be held */
+static void
+_pg_coalesce_sync_state(void)
+{
+    PG_SetAtomicInt(&_pg_coalesce_state,
+                    (_pg_coalesce_motion ? PG_COALESCE_ON : 0) |
+                        (_pg_coalesce_event.type ? PG_COALESCE_HELD : 0));
+}
+
+/* Merges b into a, b wins except for the relative motion, which adds up */
+static void
+_pg_coalesce_merge(SDL_Event *a, SDL_Event *b)
+{
+    SDL_Event merged = *b;
+
+    if (a->type == SDL_MOUSEMOTION) {
+        merged.motion.xrel += a->motion.xrel;
+        merged.motion.yrel += a->motion.yrel;
+    }
+    else if (a->type == SDL_FINGERMOTION) {
+        merged.tfinger.dx += a->tfinger.dx;
+        merged.tfinger.dy += a->tfinger.dy;
+    }
+    *a = merged;
+}
+
+/* Pushes a held back event through SDL_PushEvent, so event watchers see it
+ * like any other. The mutex is not held here, as SDL calls the filter with
+ * its own lock held */
+static void
+_pg_coalesce_push(SDL_Event *event)
+{
+    PG_LOCK_EVFILTER_MUTEX
+    _pg_coalesce_pushed = event;
+    _pg_coalesce_pushed_time = event->common.timestamp;
+    PG_UNLOCK_EVFILTER_MUTEX
+
+    SDL_PushEvent(event);
+
+    PG_LOCK_EVFILTER_MUTEX
+    if (_pg_coalesce_pushed == event) {
+        _pg_coalesce_pushed = NULL;
+    }
+    PG_UNLOCK_EVFILTER_MUTEX
+}
+
+/* Pushes the held back event, if there is one. Called on pump */
+static void
+_pg_coalesce_flush(void)
+{
+    SDL_Event held = {0};
+
+    PG_LOCK_EVFILTER_MUTEX
+    held = _pg_coalesce_event;
+    _pg_coalesce_event.type = 0;
+    _pg_coalesce_sync_state();
+    PG_UNLOCK_EVFILTER_MUTEX
+
+    if (held.type) {
+        _pg_coalesce_push(&held);
+    }
+}
+
+/* The input coalescing part of the event filter. Returns 1 if the event was
+ * held back or merged into the held back one, the filter drops it then.
+ * Anything that can't be merged first pushes the held back event out, so
+ * the events stay in order */
+static int
+_pg_coalesce_filter(SDL_Event *event)
+{
+    SDL_Event held = {0};
+    int coalesced = 0;
+
+    PG_LOCK_EVFILTER_MUTEX
+    if (event == _pg_coalesce_pushed) {
+        /* The held back event itself, on its way to the queue */
+        event->common.timestamp = _pg_coalesce_pushed_time;
+        _pg_coalesce_pushed = NULL;
+    }
+    else if (_pg_coalesce_event.type &&
+             _pg_can_coalesce(&_pg_coalesce_event, event)) {
+        _pg_coalesce_merge(&_pg_coalesce_event, event);
+        coalesced = 1;
+    }
+    else {
+        held = _pg_coalesce_event;
+        _pg_coalesce_event.type = 0;
+        if (_pg_coalesce_motion &&
+            (event->type == SDL_MOUSEMOTION ||
+             event->type == SDL_JOYAXISMOTION ||
+             event->type == SDL_FINGERMOTION) &&
+            _pg_event_enabled(_pg_pgevent_proxify(event->type))) {
+            _pg_coalesce_event = *event;
+            coalesced = 1;
+        }
+    }
+    _pg_coalesce_sync_state();
+    PG_UNLOCK_EVFILTER_MUTEX
+
+    if (held.type) {
+        _pg_coalesce_push(&held);
+    }
+    return coalesced;
+}
+
 /* SDL 2 to SDL 1.2 event mapping and SDL 1.2 key repeat emulation,
  * this can alter events in-place.
  * This function can be called from multiple threads, so a mutex must be held
@@ -575,6 +812,11 @@ pg_event_filter(void *_, SDL_Event *event)
     int x, y, i;
 #endif
 
+    if (PG_GetAtomicInt(&_pg_coalesce_state) &&
+        _pg_coalesce_filter(event)) {
+        return 0;
+    }
+
 #if SDL_VERSION_ATLEAST(3, 0, 0)
     if (event->type >= SDL_EVENT_WINDOW_FIRST &&
         event->type <= SDL_EVENT_WINDOW_LAST) {
@@ -653,7 +895,7 @@ pg_event_filter(void *_, SDL_Event *event)
     else if (event->type == SDL_KEYUP) {
         PG_LOCK_EVFILTER_MUTEX
         /* Actual keyup is blocked, so clear unneeded cache if it exists */
-        if (PG_EventEnabled(_pg_pgevent_proxify(SDL_KEYUP)) == SDL_FALSE) {
+        if (!_pg_event_enabled(_pg_pgevent_proxify(SDL_KEYUP))) {
             _pg_del_event_unicode(event);
         }
 #if SDL_VERSION_ATLEAST(3, 0, 0)
@@ -751,7 +993,7 @@ pg_event_filter(void *_, SDL_Event *event)
     if (_pg_event_psuedo_block(event)) {
         return 1;
     }
-    return PG_EventEnabled(_pg_pgevent_proxify(event->type));
+    return _pg_event_enabled(_pg_pgevent_proxify(event->type));
 }
 
 /* The two keyrepeat functions below modify state accessed by the event filter,
@@ -792,6 +1034,8 @@ pgEvent_AutoQuit(PyObject *self, PyObject *_null)
             SDL_RemoveTimer(_pg_repeat_timer);
             _pg_repeat_timer = 0;
         }
+        _pg_coalesce_event.type = 0;
+        _pg_coalesce_sync_state();
         PG_UNLOCK_EVFILTER_MUTEX
         /* The main reason for _custom_event to be reset here is so we
          * can have a unit test that checks if pygame.event.custom_type()
@@ -799,6 +1043,7 @@ pgEvent_AutoQuit(PyObject *self, PyObject *_null)
          * test preventing further tests from getting a custom event type.*/
         _custom_event = _PGE_CUSTOM_EVENT_INIT;
     }
+    Py_CLEAR(_pg_event_array_cache);
     _pg_event_is_init = 0;
     Py_RETURN_NONE;
 }
@@ -809,6 +1054,9 @@ pgEvent_AutoInit(PyObject *self, PyObject *_null)
     if (!_pg_event_is_init) {
         pg_key_repeat_delay = 0;
         pg_key_repeat_interval = 0;
+        _pg_coalesce_motion = 0;
+        _pg_coalesce_sync_state();
+        _pg_sync_blocked_types();
 #ifndef __EMSCRIPTEN__
         if (!pg_evfilter_mutex) {
             /* Create mutex only if it has not been created already */
@@ -1823,6 +2071,600 @@ pgEvent_New(SDL_Event *event)
     return (PyObject *)e;
 }
 
+/* EventArray internals
+ *
+ * get_array() stores each event as a fixed size record, exported through
+ * the buffer protocol, and keeps a copy of the SDL event so an Event object
+ * is only made when an item is asked for. Events whose data can't wait
+ * (posted events with a dict, key events with their unicode, text, drops)
+ * get their Event object right away. */
+
+typedef struct {
+    Uint32 type;
+    Uint32 timestamp; /* milliseconds */
+    Uint32 window;    /* SDL window id, 0 if none */
+    Sint32 which;     /* mouse, joystick or touch device */
+    float x, y;
+    float dx, dy;
+    Sint32 button; /* or the pressed buttons of MOUSEMOTION, or finger id */
+    Sint32 axis;   /* axis, ball, hat, sensor or touchpad index */
+    Sint32 key;
+    Sint32 scancode;
+    Uint32 mod;
+    float value;
+} pgEventRecord;
+
+#define PG_EVENT_RECORD_FORMAT                                               \
+    "T{I:type:I:timestamp:I:window:i:which:f:x:f:y:f:dx:f:dy:i:button:"      \
+    "i:axis:i:key:i:scancode:I:mod:f:value:}"
+
+/* Events an EventArray has room for before it first grows */
+#define PG_EVENT_ARRAY_MIN_CAPACITY PG_GET_LIST_LEN
+
+typedef struct {
+    PyObject_HEAD pgEventRecord *records;
+    SDL_Event *events;  /* the events the records were made from */
+    PyObject **objects; /* Event objects made so far, else NULL */
+    Py_ssize_t len;
+    Py_ssize_t capacity;
+    Py_ssize_t exports;
+} pgEventArrayObject;
+
+/* A column of an EventArray, exported as a strided buffer */
+typedef struct {
+    PyObject_HEAD pgEventArrayObject *array;
+    Py_ssize_t offset;
+    char *format;
+} pgEventFieldObject;
+
+static PyTypeObject pgEventArray_Type;
+static PyTypeObject pgEventField_Type;
+
+static const struct {
+    const char *name;
+    Py_ssize_t offset;
+    char *format;
+} _pg_event_fields[] = {
+    {"type", offsetof(pgEventRecord, type), "I"},
+    {"timestamp", offsetof(pgEventRecord, timestamp), "I"},
+    {"window", offsetof(pgEventRecord, window), "I"},
+    {"which", offsetof(pgEventRecord, which), "i"},
+    {"x", offsetof(pgEventRecord, x), "f"},
+    {"y", offsetof(pgEventRecord, y), "f"},
+    {"dx", offsetof(pgEventRecord, dx), "f"},
+    {"dy", offsetof(pgEventRecord, dy), "f"},
+    {"button", offsetof(pgEventRecord, button), "i"},
+    {"axis", offsetof(pgEventRecord, axis), "i"},
+    {"key", offsetof(pgEventRecord, key), "i"},
+    {"scancode", offsetof(pgEventRecord, scancode), "i"},
+    {"mod", offsetof(pgEventRecord, mod), "I"},
+    {"value", offsetof(pgEventRecord, value), "f"},
+};
+
+/* Whether the data of an event must be read before the next pump, or
+ * consumed exactly once */
+static int
+_pg_event_needs_object(SDL_Event *event)
+{
+    if (event->type >= PGPOST_EVENTBEGIN) {
+        return 1;
+    }
+    switch (event->type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+        case SDL_TEXTINPUT:
+        case SDL_TEXTEDITING:
+        case SDL_DROPFILE:
+        case SDL_DROPTEXT:
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+        case SDL_SYSWMEVENT:
+#endif
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static void
+_pg_record_from_event(SDL_Event *event, pgEventRecord *rec)
+{
+    Uint32 type = _pg_pgevent_type(event);
+    int hx = 0, hy = 0;
+
+    memset(rec, 0, sizeof(pgEventRecord));
+    rec->type = _pg_pgevent_deproxify(type);
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    rec->timestamp = (Uint32)SDL_NS_TO_MS(event->common.timestamp);
+#else
+    rec->timestamp = event->common.timestamp;
+#endif
+    if (type >= PGPOST_EVENTBEGIN) {
+        /* Posted events only have their dict */
+        return;
+    }
+
+    switch (type) {
+        case SDL_VIDEORESIZE:
+            rec->x = (float)event->window.data1;
+            rec->y = (float)event->window.data2;
+            break;
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            rec->window = event->key.windowID;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->key = event->key.key;
+            rec->scancode = event->key.scancode;
+            rec->mod = event->key.mod;
+#else
+            rec->key = event->key.keysym.sym;
+            rec->scancode = event->key.keysym.scancode;
+            rec->mod = event->key.keysym.mod;
+#endif
+            break;
+        case SDL_MOUSEMOTION:
+            rec->window = event->motion.windowID;
+            rec->which = event->motion.which;
+            rec->x = (float)event->motion.x;
+            rec->y = (float)event->motion.y;
+            rec->dx = (float)event->motion.xrel;
+            rec->dy = (float)event->motion.yrel;
+            rec->button = event->motion.state;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            rec->window = event->button.windowID;
+            rec->which = event->button.which;
+            rec->x = (float)event->button.x;
+            rec->y = (float)event->button.y;
+            rec->button = event->button.button;
+            break;
+        case SDL_MOUSEWHEEL:
+            rec->window = event->wheel.windowID;
+            rec->which = event->wheel.which;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->x = event->wheel.x;
+            rec->y = event->wheel.y;
+#else
+            rec->x = event->wheel.preciseX;
+            rec->y = event->wheel.preciseY;
+#endif
+            break;
+        case SDL_JOYAXISMOTION:
+            rec->which = event->jaxis.which;
+            rec->axis = event->jaxis.axis;
+            rec->value = event->jaxis.value / 32768.0f;
+            break;
+        case SDL_JOYBALLMOTION:
+            rec->which = event->jball.which;
+            rec->axis = event->jball.ball;
+            rec->dx = (float)event->jball.xrel;
+            rec->dy = (float)event->jball.yrel;
+            break;
+        case SDL_JOYHATMOTION:
+            rec->which = event->jhat.which;
+            rec->axis = event->jhat.hat;
+            if (event->jhat.value & SDL_HAT_UP) {
+                hy = 1;
+            }
+            else if (event->jhat.value & SDL_HAT_DOWN) {
+                hy = -1;
+            }
+            if (event->jhat.value & SDL_HAT_RIGHT) {
+                hx = 1;
+            }
+            else if (event->jhat.value & SDL_HAT_LEFT) {
+                hx = -1;
+            }
+            rec->x = (float)hx;
+            rec->y = (float)hy;
+            break;
+        case SDL_JOYBUTTONUP:
+        case SDL_JOYBUTTONDOWN:
+            rec->which = event->jbutton.which;
+            rec->button = event->jbutton.button;
+            break;
+        case SDL_JOYDEVICEADDED:
+        case SDL_JOYDEVICEREMOVED:
+            rec->which = event->jdevice.which;
+            break;
+        case SDL_CONTROLLERAXISMOTION:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = event->gaxis.which;
+            rec->axis = event->gaxis.axis;
+            rec->value = (float)event->gaxis.value;
+#else
+            rec->which = event->caxis.which;
+            rec->axis = event->caxis.axis;
+            rec->value = (float)event->caxis.value;
+#endif
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = event->gbutton.which;
+            rec->button = event->gbutton.button;
+#else
+            rec->which = event->cbutton.which;
+            rec->button = event->cbutton.button;
+#endif
+            break;
+        case SDL_CONTROLLERDEVICEADDED:
+        case SDL_CONTROLLERDEVICEREMOVED:
+        case SDL_CONTROLLERDEVICEREMAPPED:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = event->gdevice.which;
+#else
+            rec->which = event->cdevice.which;
+#endif
+            break;
+        case SDL_CONTROLLERTOUCHPADDOWN:
+        case SDL_CONTROLLERTOUCHPADMOTION:
+        case SDL_CONTROLLERTOUCHPADUP:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = event->gtouchpad.which;
+            rec->axis = event->gtouchpad.touchpad;
+            rec->button = event->gtouchpad.finger;
+            rec->x = event->gtouchpad.x;
+            rec->y = event->gtouchpad.y;
+            rec->value = event->gtouchpad.pressure;
+#else
+            rec->which = event->ctouchpad.which;
+            rec->axis = event->ctouchpad.touchpad;
+            rec->button = event->ctouchpad.finger;
+            rec->x = event->ctouchpad.x;
+            rec->y = event->ctouchpad.y;
+            rec->value = event->ctouchpad.pressure;
+#endif
+            break;
+        case SDL_CONTROLLERSENSORUPDATE:
+            /* The three readings go to x, y and value */
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = event->gsensor.which;
+            rec->axis = event->gsensor.sensor;
+            rec->x = event->gsensor.data[0];
+            rec->y = event->gsensor.data[1];
+            rec->value = event->gsensor.data[2];
+#else
+            rec->which = event->csensor.which;
+            rec->axis = event->csensor.sensor;
+            rec->x = event->csensor.data[0];
+            rec->y = event->csensor.data[1];
+            rec->value = event->csensor.data[2];
+#endif
+            break;
+        case SDL_FINGERMOTION:
+        case SDL_FINGERDOWN:
+        case SDL_FINGERUP:
+            rec->window = event->tfinger.windowID;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = (Sint32)event->tfinger.touchID;
+            rec->button = (Sint32)event->tfinger.fingerID;
+#else
+            rec->which = (Sint32)event->tfinger.touchId;
+            rec->button = (Sint32)event->tfinger.fingerId;
+#endif
+            rec->x = event->tfinger.x;
+            rec->y = event->tfinger.y;
+            rec->dx = event->tfinger.dx;
+            rec->dy = event->tfinger.dy;
+            rec->value = event->tfinger.pressure;
+            break;
+        case PGE_WINDOWMOVED:
+        case PGE_WINDOWRESIZED:
+        case PGE_WINDOWSIZECHANGED:
+        case PGE_WINDOWDISPLAYCHANGED:
+            rec->x = (float)event->window.data1;
+            rec->y = (float)event->window.data2;
+            /* fallthrough */
+        case PGE_WINDOWSHOWN:
+        case PGE_WINDOWHIDDEN:
+        case PGE_WINDOWEXPOSED:
+        case PGE_WINDOWMINIMIZED:
+        case PGE_WINDOWMAXIMIZED:
+        case PGE_WINDOWRESTORED:
+        case PGE_WINDOWENTER:
+        case PGE_WINDOWLEAVE:
+        case PGE_WINDOWFOCUSGAINED:
+        case PGE_WINDOWFOCUSLOST:
+        case PGE_WINDOWCLOSE:
+        case PGE_WINDOWTAKEFOCUS:
+        case PGE_WINDOWHITTEST:
+        case PGE_WINDOWICCPROFCHANGED:
+            rec->window = event->window.windowID;
+            break;
+        case SDL_TEXTEDITING:
+            rec->window = event->edit.windowID;
+            break;
+        case SDL_TEXTINPUT:
+            rec->window = event->text.windowID;
+            break;
+        case SDL_DROPBEGIN:
+        case SDL_DROPCOMPLETE:
+        case SDL_DROPTEXT:
+        case SDL_DROPFILE:
+            rec->window = event->drop.windowID;
+            break;
+        default:
+            break;
+    }
+}
+
+/* Drops the events of an array, keeping its buffers */
+static void
+_pg_event_array_clear(pgEventArrayObject *self)
+{
+    Py_ssize_t i, len = self->len;
+
+    /* Event objects can run code when freed, empty the array first */
+    self->len = 0;
+    for (i = 0; i < len; i++) {
+        Py_XDECREF(self->objects[i]);
+    }
+}
+
+static int
+_pg_event_array_grow(pgEventArrayObject *self)
+{
+    Py_ssize_t capacity = self->capacity ? self->capacity * 2
+                                         : PG_EVENT_ARRAY_MIN_CAPACITY;
+    pgEventRecord *records;
+    SDL_Event *events;
+    PyObject **objects;
+
+    records = PyMem_Realloc(self->records, capacity * sizeof(pgEventRecord));
+    if (!records) {
+        PyErr_NoMemory();
+        return 0;
+    }
+    self->records = records;
+    events = PyMem_Realloc(self->events, capacity * sizeof(SDL_Event));
+    if (!events) {
+        PyErr_NoMemory();
+        return 0;
+    }
+    self->events = events;
+    objects = PyMem_Realloc(self->objects, capacity * sizeof(PyObject *));
+    if (!objects) {
+        PyErr_NoMemory();
+        return 0;
+    }
+    self->objects = objects;
+    self->capacity = capacity;
+    return 1;
+}
+
+/* An empty EventArray for get_array(). The last one returned is reused when
+ * nothing but this cache refers to it, so a loop that lets go of each array
+ * before the next call keeps filling the same buffers. */
+static PyObject *
+_pg_event_array_take(void)
+{
+    pgEventArrayObject *array = (pgEventArrayObject *)_pg_event_array_cache;
+
+    if (array && Py_REFCNT(array) == 1 && !array->exports) {
+        _pg_event_array_clear(array);
+        return Py_NewRef(array);
+    }
+
+    array = PyObject_New(pgEventArrayObject, &pgEventArray_Type);
+    if (!array) {
+        return NULL;
+    }
+    array->records = NULL;
+    array->events = NULL;
+    array->objects = NULL;
+    array->len = 0;
+    array->capacity = 0;
+    array->exports = 0;
+    if (!_pg_event_array_grow(array)) {
+        Py_DECREF(array);
+        return NULL;
+    }
+
+    Py_XSETREF(_pg_event_array_cache, Py_NewRef(array));
+    return (PyObject *)array;
+}
+
+static int
+_pg_event_append_to_array(PyObject *dest, SDL_Event *event)
+{
+    pgEventArrayObject *array = (pgEventArrayObject *)dest;
+    Py_ssize_t i = array->len;
+
+    if (i == array->capacity && !_pg_event_array_grow(array)) {
+        return 0;
+    }
+    _pg_record_from_event(event, &array->records[i]);
+    array->events[i] = *event;
+    array->objects[i] = NULL;
+    if (_pg_event_needs_object(event)) {
+        array->objects[i] = pgEvent_New(&array->events[i]);
+        if (!array->objects[i]) {
+            return 0;
+        }
+    }
+    array->len++;
+    return 1;
+}
+
+static void
+pg_event_array_dealloc(pgEventArrayObject *self)
+{
+    _pg_event_array_clear(self);
+    PyMem_Free(self->records);
+    PyMem_Free(self->events);
+    PyMem_Free(self->objects);
+    PyObject_Free(self);
+}
+
+static Py_ssize_t
+pg_event_array_len(pgEventArrayObject *self)
+{
+    return self->len;
+}
+
+static PyObject *
+pg_event_array_item(pgEventArrayObject *self, Py_ssize_t i)
+{
+    if (i < 0 || i >= self->len) {
+        return RAISE(PyExc_IndexError, "EventArray index out of range");
+    }
+    if (!self->objects[i]) {
+        self->objects[i] = pgEvent_New(&self->events[i]);
+        if (!self->objects[i]) {
+            return NULL;
+        }
+    }
+    return Py_NewRef(self->objects[i]);
+}
+
+static PyObject *
+pg_event_array_field(pgEventArrayObject *self, PyObject *arg)
+{
+    pgEventFieldObject *field;
+    PyObject *view;
+    const char *name;
+    size_t i;
+
+    name = PyUnicode_AsUTF8(arg);
+    if (!name) {
+        return NULL;
+    }
+    for (i = 0; i < SDL_arraysize(_pg_event_fields); i++) {
+        if (!strcmp(name, _pg_event_fields[i].name)) {
+            break;
+        }
+    }
+    if (i == SDL_arraysize(_pg_event_fields)) {
+        return PyErr_Format(PyExc_KeyError, "no event field named '%s'",
+                            name);
+    }
+
+    field = PyObject_New(pgEventFieldObject, &pgEventField_Type);
+    if (!field) {
+        return NULL;
+    }
+    field->array = (pgEventArrayObject *)Py_NewRef(self);
+    field->offset = _pg_event_fields[i].offset;
+    field->format = _pg_event_fields[i].format;
+
+    view = PyMemoryView_FromObject((PyObject *)field);
+    Py_DECREF(field);
+    return view;
+}
+
+static int
+pg_event_array_getbuffer(pgEventArrayObject *self, Py_buffer *view,
+                         int flags)
+{
+    static Py_ssize_t itemsize = sizeof(pgEventRecord);
+
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "an EventArray is read only");
+        return -1;
+    }
+
+    view->buf = self->records;
+    view->len = self->len * itemsize;
+    view->readonly = 1;
+    view->itemsize = itemsize;
+    view->ndim = 1;
+    view->format = (flags & PyBUF_FORMAT) ? PG_EVENT_RECORD_FORMAT : NULL;
+    view->shape = (flags & PyBUF_ND) ? &self->len : NULL;
+    view->strides = (flags & PyBUF_STRIDES) ? &itemsize : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    view->obj = Py_NewRef(self);
+    self->exports++;
+    return 0;
+}
+
+static void
+pg_event_array_releasebuffer(pgEventArrayObject *self, Py_buffer *view)
+{
+    self->exports--;
+}
+
+static void
+pg_event_field_dealloc(pgEventFieldObject *self)
+{
+    Py_DECREF(self->array);
+    PyObject_Free(self);
+}
+
+static int
+pg_event_field_getbuffer(pgEventFieldObject *self, Py_buffer *view,
+                         int flags)
+{
+    static Py_ssize_t stride = sizeof(pgEventRecord);
+    pgEventArrayObject *array = self->array;
+
+    if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES) {
+        PyErr_SetString(PyExc_BufferError,
+                        "an EventArray field is not contiguous");
+        return -1;
+    }
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "an EventArray is read only");
+        return -1;
+    }
+
+    view->buf = (char *)array->records + self->offset;
+    view->len = array->len * 4;
+    view->readonly = 1;
+    view->itemsize = 4;
+    view->ndim = 1;
+    view->format = (flags & PyBUF_FORMAT) ? self->format : NULL;
+    view->shape = &array->len;
+    view->strides = &stride;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    view->obj = Py_NewRef(self);
+    array->exports++;
+    return 0;
+}
+
+static void
+pg_event_field_releasebuffer(pgEventFieldObject *self, Py_buffer *view)
+{
+    self->array->exports--;
+}
+
+static PyMethodDef pg_event_array_methods[] = {
+    {"field", (PyCFunction)pg_event_array_field, METH_O,
+     DOC_EVENT_EVENTARRAY_FIELD},
+    {NULL, NULL, 0, NULL}};
+
+static PySequenceMethods pg_event_array_as_sequence = {
+    .sq_length = (lenfunc)pg_event_array_len,
+    .sq_item = (ssizeargfunc)pg_event_array_item,
+};
+
+static PyBufferProcs pg_event_array_as_buffer = {
+    (getbufferproc)pg_event_array_getbuffer,
+    (releasebufferproc)pg_event_array_releasebuffer};
+
+static PyTypeObject pgEventArray_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.event.EventArray",
+    .tp_basicsize = sizeof(pgEventArrayObject),
+    .tp_dealloc = (destructor)pg_event_array_dealloc,
+    .tp_as_sequence = &pg_event_array_as_sequence,
+    .tp_as_buffer = &pg_event_array_as_buffer,
+    .tp_doc = DOC_EVENT_EVENTARRAY,
+    .tp_methods = pg_event_array_methods,
+};
+
+static PyBufferProcs pg_event_field_as_buffer = {
+    (getbufferproc)pg_event_field_getbuffer,
+    (releasebufferproc)pg_event_field_releasebuffer};
+
+static PyTypeObject pgEventField_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.event._EventArrayField",
+    .tp_basicsize = sizeof(pgEventFieldObject),
+    .tp_dealloc = (destructor)pg_event_field_dealloc,
+    .tp_as_buffer = &pg_event_field_as_buffer,
+};
+
 /* event module functions */
 
 static PyObject *
@@ -1908,7 +2750,12 @@ _pg_event_pump(int dopump)
         SDL_PumpEvents();
     }
 
-    SDL_FilterEvents(_pg_filter_blocked_events, NULL);
+    if (PG_GetAtomicInt(&_pg_coalesce_state) & PG_COALESCE_HELD) {
+        _pg_coalesce_flush();
+    }
+    if (_pg_window_events_blocked) {
+        SDL_FilterEvents(_pg_filter_blocked_events, NULL);
+    }
 }
 
 static int
@@ -2075,6 +2922,10 @@ pg_event_clear(PyObject *self, PyObject *args, PyObject *kwargs)
     Py_RETURN_NONE;
 }
 
+/* Adds an event taken from the queue to dest, a list or an EventArray.
+ * Returns 0 with an exception set on failure. */
+typedef int (*_pg_event_append_func)(PyObject *dest, SDL_Event *event);
+
 static int
 _pg_event_append_to_list(PyObject *list, SDL_Event *event)
 {
@@ -2116,13 +2967,14 @@ pgEvent_GetMouseButtonUpInfo(void)
     return released_mouse_buttons;
 }
 
-static PyObject *
-_pg_get_all_events_except(PyObject *obj)
+static int
+_pg_get_all_events_except(PyObject *obj, PyObject *dest,
+                          _pg_event_append_func append)
 {
     SDL_Event event;
     Py_ssize_t len;
     int loop, type, ret;
-    PyObject *seq, *list;
+    PyObject *seq;
 
     SDL_Event *filtered_events;
     int filtered_index = 0;
@@ -2132,13 +2984,8 @@ _pg_get_all_events_except(PyObject *obj)
 
     filtered_events = malloc(sizeof(SDL_Event) * filtered_events_len);
     if (!filtered_events) {
-        return PyErr_NoMemory();
-    }
-
-    list = PyList_New(0);
-    if (!list) {
-        free(filtered_events);
-        return PyErr_NoMemory();
+        PyErr_NoMemory();
+        return 0;
     }
 
     seq = _pg_eventtype_as_seq(obj, &len);
@@ -2210,7 +3057,7 @@ _pg_get_all_events_except(PyObject *obj)
         }
 
         for (loop = 0; loop < len; loop++) {
-            if (!_pg_event_append_to_list(list, &eventbuf[loop])) {
+            if (!append(dest, &eventbuf[loop])) {
                 goto error;
             }
         }
@@ -2220,60 +3067,45 @@ _pg_get_all_events_except(PyObject *obj)
 
     free(filtered_events);
     Py_DECREF(seq);
-    return list;
+    return 1;
 
 error:
     /* While doing a goto here, PyErr must be set */
     free(filtered_events);
-    Py_DECREF(list);
     Py_XDECREF(seq);
-    return NULL;
+    return 0;
 }
 
-static PyObject *
-_pg_get_all_events(void)
+static int
+_pg_get_all_events(PyObject *dest, _pg_event_append_func append)
 {
     SDL_Event eventbuf[PG_GET_LIST_LEN];
-    PyObject *list;
     int loop, len = PG_GET_LIST_LEN;
 
-    list = PyList_New(0);
-    if (!list) {
-        return PyErr_NoMemory();
-    }
-
     while (len == PG_GET_LIST_LEN) {
         len = PG_PEEP_EVENT_ALL(eventbuf, PG_GET_LIST_LEN, SDL_GETEVENT);
         if (len == -1) {
             PyErr_SetString(pgExc_SDLError, SDL_GetError());
-            goto error;
+            return 0;
         }
 
         for (loop = 0; loop < len; loop++) {
-            if (!_pg_event_append_to_list(list, &eventbuf[loop])) {
-                goto error;
+            if (!append(dest, &eventbuf[loop])) {
+                return 0;
             }
         }
     }
-    return list;
-
-error:
-    Py_DECREF(list);
-    return NULL;
+    return 1;
 }
 
-static PyObject *
-_pg_get_seq_events(PyObject *obj)
+static int
+_pg_get_seq_events(PyObject *obj, PyObject *dest,
+                   _pg_event_append_func append)
 {
     Py_ssize_t len;
     SDL_Event event;
     int loop, type, ret;
-    PyObject *seq, *list;
-
-    list = PyList_New(0);
-    if (!list) {
-        return PyErr_NoMemory();
-    }
+    PyObject *seq;
 
     seq = _pg_eventtype_as_seq(obj, &len);
     if (!seq) {
@@ -2293,7 +3125,7 @@ _pg_get_seq_events(PyObject *obj)
                 goto error;
             }
             else if (ret > 0) {
-                if (!_pg_event_append_to_list(list, &event)) {
+                if (!append(dest, &event)) {
                     goto error;
                 }
             }
@@ -2306,20 +3138,43 @@ _pg_get_seq_events(PyObject *obj)
                 goto error;
             }
             else if (ret > 0) {
-                if (!_pg_event_append_to_list(list, &event)) {
+                if (!append(dest, &event)) {
                     goto error;
                 }
             }
         } while (ret);
     }
     Py_DECREF(seq);
-    return list;
+    return 1;
 
 error:
     /* While doing a goto here, PyErr must be set */
-    Py_DECREF(list);
     Py_XDECREF(seq);
-    return NULL;
+    return 0;
+}
+
+/* Takes the events picked by the eventtype and exclude arguments of
+ * pygame.event.get() off the queue and hands them to append. Returns 0 with
+ * an exception set on failure. */
+static int
+_pg_get_events(PyObject *obj_evtype, PyObject *obj_exclude, PyObject *dest,
+               _pg_event_append_func append)
+{
+    if (obj_evtype == NULL || obj_evtype == Py_None) {
+        if (obj_exclude != NULL && obj_exclude != Py_None) {
+            return _pg_get_all_events_except(obj_exclude, dest, append);
+        }
+        return _pg_get_all_events(dest, append);
+    }
+    else {
+        if (obj_exclude != NULL && obj_exclude != Py_None) {
+            PyErr_SetString(
+                pgExc_SDLError,
+                "Invalid combination of excluded and included event type");
+            return 0;
+        }
+        return _pg_get_seq_events(obj_evtype, dest, append);
+    }
 }
 
 static PyObject *
@@ -2327,6 +3182,7 @@ pg_event_get(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     PyObject *obj_evtype = NULL;
     PyObject *obj_exclude = NULL;
+    PyObject *list;
     int dopump = 1;
 
     static char *kwids[] = {"eventtype", "pump", "exclude", NULL};
@@ -2340,20 +3196,47 @@ pg_event_get(PyObject *self, PyObject *args, PyObject *kwargs)
 
     _pg_event_pump(dopump);
 
-    if (obj_evtype == NULL || obj_evtype == Py_None) {
-        if (obj_exclude != NULL && obj_exclude != Py_None) {
-            return _pg_get_all_events_except(obj_exclude);
-        }
-        return _pg_get_all_events();
+    list = PyList_New(0);
+    if (!list) {
+        return NULL;
     }
-    else {
-        if (obj_exclude != NULL && obj_exclude != Py_None) {
-            return RAISE(
-                pgExc_SDLError,
-                "Invalid combination of excluded and included event type");
-        }
-        return _pg_get_seq_events(obj_evtype);
+    if (!_pg_get_events(obj_evtype, obj_exclude, list,
+                        _pg_event_append_to_list)) {
+        Py_DECREF(list);
+        return NULL;
     }
+    return list;
+}
+
+static PyObject *
+pg_event_get_array(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    PyObject *obj_evtype = NULL;
+    PyObject *obj_exclude = NULL;
+    PyObject *array;
+    int dopump = 1;
+
+    static char *kwids[] = {"eventtype", "pump", "exclude", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OpO", kwids, &obj_evtype,
+                                     &dopump, &obj_exclude)) {
+        return NULL;
+    }
+
+    VIDEO_INIT_CHECK();
+
+    _pg_event_pump(dopump);
+
+    array = _pg_event_array_take();
+    if (!array) {
+        return NULL;
+    }
+    if (!_pg_get_events(obj_evtype, obj_exclude, array,
+                        _pg_event_append_to_array)) {
+        Py_DECREF(array);
+        return NULL;
+    }
+    return array;
 }
 
 static PyObject *
@@ -2455,7 +3338,7 @@ pg_event_set_allowed(PyObject *self, PyObject *obj)
     if (obj == Py_None) {
         int i;
         for (i = SDL_FIRSTEVENT; i < SDL_LASTEVENT; i++) {
-            PG_SetEventEnabled(i, SDL_TRUE);
+            _pg_set_event_enabled(i, SDL_TRUE);
         }
     }
     else {
@@ -2470,7 +3353,7 @@ pg_event_set_allowed(PyObject *self, PyObject *obj)
                 Py_DECREF(seq);
                 return NULL;
             }
-            PG_SetEventEnabled(_pg_pgevent_proxify(type), SDL_TRUE);
+            _pg_set_event_enabled(_pg_pgevent_proxify(type), SDL_TRUE);
         }
         Py_DECREF(seq);
     }
@@ -2489,7 +3372,7 @@ pg_event_set_blocked(PyObject *self, PyObject *obj)
         int i;
         /* Start at PGPOST_EVENTBEGIN */
         for (i = PGPOST_EVENTBEGIN; i < SDL_LASTEVENT; i++) {
-            PG_SetEventEnabled(i, SDL_FALSE);
+            _pg_set_event_enabled(i, SDL_FALSE);
         }
     }
     else {
@@ -2504,13 +3387,13 @@ pg_event_set_blocked(PyObject *self, PyObject *obj)
                 Py_DECREF(seq);
                 return NULL;
             }
-            PG_SetEventEnabled(_pg_pgevent_proxify(type), SDL_FALSE);
+            _pg_set_event_enabled(_pg_pgevent_proxify(type), SDL_FALSE);
         }
         Py_DECREF(seq);
     }
 #if !SDL_VERSION_ATLEAST(3, 0, 0)
     /* Never block SDL_WINDOWEVENT on SDL2, we need them for translation */
-    PG_SetEventEnabled(SDL_WINDOWEVENT, SDL_TRUE);
+    _pg_set_event_enabled(SDL_WINDOWEVENT, SDL_TRUE);
 #endif
     Py_RETURN_NONE;
 }
@@ -2535,7 +3418,7 @@ pg_event_get_blocked(PyObject *self, PyObject *obj)
             Py_DECREF(seq);
             return NULL;
         }
-        if (PG_EventEnabled(_pg_pgevent_proxify(type)) == SDL_FALSE) {
+        if (!_pg_event_enabled(_pg_pgevent_proxify(type))) {
             isblocked = 1;
             break;
         }
@@ -2545,6 +3428,32 @@ pg_event_get_blocked(PyObject *self, PyObject *obj)
     return PyBool_FromLong(isblocked);
 }
 
+static PyObject *
+pg_event_set_coalescing(PyObject *self, PyObject *arg)
+{
+    int coalesce = PyObject_IsTrue(arg);
+    if (coalesce == -1) {
+        return NULL;
+    }
+
+    VIDEO_INIT_CHECK();
+
+    PG_LOCK_EVFILTER_MUTEX
+    _pg_coalesce_motion = coalesce;
+    _pg_coalesce_sync_state();
+    PG_UNLOCK_EVFILTER_MUTEX
+    if (!coalesce) {
+        _pg_coalesce_flush();
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_event_get_coalescing(PyObject *self, PyObject *_null)
+{
+    return PyBool_FromLong(_pg_coalesce_motion);
+}
+
 static PyObject *
 pg_event_custom_type(PyObject *self, PyObject *_null)
 {
@@ -2576,6 +3485,8 @@ static PyMethodDef _event_methods[] = {
      DOC_EVENT_CLEAR},
     {"get", (PyCFunction)pg_event_get, METH_VARARGS | METH_KEYWORDS,
      DOC_EVENT_GET},
+    {"get_array", (PyCFunction)pg_event_get_array,
+     METH_VARARGS | METH_KEYWORDS, DOC_EVENT_GETARRAY},
     {"peek", (PyCFunction)pg_event_peek, METH_VARARGS | METH_KEYWORDS,
      DOC_EVENT_PEEK},
     {"post", (PyCFunction)pg_event_post, METH_O, DOC_EVENT_POST},
@@ -2586,6 +3497,10 @@ static PyMethodDef _event_methods[] = {
      DOC_EVENT_SETBLOCKED},
     {"get_blocked", (PyCFunction)pg_event_get_blocked, METH_O,
      DOC_EVENT_GETBLOCKED},
+    {"set_coalescing", (PyCFunction)pg_event_set_coalescing, METH_O,
+     DOC_EVENT_SETCOALESCING},
+    {"get_coalescing", (PyCFunction)pg_event_get_coalescing, METH_NOARGS,
+     DOC_EVENT_GETCOALESCING},
     {"custom_type", (PyCFunction)pg_event_custom_type, METH_NOARGS,
      DOC_EVENT_CUSTOMTYPE},
 
@@ -2623,6 +3538,12 @@ MODINIT_DEFINE(event)
     if (PyType_Ready(&pgEvent_Type) < 0) {
         return NULL;
     }
+    if (PyType_Ready(&pgEventArray_Type) < 0) {
+        return NULL;
+    }
+    if (PyType_Ready(&pgEventField_Type) < 0) {
+        return NULL;
+    }
 
     /* create the module */
     module = PyModule_Create(&_module);
@@ -2639,6 +3560,11 @@ MODINIT_DEFINE(event)
         Py_DECREF(module);
         return NULL;
     }
+    if (PyModule_AddObjectRef(module, "EventArray",
+                              (PyObject *)&pgEventArray_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
 
     /* export the c api */
     assert(PYGAMEAPI_EVENT_NUMSLOTS == 10);
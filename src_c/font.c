@@ -226,6 +226,18 @@ font_get_linesize(PyObject *self, PyObject *_null)
 #endif
 }
 
+/* Drops every cached render. Everything that changes how the font draws
+ * text has to call this, see Font.set_render_cache */
+static void
+_font_invalidate_render_cache(PyObject *self)
+{
+    PyObject *cache = ((PyFontObject *)self)->render_cache;
+
+    if (cache) {
+        PyDict_Clear(cache);
+    }
+}
+
 static PyObject *
 font_set_linesize(PyObject *self, PyObject *arg)
 {
@@ -249,6 +261,7 @@ font_set_linesize(PyObject *self, PyObject *arg)
     }
 
     TTF_SetFontLineSkip(font, linesize);
+    _font_invalidate_render_cache(self);
 
     Py_RETURN_NONE;
 #else
@@ -308,6 +321,7 @@ font_setter_bold(PyObject *self, PyObject *value, void *closure)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_BOLD, val);
+    _font_invalidate_render_cache(self);
     return 0;
 }
 
@@ -337,6 +351,7 @@ font_set_bold(PyObject *self, PyObject *arg)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_BOLD, val);
+    _font_invalidate_render_cache(self);
 
     Py_RETURN_NONE;
 }
@@ -371,6 +386,7 @@ font_setter_italic(PyObject *self, PyObject *value, void *closure)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_ITALIC, val);
+    _font_invalidate_render_cache(self);
     return 0;
 }
 
@@ -400,6 +416,7 @@ font_set_italic(PyObject *self, PyObject *arg)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_ITALIC, val);
+    _font_invalidate_render_cache(self);
 
     Py_RETURN_NONE;
 }
@@ -434,6 +451,7 @@ font_setter_underline(PyObject *self, PyObject *value, void *closure)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_UNDERLINE, val);
+    _font_invalidate_render_cache(self);
     return 0;
 }
 
@@ -463,6 +481,7 @@ font_set_underline(PyObject *self, PyObject *arg)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_UNDERLINE, val);
+    _font_invalidate_render_cache(self);
 
     Py_RETURN_NONE;
 }
@@ -497,6 +516,7 @@ font_setter_strikethrough(PyObject *self, PyObject *value, void *closure)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_STRIKETHROUGH, val);
+    _font_invalidate_render_cache(self);
     return 0;
 }
 
@@ -555,6 +575,7 @@ font_setter_align(PyObject *self, PyObject *value, void *closure)
 #else
     TTF_SetFontWrappedAlign(font, val);
 #endif
+    _font_invalidate_render_cache(self);
     return 0;
 #else
     PyErr_SetString(pgExc_SDLError,
@@ -590,10 +611,88 @@ font_set_strikethrough(PyObject *self, PyObject *arg)
     }
 
     _font_set_or_clear_style_flag(font, TTF_STYLE_STRIKETHROUGH, val);
+    _font_invalidate_render_cache(self);
 
     Py_RETURN_NONE;
 }
 
+/* Looks up a render in the cache of the font. Returns a new reference to
+ * the surface to hand out, or NULL on a miss, with an exception set only if
+ * the lookup failed. A hit becomes the most recently used entry. */
+static PyObject *
+_font_render_cache_get(PyFontObject *self, PyObject *key)
+{
+    PyObject *cache = self->render_cache;
+    PyObject *surfobj, *final;
+
+    surfobj = PyDict_GetItemWithError(cache, key);
+    if (!surfobj) {
+        if (!PyErr_Occurred()) {
+            self->render_cache_misses++;
+        }
+        return NULL;
+    }
+    self->render_cache_hits++;
+
+    /* dicts keep insertion order, so reinserting marks the entry as the
+     * newest one and the first entry is always the least recently used */
+    Py_INCREF(surfobj);
+    if (PyDict_DelItem(cache, key) || PyDict_SetItem(cache, key, surfobj)) {
+        Py_DECREF(surfobj);
+        return NULL;
+    }
+
+    if (self->render_cache_shared) {
+        return surfobj;
+    }
+    final = PyObject_CallMethod(surfobj, "copy", NULL);
+    Py_DECREF(surfobj);
+    return final;
+}
+
+/* Drops the least recently used renders until at most limit are left */
+static int
+_font_render_cache_trim(PyFontObject *self, Py_ssize_t limit)
+{
+    PyObject *cache = self->render_cache;
+    PyObject *oldest, *value;
+    Py_ssize_t pos;
+    int err;
+
+    while (PyDict_Size(cache) > limit) {
+        pos = 0;
+        if (!PyDict_Next(cache, &pos, &oldest, &value)) {
+            break;
+        }
+        Py_INCREF(oldest);
+        err = PyDict_DelItem(cache, oldest);
+        Py_DECREF(oldest);
+        if (err) {
+            return -1;
+        }
+        self->render_cache_evictions++;
+    }
+    return 0;
+}
+
+/* Stores a fresh render in the cache of the font. Returns a new reference
+ * to the surface to hand out, or NULL with an exception set. */
+static PyObject *
+_font_render_cache_put(PyFontObject *self, PyObject *key, PyObject *surfobj)
+{
+    if (_font_render_cache_trim(self, self->render_cache_limit - 1) ||
+        PyDict_SetItem(self->render_cache, key, surfobj)) {
+        return NULL;
+    }
+
+    if (self->render_cache_shared) {
+        Py_INCREF(surfobj);
+        return surfobj;
+    }
+    /* the caller owns what it gets back, keep the cached one pristine */
+    return PyObject_CallMethod(surfobj, "copy", NULL);
+}
+
 static PyObject *
 font_render(PyObject *self, PyObject *args, PyObject *kwds)
 {
@@ -602,8 +701,10 @@ font_render(PyObject *self, PyObject *args, PyObject *kwds)
     }
 
     TTF_Font *font = PyFont_AsFont(self);
+    PyFontObject *fontobj = (PyFontObject *)self;
     int antialias;
     PyObject *text, *final;
+    PyObject *key = NULL;
     PyObject *fg_rgba_obj, *bg_rgba_obj = Py_None;
     Uint8 rgba[] = {0, 0, 0, 0};
     SDL_Surface *surf;
@@ -672,6 +773,24 @@ font_render(PyObject *self, PyObject *args, PyObject *kwds)
     /* if text is Py_None, leave astring as a null byte to represent 0
        length string */
 
+    /* subclasses of str and bytes are not cached, they could hold references
+       back to the font */
+    if (fontobj->render_cache &&
+        (PyUnicode_CheckExact(text) || PyBytes_CheckExact(text) ||
+         text == Py_None)) {
+        key = Py_BuildValue("(Oi(iii)(iii)ii)", text, antialias, foreg.r,
+                            foreg.g, foreg.b, backg.r, backg.g, backg.b,
+                            bg_rgba_obj != Py_None, wraplength);
+        if (key == NULL) {
+            return NULL;
+        }
+        final = _font_render_cache_get(fontobj, key);
+        if (final != NULL || PyErr_Occurred()) {
+            Py_DECREF(key);
+            return final;
+        }
+    }
+
     if (strlen(astring) == 0) { /* special 0 string case */
 #if SDL_TTF_VERSION_ATLEAST(3, 0, 0)
         int height = TTF_GetFontHeight(font);
@@ -722,6 +841,7 @@ font_render(PyObject *self, PyObject *args, PyObject *kwds)
     }
 
     if (surf == NULL) {
+        Py_XDECREF(key);
         return RAISE(pgExc_SDLError, TTF_GetError());
     }
 
@@ -729,9 +849,80 @@ font_render(PyObject *self, PyObject *args, PyObject *kwds)
     if (final == NULL) {
         SDL_FreeSurface(surf);
     }
+    else if (key != NULL) {
+        PyObject *surfobj = final;
+
+        final = _font_render_cache_put(fontobj, key, surfobj);
+        Py_DECREF(surfobj);
+    }
+    Py_XDECREF(key);
     return final;
 }
 
+static PyObject *
+font_set_render_cache(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyFontObject *fontobj = (PyFontObject *)self;
+    Py_ssize_t size;
+    int shared = 0;
+
+    static char *kwlist[] = {"size", "shared", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "n|p", kwlist, &size,
+                                     &shared)) {
+        return NULL;
+    }
+
+    if (size < 0) {
+        return RAISE(PyExc_ValueError, "size must be >= 0");
+    }
+
+    if (size == 0) {
+        Py_CLEAR(fontobj->render_cache);
+    }
+    else if (fontobj->render_cache == NULL) {
+        fontobj->render_cache = PyDict_New();
+        if (fontobj->render_cache == NULL) {
+            return NULL;
+        }
+    }
+    else if (_font_render_cache_trim(fontobj, size)) {
+        return NULL;
+    }
+    fontobj->render_cache_limit = size;
+    fontobj->render_cache_shared = shared;
+
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+font_get_render_cache_stats(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    PyFontObject *fontobj = (PyFontObject *)self;
+    PyObject *stats;
+    int reset = 0;
+
+    static char *kwlist[] = {"reset", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|p", kwlist, &reset)) {
+        return NULL;
+    }
+
+    stats = Py_BuildValue(
+        "{s:n,s:n,s:n,s:n,s:n}", "hits", fontobj->render_cache_hits,
+        "misses", fontobj->render_cache_misses, "evictions",
+        fontobj->render_cache_evictions, "size",
+        fontobj->render_cache ? PyDict_Size(fontobj->render_cache) : 0,
+        "limit", fontobj->render_cache_limit);
+
+    if (stats != NULL && reset) {
+        fontobj->render_cache_hits = 0;
+        fontobj->render_cache_misses = 0;
+        fontobj->render_cache_evictions = 0;
+    }
+    return stats;
+}
+
 static PyObject *
 font_size(PyObject *self, PyObject *text)
 {
@@ -823,6 +1014,7 @@ font_setter_point_size(PyFontObject *self, PyObject *value, void *closure)
         return -1;
     }
     self->ptsize = val;
+    _font_invalidate_render_cache((PyObject *)self);
 
     return 0;
 }
@@ -866,6 +1058,7 @@ font_set_ptsize(PyObject *self, PyObject *arg)
         return RAISE(pgExc_SDLError, SDL_GetError());
     }
     ((PyFontObject *)self)->ptsize = val;
+    _font_invalidate_render_cache(self);
 
     Py_RETURN_NONE;
 }
@@ -908,6 +1101,7 @@ font_setter_outline(PyObject *self, PyObject *value, void *closure)
 #else
     TTF_SetFontOutline(font, (int)val);
 #endif
+    _font_invalidate_render_cache(self);
     return 0;
 }
 
@@ -1066,6 +1260,7 @@ font_set_script(PyObject *self, PyObject *arg)
     {
         return RAISE(pgExc_SDLError, SDL_GetError());
     }
+    _font_invalidate_render_cache(self);
 #else
     return RAISE(pgExc_SDLError,
                  "pygame.font not compiled with a new enough SDL_ttf version. "
@@ -1149,6 +1344,7 @@ font_set_direction(PyObject *self, PyObject *arg, PyObject *kwarg)
     {
         return RAISE(pgExc_SDLError, SDL_GetError());
     }
+    _font_invalidate_render_cache(self);
 
 #else
     return RAISE(pgExc_SDLError,
@@ -1205,6 +1401,10 @@ static PyMethodDef font_methods[] = {
     {"metrics", font_metrics, METH_O, DOC_FONT_FONT_METRICS},
     {"render", (PyCFunction)font_render, METH_VARARGS | METH_KEYWORDS,
      DOC_FONT_FONT_RENDER},
+    {"set_render_cache", (PyCFunction)font_set_render_cache,
+     METH_VARARGS | METH_KEYWORDS, DOC_FONT_FONT_SETRENDERCACHE},
+    {"get_render_cache_stats", (PyCFunction)font_get_render_cache_stats,
+     METH_VARARGS | METH_KEYWORDS, DOC_FONT_FONT_GETRENDERCACHESTATS},
     {"size", font_size, METH_O, DOC_FONT_FONT_SIZE},
     {"set_script", font_set_script, METH_O, DOC_FONT_FONT_SETSCRIPT},
     {"set_direction", (PyCFunction)font_set_direction,
@@ -1239,6 +1439,8 @@ font_dealloc(PyFontObject *self)
 #endif
     }
 
+    Py_CLEAR(self->render_cache);
+
     if (self->weakreflist) {
         PyObject_ClearWeakRefs((PyObject *)self);
     }
@@ -1256,6 +1458,7 @@ font_init(PyFontObject *self, PyObject *args, PyObject *kwds)
     static char *kwlist[] = {"filename", "size", NULL};
 
     self->font = NULL;
+    _font_invalidate_render_cache((PyObject *)self);
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "|Oi", kwlist, &obj,
                                      &fontsize)) {
         return -1;
@@ -0,0 +1,354 @@
+/*
+  pygame-ce - Python Game Library
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Library General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Library General Public License for more details.
+
+  You should have received a copy of the GNU Library General Public
+  License along with this library; if not, write to the Free
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*/
+
+/*
+ * Glyph atlas: every glyph bitmap rendered through the atlas is painted once,
+ * in its final color, into a single RGBA surface shared by all atlas renders
+ * of a font. Glyphs are packed on shelves, left to right and top to bottom.
+ * The surface grows by doubling, which keeps the position of the glyphs
+ * already packed, and is cleared when it would grow beyond
+ * PGFT_MAX_ATLAS_SIZE.
+ */
+
+#define PYGAME_FREETYPE_INTERNAL
+
+#include "ft_wrap.h"
+
+/* Space left between packed glyphs */
+#define ATLAS_PADDING 1
+
+typedef struct atlaskey_ {
+    GlyphIndex_t id;
+    Scale_t face_size;
+    FT_UInt16 style;
+    FT_UInt16 render_flags;
+    FT_Angle rotation;
+    FT_Fixed strength;
+    FontColor color;
+} AtlasKey;
+
+typedef struct atlasnode_ {
+    struct atlasnode_ *next;
+    AtlasKey key;
+    FT_UInt32 hash;
+    SDL_Rect area;
+} AtlasNode;
+
+static void
+set_atlas_key(AtlasKey *key, GlyphIndex_t id, const FontRenderMode *mode,
+              const FontColor *color)
+{
+    /* Same fields as the glyph cache key, see ft_cache.c */
+    const FT_UInt16 style_mask = ~(FT_STYLE_UNDERLINE);
+    const FT_UInt16 rflag_mask = ~(FT_RFLAG_VERTICAL | FT_RFLAG_KERNING);
+
+    memset(key, 0, sizeof(*key));
+    key->id = id;
+    key->face_size = mode->face_size;
+    key->style = mode->style & style_mask;
+    key->render_flags = mode->render_flags & rflag_mask;
+    key->rotation = mode->rotation_angle;
+    key->strength = mode->strength;
+    key->color = *color;
+}
+
+static FT_UInt32
+get_atlas_hash(const AtlasKey *key)
+{
+    /* 32 bit FNV-1a */
+    const FT_Byte *bytes = (const FT_Byte *)key;
+    FT_UInt32 h = 2166136261u;
+    size_t i;
+
+    for (i = 0; i < sizeof(*key); ++i) {
+        h ^= bytes[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void
+free_nodes(FontAtlas *atlas)
+{
+    AtlasNode *node, *next;
+    FT_UInt32 i;
+
+    if (!atlas->nodes) {
+        return;
+    }
+    for (i = 0; i <= atlas->size_mask; ++i) {
+        for (node = atlas->nodes[i]; node; node = next) {
+            next = node->next;
+            _PGFT_free(node);
+        }
+        atlas->nodes[i] = 0;
+    }
+    atlas->count = 0;
+}
+
+static int
+grow_table(FontAtlas *atlas)
+{
+    FT_UInt32 new_size = atlas->nodes ? (atlas->size_mask + 1) * 2 : 256;
+    AtlasNode **nodes = _PGFT_calloc(new_size, sizeof(AtlasNode *));
+    AtlasNode *node, *next;
+    FT_UInt32 i;
+
+    if (!nodes) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (atlas->nodes) {
+        for (i = 0; i <= atlas->size_mask; ++i) {
+            for (node = atlas->nodes[i]; node; node = next) {
+                next = node->next;
+                node->next = nodes[node->hash & (new_size - 1)];
+                nodes[node->hash & (new_size - 1)] = node;
+            }
+        }
+        _PGFT_free(atlas->nodes);
+    }
+    atlas->nodes = nodes;
+    atlas->size_mask = new_size - 1;
+    return 0;
+}
+
+/* Replaces the atlas surface with a transparent one of the given size,
+ * keeping the pixels packed so far */
+static int
+resize_surface(FontAtlas *atlas, int width, int height)
+{
+    SDL_Surface *old_surf =
+        atlas->surface ? pgSurface_AsSurface(atlas->surface) : NULL;
+    SDL_Surface *surf;
+    PyObject *surfobj;
+    int y;
+
+    surf = PG_CreateSurface(width, height, SDL_PIXELFORMAT_RGBA32);
+    if (!surf) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return -1;
+    }
+    SDL_FillRect(surf, NULL, 0);
+    SDL_SetSurfaceBlendMode(surf, SDL_BLENDMODE_BLEND);
+
+    if (old_surf && atlas->height > 0) {
+        if (!PG_LockSurface(old_surf)) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            SDL_FreeSurface(surf);
+            return -1;
+        }
+        for (y = 0; y < atlas->height; ++y) {
+            memcpy((FT_Byte *)surf->pixels + y * surf->pitch,
+                   (FT_Byte *)old_surf->pixels + y * old_surf->pitch,
+                   (size_t)atlas->width * 4);
+        }
+        SDL_UnlockSurface(old_surf);
+    }
+
+    surfobj = (PyObject *)pgSurface_New(surf);
+    if (!surfobj) {
+        SDL_FreeSurface(surf);
+        return -1;
+    }
+    /* Surfaces handed out earlier stay valid, they keep their own pixels */
+    Py_XDECREF(atlas->surface);
+    atlas->surface = surfobj;
+    atlas->width = width;
+    atlas->height = height;
+    return 0;
+}
+
+/* Finds room for a w by h glyph, on the current shelf, else on a new one,
+ * else after growing the surface. Returns 1 if the atlas is full. */
+static int
+pack_glyph(FontAtlas *atlas, int w, int h, SDL_Rect *area)
+{
+    int pw = w + ATLAS_PADDING;
+    int ph = h + ATLAS_PADDING;
+    int width = atlas->width;
+    int height = atlas->height;
+
+    if (!width) {
+        width = height = PGFT_MIN_ATLAS_SIZE;
+    }
+    for (;;) {
+        if (atlas->shelf_x + pw <= width &&
+            atlas->shelf_y + MAX(atlas->shelf_h, ph) <= height) {
+            break;
+        }
+        if (atlas->shelf_x > 0 && pw <= width &&
+            atlas->shelf_y + atlas->shelf_h + ph <= height) {
+            atlas->shelf_y += atlas->shelf_h;
+            atlas->shelf_x = 0;
+            atlas->shelf_h = 0;
+            break;
+        }
+        if (width <= height && width < PGFT_MAX_ATLAS_SIZE) {
+            width *= 2;
+        }
+        else if (height < PGFT_MAX_ATLAS_SIZE) {
+            height *= 2;
+        }
+        else if (width < PGFT_MAX_ATLAS_SIZE) {
+            width *= 2;
+        }
+        else {
+            return 1;
+        }
+    }
+    if ((width != atlas->width || height != atlas->height) &&
+        resize_surface(atlas, width, height)) {
+        return -1;
+    }
+
+    area->x = atlas->shelf_x;
+    area->y = atlas->shelf_y;
+    area->w = w;
+    area->h = h;
+    atlas->shelf_x += pw;
+    atlas->shelf_h = MAX(atlas->shelf_h, ph);
+    return 0;
+}
+
+/* Paints a glyph bitmap into the atlas, coverage becoming alpha */
+static int
+paint_glyph(FontAtlas *atlas, const FT_Bitmap *bitmap, const SDL_Rect *area,
+            const FontColor *color)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(atlas->surface);
+    const FT_Byte *src_row;
+    FT_Byte *dst;
+    FT_Byte alpha;
+    int x, y;
+
+    if (!PG_LockSurface(surf)) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return -1;
+    }
+    for (y = 0; y < area->h; ++y) {
+        src_row = bitmap->buffer + y * bitmap->pitch;
+        dst = (FT_Byte *)surf->pixels + (area->y + y) * surf->pitch +
+              area->x * 4;
+        for (x = 0; x < area->w; ++x, dst += 4) {
+            if (bitmap->pixel_mode == FT_PIXEL_MODE_GRAY) {
+                alpha = (FT_Byte)((src_row[x] * color->a + 127) / 255);
+            }
+            else {
+                alpha = (src_row[x >> 3] & (0x80 >> (x & 7))) ? color->a : 0;
+            }
+            /* SDL_PIXELFORMAT_RGBA32 is R, G, B, A in memory order */
+            dst[0] = color->r;
+            dst[1] = color->g;
+            dst[2] = color->b;
+            dst[3] = alpha;
+        }
+    }
+    SDL_UnlockSurface(surf);
+    return 0;
+}
+
+void
+_PGFT_Atlas_Clear(FontAtlas *atlas)
+{
+    free_nodes(atlas);
+    atlas->shelf_x = 0;
+    atlas->shelf_y = 0;
+    atlas->shelf_h = 0;
+    if (atlas->surface) {
+        SDL_FillRect(pgSurface_AsSurface(atlas->surface), NULL, 0);
+    }
+}
+
+void
+_PGFT_Atlas_Destroy(FontAtlas *atlas)
+{
+    if (!atlas) {
+        return;
+    }
+    free_nodes(atlas);
+    _PGFT_free(atlas->nodes);
+    atlas->nodes = 0;
+    Py_CLEAR(atlas->surface);
+    atlas->width = 0;
+    atlas->height = 0;
+    atlas->shelf_x = 0;
+    atlas->shelf_y = 0;
+    atlas->shelf_h = 0;
+}
+
+PyObject *
+_PGFT_Atlas_GetSurface(FontAtlas *atlas)
+{
+    if (!atlas->surface &&
+        resize_surface(atlas, PGFT_MIN_ATLAS_SIZE, PGFT_MIN_ATLAS_SIZE)) {
+        return 0;
+    }
+    return atlas->surface;
+}
+
+int
+_PGFT_Atlas_FindGlyph(FontAtlas *atlas, GlyphIndex_t id,
+                      const FontRenderMode *mode, const FontColor *color,
+                      const FT_Bitmap *bitmap, SDL_Rect *area)
+{
+    AtlasKey key;
+    AtlasNode *node;
+    FT_UInt32 hash;
+    int full;
+
+    set_atlas_key(&key, id, mode, color);
+    hash = get_atlas_hash(&key);
+
+    if (atlas->nodes) {
+        for (node = atlas->nodes[hash & atlas->size_mask]; node;
+             node = node->next) {
+            if (node->hash == hash && !memcmp(&node->key, &key, sizeof(key))) {
+                *area = node->area;
+                return 0;
+            }
+        }
+    }
+
+    full = pack_glyph(atlas, (int)bitmap->width, (int)bitmap->rows, area);
+    if (full) {
+        return full;
+    }
+
+    if (paint_glyph(atlas, bitmap, area, color)) {
+        return -1;
+    }
+
+    if ((!atlas->nodes || atlas->count > atlas->size_mask) &&
+        grow_table(atlas)) {
+        return -1;
+    }
+    node = _PGFT_malloc(sizeof(AtlasNode));
+    if (!node) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    node->key = key;
+    node->hash = hash;
+    node->area = *area;
+    node->next = atlas->nodes[hash & atlas->size_mask];
+    atlas->nodes[hash & atlas->size_mask] = node;
+    atlas->count++;
+    return 0;
+}
@@ -43,8 +43,11 @@ typedef union cachenodekey_ {
 typedef struct cachenode_ {
     FontGlyph glyph;
     struct cachenode_ *next;
+    struct cachenode_ *lru_prev;
+    struct cachenode_ *lru_next;
     NodeKey key;
     FT_UInt32 hash;
+    size_t size; /* bytes charged to the cache budget */
 } CacheNode;
 
 static FT_UInt32
@@ -54,6 +57,12 @@ allocate_node(FontCache *, const FontRenderMode *, GlyphIndex_t, void *);
 static void
 free_node(FontCache *, CacheNode *);
 static void
+lru_unlink(FontCache *, CacheNode *);
+static void
+lru_push_front(FontCache *, CacheNode *);
+static void
+grow_table(FontCache *);
+static void
 set_node_key(NodeKey *, GlyphIndex_t, const FontRenderMode *);
 static int
 equal_node_keys(const NodeKey *, const NodeKey *);
@@ -149,22 +158,16 @@ _PGFT_Cache_Init(FreeTypeInstance *ft, FontCache *cache)
     if (!cache->nodes) {
         return -1;
     }
-    cache->depths = _PGFT_calloc((size_t)cache_size, sizeof(FT_Byte));
-    if (!cache->depths) {
-        _PGFT_free(cache->nodes);
-        cache->nodes = 0;
-        return -1;
-    }
     cache->free_nodes = 0;
+    cache->lru_head = 0;
+    cache->lru_tail = 0;
+    cache->max_bytes = PGFT_DEFAULT_CACHE_BYTES;
+    cache->resident_bytes = 0;
+    cache->count = 0;
+    cache->generation = 0;
     cache->size_mask = (FT_UInt32)(cache_size - 1);
+    _PGFT_Cache_ResetStats(cache);
 
-#ifdef PGFT_DEBUG_CACHE
-    cache->_debug_count = 0;
-    cache->_debug_delete_count = 0;
-    cache->_debug_access = 0;
-    cache->_debug_hit = 0;
-    cache->_debug_miss = 0;
-#endif
     return 0;
 }
 
@@ -177,10 +180,6 @@ _PGFT_Cache_Destroy(FontCache *cache)
         return;
     }
 
-    /* PGFT_DEBUG_CACHE - Here is a good place to set a breakpoint
-     * to examine _debug fields.
-     */
-
     if (cache->nodes) {
         FT_UInt i;
 
@@ -196,41 +195,47 @@ _PGFT_Cache_Destroy(FontCache *cache)
         _PGFT_free(cache->nodes);
         cache->nodes = 0;
     }
-    _PGFT_free(cache->depths);
-    cache->depths = 0;
 }
 
+/* Evicts the least recently used glyphs until the cache fits its budget.
+ * Glyph pointers handed out earlier may dangle afterwards, which is why
+ * the active layout checks the cache generation before reusing its glyphs.
+ */
 void
 _PGFT_Cache_Cleanup(FontCache *cache)
 {
-    const FT_Byte MAX_BUCKET_DEPTH = 2;
-    CacheNode *node, *prev;
-    FT_UInt32 i;
-
-    for (i = 0; i <= cache->size_mask; ++i) {
-        while (cache->depths[i] > MAX_BUCKET_DEPTH) {
-            node = cache->nodes[i];
-            prev = 0;
-
-            for (;;) {
-                if (!node->next) {
-#ifdef PGFT_DEBUG_CACHE
-                    cache->_debug_delete_count++;
-#endif
+    CacheNode *node, **link;
 
-                    if (prev) {
-                        prev->next = 0;
-                    }
-
-                    free_node(cache, node);
-                    break;
-                }
+    if (!cache->max_bytes || cache->resident_bytes <= cache->max_bytes) {
+        return;
+    }
 
-                prev = node;
-                node = node->next;
-            }
+    while (cache->lru_tail && cache->resident_bytes > cache->max_bytes) {
+        node = cache->lru_tail;
+        link = &cache->nodes[node->hash & cache->size_mask];
+        while (*link != node) {
+            link = &(*link)->next;
         }
+        *link = node->next;
+        free_node(cache, node);
+        cache->evictions++;
     }
+    cache->generation++;
+}
+
+void
+_PGFT_Cache_SetBudget(FontCache *cache, size_t max_bytes)
+{
+    cache->max_bytes = max_bytes;
+    _PGFT_Cache_Cleanup(cache);
+}
+
+void
+_PGFT_Cache_ResetStats(FontCache *cache)
+{
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
 }
 
 FontGlyph *
@@ -250,10 +255,6 @@ _PGFT_Cache_FindGlyph(GlyphIndex_t id, const FontRenderMode *render,
     node = nodes[bucket];
     prev = 0;
 
-#ifdef PGFT_DEBUG_CACHE
-    cache->_debug_access++;
-#endif
-
     while (node) {
         if (equal_node_keys(&node->key, &key)) {
             if (prev) {
@@ -261,10 +262,12 @@ _PGFT_Cache_FindGlyph(GlyphIndex_t id, const FontRenderMode *render,
                 node->next = nodes[bucket];
                 nodes[bucket] = node;
             }
+            if (node != cache->lru_head) {
+                lru_unlink(cache, node);
+                lru_push_front(cache, node);
+            }
 
-#ifdef PGFT_DEBUG_CACHE
-            cache->_debug_hit++;
-#endif
+            cache->hits++;
 
             return &node->glyph;
         }
@@ -275,13 +278,69 @@ _PGFT_Cache_FindGlyph(GlyphIndex_t id, const FontRenderMode *render,
 
     node = allocate_node(cache, render, id, internal);
 
-#ifdef PGFT_DEBUG_CACHE
-    cache->_debug_miss++;
-#endif
+    cache->misses++;
 
     return node ? &node->glyph : 0;
 }
 
+static void
+lru_unlink(FontCache *cache, CacheNode *node)
+{
+    if (node->lru_prev) {
+        node->lru_prev->lru_next = node->lru_next;
+    }
+    else {
+        cache->lru_head = node->lru_next;
+    }
+    if (node->lru_next) {
+        node->lru_next->lru_prev = node->lru_prev;
+    }
+    else {
+        cache->lru_tail = node->lru_prev;
+    }
+    node->lru_prev = 0;
+    node->lru_next = 0;
+}
+
+static void
+lru_push_front(FontCache *cache, CacheNode *node)
+{
+    node->lru_prev = 0;
+    node->lru_next = cache->lru_head;
+    if (cache->lru_head) {
+        cache->lru_head->lru_prev = node;
+    }
+    else {
+        cache->lru_tail = node;
+    }
+    cache->lru_head = node;
+}
+
+/* Doubles the bucket count, keeping chains short as the budget allows more
+ * glyphs than the initial table size. Failing to grow is not an error. */
+static void
+grow_table(FontCache *cache)
+{
+    FT_UInt32 new_size = (cache->size_mask + 1) * 2;
+    CacheNode **nodes = _PGFT_calloc((size_t)new_size, sizeof(CacheNode *));
+    CacheNode *node, *next;
+    FT_UInt32 i;
+
+    if (!nodes) {
+        return;
+    }
+    for (i = 0; i <= cache->size_mask; ++i) {
+        for (node = cache->nodes[i]; node; node = next) {
+            next = node->next;
+            node->next = nodes[node->hash & (new_size - 1)];
+            nodes[node->hash & (new_size - 1)] = node;
+        }
+    }
+    _PGFT_free(cache->nodes);
+    cache->nodes = nodes;
+    cache->size_mask = new_size - 1;
+}
+
 static void
 free_node(FontCache *cache, CacheNode *node)
 {
@@ -289,11 +348,9 @@ free_node(FontCache *cache, CacheNode *node)
         return;
     }
 
-#ifdef PGFT_DEBUG_CACHE
-    cache->_debug_count--;
-#endif
-
-    cache->depths[node->hash & cache->size_mask]--;
+    lru_unlink(cache, node);
+    cache->resident_bytes -= node->size;
+    cache->count--;
 
     FT_Done_Glyph((FT_Glyph)(node->glyph.image));
     _PGFT_free(node);
@@ -304,6 +361,7 @@ allocate_node(FontCache *cache, const FontRenderMode *render, GlyphIndex_t id,
               void *internal)
 {
     CacheNode *node = _PGFT_calloc(1, sizeof(CacheNode));
+    const FT_Bitmap *bitmap;
     FT_UInt32 bucket;
 
     if (!node) {
@@ -314,17 +372,22 @@ allocate_node(FontCache *cache, const FontRenderMode *render, GlyphIndex_t id,
         goto cleanup;
     }
 
+    if (cache->count > 2 * cache->size_mask) {
+        grow_table(cache);
+    }
+
     set_node_key(&node->key, id, render);
     node->hash = get_hash(&node->key);
     bucket = node->hash & cache->size_mask;
     node->next = cache->nodes[bucket];
     cache->nodes[bucket] = node;
 
-    cache->depths[bucket]++;
-
-#ifdef PGFT_DEBUG_CACHE
-    cache->_debug_count++;
-#endif
+    bitmap = &node->glyph.image->bitmap;
+    node->size = sizeof(CacheNode) + sizeof(*node->glyph.image) +
+                 (size_t)bitmap->rows * (size_t)abs(bitmap->pitch);
+    cache->resident_bytes += node->size;
+    cache->count++;
+    lru_push_front(cache, node);
 
     return node;
 
@@ -102,6 +102,7 @@ _PGFT_LayoutInit(FreeTypeInstance *ft, pgFontObject *fontobj)
 
     ftext->buffer_size = 0;
     ftext->glyphs = 0;
+    ftext->cache_generation = 0;
 
     if (_PGFT_Cache_Init(ft, cache)) {
         PyErr_NoMemory();
@@ -122,6 +123,7 @@ _PGFT_LayoutFree(pgFontObject *fontobj)
         ftext->glyphs = 0;
     }
     _PGFT_Cache_Destroy(cache);
+    _PGFT_Atlas_Destroy(&fontobj->_internals->glyph_atlas);
 }
 
 Layout *
@@ -135,6 +137,11 @@ _PGFT_LoadLayout(FreeTypeInstance *ft, pgFontObject *fontobj,
     FT_Face font = 0;
     TextContext context;
 
+    if (ftext->cache_generation != cache->generation) {
+        /* Some glyphs of the layout may have been evicted since */
+        level = UPDATE_GLYPHS;
+    }
+
     if (level != UPDATE_NONE) {
         copy_mode(&ftext->mode, mode);
         font = _PGFT_GetFontSized(ft, fontobj, mode->face_size);
@@ -156,6 +163,7 @@ _PGFT_LoadLayout(FreeTypeInstance *ft, pgFontObject *fontobj,
             if (load_glyphs(ftext, &context, cache)) {
                 return 0;
             }
+            ftext->cache_generation = cache->generation;
             /* fall through */
 
         case UPDATE_LAYOUT:
@@ -490,6 +498,45 @@ _PGFT_GetMetrics(FreeTypeInstance *ft, pgFontObject *fontobj,
     return 0;
 }
 
+Py_ssize_t
+_PGFT_PreloadGlyphs(FreeTypeInstance *ft, pgFontObject *fontobj,
+                    const FontRenderMode *mode, PGFT_String *text)
+{
+    FontCache *cache = &(fontobj->_internals->glyph_cache);
+    Py_ssize_t length = PGFT_String_GET_LENGTH(text);
+    PGFT_char *data = PGFT_String_GET_DATA(text);
+    GlyphIndex_t id;
+    TextContext context;
+    FT_Face font;
+    Py_ssize_t count = 0;
+    Py_ssize_t i;
+
+    font = _PGFT_GetFontSized(ft, fontobj, mode->face_size);
+    if (!font) {
+        PyErr_SetString(pgExc_SDLError, _PGFT_GetError(ft));
+        return -1;
+    }
+
+    _PGFT_Cache_Cleanup(cache);
+
+    fill_context(&context, ft, fontobj, mode, font);
+    for (i = 0; i < length; ++i) {
+        id = FTC_CMapCache_Lookup(context.charmap, context.id, -1,
+                                  (FT_UInt32)data[i]);
+        if (!id) {
+            /* not in the font */
+            continue;
+        }
+        if (!_PGFT_Cache_FindGlyph(id, mode, cache, &context)) {
+            PyErr_Format(pgExc_SDLError, "Unable to load glyph for id %lu",
+                         (unsigned long)id);
+            return -1;
+        }
+        ++count;
+    }
+    return count;
+}
+
 int
 _PGFT_LoadGlyph(FontGlyph *glyph, GlyphIndex_t id, const FontRenderMode *mode,
                 void *internal)
@@ -548,6 +548,120 @@ _PGFT_Render_NewSurface(FreeTypeInstance *ft, pgFontObject *fontobj,
     return surface;
 }
 
+/*********************************************************
+ *
+ * Rendering through the glyph atlas
+ *
+ *********************************************************/
+int
+_PGFT_Render_Atlas(FreeTypeInstance *ft, pgFontObject *fontobj,
+                   const FontRenderMode *mode, PGFT_String *text,
+                   const FontColor *fgcolor, int x, int y, AtlasQuad **quads,
+                   int *count, SDL_Rect *r)
+{
+    FontAtlas *atlas = &fontobj->_internals->glyph_atlas;
+    Layout *font_text;
+    GlyphSlot *slots;
+    FT_Bitmap *bitmap;
+    AtlasQuad *quad = 0;
+    unsigned width = 0;
+    unsigned height = 0;
+    FT_Vector offset;
+    FT_Vector origin;
+    FT_Pos underline_top;
+    FT_Fixed underline_size;
+    int n;
+    int pass;
+    int result = 0;
+
+    *quads = 0;
+    *count = 0;
+
+    if (mode->style & FT_STYLE_UNDERLINE) {
+        PyErr_SetString(PyExc_ValueError,
+                        "the underline style is unsupported for atlas "
+                        "rendering");
+        return -1;
+    }
+
+    /* build font text */
+    font_text = _PGFT_LoadLayout(ft, fontobj, mode, text);
+    if (!font_text) {
+        return -1;
+    }
+
+    if (font_text->length > 0) {
+        _PGFT_GetRenderMetrics(mode, font_text, &width, &height, &offset,
+                               &underline_top, &underline_size);
+    }
+    if (font_text->length == 0 || width == 0 || height == 0) {
+        /* Nothing to render */
+        r->x = 0;
+        r->y = 0;
+        r->w = 0;
+        r->h = (Uint16)_PGFT_Font_GetHeightSized(ft, fontobj, mode->face_size);
+        return 0;
+    }
+
+    origin.x = INT_TO_FX6(x);
+    origin.y = INT_TO_FX6(y);
+    if (mode->render_flags & FT_RFLAG_ORIGIN) {
+        x -= FX6_TRUNC(FX6_CEIL(offset.x));
+        y -= FX6_TRUNC(FX6_CEIL(offset.y));
+    }
+    else {
+        origin.x += offset.x;
+        origin.y += offset.y;
+    }
+
+    *quads = _PGFT_malloc(sizeof(AtlasQuad) * font_text->length);
+    if (!*quads) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    /* A full atlas is cleared once and the whole text packed again, as the
+     * quads already made point into the cleared pixels */
+    slots = font_text->glyphs;
+    for (pass = 0; pass < 2; ++pass) {
+        quad = *quads;
+        for (n = 0; n < font_text->length; ++n) {
+            bitmap = &slots[n].glyph->image->bitmap;
+            if (bitmap->width == 0 || bitmap->rows == 0) {
+                continue;
+            }
+            result = _PGFT_Atlas_FindGlyph(atlas, slots[n].id, mode, fgcolor,
+                                           bitmap, &quad->area);
+            if (result) {
+                break;
+            }
+            quad->x = FX6_TRUNC(FX6_CEIL(origin.x + slots[n].posn.x));
+            quad->y = FX6_TRUNC(FX6_CEIL(origin.y + slots[n].posn.y));
+            ++quad;
+        }
+        if (result != 1) {
+            break;
+        }
+        _PGFT_Atlas_Clear(atlas);
+    }
+    if (result) {
+        if (result == 1) {
+            PyErr_SetString(PyExc_ValueError,
+                            "text too large for the glyph atlas");
+        }
+        _PGFT_free(*quads);
+        *quads = 0;
+        return -1;
+    }
+
+    *count = (int)(quad - *quads);
+    r->x = (Sint16)x;
+    r->y = (Sint16)y;
+    r->w = (Uint16)width;
+    r->h = (Uint16)height;
+    return 0;
+}
+
 /*********************************************************
  *
  * Rendering on generic arrays
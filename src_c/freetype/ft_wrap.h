@@ -51,11 +51,17 @@
 /* Internal configuration variables */
 #define PGFT_DEFAULT_CACHE_SIZE 64
 #define PGFT_MIN_CACHE_SIZE 32
+/* Default memory budget of a font's glyph cache, in bytes */
+#define PGFT_DEFAULT_CACHE_BYTES (4 * 1024 * 1024)
 #if defined(PGFT_DEBUG_CACHE)
 #undef PGFT_DEBUG_CACHE
 #endif
 #define PGFT_DEFAULT_RESOLUTION 72 /* dots per inch */
 
+/* Initial and largest side of the glyph atlas, in pixels */
+#define PGFT_MIN_ATLAS_SIZE 256
+#define PGFT_MAX_ATLAS_SIZE 2048
+
 #define PGFT_DBL_DEFAULT_STRENGTH (1.0 / 36.0)
 
 /* Rendering styles unsupported for bitmap fonts */
@@ -123,19 +129,47 @@ typedef struct fontcache_ {
     struct cachenode_ **nodes;
     struct cachenode_ *free_nodes;
 
-    FT_Byte *depths;
+    /* least recently used list, most recent first */
+    struct cachenode_ *lru_head;
+    struct cachenode_ *lru_tail;
 
-#ifdef PGFT_DEBUG_CACHE
-    FT_UInt32 _debug_count;
-    FT_UInt32 _debug_delete_count;
-    FT_UInt32 _debug_access;
-    FT_UInt32 _debug_hit;
-    FT_UInt32 _debug_miss;
-#endif
+    size_t max_bytes;      /* budget, 0 for no limit */
+    size_t resident_bytes; /* nodes and glyph bitmaps */
+    FT_UInt32 count;
+
+    /* bumped whenever glyphs are evicted, see _PGFT_LoadLayout */
+    FT_UInt32 generation;
+
+    unsigned long hits;
+    unsigned long misses;
+    unsigned long evictions;
 
     FT_UInt32 size_mask;
 } FontCache;
 
+struct atlasnode_;
+
+typedef struct fontatlas_ {
+    struct atlasnode_ **nodes;
+    FT_UInt32 size_mask;
+    FT_UInt32 count;
+
+    PyObject *surface; /* the atlas pgSurfaceObject, or NULL while empty */
+    int width;
+    int height;
+
+    /* packing cursor: the current shelf and its height */
+    int shelf_x;
+    int shelf_y;
+    int shelf_h;
+} FontAtlas;
+
+typedef struct atlasquad_ {
+    SDL_Rect area; /* glyph in the atlas */
+    int x;         /* destination */
+    int y;
+} AtlasQuad;
+
 typedef struct fontmetrics_ {
     /* All these are 26.6 precision */
     FT_Pos bearing_x;
@@ -183,6 +217,8 @@ typedef struct layout_ {
 
     int buffer_size;
     GlyphSlot *glyphs;
+
+    FT_UInt32 cache_generation; /* glyph cache generation of the glyphs */
 } Layout;
 
 struct fontsurface_;
@@ -212,6 +248,7 @@ typedef struct fontsurface_ {
 typedef struct fontinternals_ {
     Layout active_text;
     FontCache glyph_cache;
+    FontAtlas glyph_atlas;
 } FontInternals;
 
 typedef struct PGFT_String_ {
@@ -219,9 +256,7 @@ typedef struct PGFT_String_ {
     PGFT_char data[];
 } PGFT_String;
 
-#if defined(PGFT_DEBUG_CACHE)
 #define PGFT_FONT_CACHE(f) ((f)->_internals->glyph_cache)
-#endif
 
 /**********************************************************
  * Module state
@@ -326,6 +361,10 @@ int
 _PGFT_Render_Array(FreeTypeInstance *, pgFontObject *, const FontRenderMode *,
                    PyObject *, PGFT_String *, int, int, int, SDL_Rect *);
 int
+_PGFT_Render_Atlas(FreeTypeInstance *, pgFontObject *, const FontRenderMode *,
+                   PGFT_String *, const FontColor *, int, int, AtlasQuad **,
+                   int *, SDL_Rect *);
+int
 _PGFT_BuildRenderMode(FreeTypeInstance *, pgFontObject *, FontRenderMode *,
                       Scale_t, int, Angle_t);
 int _PGFT_CheckStyle(FT_UInt32);
@@ -405,6 +444,9 @@ _PGFT_LoadLayout(FreeTypeInstance *, pgFontObject *, const FontRenderMode *,
                  PGFT_String *);
 int
 _PGFT_LoadGlyph(FontGlyph *, GlyphIndex_t, const FontRenderMode *, void *);
+Py_ssize_t
+_PGFT_PreloadGlyphs(FreeTypeInstance *, pgFontObject *, const FontRenderMode *,
+                    PGFT_String *);
 
 /**************************************** Glyph cache management *************/
 int
@@ -413,9 +455,24 @@ void
 _PGFT_Cache_Destroy(FontCache *);
 void
 _PGFT_Cache_Cleanup(FontCache *);
+void
+_PGFT_Cache_SetBudget(FontCache *, size_t);
+void
+_PGFT_Cache_ResetStats(FontCache *);
 FontGlyph *
 _PGFT_Cache_FindGlyph(FT_UInt32, const FontRenderMode *, FontCache *, void *);
 
+/**************************************** Glyph atlas management *************/
+void
+_PGFT_Atlas_Destroy(FontAtlas *);
+void
+_PGFT_Atlas_Clear(FontAtlas *);
+PyObject *
+_PGFT_Atlas_GetSurface(FontAtlas *);
+int
+_PGFT_Atlas_FindGlyph(FontAtlas *, GlyphIndex_t, const FontRenderMode *,
+                      const FontColor *, const FT_Bitmap *, SDL_Rect *);
+
 /**************************************** Unicode ****************************/
 PGFT_String *
 _PGFT_EncodePyString(PyObject *, int);
@@ -1,5 +1,6 @@
 #include "circle.c"
 #include "line.c"
+#include "spatialhash.c"
 #include "geometry_common.c"
 
 static PyMethodDef geometry_methods[] = {{NULL, NULL, 0, NULL}};
@@ -42,6 +43,11 @@ MODINIT_DEFINE(geometry)
         return NULL;
     }
 
+    if (PyModule_AddType(module, &pgSpatialHash_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
     c_api[0] = &pgCircle_Type;
     c_api[1] = &pgLine_Type;
     apiobj = encapsulate_api(c_api, "geometry");
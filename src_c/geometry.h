@@ -32,8 +32,49 @@ typedef struct {
 #define pgLine_AsLine(o) (pgLine_CAST(o)->line)
 #define pgLine_Check(o) ((o)->ob_type == &pgLine_Type)
 
+/* A uniform grid broad-phase index. Every entry is linked into the cells its
+ * rect covers, cells live in an open addressing table keyed by their packed
+ * grid coordinates. */
+typedef struct {
+    int *items;
+    int count;
+    int capacity;
+} pgSpatialBucket;
+
+typedef struct {
+    Sint64 coords;
+    int used;
+    pgSpatialBucket bucket;
+} pgSpatialCell;
+
+typedef struct {
+    PyObject *key; /* borrowed, the index dict owns the reference */
+    double x0, y0, x1, y1;
+    int cx0, cy0, cx1, cy1; /* for free entries, cx0 is the next free slot */
+    int large;
+    Uint32 stamp;
+} pgSpatialEntry;
+
+typedef struct {
+    PyObject_HEAD double cell_size;
+    PyObject *index; /* key -> entry slot */
+    pgSpatialEntry *entries;
+    int entries_len;
+    int entries_capacity;
+    int free_head;
+    pgSpatialBucket large;
+    pgSpatialCell *cells;
+    int cells_used;
+    int cells_capacity;
+    Uint32 stamp;
+    PyObject *weakreflist;
+} pgSpatialHashObject;
+
+#define pgSpatialHash_Check(o) ((o)->ob_type == &pgSpatialHash_Type)
+
 static PyTypeObject pgCircle_Type;
 static PyTypeObject pgLine_Type;
+static PyTypeObject pgSpatialHash_Type;
 
 /* Constants */
 
@@ -50,6 +50,9 @@ static PyObject *extsaveobj = NULL;
 static PyObject *extverobj = NULL;
 static PyObject *ext_load_sized_svg = NULL;
 static PyObject *ext_load_animation = NULL;
+/* The decoder behind load_extended, for load_async() to call without the
+ * GIL. Takes ownership of the SDL_RWops, like IMG_LoadTyped_RW */
+static SDL_Surface *(*ext_load_rw)(SDL_RWops *, const char *) = NULL;
 
 static inline void
 pad(char **data, int padding)
@@ -1890,6 +1893,430 @@ image_load_animation(PyObject *self, PyObject *args, PyObject *kwargs)
                  "Support for animation loading was not compiled in.");
 }
 
+/* Asynchronous loading
+ *
+ * load_async() queues a batch of files on a small pool of SDL threads that
+ * live as long as the process. Workers decode (and convert) the images with
+ * nothing but SDL calls, the AsyncLoad object returned to Python only turns
+ * the finished SDL surfaces into Surface objects.
+ */
+
+/* Upper bound on the number of worker threads, there are never more than
+ * CPU cores */
+#define ASYNC_MAX_THREADS 4
+
+typedef struct {
+    char *file;        /* UTF-8 path */
+    SDL_Surface *surf; /* until AsyncLoad.result() takes it */
+    char *error;       /* copy of SDL_GetError() if loading failed */
+} pgAsyncImage;
+
+typedef struct pgAsyncBatch {
+    struct pgAsyncBatch *next; /* in the queue */
+    pgAsyncImage *images;
+    int count;
+    int started;  /* images handed to a worker */
+    int finished; /* images done, failed or not */
+    int refs;     /* the AsyncLoad object, and the pool until finished */
+    /* what to convert images without and with per pixel alpha to, 0 to
+     * leave them as they were decoded */
+    PG_PixelFormatEnum format;
+    PG_PixelFormatEnum alpha_format;
+} pgAsyncBatch;
+
+typedef struct {
+    PyObject_HEAD pgAsyncBatch *batch;
+    PyObject *result; /* the list of Surfaces, once made */
+} pgAsyncLoadObject;
+
+/* All of the batch fields but images[] are guarded by async_mutex, an
+ * image belongs to the worker that started it until it is finished */
+static SDL_mutex *async_mutex = NULL;
+static SDL_cond *async_work_cond = NULL; /* a batch was queued */
+static SDL_cond *async_done_cond = NULL; /* an image was finished */
+static pgAsyncBatch *async_queue_head = NULL;
+static pgAsyncBatch *async_queue_tail = NULL;
+static int async_num_threads = 0;
+
+static void
+async_batch_free(pgAsyncBatch *batch)
+{
+    int i;
+
+    for (i = 0; i < batch->count; i++) {
+        free(batch->images[i].file);
+        free(batch->images[i].error);
+        if (batch->images[i].surf) {
+            SDL_FreeSurface(batch->images[i].surf);
+        }
+    }
+    free(batch->images);
+    free(batch);
+}
+
+/* Drops a reference to batch, called with async_mutex held */
+static void
+async_batch_decref(pgAsyncBatch *batch)
+{
+    if (--batch->refs == 0) {
+        async_batch_free(batch);
+    }
+}
+
+static void
+async_load_image(pgAsyncImage *image, PG_PixelFormatEnum format,
+                 PG_PixelFormatEnum alpha_format)
+{
+    SDL_Surface *surf = NULL, *newsurf;
+    SDL_RWops *rw;
+    const char *ext;
+
+    rw = SDL_RWFromFile(image->file, "rb");
+    if (rw) {
+        if (ext_load_rw) {
+            ext = strrchr(image->file, '.');
+            ext = (ext && ext[1]) ? ext + 1 : NULL;
+            surf = ext_load_rw(rw, ext);
+        }
+        else {
+            surf = SDL_LoadBMP_RW(rw, 1);
+        }
+    }
+
+    if (surf && format) {
+        /* The same formats and blend modes as Surface.convert() and
+         * Surface.convert_alpha() */
+        if (SDL_ISPIXELFORMAT_ALPHA(PG_SURF_FORMATENUM(surf))) {
+            newsurf = PG_ConvertSurfaceFormat(surf, alpha_format);
+            if (newsurf) {
+                SDL_SetSurfaceBlendMode(newsurf, SDL_BLENDMODE_BLEND);
+            }
+        }
+        else {
+            newsurf = PG_ConvertSurfaceFormat(surf, format);
+            if (newsurf) {
+                SDL_SetSurfaceBlendMode(newsurf, SDL_BLENDMODE_NONE);
+            }
+        }
+        SDL_FreeSurface(surf);
+        surf = newsurf;
+    }
+
+    if (surf) {
+        image->surf = surf;
+    }
+    else {
+        /* SDL errors are per thread */
+        image->error = SDL_strdup(SDL_GetError());
+        if (!image->error) {
+            image->error = SDL_strdup("out of memory");
+        }
+    }
+}
+
+static int SDLCALL
+async_worker(void *_null)
+{
+    pgAsyncBatch *batch;
+    int i;
+
+    PG_LockMutex(async_mutex);
+    for (;;) {
+        while (!async_queue_head) {
+            SDL_CondWait(async_work_cond, async_mutex);
+        }
+        batch = async_queue_head;
+        i = batch->started++;
+        if (batch->started == batch->count) {
+            async_queue_head = batch->next;
+            if (!async_queue_head) {
+                async_queue_tail = NULL;
+            }
+        }
+        PG_UnlockMutex(async_mutex);
+
+        async_load_image(&batch->images[i], batch->format,
+                         batch->alpha_format);
+
+        PG_LockMutex(async_mutex);
+        if (++batch->finished == batch->count) {
+            async_batch_decref(batch);
+        }
+        SDL_CondBroadcast(async_done_cond);
+    }
+    return 0;
+}
+
+/* Starts up to want workers in total, returns 0 if there are none to run a
+ * batch on */
+static int
+async_start_workers(int want)
+{
+    SDL_Thread *thread;
+
+    if (!async_mutex) {
+        async_mutex = SDL_CreateMutex();
+        async_work_cond = SDL_CreateCond();
+        async_done_cond = SDL_CreateCond();
+        if (!async_mutex || !async_work_cond || !async_done_cond) {
+            /* No threads here (emscripten), load_async() loads in place */
+            if (async_mutex) {
+                SDL_DestroyMutex(async_mutex);
+                async_mutex = NULL;
+            }
+            return 0;
+        }
+    }
+
+    want = MIN(want, MIN(SDL_GetCPUCount(), ASYNC_MAX_THREADS));
+    while (async_num_threads < want) {
+        thread = SDL_CreateThread(async_worker, "pg_image_async", NULL);
+        if (!thread) {
+            break;
+        }
+        SDL_DetachThread(thread);
+        async_num_threads++;
+    }
+    return async_num_threads > 0;
+}
+
+/* Same as pg_DisplayFormatAlpha() in surface.c */
+static PG_PixelFormatEnum
+async_alpha_format(PG_PixelFormatEnum dformat)
+{
+    switch (dformat) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        case SDL_PIXELFORMAT_XBGR1555:
+#else
+        case SDL_PIXELFORMAT_BGR555:
+#endif
+        case SDL_PIXELFORMAT_ABGR1555:
+        case SDL_PIXELFORMAT_BGR565:
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            return SDL_PIXELFORMAT_ABGR8888;
+
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        case SDL_PIXELFORMAT_BGR24:
+#else
+        case SDL_PIXELFORMAT_RGB24:
+#endif
+            return SDL_PIXELFORMAT_BGRA8888;
+
+        default:
+            return SDL_PIXELFORMAT_ARGB8888;
+    }
+}
+
+static void
+async_load_dealloc(pgAsyncLoadObject *self)
+{
+    if (self->batch) {
+        if (async_mutex) {
+            PG_LockMutex(async_mutex);
+            async_batch_decref(self->batch);
+            PG_UnlockMutex(async_mutex);
+        }
+        else {
+            async_batch_decref(self->batch);
+        }
+    }
+    Py_XDECREF(self->result);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *
+async_load_done(pgAsyncLoadObject *self, PyObject *_null)
+{
+    int done;
+
+    if (!async_mutex) {
+        Py_RETURN_TRUE;
+    }
+    PG_LockMutex(async_mutex);
+    done = self->batch->finished == self->batch->count;
+    PG_UnlockMutex(async_mutex);
+    return PyBool_FromLong(done);
+}
+
+static PyObject *
+async_load_result(pgAsyncLoadObject *self, PyObject *_null)
+{
+    pgAsyncBatch *batch = self->batch;
+    pgAsyncImage *image;
+    PyObject *list, *surfobj;
+    int i;
+
+    if (self->result) {
+        return Py_NewRef(self->result);
+    }
+
+    if (async_mutex) {
+        Py_BEGIN_ALLOW_THREADS;
+        PG_LockMutex(async_mutex);
+        while (batch->finished != batch->count) {
+            SDL_CondWait(async_done_cond, async_mutex);
+        }
+        PG_UnlockMutex(async_mutex);
+        Py_END_ALLOW_THREADS;
+    }
+
+    /* Every image is finished, so they can be read without the mutex */
+    for (i = 0; i < batch->count; i++) {
+        image = &batch->images[i];
+        if (image->error) {
+            return RAISE(pgExc_SDLError, image->error);
+        }
+    }
+
+    list = PyList_New(batch->count);
+    if (!list) {
+        return NULL;
+    }
+    for (i = 0; i < batch->count; i++) {
+        image = &batch->images[i];
+        surfobj = (PyObject *)pgSurface_New(image->surf);
+        if (!surfobj) {
+            Py_DECREF(list);
+            return NULL;
+        }
+        image->surf = NULL;
+        PyList_SET_ITEM(list, i, surfobj);
+    }
+    self->result = Py_NewRef(list);
+    return list;
+}
+
+static PyMethodDef async_load_methods[] = {
+    {"done", (PyCFunction)async_load_done, METH_NOARGS,
+     DOC_IMAGE_ASYNCLOAD_DONE},
+    {"result", (PyCFunction)async_load_result, METH_NOARGS,
+     DOC_IMAGE_ASYNCLOAD_RESULT},
+    {NULL, NULL, 0, NULL}};
+
+static PyTypeObject pgAsyncLoad_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.image.AsyncLoad",
+    .tp_basicsize = sizeof(pgAsyncLoadObject),
+    .tp_dealloc = (destructor)async_load_dealloc,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = DOC_IMAGE_ASYNCLOAD,
+    .tp_methods = async_load_methods,
+};
+
+static PyObject *
+image_load_async(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    PyObject *files, *seq, *encoded;
+    pgAsyncLoadObject *handle;
+    pgAsyncBatch *batch;
+    PG_PixelFormatEnum dformat;
+    Py_ssize_t len, i;
+    int convert = 1;
+    static char *kwds[] = {"files", "convert", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O|p", kwds, &files,
+                                     &convert)) {
+        return NULL;
+    }
+
+    seq = PySequence_Fast(files, "files must be a sequence of file paths");
+    if (!seq) {
+        return NULL;
+    }
+    len = PySequence_Fast_GET_SIZE(seq);
+    if (len > INT_MAX) {
+        Py_DECREF(seq);
+        return RAISE(PyExc_ValueError, "too many files");
+    }
+
+    handle = PyObject_New(pgAsyncLoadObject, &pgAsyncLoad_Type);
+    if (!handle) {
+        Py_DECREF(seq);
+        return NULL;
+    }
+    handle->result = NULL;
+    handle->batch = batch = calloc(1, sizeof(pgAsyncBatch));
+    if (batch) {
+        batch->images = calloc(len ? len : 1, sizeof(pgAsyncImage));
+        if (!batch->images) {
+            free(batch);
+            handle->batch = batch = NULL;
+        }
+    }
+    if (!batch) {
+        Py_DECREF(handle);
+        Py_DECREF(seq);
+        return PyErr_NoMemory();
+    }
+    /* Only the AsyncLoad object has the batch for now, so it frees the
+     * paths if anything fails from here on */
+    batch->refs = 1;
+
+    for (i = 0; i < len; i++) {
+        /* Paths only, file objects need the GIL to be read */
+        encoded = pg_EncodeString(PySequence_Fast_GET_ITEM(seq, i), "UTF-8",
+                                  NULL, NULL);
+        if (!encoded) {
+            goto error;
+        }
+        if (encoded == Py_None) {
+            Py_DECREF(encoded);
+            PyErr_SetString(PyExc_TypeError,
+                            "load_async() can only load files by path");
+            goto error;
+        }
+        batch->images[i].file = strdup(PyBytes_AS_STRING(encoded));
+        Py_DECREF(encoded);
+        if (!batch->images[i].file) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        batch->count++;
+    }
+    Py_DECREF(seq);
+
+    dformat = convert ? pg_GetDefaultConvertFormat() : 0;
+    if (dformat && !SDL_ISPIXELFORMAT_INDEXED(dformat)) {
+        batch->format = dformat;
+        batch->alpha_format = async_alpha_format(dformat);
+    }
+
+    if (!batch->count) {
+        return (PyObject *)handle;
+    }
+
+    if (!async_start_workers(batch->count)) {
+        Py_BEGIN_ALLOW_THREADS;
+        for (i = 0; i < batch->count; i++) {
+            async_load_image(&batch->images[i], batch->format,
+                             batch->alpha_format);
+        }
+        Py_END_ALLOW_THREADS;
+        batch->started = batch->finished = batch->count;
+        return (PyObject *)handle;
+    }
+
+    PG_LockMutex(async_mutex);
+    batch->refs++;
+    if (async_queue_tail) {
+        async_queue_tail->next = batch;
+    }
+    else {
+        async_queue_head = batch;
+    }
+    async_queue_tail = batch;
+    SDL_CondBroadcast(async_work_cond);
+    PG_UnlockMutex(async_mutex);
+    return (PyObject *)handle;
+
+error:
+    Py_DECREF(seq);
+    Py_DECREF(handle);
+    return NULL;
+}
+
 static PyMethodDef _image_methods[] = {
     {"load_basic", (PyCFunction)image_load_basic, METH_O, DOC_IMAGE_LOADBASIC},
     {"load_extended", (PyCFunction)image_load_extended,
@@ -1900,6 +2327,8 @@ static PyMethodDef _image_methods[] = {
      METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_LOADSIZEDSVG},
     {"load_animation", (PyCFunction)image_load_animation,
      METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_LOADANIMATION},
+    {"load_async", (PyCFunction)image_load_async,
+     METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_LOADASYNC},
 
     {"save_extended", (PyCFunction)image_save_extended,
      METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_SAVEEXTENDED},
@@ -1926,6 +2355,7 @@ MODINIT_DEFINE(image)
 {
     PyObject *module;
     PyObject *extmodule;
+    PyObject *capsule;
 
     static struct PyModuleDef _module = {PyModuleDef_HEAD_INIT,
                                          "image",
@@ -1953,11 +2383,20 @@ MODINIT_DEFINE(image)
         return NULL;
     }
 
+    if (PyType_Ready(&pgAsyncLoad_Type) < 0) {
+        return NULL;
+    }
+
     /* create the module */
     module = PyModule_Create(&_module);
     if (module == NULL) {
         return NULL;
     }
+    if (PyModule_AddObjectRef(module, "AsyncLoad",
+                              (PyObject *)&pgAsyncLoad_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
 
     /* try to get extended formats */
     extmodule = PyImport_ImportModule(IMPPREFIX "imageext");
@@ -1985,6 +2424,16 @@ MODINIT_DEFINE(image)
         if (!ext_load_animation) {
             goto error;
         }
+        capsule = PyObject_GetAttrString(extmodule, "_load_rw");
+        if (!capsule) {
+            goto error;
+        }
+        ext_load_rw =
+            PyCapsule_GetPointer(capsule, IMPPREFIX "imageext._load_rw");
+        Py_DECREF(capsule);
+        if (!ext_load_rw) {
+            goto error;
+        }
         Py_DECREF(extmodule);
     }
     else {
@@ -86,6 +86,44 @@ iext_find_extension(char *fullname)
     return dot + 1;
 }
 
+/* Decodes an image, takes ownership of rw. Returns NULL with the SDL_image
+ * error set on failure. Doesn't need the GIL, image.load_async() decodes
+ * with this on its worker threads. */
+static SDL_Surface *
+iext_load_rw(SDL_RWops *rw, const char *type)
+{
+    SDL_Surface *surf;
+
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    surf = IMG_LoadTyped_IO(rw, 1, type);
+#else
+    surf = IMG_LoadTyped_RW(rw, 1, type);
+#endif
+    if (surf == NULL) {
+        return NULL;
+    }
+
+    /* Vendor in fix from https://github.com/libsdl-org/SDL_image/pull/559.
+     * When that PR is merged this block can be removed. */
+    if (SDL_ISPIXELFORMAT_INDEXED(PG_SURF_FORMATENUM(surf))) {
+        Uint32 colorkey;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        if (SDL_GetSurfaceColorKey(surf, &colorkey))
+#else
+        if (SDL_GetColorKey(surf, &colorkey) == 0)
+#endif
+        {
+            SDL_Palette *pal = PG_GetSurfacePalette(surf);
+            if (pal && colorkey < (Uint32)pal->ncolors) {
+                SDL_Color c = pal->colors[colorkey];
+                c.a = SDL_ALPHA_OPAQUE;
+                SDL_SetPaletteColors(pal, &c, (int)colorkey, 1);
+            }
+        }
+    }
+    return surf;
+}
+
 static PyObject *
 image_load_ext(PyObject *self, PyObject *arg, PyObject *kwarg)
 {
@@ -126,18 +164,10 @@ image_load_ext(PyObject *self, PyObject *arg, PyObject *kwarg)
     SDL_UnlockMutex(_pg_img_mutex);
     */
 
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-    surf = IMG_LoadTyped_IO(rw, 1, type);
-#else
-    surf = IMG_LoadTyped_RW(rw, 1, type);
-#endif
+    surf = iext_load_rw(rw, type);
     Py_END_ALLOW_THREADS;
 #else /* ~WITH_THREAD */
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-    surf = IMG_LoadTyped_IO(rw, 1, type);
-#else
-    surf = IMG_LoadTyped_RW(rw, 1, type);
-#endif
+    surf = iext_load_rw(rw, type);
 #endif /* ~WITH_THREAD */
 
     if (ext) {
@@ -148,25 +178,6 @@ image_load_ext(PyObject *self, PyObject *arg, PyObject *kwarg)
         return RAISE(pgExc_SDLError, IMG_GetError());
     }
 
-    /* Vendor in fix from https://github.com/libsdl-org/SDL_image/pull/559.
-     * When that PR is merged this block can be removed. */
-    if (SDL_ISPIXELFORMAT_INDEXED(PG_SURF_FORMATENUM(surf))) {
-        Uint32 colorkey;
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-        if (SDL_GetSurfaceColorKey(surf, &colorkey))
-#else
-        if (SDL_GetColorKey(surf, &colorkey) == 0)
-#endif
-        {
-            SDL_Palette *pal = PG_GetSurfacePalette(surf);
-            if (pal && colorkey < (Uint32)pal->ncolors) {
-                SDL_Color c = pal->colors[colorkey];
-                c.a = SDL_ALPHA_OPAQUE;
-                SDL_SetPaletteColors(pal, &c, (int)colorkey, 1);
-            }
-        }
-    }
-
     final = (PyObject *)pgSurface_New(surf);
     if (final == NULL) {
         SDL_FreeSurface(surf);
@@ -467,6 +478,8 @@ static PyMethodDef _imageext_methods[] = {
 
 MODINIT_DEFINE(imageext)
 {
+    PyObject *module, *capsule;
+
     static struct PyModuleDef _module = {PyModuleDef_HEAD_INIT,
                                          "imageext",
                                          _imageext_doc,
@@ -505,5 +518,16 @@ MODINIT_DEFINE(imageext)
     */
 
     /* create the module */
-    return PyModule_Create(&_module);
+    module = PyModule_Create(&_module);
+    if (!module) {
+        return NULL;
+    }
+
+    capsule = PyCapsule_New((void *)iext_load_rw,
+                            IMPPREFIX "imageext._load_rw", NULL);
+    if (PyModule_Add(module, "_load_rw", capsule) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
 }
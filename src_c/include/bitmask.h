@@ -170,6 +170,26 @@ void
 bitmask_convolve(const bitmask_t *a, const bitmask_t *b, bitmask_t *o,
                  int xoffset, int yoffset);
 
+/* Side in pixels of the square tiles summarised by one bit of a coarse
+   mask. Divides BITMASK_W_LEN, so a tile never straddles two words. */
+#define BITMASK_TILE 8
+
+/* Updates the coarse mask c of m, where bit (x,y) of c is set if any bit
+   is set in the BITMASK_TILE by BITMASK_TILE tile of m at
+   (x * BITMASK_TILE, y * BITMASK_TILE). Only the tiles touching the w*h
+   area at (x,y) of m are recomputed. c must be
+   ceil(m->w / BITMASK_TILE) by ceil(m->h / BITMASK_TILE) bits. */
+void
+bitmask_coarsen_area(const bitmask_t *m, bitmask_t *c, int x, int y, int w,
+                     int h);
+
+/* Returns zero if the masks summarised by the coarse masks ca and cb, with
+   tiles of tile*tile pixels, cannot overlap at the given offset. A nonzero
+   result only means they might. */
+int
+bitmask_coarse_overlap(const bitmask_t *ca, const bitmask_t *cb, int tile,
+                       int xoffset, int yoffset);
+
 #ifdef __cplusplus
 } /* End of extern "C" { */
 #endif
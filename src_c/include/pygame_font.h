@@ -29,6 +29,13 @@ typedef struct {
     PyObject *weakreflist;
     int ptsize;
     unsigned int ttf_init_generation;
+    /* rendered text cache, see Font.set_render_cache */
+    PyObject *render_cache; /* dict of key -> Surface, oldest first */
+    Py_ssize_t render_cache_limit;
+    int render_cache_shared;
+    Py_ssize_t render_cache_hits;
+    Py_ssize_t render_cache_misses;
+    Py_ssize_t render_cache_evictions;
 } PyFontObject;
 #define PyFont_AsFont(x) (((PyFontObject *)x)->font)
 
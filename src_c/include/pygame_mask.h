@@ -22,11 +22,37 @@
 #include <Python.h>
 #include "bitmask.h"
 
+/* Number of levels in the coarse occupancy pyramid of a mask */
+#define PGMASK_MIP_LEVELS 3
+
 typedef struct {
     PyObject_HEAD bitmask_t *mask;
     void *bufdata;
+    /* Coarse occupancy pyramid, level k summarises tiles of
+     * BITMASK_TILE**(k+1) pixels square. Built by the first overlap query
+     * that can use it, NULL until then. */
+    bitmask_t *mip[PGMASK_MIP_LEVELS];
+    int mip_levels;
 } pgMaskObject;
 
 #define pgMask_AsBitmap(x) (((pgMaskObject *)x)->mask)
 
+#define PYGAMEAPI_MASK_NUMSLOTS 2
+
+#ifndef PYGAMEAPI_MASK_INTERNAL
+#include "pgimport.h"
+
+PYGAMEAPI_DEFINE_SLOTS(mask);
+
+#define pgMask_Type (*(PyTypeObject *)PYGAMEAPI_GET_SLOT(mask, 0))
+
+#define pgMask_Check(x) (PyObject_IsInstance((x), (PyObject *)&pgMask_Type))
+
+/* To be called after changing the bits of a mask through its bitmask, so
+ * the mask drops what it derived from them (the occupancy pyramid) */
+#define pgMask_Changed (*(void (*)(PyObject *))PYGAMEAPI_GET_SLOT(mask, 1))
+
+#define import_pygame_mask() _IMPORT_PYGAME_MODULE(mask)
+#endif /* ~PYGAMEAPI_MASK_INTERNAL */
+
 #endif /* ~PGMASK_H */
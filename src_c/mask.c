@@ -32,9 +32,17 @@
 #include "pygame.h"
 
 #include "pgcompat.h"
+#include "pgparallel.h"
 
 #include "doc/mask_doc.h"
 
+#if !defined(__EMSCRIPTEN__)
+#include "simd_mask.h"
+#define MASK_SIMD 1
+#else
+#define MASK_SIMD 0
+#endif /* __EMSCRIPTEN__ */
+
 #include "structmember.h"
 
 #include <math.h>
@@ -70,6 +78,142 @@ abs_diff_uint32(Uint32 a, Uint32 b)
     return (a > b) ? a - b : b - a;
 }
 
+/* Overlap queries covering fewer pixels than this scan the masks directly,
+ * the coarse tests would cost about as much as the scan itself. */
+#define MASK_MIP_MIN_AREA (64 * 64)
+
+/* Frees the coarse occupancy pyramid of the mask. */
+static void
+mask_mip_clear(pgMaskObject *maskobj)
+{
+    int k;
+
+    for (k = 0; k < maskobj->mip_levels; k++) {
+        bitmask_free(maskobj->mip[k]);
+        maskobj->mip[k] = NULL;
+    }
+    maskobj->mip_levels = 0;
+}
+
+/* C API: drops what the mask derived from its bits after they were changed
+ * directly through its bitmask. */
+static void
+pgMask_Changed(PyObject *maskobj)
+{
+    mask_mip_clear((pgMaskObject *)maskobj);
+}
+
+/* Builds the coarse occupancy pyramid of the mask.
+ *
+ * Returns:
+ *     1 on success, 0 if out of memory (no exception is set)
+ */
+static int
+mask_mip_build(pgMaskObject *maskobj)
+{
+    bitmask_t *level = maskobj->mask;
+    bitmask_t *coarse;
+    int k;
+
+    for (k = 0; k < PGMASK_MIP_LEVELS; k++) {
+        /* Past this point a level would be a single bit. */
+        if (k && level->w <= BITMASK_TILE && level->h <= BITMASK_TILE) {
+            break;
+        }
+        coarse = bitmask_create((level->w - 1) / BITMASK_TILE + 1,
+                                (level->h - 1) / BITMASK_TILE + 1);
+        if (NULL == coarse) {
+            mask_mip_clear(maskobj);
+            return 0;
+        }
+        bitmask_coarsen_area(level, coarse, 0, 0, level->w, level->h);
+        maskobj->mip[k] = coarse;
+        maskobj->mip_levels = k + 1;
+        level = coarse;
+    }
+    return 1;
+}
+
+/* Brings the pyramid of the mask back in sync after the bits in the w*h
+ * area at (x, y) changed. Does nothing if the pyramid is not built. */
+static void
+mask_mip_update(pgMaskObject *maskobj, int x, int y, int w, int h)
+{
+    bitmask_t *level = maskobj->mask;
+    int k;
+
+    for (k = 0; k < maskobj->mip_levels; k++) {
+        if (x < 0) {
+            w += x;
+            x = 0;
+        }
+        if (y < 0) {
+            h += y;
+            y = 0;
+        }
+        if (w <= 0 || h <= 0 || x >= level->w || y >= level->h) {
+            return;
+        }
+        w = MIN(w, level->w - x);
+        h = MIN(h, level->h - y);
+
+        bitmask_coarsen_area(level, maskobj->mip[k], x, y, w, h);
+
+        /* The tiles just updated, as an area of the next level. */
+        w = (x + w - 1) / BITMASK_TILE - x / BITMASK_TILE + 1;
+        h = (y + h - 1) / BITMASK_TILE - y / BITMASK_TILE + 1;
+        x /= BITMASK_TILE;
+        y /= BITMASK_TILE;
+        level = maskobj->mip[k];
+    }
+}
+
+/* Checks the pyramids of two masks, building them if needed, to rule out
+ * an overlap without scanning the masks. Empty tiles, which make up most of
+ * a sparse mask, take no part in the tests.
+ *
+ * Params:
+ *     a: mask object
+ *     b: mask object, offset from a
+ *     x, y: offset of b from a
+ *
+ * Returns:
+ *     0 if the masks cannot overlap, 1 if they might
+ */
+static int
+mask_mip_may_overlap(pgMaskObject *a, pgMaskObject *b, int x, int y)
+{
+    Sint64 w = MIN((Sint64)a->mask->w, (Sint64)x + b->mask->w) - MAX(0, x);
+    Sint64 h = MIN((Sint64)a->mask->h, (Sint64)y + b->mask->h) - MAX(0, y);
+    int i, k, tile;
+
+    if (w <= 0 || h <= 0 || w * h < MASK_MIP_MIN_AREA) {
+        return 1;
+    }
+
+    /* An exported buffer can change the bits behind the pyramid's back. */
+    if (NULL != a->bufdata || NULL != b->bufdata) {
+        return 1;
+    }
+
+    if ((!a->mip_levels && !mask_mip_build(a)) ||
+        (!b->mip_levels && !mask_mip_build(b))) {
+        return 1;
+    }
+
+    /* Coarsest level first, it is the cheapest to test. */
+    k = MIN(a->mip_levels, b->mip_levels) - 1;
+    for (tile = BITMASK_TILE, i = 0; i < k; i++) {
+        tile *= BITMASK_TILE;
+    }
+    for (; k >= 0; k--, tile /= BITMASK_TILE) {
+        if (!bitmask_coarse_overlap(a->mip[k], b->mip[k], tile, x, y)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 /********** mask object methods **********/
 
 /* Copies the given mask. */
@@ -194,6 +338,7 @@ mask_set_at(PyObject *self, PyObject *args, PyObject *kwargs)
         else {
             bitmask_clearbit(mask, x, y);
         }
+        mask_mip_update((pgMaskObject *)self, x, y, 1, 1);
     }
     else {
         PyErr_Format(PyExc_IndexError, "%d, %d is out of bounds", x, y);
@@ -224,6 +369,11 @@ mask_overlap(PyObject *self, PyObject *args, PyObject *kwargs)
         return RAISE(PyExc_TypeError, "offset must be two numbers");
     }
 
+    if (!mask_mip_may_overlap((pgMaskObject *)self, (pgMaskObject *)maskobj,
+                              x, y)) {
+        return Py_NewRef(Py_None);
+    }
+
     val = bitmask_overlap_pos(mask, othermask, x, y, &xp, &yp);
     if (val) {
         return pg_tuple_couple_from_values_int(xp, yp);
@@ -254,6 +404,11 @@ mask_overlap_area(PyObject *self, PyObject *args, PyObject *kwargs)
         return RAISE(PyExc_TypeError, "offset must be two numbers");
     }
 
+    if (!mask_mip_may_overlap((pgMaskObject *)self, (pgMaskObject *)maskobj,
+                              x, y)) {
+        return PyLong_FromLong(0);
+    }
+
     val = bitmask_overlap_area(mask, othermask, x, y);
     return PyLong_FromLong(val);
 }
@@ -283,8 +438,11 @@ mask_overlap_mask(PyObject *self, PyObject *args, PyObject *kwargs)
         return NULL; /* Exception already set. */
     }
 
-    bitmask_overlap_mask(bitmask, pgMask_AsBitmap(maskobj),
-                         output_maskobj->mask, x, y);
+    if (mask_mip_may_overlap((pgMaskObject *)self, (pgMaskObject *)maskobj,
+                             x, y)) {
+        bitmask_overlap_mask(bitmask, pgMask_AsBitmap(maskobj),
+                             output_maskobj->mask, x, y);
+    }
 
     return (PyObject *)output_maskobj;
 }
@@ -295,6 +453,7 @@ mask_fill(PyObject *self, PyObject *_null)
     bitmask_t *mask = pgMask_AsBitmap(self);
 
     bitmask_fill(mask);
+    mask_mip_update((pgMaskObject *)self, 0, 0, mask->w, mask->h);
 
     Py_RETURN_NONE;
 }
@@ -305,6 +464,7 @@ mask_clear(PyObject *self, PyObject *_null)
     bitmask_t *mask = pgMask_AsBitmap(self);
 
     bitmask_clear(mask);
+    mask_mip_update((pgMaskObject *)self, 0, 0, mask->w, mask->h);
 
     Py_RETURN_NONE;
 }
@@ -315,6 +475,7 @@ mask_invert(PyObject *self, PyObject *_null)
     bitmask_t *mask = pgMask_AsBitmap(self);
 
     bitmask_invert(mask);
+    mask_mip_update((pgMaskObject *)self, 0, 0, mask->w, mask->h);
 
     Py_RETURN_NONE;
 }
@@ -352,7 +513,7 @@ static PyObject *
 mask_draw(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     bitmask_t *mask = pgMask_AsBitmap(self);
-    bitmask_t *othermask;
+    bitmask_t *othermask, *source;
     PyObject *maskobj;
     int x, y;
     PyObject *offset = NULL;
@@ -367,9 +528,26 @@ mask_draw(PyObject *self, PyObject *args, PyObject *kwargs)
         return RAISE(PyExc_TypeError, "offset must be two numbers");
     }
 
-    othermask = pgMask_AsBitmap(maskobj);
+    othermask = source = pgMask_AsBitmap(maskobj);
 
-    bitmask_draw(mask, othermask, x, y);
+    /* The strip kernels read words they have already written when other
+     * is this mask, so work from a copy of it. */
+    if (othermask == mask) {
+        source = bitmask_copy(mask);
+
+        if (NULL == source) {
+            return RAISE(PyExc_MemoryError,
+                         "cannot allocate memory for bitmask");
+        }
+    }
+
+    bitmask_draw(mask, source, x, y);
+
+    if (source != othermask) {
+        bitmask_free(source);
+    }
+
+    mask_mip_update((pgMaskObject *)self, x, y, othermask->w, othermask->h);
 
     Py_RETURN_NONE;
 }
@@ -378,7 +556,7 @@ static PyObject *
 mask_erase(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     bitmask_t *mask = pgMask_AsBitmap(self);
-    bitmask_t *othermask;
+    bitmask_t *othermask, *source;
     PyObject *maskobj;
     int x, y;
     PyObject *offset = NULL;
@@ -393,9 +571,26 @@ mask_erase(PyObject *self, PyObject *args, PyObject *kwargs)
         return RAISE(PyExc_TypeError, "offset must be two numbers");
     }
 
-    othermask = pgMask_AsBitmap(maskobj);
+    othermask = source = pgMask_AsBitmap(maskobj);
+
+    /* The strip kernels read words they have already written when other
+     * is this mask, so work from a copy of it. */
+    if (othermask == mask) {
+        source = bitmask_copy(mask);
+
+        if (NULL == source) {
+            return RAISE(PyExc_MemoryError,
+                         "cannot allocate memory for bitmask");
+        }
+    }
 
-    bitmask_erase(mask, othermask, x, y);
+    bitmask_erase(mask, source, x, y);
+
+    if (source != othermask) {
+        bitmask_free(source);
+    }
+
+    mask_mip_update((pgMaskObject *)self, x, y, othermask->w, othermask->h);
 
     Py_RETURN_NONE;
 }
@@ -685,6 +880,8 @@ mask_convolve(PyObject *aobj, PyObject *args, PyObject *kwargs)
     }
 
     bitmask_convolve(a, b, pgMask_AsBitmap(oobj), xoffset, yoffset);
+    mask_mip_update((pgMaskObject *)oobj, xoffset, yoffset, a->w + b->w - 1,
+                    a->h + b->h - 1);
 
     return oobj;
 }
@@ -759,6 +956,132 @@ set_pixel_color(Uint8 *pixel, Uint8 bpp, Uint32 color)
     }
 }
 
+#if MASK_SIMD
+#define MASK_SIMD_NONE 0
+#define MASK_SIMD_SSE2 1
+#define MASK_SIMD_AVX2 2
+
+/* The best row kernels the CPU supports, looked up on first use */
+static int
+mask_simd_backend(void)
+{
+    static int backend = -1;
+
+    if (backend < 0) {
+        if (_pg_bitmask_has_avx2()) {
+            backend = MASK_SIMD_AVX2;
+        }
+        else if (_pg_bitmask_HasSSE_NEON()) {
+            backend = MASK_SIMD_SSE2;
+        }
+        else {
+            backend = MASK_SIMD_NONE;
+        }
+    }
+    return backend;
+}
+
+#define SURF_ROW32(surf, y) \
+    ((const Uint32 *)((Uint8 *)(surf)->pixels + (y) * (surf)->pitch))
+
+/* Sets the bits of a 32 bit surface's pixels whose alpha is greater than
+ * threshold, a whole row of words at a time, see simd_mask.h.
+ *
+ * Returns:
+ *     0 if the CPU has no row kernels and nothing was done, 1 otherwise
+ */
+static int
+simd_set_from_alpha(SDL_Surface *surf, bitmask_t *bitmask, int ashift,
+                    Uint8 threshold)
+{
+    int y, backend = mask_simd_backend();
+
+    if (backend == MASK_SIMD_NONE) {
+        return 0;
+    }
+    for (y = 0; y < surf->h; y++) {
+        if (backend == MASK_SIMD_AVX2) {
+            bitmask_row_alpha_avx2(bitmask->bits + y, bitmask->h,
+                                   SURF_ROW32(surf, y), surf->w, ashift,
+                                   threshold);
+        }
+        else {
+            bitmask_row_alpha_sse2(bitmask->bits + y, bitmask->h,
+                                   SURF_ROW32(surf, y), surf->w, ashift,
+                                   threshold);
+        }
+    }
+    return 1;
+}
+
+/* Sets the bits of a 32 bit surface's pixels that aren't the colorkey, see
+ * simd_set_from_alpha(). */
+static int
+simd_set_from_colorkey(SDL_Surface *surf, bitmask_t *bitmask,
+                       Uint32 colorkey)
+{
+    int y, backend = mask_simd_backend();
+
+    if (backend == MASK_SIMD_NONE) {
+        return 0;
+    }
+    for (y = 0; y < surf->h; y++) {
+        if (backend == MASK_SIMD_AVX2) {
+            bitmask_row_colorkey_avx2(bitmask->bits + y, bitmask->h,
+                                      SURF_ROW32(surf, y), surf->w,
+                                      colorkey);
+        }
+        else {
+            bitmask_row_colorkey_sse2(bitmask->bits + y, bitmask->h,
+                                      SURF_ROW32(surf, y), surf->w,
+                                      colorkey);
+        }
+    }
+    return 1;
+}
+
+/* Sets the bits of a 32 bit surface's pixels whose channels are all within
+ * threshold of color, or of the same pixel of surf2 if it isn't NULL, see
+ * simd_set_from_alpha(). Each channel must be a whole byte. */
+static int
+simd_set_from_distance(SDL_Surface *surf, SDL_Surface *surf2,
+                       bitmask_t *bitmask, Uint32 color, Uint32 threshold,
+                       Uint32 channels)
+{
+    int y, backend = mask_simd_backend();
+    const Uint32 *row2 = NULL;
+
+    if (backend == MASK_SIMD_NONE) {
+        return 0;
+    }
+    for (y = 0; y < surf->h; y++) {
+        if (surf2) {
+            row2 = SURF_ROW32(surf2, y);
+        }
+        if (backend == MASK_SIMD_AVX2) {
+            bitmask_row_distance_avx2(bitmask->bits + y, bitmask->h,
+                                      SURF_ROW32(surf, y), row2, surf->w,
+                                      color, threshold, channels);
+        }
+        else {
+            bitmask_row_distance_sse2(bitmask->bits + y, bitmask->h,
+                                      SURF_ROW32(surf, y), row2, surf->w,
+                                      color, threshold, channels);
+        }
+    }
+    return 1;
+}
+
+/* Whether the red, green and blue channels of a format each fill a byte */
+static int
+rgb_channels_are_bytes(PG_PixelFormat *format)
+{
+    return !(format->Rshift & 7) && format->Rmask == 0xFFu << format->Rshift &&
+           !(format->Gshift & 7) && format->Gmask == 0xFFu << format->Gshift &&
+           !(format->Bshift & 7) && format->Bmask == 0xFFu << format->Bshift;
+}
+#endif /* MASK_SIMD */
+
 /* For each surface pixel's alpha that is greater than the threshold,
  * the corresponding bitmask bit is set.
  *
@@ -812,6 +1135,13 @@ set_from_threshold(SDL_Surface *surf, PG_PixelFormat *surf_format,
         return;
     }
 
+#if MASK_SIMD
+    if (simd_set_from_alpha(surf, bitmask, surf_format->Ashift,
+                            u_threshold)) {
+        return;
+    }
+#endif /* MASK_SIMD */
+
     /*
     The bitmask is stored column-group-major, with each group being 32 or
     64 bits depending on the platform.
@@ -904,6 +1234,12 @@ set_from_colorkey(SDL_Surface *surf, bitmask_t *bitmask, Uint32 colorkey)
     Uint8 *pixel = NULL;
     int x, y;
 
+#if MASK_SIMD
+    if (bpp == 4 && simd_set_from_colorkey(surf, bitmask, colorkey)) {
+        return;
+    }
+#endif /* MASK_SIMD */
+
     for (y = 0; y < surf->h; ++y) {
         pixel = (Uint8 *)surf->pixels + y * surf->pitch;
 
@@ -1042,6 +1378,19 @@ bitmask_threshold(bitmask_t *m, SDL_Surface *surf, PG_PixelFormat *format,
         bpp2 = 0;
     }
 
+#if MASK_SIMD
+    /* With whole byte channels the distance of each channel can be taken
+     * in place, on color and threshold as they are */
+    if (bpp1 == 4 && rgb_channels_are_bytes(format) &&
+        (!surf2 ||
+         (bpp2 == 4 && rmask2 == rmask && gmask2 == gmask &&
+          bmask2 == bmask && surf2->w >= surf->w && surf2->h >= surf->h)) &&
+        simd_set_from_distance(surf, surf2, m, color, threshold,
+                               rmask | gmask | bmask)) {
+        return;
+    }
+#endif /* MASK_SIMD */
+
     PG_GetRGBA(color, format, palette, &r, &g, &b, &a);
     PG_GetRGBA(threshold, format, palette, &tr, &tg, &tb, &ta);
 
@@ -1230,7 +1579,124 @@ mask_from_threshold(PyObject *self, PyObject *args, PyObject *kwargs)
     return (PyObject *)maskobj;
 }
 
-/* The initial labelling phase of the connected components algorithm.
+/* Strips with fewer rows than this are not worth a thread */
+#define CC_MIN_STRIP_ROWS 64
+
+/* Number of threads the connected component functions may use, see
+ * mask.set_num_threads() */
+static int cc_num_threads = 1;
+
+/* Statistics of a connected component, or of one of its provisional labels
+ * while labelling. */
+typedef struct {
+    Sint64 sum_x; /* sums of the pixel coordinates, for the centroid */
+    Sint64 sum_y;
+    unsigned int area;
+    int x_min, y_min, x_max, y_max; /* inclusive bounding box */
+} cc_stats;
+
+/* Labelling job for a horizontal strip of the mask. Each strip numbers its
+ * provisional labels from 1 in its own union-find array. */
+typedef struct {
+    const bitmask_t *input;
+    unsigned int *image; /* labels of the whole mask, or NULL */
+    unsigned int *rows;  /* two rows of labels and a copy of the first row,
+                            used when image is NULL */
+    unsigned int *first_row;
+    unsigned int *last_row;
+    int y_start, y_end;
+    unsigned int label; /* highest label used */
+    unsigned int capacity;
+    unsigned int *ufind; /* the union-find label equivalence array */
+    cc_stats *stats;
+    unsigned int base; /* label offset of the strip in the merged arrays */
+    const unsigned int *remap; /* merged label to component, for relabelling */
+    int failed;
+} cc_strip;
+
+/* Joins the sets of labels a and b. Every set is rooted at its lowest label,
+ * which keeps ufind[label] <= label.
+ *
+ * Returns:
+ *     the root of the joined set
+ */
+static unsigned int
+cc_union(unsigned int *ufind, unsigned int a, unsigned int b)
+{
+    unsigned int root, broot, temp;
+
+    for (root = a; ufind[root] < root; root = ufind[root]) {
+    }
+    for (broot = b; ufind[broot] < broot; broot = ufind[broot]) {
+    }
+    if (broot < root) {
+        root = broot;
+    }
+    /* point both paths straight at the root */
+    while (ufind[a] > root) {
+        temp = ufind[a];
+        ufind[a] = root;
+        a = temp;
+    }
+    while (ufind[b] > root) {
+        temp = ufind[b];
+        ufind[b] = root;
+        b = temp;
+    }
+    return root;
+}
+
+/* Creates a label for a component starting at (x, y).
+ *
+ * Returns:
+ *     the new label, or 0 on memory allocation error
+ */
+static unsigned int
+cc_new_label(cc_strip *strip, int x, int y)
+{
+    unsigned int capacity, *ufind;
+    cc_stats *stats;
+
+    if (strip->label + 1 >= strip->capacity) {
+        capacity = strip->capacity ? strip->capacity * 2 : 256;
+        ufind = realloc(strip->ufind, sizeof(unsigned int) * capacity);
+        if (!ufind) {
+            return 0;
+        }
+        strip->ufind = ufind;
+        stats = realloc(strip->stats, sizeof(cc_stats) * capacity);
+        if (!stats) {
+            return 0;
+        }
+        strip->stats = stats;
+        strip->capacity = capacity;
+    }
+
+    strip->label++;
+    strip->ufind[strip->label] = strip->label;
+    stats = strip->stats + strip->label;
+    stats->sum_x = stats->sum_y = 0;
+    stats->area = 0;
+    stats->x_min = stats->x_max = x;
+    stats->y_min = stats->y_max = y;
+    return strip->label;
+}
+
+/* Adds the statistics of src to dst. */
+static void
+cc_merge_stats(cc_stats *dst, const cc_stats *src)
+{
+    dst->sum_x += src->sum_x;
+    dst->sum_y += src->sum_y;
+    dst->area += src->area;
+    dst->x_min = MIN(dst->x_min, src->x_min);
+    dst->y_min = MIN(dst->y_min, src->y_min);
+    dst->x_max = MAX(dst->x_max, src->x_max);
+    dst->y_max = MAX(dst->y_max, src->y_max);
+}
+
+/* The labelling pass of the connected components algorithm, over the rows
+ * of one strip.
  *
  * Connected component labeling based on the SAUF algorithm by Kesheng Wu,
  * Ekow Otoo, and Kenji Suzuki. The algorithm is best explained by their
@@ -1240,196 +1706,288 @@ mask_from_threshold(PyObject *self, PyObject *args, PyObject *kwargs)
  * need to be checked. It stores equivalence information in an array based
  * union-find.
  *
+ * Only the labels of the previous row are looked at, so without an image
+ * two rows of labels are enough. Words with no bits set are skipped whole.
+ */
+static int
+cc_label_strip(void *data)
+{
+    cc_strip *strip = (cc_strip *)data;
+    const bitmask_t *input = strip->input;
+    const int w = input->w;
+    unsigned int *prev = NULL, *cur = NULL;
+    unsigned int a, b, c, d, label;
+    BITMASK_W word = 0;
+    int x, y, n;
+
+    for (y = strip->y_start; y < strip->y_end; y++) {
+        if (strip->image) {
+            cur = strip->image + (size_t)y * w;
+        }
+        else {
+            cur = strip->rows + (size_t)(y & 1) * w;
+        }
+
+        for (x = 0; x < w; x++) {
+            if (!(x & BITMASK_W_MASK)) {
+                word = input->bits[x / BITMASK_W_LEN * input->h + y];
+                if (!word) {
+                    n = MIN(BITMASK_W_LEN, w - x);
+                    memset(cur + x, 0, sizeof(unsigned int) * n);
+                    x += n - 1;
+                    continue;
+                }
+            }
+            if (!(word & BITMASK_N(x & BITMASK_W_MASK))) {
+                cur[x] = 0;
+                continue;
+            }
+
+            /* neighbors: a b c
+             *            d x   */
+            a = b = c = 0;
+            if (prev) {
+                b = prev[x];
+                a = x > 0 ? prev[x - 1] : 0;
+                c = x + 1 < w ? prev[x + 1] : 0;
+            }
+            d = x > 0 ? cur[x - 1] : 0;
+
+            if (b) {
+                label = b;
+            }
+            else if (c) {
+                if (a) {
+                    label = cc_union(strip->ufind, c, a);
+                }
+                else if (d) {
+                    label = cc_union(strip->ufind, c, d);
+                }
+                else {
+                    label = c;
+                }
+            }
+            else if (a) {
+                label = a;
+            }
+            else if (d) {
+                label = d;
+            }
+            else {
+                label = cc_new_label(strip, x, y);
+                if (!label) {
+                    strip->failed = 1;
+                    return -1;
+                }
+            }
+
+            cur[x] = label;
+            strip->stats[label].sum_x += x;
+            strip->stats[label].sum_y += y;
+            strip->stats[label].area++;
+            strip->stats[label].x_min = MIN(strip->stats[label].x_min, x);
+            strip->stats[label].x_max = MAX(strip->stats[label].x_max, x);
+            strip->stats[label].y_max = y;
+        }
+
+        if (y == strip->y_start) {
+            if (strip->image) {
+                strip->first_row = cur;
+            }
+            else {
+                strip->first_row = strip->rows + 2 * (size_t)w;
+                memcpy(strip->first_row, cur, sizeof(unsigned int) * w);
+            }
+        }
+        prev = cur;
+    }
+    strip->last_row = cur;
+    return 0;
+}
+
+/* Rewrites the labels of one strip of the image as component numbers. */
+static int
+cc_relabel_strip(void *data)
+{
+    cc_strip *strip = (cc_strip *)data;
+    const int w = strip->input->w;
+    unsigned int *buf = strip->image + (size_t)strip->y_start * w;
+    unsigned int *end = strip->image + (size_t)strip->y_end * w;
+
+    for (; buf < end; buf++) {
+        if (*buf) {
+            *buf = strip->remap[strip->base + *buf];
+        }
+    }
+    return 0;
+}
+
+/* Finds the 8-connected components of a mask.
+ *
+ * The mask is split into horizontal strips that are labelled in parallel,
+ * on up to cc_num_threads threads. The labels touching across the strip
+ * boundaries are then joined, and the statistics of all the labels of a
+ * component are added up.
+ *
+ * Allocates memory for ret_stats.
+ *
+ * NOTE: Caller is responsible for freeing the "ret_stats" memory.
+ *
  * Params:
- *     input - the input mask
- *     image - an array to store labelled pixels
- *     ufind - the union-find label equivalence array
- *     largest - an array to store the number of pixels for each label
+ *     input - the mask to search in for the connected components
+ *     image - NULL, or an array of w * h labels which is set to the number
+ *         of the component of each pixel, 0 for unset pixels and the pixels
+ *         of components smaller than min
+ *     min - minimum number of pixels for a component to be considered
+ *     ret_stats - passes back the statistics of each component with the
+ *         first component at index 1, ordered by their topmost then leftmost
+ *         pixel, memory is allocated unless no components are found
  *
  * Returns:
- *     the highest label in the labelled image
+ *     the number of connected components (>= 0)
+ *     -2 on memory allocation error
  */
-unsigned int
-cc_label(bitmask_t *input, unsigned int *image, unsigned int *ufind,
-         unsigned int *largest)
+static int
+cc_label_mask(const bitmask_t *input, unsigned int *image, unsigned int min,
+              cc_stats **ret_stats)
 {
-    unsigned int *buf;
-    unsigned int x, y, w, h, root, aroot, croot, temp, label;
+    cc_strip strips[PG_PARALLEL_MAX_THREADS];
+    unsigned int *ufind = NULL, *top, *bottom;
+    cc_stats *stats = NULL;
+    unsigned int total, label, count;
+    int w = input->w, h = input->h;
+    int i, x, num_strips, ret = -2;
+
+    *ret_stats = NULL;
+    if (!w || !h) {
+        return 0;
+    }
 
-    label = 0;
-    w = input->w;
-    h = input->h;
+    num_strips = MIN(cc_num_threads, h / CC_MIN_STRIP_ROWS);
+    num_strips = MAX(1, MIN(num_strips, PG_PARALLEL_MAX_THREADS));
 
-    ufind[0] = 0;
-    buf = image;
+    memset(strips, 0, sizeof(strips));
+    for (i = 0; i < num_strips; i++) {
+        strips[i].input = input;
+        strips[i].image = image;
+        strips[i].y_start = (int)((Sint64)h * i / num_strips);
+        strips[i].y_end = (int)((Sint64)h * (i + 1) / num_strips);
+        if (!image) {
+            strips[i].rows = malloc(sizeof(unsigned int) * 3 * (size_t)w);
+            if (!strips[i].rows) {
+                goto cleanup;
+            }
+        }
+    }
+
+    pg_run_parallel(cc_label_strip, "pg_mask", strips, sizeof(cc_strip),
+                    num_strips);
 
-    /* special case for first pixel */
-    if (bitmask_getbit(input, 0, 0)) { /* process for a new connected comp: */
-        label++;                       /* create a new label */
-        *buf = label;                  /* give the pixel the label */
-        ufind[label] = label; /* put the label in the equivalence array */
-        largest[label] = 1;   /* the label has 1 pixel associated with it */
+    /* merge the union-find and statistics arrays of the strips */
+    total = 0;
+    for (i = 0; i < num_strips; i++) {
+        if (strips[i].failed) {
+            goto cleanup;
+        }
+        strips[i].base = total;
+        total += strips[i].label;
     }
-    else {
-        *buf = 0;
+    if (!total) {
+        ret = 0;
+        goto cleanup;
     }
-    buf++;
 
-    /* special case for first row.
-           Go over the first row except the first pixel.
-    */
-    for (x = 1; x < w; x++) {
-        if (bitmask_getbit(input, x, 0)) {
-            if (*(buf - 1)) { /* d label */
-                *buf = *(buf - 1);
-            }
-            else { /* create label */
-                label++;
-                *buf = label;
-                ufind[label] = label;
-                largest[label] = 0;
-            }
-            largest[*buf]++;
+    ufind = malloc(sizeof(unsigned int) * (total + 1));
+    stats = malloc(sizeof(cc_stats) * (total + 1));
+    if (!ufind || !stats) {
+        goto cleanup;
+    }
+    ufind[0] = 0;
+    for (i = 0; i < num_strips; i++) {
+        for (label = 1; label <= strips[i].label; label++) {
+            ufind[strips[i].base + label] =
+                strips[i].base + strips[i].ufind[label];
         }
-        else {
-            *buf = 0;
+        if (strips[i].label) {
+            memcpy(stats + strips[i].base + 1, strips[i].stats + 1,
+                   sizeof(cc_stats) * strips[i].label);
         }
-        buf++;
     }
 
-    /* the rest of the image */
-    for (y = 1; y < h; y++) {
-        /* first pixel of the row */
-        if (bitmask_getbit(input, 0, y)) {
-            if (*(buf - w)) { /* b label */
-                *buf = *(buf - w);
+    /* join the labels touching across each strip boundary */
+    for (i = 1; i < num_strips; i++) {
+        top = strips[i - 1].last_row;
+        bottom = strips[i].first_row;
+        for (x = 0; x < w; x++) {
+            if (!bottom[x]) {
+                continue;
             }
-            else if (*(buf - w + 1)) { /* c label */
-                *buf = *(buf - w + 1);
+            label = strips[i].base + bottom[x];
+            if (x > 0 && top[x - 1]) {
+                cc_union(ufind, label, strips[i - 1].base + top[x - 1]);
             }
-            else { /* create label */
-                label++;
-                *buf = label;
-                ufind[label] = label;
-                largest[label] = 0;
+            if (top[x]) {
+                cc_union(ufind, label, strips[i - 1].base + top[x]);
             }
-            largest[*buf]++;
+            if (x + 1 < w && top[x + 1]) {
+                cc_union(ufind, label, strips[i - 1].base + top[x + 1]);
+            }
+        }
+    }
+
+    /* flatten the union-find equivalence array, adding the statistics of
+     * each label to its root. Start at label 1 because label 0 indicates an
+     * unset pixel. */
+    for (label = 1; label <= total; label++) {
+        if (ufind[label] < label) {
+            ufind[label] = ufind[ufind[label]];
+            cc_merge_stats(stats + ufind[label], stats + label);
+        }
+    }
+
+    /* number the components big enough to keep, moving their statistics
+     * down to their number */
+    count = 0;
+    for (label = 1; label <= total; label++) {
+        if (ufind[label] < label) { /* not a root, use the root's number */
+            ufind[label] = ufind[ufind[label]];
+        }
+        else if (stats[label].area >= min) {
+            count++;
+            stats[count] = stats[label];
+            ufind[label] = count;
         }
         else {
-            *buf = 0;
-        }
-        buf++;
-        /* middle pixels of the row */
-        for (x = 1; x < (w - 1); x++) {
-            if (bitmask_getbit(input, x, y)) {
-                if (*(buf - w)) { /* b label */
-                    *buf = *(buf - w);
-                }
-                else if (*(buf - w + 1)) { /* c branch of tree */
-                    if (*(buf - w - 1)) {  /* union(c, a) */
-                        croot = root = *(buf - w + 1);
-                        while (ufind[root] < root) { /* find root */
-                            root = ufind[root];
-                        }
-                        if (croot != *(buf - w - 1)) {
-                            temp = aroot = *(buf - w - 1);
-                            while (ufind[aroot] < aroot) { /* find root */
-                                aroot = ufind[aroot];
-                            }
-                            if (root > aroot) {
-                                root = aroot;
-                            }
-                            while (ufind[temp] > root) { /* set root */
-                                aroot = ufind[temp];
-                                ufind[temp] = root;
-                                temp = aroot;
-                            }
-                        }
-                        while (ufind[croot] > root) { /* set root */
-                            temp = ufind[croot];
-                            ufind[croot] = root;
-                            croot = temp;
-                        }
-                        *buf = root;
-                    }
-                    else if (*(buf - 1)) { /* union(c, d) */
-                        croot = root = *(buf - w + 1);
-                        while (ufind[root] < root) { /* find root */
-                            root = ufind[root];
-                        }
-                        if (croot != *(buf - 1)) {
-                            temp = aroot = *(buf - 1);
-                            while (ufind[aroot] < aroot) { /* find root */
-                                aroot = ufind[aroot];
-                            }
-                            if (root > aroot) {
-                                root = aroot;
-                            }
-                            while (ufind[temp] > root) { /* set root */
-                                aroot = ufind[temp];
-                                ufind[temp] = root;
-                                temp = aroot;
-                            }
-                        }
-                        while (ufind[croot] > root) { /* set root */
-                            temp = ufind[croot];
-                            ufind[croot] = root;
-                            croot = temp;
-                        }
-                        *buf = root;
-                    }
-                    else { /* c label */
-                        *buf = *(buf - w + 1);
-                    }
-                }
-                else if (*(buf - w - 1)) { /* a label */
-                    *buf = *(buf - w - 1);
-                }
-                else if (*(buf - 1)) { /* d label */
-                    *buf = *(buf - 1);
-                }
-                else { /* create label */
-                    label++;
-                    *buf = label;
-                    ufind[label] = label;
-                    largest[label] = 0;
-                }
-                largest[*buf]++;
-            }
-            else {
-                *buf = 0;
-            }
-            buf++;
+            ufind[label] = 0;
         }
-        /* last pixel of the row, if it's not also the first pixel of the row
-         */
-        if (w > 1) {
-            if (bitmask_getbit(input, x, y)) {
-                if (*(buf - w)) { /* b label */
-                    *buf = *(buf - w);
-                }
-                else if (*(buf - w - 1)) { /* a label */
-                    *buf = *(buf - w - 1);
-                }
-                else if (*(buf - 1)) { /* d label */
-                    *buf = *(buf - 1);
-                }
-                else { /* create label */
-                    label++;
-                    *buf = label;
-                    ufind[label] = label;
-                    largest[label] = 0;
-                }
-                largest[*buf]++;
-            }
-            else {
-                *buf = 0;
-            }
-            buf++;
+    }
+
+    if (image && count) {
+        for (i = 0; i < num_strips; i++) {
+            strips[i].remap = ufind;
         }
+        pg_run_parallel(cc_relabel_strip, "pg_mask", strips, sizeof(cc_strip),
+                        num_strips);
+    }
+    else if (image) {
+        memset(image, 0, sizeof(unsigned int) * (size_t)w * h);
+    }
+
+    if (count) {
+        *ret_stats = stats;
+        stats = NULL;
     }
+    ret = (int)count;
 
-    return label;
+cleanup:
+    for (i = 0; i < num_strips; i++) {
+        free(strips[i].rows);
+        free(strips[i].ufind);
+        free(strips[i].stats);
+    }
+    free(ufind);
+    free(stats);
+    return ret;
 }
 
 /* Creates a bounding rect for each connected component in the given mask.
@@ -1452,113 +2010,40 @@ static int
 get_bounding_rects(bitmask_t *input, int *num_bounding_boxes,
                    SDL_Rect **ret_rects)
 {
-    unsigned int *image, *ufind, *largest, *buf;
-    unsigned int x_uf, label = 0;
-    int x, y, w, h, temp, relabel;
+    cc_stats *stats;
     SDL_Rect *rects;
+    int i, count;
 
-    rects = NULL;
+    *ret_rects = NULL;
 
-    w = input->w;
-    h = input->h;
-
-    if (!w || !h) {
-        *ret_rects = rects;
-        return 0;
-    }
-    /* a temporary image to assign labels to each bit of the mask */
-    image = (unsigned int *)malloc(sizeof(unsigned int) * w * h);
-    if (!image) {
+    /* no label image is needed, the statistics have the bounding boxes */
+    count = cc_label_mask(input, NULL, 0, &stats);
+    if (count == -2) {
         return -2;
     }
 
-    /* allocate enough space for the maximum possible connected components */
-    /* the union-find array. see wikipedia for info on union find */
-    ufind = (unsigned int *)malloc(sizeof(unsigned int) * (w / 2 + 1) *
-                                   (h / 2 + 1));
-    if (!ufind) {
-        free(image);
-        return -2;
-    }
-
-    largest = (unsigned int *)malloc(sizeof(unsigned int) * (w / 2 + 1) *
-                                     (h / 2 + 1));
-    if (!largest) {
-        free(image);
-        free(ufind);
-        return -2;
-    }
-
-    /* do the initial labelling */
-    label = cc_label(input, image, ufind, largest);
+    *num_bounding_boxes = count;
 
-    relabel = 0;
-    /* flatten and relabel the union-find equivalence array.  Start at label 1
-       because label 0 indicates an unset pixel.  For this reason, we also use
-       <= label rather than < label. */
-    for (x_uf = 1; x_uf <= label; ++x_uf) {
-        if (ufind[x_uf] < x_uf) {             /* is it a union find root? */
-            ufind[x_uf] = ufind[ufind[x_uf]]; /* relabel it to its root */
-        }
-        else { /* it's a root */
-            relabel++;
-            ufind[x_uf] = relabel; /* assign the lowest label available */
-        }
-    }
-
-    *num_bounding_boxes = relabel;
-
-    if (relabel == 0) {
+    if (count == 0) {
         /* early out, as we didn't find anything. */
-        free(image);
-        free(ufind);
-        free(largest);
-        *ret_rects = rects;
         return 0;
     }
 
     /* the bounding rects, need enough space for the number of labels */
-    rects = (SDL_Rect *)malloc(sizeof(SDL_Rect) * (relabel + 1));
+    rects = (SDL_Rect *)malloc(sizeof(SDL_Rect) * (count + 1));
     if (!rects) {
-        free(image);
-        free(ufind);
-        free(largest);
+        free(stats);
         return -2;
     }
 
-    for (temp = 0; temp <= relabel; temp++) {
-        rects[temp].h = 0; /* so we know if it's a new rect or not */
+    for (i = 1; i <= count; i++) {
+        rects[i].x = stats[i].x_min;
+        rects[i].y = stats[i].y_min;
+        rects[i].w = stats[i].x_max - stats[i].x_min + 1;
+        rects[i].h = stats[i].y_max - stats[i].y_min + 1;
     }
 
-    /* find the bounding rect of each connected component */
-    buf = image;
-    for (y = 0; y < h; y++) {
-        for (x = 0; x < w; x++) {
-            if (ufind[*buf]) { /* if the pixel is part of a component */
-                if (rects[ufind[*buf]].h) { /* the component has a rect */
-                    temp = rects[ufind[*buf]].x;
-                    rects[ufind[*buf]].x = MIN(x, temp);
-                    rects[ufind[*buf]].y = MIN(y, rects[ufind[*buf]].y);
-                    rects[ufind[*buf]].w =
-                        MAX(rects[ufind[*buf]].w + temp, x + 1) -
-                        rects[ufind[*buf]].x;
-                    rects[ufind[*buf]].h = MAX(rects[ufind[*buf]].h,
-                                               y - rects[ufind[*buf]].y + 1);
-                }
-                else { /* otherwise, start the rect */
-                    rects[ufind[*buf]].x = x;
-                    rects[ufind[*buf]].y = y;
-                    rects[ufind[*buf]].w = 1;
-                    rects[ufind[*buf]].h = 1;
-                }
-            }
-            buf++;
-        }
-    }
-
-    free(image);
-    free(ufind);
-    free(largest);
+    free(stats);
     *ret_rects = rects;
 
     return 0;
@@ -1650,9 +2135,9 @@ mask_get_bounding_rects(PyObject *self, PyObject *_null)
 static int
 get_connected_components(bitmask_t *mask, bitmask_t ***components, int min)
 {
-    unsigned int *image, *ufind, *largest, *buf;
-    unsigned int x_uf, min_cc, label = 0;
-    int x, y, w, h, relabel;
+    unsigned int *image, *buf;
+    cc_stats *stats;
+    int x, y, w, h, count;
     bitmask_t **comps;
 
     w = mask->w;
@@ -1668,93 +2153,52 @@ get_connected_components(bitmask_t *mask, bitmask_t ***components, int min)
         return -2;
     }
 
-    /* allocate enough space for the maximum possible connected components */
-    /* the union-find array. see wikipedia for info on union find */
-    ufind = (unsigned int *)malloc(sizeof(unsigned int) * (w / 2 + 1) *
-                                   (h / 2 + 1));
-    if (!ufind) {
-        free(image);
-        return -2;
-    }
-
-    largest = (unsigned int *)malloc(sizeof(unsigned int) * (w / 2 + 1) *
-                                     (h / 2 + 1));
-    if (!largest) {
-        free(image);
-        free(ufind);
-        return -2;
-    }
-
-    /* do the initial labelling */
-    label = cc_label(mask, image, ufind, largest);
-
-    for (x_uf = 1; x_uf <= label; ++x_uf) {
-        if (ufind[x_uf] < x_uf) {
-            largest[ufind[x_uf]] += largest[x_uf];
-        }
-    }
-
-    relabel = 0;
-    min_cc = (0 < min) ? (unsigned int)min : 0;
-
-    /* flatten and relabel the union-find equivalence array.  Start at label 1
-       because label 0 indicates an unset pixel.  For this reason, we also use
-       <= label rather than < label. */
-    for (x_uf = 1; x_uf <= label; ++x_uf) {
-        if (ufind[x_uf] < x_uf) {             /* is it a union find root? */
-            ufind[x_uf] = ufind[ufind[x_uf]]; /* relabel it to its root */
-        }
-        else { /* it's a root */
-            if (largest[x_uf] >= min_cc) {
-                relabel++;
-                ufind[x_uf] = relabel; /* assign the lowest label available */
-            }
-            else {
-                ufind[x_uf] = 0;
-            }
-        }
-    }
+    count = cc_label_mask(mask, image, (0 < min) ? (unsigned int)min : 0,
+                          &stats);
+    free(stats);
 
-    if (relabel == 0) {
-        /* early out, as we didn't find anything. */
+    if (count <= 0) {
+        /* early out, as we didn't find anything or ran out of memory. */
         free(image);
-        free(ufind);
-        free(largest);
-        return 0;
+        return count;
     }
 
     /* allocate space for the mask array */
-    comps = (bitmask_t **)malloc(sizeof(bitmask_t *) * (relabel + 1));
+    comps = (bitmask_t **)malloc(sizeof(bitmask_t *) * (count + 1));
     if (!comps) {
         free(image);
-        free(ufind);
-        free(largest);
         return -2;
     }
 
     /* create the empty masks */
-    for (x = 1; x <= relabel; x++) {
+    for (x = 1; x <= count; x++) {
         comps[x] = bitmask_create(w, h);
+        if (!comps[x]) {
+            while (--x > 0) {
+                bitmask_free(comps[x]);
+            }
+            free(comps);
+            free(image);
+            return -2;
+        }
     }
 
     /* set the bits in each mask */
     buf = image;
     for (y = 0; y < h; y++) {
         for (x = 0; x < w; x++) {
-            if (ufind[*buf]) { /* if the pixel is part of a component */
-                bitmask_setbit(comps[ufind[*buf]], x, y);
+            if (*buf) { /* if the pixel is part of a component */
+                bitmask_setbit(comps[*buf], x, y);
             }
             buf++;
         }
     }
 
     free(image);
-    free(ufind);
-    free(largest);
 
     *components = comps;
 
-    return relabel;
+    return count;
 }
 
 static PyObject *
@@ -1826,6 +2270,66 @@ mask_connected_components(PyObject *self, PyObject *args, PyObject *kwargs)
     return mask_list;
 }
 
+static PyObject *
+mask_connected_component_stats(PyObject *self, PyObject *args,
+                               PyObject *kwargs)
+{
+    bitmask_t *mask = pgMask_AsBitmap(self);
+    PyObject *stats_list = NULL;
+    PyObject *item, *rect;
+    cc_stats *stats = NULL, *comp;
+    int i, num_components, min = 0; /* Default min value. */
+    static char *keywords[] = {"minimum", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|i", keywords, &min)) {
+        return NULL; /* Exception already set. */
+    }
+
+    /* no mask or label image is created for the components */
+    Py_BEGIN_ALLOW_THREADS;
+    num_components = cc_label_mask(
+        mask, NULL, (0 < min) ? (unsigned int)min : 0, &stats);
+    Py_END_ALLOW_THREADS;
+
+    if (num_components == -2) {
+        return RAISE(PyExc_MemoryError,
+                     "cannot allocate memory for connected components");
+    }
+
+    stats_list = PyList_New(num_components);
+    if (!stats_list) {
+        free(stats);
+        return NULL; /* Exception already set. */
+    }
+
+    /* Components are numbered starting at 1. */
+    for (i = 1; i <= num_components; ++i) {
+        comp = stats + i;
+        rect = pgRect_New4(comp->x_min, comp->y_min,
+                           comp->x_max - comp->x_min + 1,
+                           comp->y_max - comp->y_min + 1);
+        if (NULL == rect) {
+            free(stats);
+            Py_DECREF(stats_list);
+            return NULL; /* Exception already set. */
+        }
+
+        /* Same rounding as Mask.centroid(). */
+        item = Py_BuildValue("(IN(ii))", comp->area, rect,
+                             (int)(comp->sum_x / comp->area),
+                             (int)(comp->sum_y / comp->area));
+        if (NULL == item) {
+            free(stats);
+            Py_DECREF(stats_list);
+            return NULL; /* Exception already set. */
+        }
+        PyList_SET_ITEM(stats_list, i - 1, item);
+    }
+
+    free(stats);
+    return stats_list;
+}
+
 /* Finds the largest connected component in a given mask.
  *
  * Tracks the number of pixels in each label, finding the biggest one while
@@ -1847,8 +2351,10 @@ mask_connected_components(PyObject *self, PyObject *args, PyObject *kwargs)
 static int
 largest_connected_comp(bitmask_t *input, bitmask_t *output, int ccx, int ccy)
 {
-    unsigned int *image, *ufind, *largest, *buf;
-    unsigned int max, x, y, w, h, label;
+    unsigned int *image, *buf;
+    cc_stats *stats;
+    unsigned int max, x, y, w, h;
+    int count, i;
 
     w = input->w;
     h = input->h;
@@ -1862,46 +2368,31 @@ largest_connected_comp(bitmask_t *input, bitmask_t *output, int ccx, int ccy)
     if (!image) {
         return -2;
     }
-    /* allocate enough space for the maximum possible connected components */
-    /* the union-find array. see wikipedia for info on union find */
-    ufind = (unsigned int *)malloc(sizeof(unsigned int) * (w / 2 + 1) *
-                                   (h / 2 + 1));
-    if (!ufind) {
+
+    count = cc_label_mask(input, image, 0, &stats);
+    if (count <= 0) {
         free(image);
-        return -2;
+        return count;
     }
-    /* an array to track the number of pixels associated with each label */
-    largest = (unsigned int *)malloc(sizeof(unsigned int) * (w / 2 + 1) *
-                                     (h / 2 + 1));
-    if (!largest) {
-        free(image);
-        free(ufind);
-        return -2;
-    }
-
-    /* do the initial labelling */
-    label = cc_label(input, image, ufind, largest);
 
-    max = 1;
-    /* flatten the union-find equivalence array */
-    for (x = 2; x <= label; x++) {
-        if (ufind[x] != x) {                 /* is it a union find root? */
-            largest[ufind[x]] += largest[x]; /* add its pixels to its root */
-            ufind[x] = ufind[ufind[x]];      /* relabel it to its root */
-        }
-        if (largest[ufind[x]] > largest[max]) { /* is it the new biggest? */
-            max = ufind[x];
+    if (ccx >= 0) {
+        max = image[ccy * w + ccx];
+    }
+    else { /* the first of the biggest components */
+        max = 1;
+        for (i = 2; i <= count; i++) {
+            if (stats[i].area > stats[max].area) {
+                max = i;
+            }
         }
     }
+    free(stats);
 
     /* write out the final image */
     buf = image;
-    if (ccx >= 0) {
-        max = ufind[*(buf + ccy * w + ccx)];
-    }
     for (y = 0; y < h; y++) {
         for (x = 0; x < w; x++) {
-            if (ufind[*buf] == max) {         /* if the label is the max one */
+            if (*buf == max) {                /* if the label is the max one */
                 bitmask_setbit(output, x, y); /* set the bit in the mask */
             }
             buf++;
@@ -1909,8 +2400,6 @@ largest_connected_comp(bitmask_t *input, bitmask_t *output, int ccx, int ccy)
     }
 
     free(image);
-    free(ufind);
-    free(largest);
 
     return 0;
 }
@@ -2481,6 +2970,9 @@ static PyMethodDef mask_methods[] = {
      METH_VARARGS | METH_KEYWORDS, DOC_MASK_MASK_CONNECTEDCOMPONENT},
     {"connected_components", (PyCFunction)mask_connected_components,
      METH_VARARGS | METH_KEYWORDS, DOC_MASK_MASK_CONNECTEDCOMPONENTS},
+    {"connected_component_stats",
+     (PyCFunction)mask_connected_component_stats, METH_VARARGS | METH_KEYWORDS,
+     DOC_MASK_MASK_CONNECTEDCOMPONENTSTATS},
     {"get_bounding_rects", mask_get_bounding_rects, METH_NOARGS,
      DOC_MASK_MASK_GETBOUNDINGRECTS},
     {"to_surface", (PyCFunction)mask_to_surface, METH_VARARGS | METH_KEYWORDS,
@@ -2536,6 +3028,8 @@ mask_dealloc(PyObject *self)
 {
     bitmask_t *bitmask = pgMask_AsBitmap(self);
 
+    mask_mip_clear((pgMaskObject *)self);
+
     if (NULL != bitmask) {
         /* Free up the bitmask. */
         bitmask_free(bitmask);
@@ -2562,6 +3056,7 @@ mask_new(PyTypeObject *subtype, PyObject *args, PyObject *kwargs)
     }
 
     maskobj->mask = NULL;
+    maskobj->mip_levels = 0;
     return (PyObject *)maskobj;
 }
 
@@ -2603,6 +3098,7 @@ mask_init(PyObject *self, PyObject *args, PyObject *kwargs)
         bitmask_fill(bitmask);
     }
 
+    mask_mip_clear((pgMaskObject *)self);
     ((pgMaskObject *)self)->mask = bitmask;
     return 0;
 }
@@ -2619,6 +3115,10 @@ pgMask_GetBuffer(pgMaskObject *self, Py_buffer *view, int flags)
     bitmask_t *m = self->mask;
     mask_bufinfo *bufinfo = (mask_bufinfo *)self->bufdata;
 
+    /* Writes through the buffer bypass the pyramid, it is rebuilt once the
+     * last buffer is released. */
+    mask_mip_clear(self);
+
     if (bufinfo == NULL) {
         bufinfo = PyMem_RawMalloc(sizeof(mask_bufinfo));
         if (bufinfo == NULL) {
@@ -2687,17 +3187,51 @@ static PyTypeObject pgMask_Type = {
     .tp_new = mask_new,
 };
 
+static PyObject *
+mask_get_num_threads(PyObject *self, PyObject *_null)
+{
+    return PyLong_FromLong(cc_num_threads);
+}
+
+static PyObject *
+mask_set_num_threads(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    static char *keywords[] = {"count", NULL};
+    int count;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i", keywords, &count)) {
+        return NULL;
+    }
+
+    if (count < 0) {
+        return RAISE(PyExc_ValueError, "count must not be negative");
+    }
+    if (count == 0) {
+        count = SDL_GetCPUCount();
+    }
+    if (count > PG_PARALLEL_MAX_THREADS) {
+        count = PG_PARALLEL_MAX_THREADS;
+    }
+    cc_num_threads = count < 1 ? 1 : count;
+    Py_RETURN_NONE;
+}
+
 /*mask module methods*/
 static PyMethodDef _mask_methods[] = {
     {"from_surface", (PyCFunction)mask_from_surface,
      METH_VARARGS | METH_KEYWORDS, DOC_MASK_FROMSURFACE},
     {"from_threshold", (PyCFunction)mask_from_threshold,
      METH_VARARGS | METH_KEYWORDS, DOC_MASK_FROMTHRESHOLD},
+    {"get_num_threads", mask_get_num_threads, METH_NOARGS,
+     DOC_MASK_GETNUMTHREADS},
+    {"set_num_threads", (PyCFunction)mask_set_num_threads,
+     METH_VARARGS | METH_KEYWORDS, DOC_MASK_SETNUMTHREADS},
     {NULL, NULL, 0, NULL}};
 
 MODINIT_DEFINE(mask)
 {
-    PyObject *module;
+    PyObject *module, *apiobj;
+    static void *c_api[PYGAMEAPI_MASK_NUMSLOTS];
 
     static struct PyModuleDef _module = {PyModuleDef_HEAD_INIT,
                                          "mask",
@@ -2749,5 +3283,13 @@ MODINIT_DEFINE(mask)
         return NULL;
     }
 
+    c_api[0] = &pgMask_Type;
+    c_api[1] = pgMask_Changed;
+    apiobj = encapsulate_api(c_api, "mask");
+    if (PyModule_Add(module, PYGAMEAPI_LOCAL_ENTRY, apiobj) < 0) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
     return module;
 }
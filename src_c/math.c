@@ -39,6 +39,10 @@
 
 #include "pgcompat.h"
 
+#include "simd_math.h"
+
+#include "pgfreelist.h"
+
 #include <float.h>
 #include <math.h>
 #include <stddef.h>
@@ -84,6 +88,14 @@ static PyTypeObject pgVector2_Type;
 static PyTypeObject pgVector3_Type;
 static PyTypeObject pgVectorElementwiseProxy_Type;
 static PyTypeObject pgVectorIter_Type;
+static PyTypeObject pgVector2Array_Type;
+static PyTypeObject pgVector3Array_Type;
+
+/* Dead Vector2 and Vector3 objects are recycled, arithmetic creates lots of
+ * short lived ones */
+#define PG_VECTOR_FREELIST_MAX 256
+PG_FREELIST_DEFINE(pg_vector2_freelist, PG_VECTOR_FREELIST_MAX);
+PG_FREELIST_DEFINE(pg_vector3_freelist, PG_VECTOR_FREELIST_MAX);
 
 #define pgVector2_Check(x) (PyType_IsSubtype(Py_TYPE(x), &pgVector2_Type))
 #define pgVector3_Check(x) (PyType_IsSubtype(Py_TYPE(x), &pgVector3_Type))
@@ -111,6 +123,16 @@ typedef struct {
     PyObject_HEAD pgVector *vec;
 } vector_elementwiseproxy;
 
+typedef struct {
+    PyObject_HEAD double *data; /* dim columns of length doubles each */
+    Py_ssize_t length;
+    Py_ssize_t dim;
+    Py_ssize_t exports; /* number of buffer views currently exported */
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+    PyObject *weakreflist;
+} pgVectorArray;
+
 /* further forward declarations */
 /* math functions */
 static PyObject *
@@ -647,6 +669,17 @@ pgVector_NEW(Py_ssize_t dim)
 static void
 vector_dealloc(pgVector *self)
 {
+    /* only exact Vector2 and Vector3 instances are recycled */
+    if (Py_TYPE(self) == &pgVector2_Type) {
+        if (pgFreelist_Push(&pg_vector2_freelist, (PyObject *)self)) {
+            return;
+        }
+    }
+    else if (Py_TYPE(self) == &pgVector3_Type) {
+        if (pgFreelist_Push(&pg_vector3_freelist, (PyObject *)self)) {
+            return;
+        }
+    }
     Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
@@ -2308,7 +2341,14 @@ vector___round__(pgVector *self, PyObject *args)
 static PyObject *
 vector2_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
-    pgVector *vec = (pgVector *)type->tp_alloc(type, 0);
+    pgVector *vec = NULL;
+
+    if (type == &pgVector2_Type) {
+        vec = (pgVector *)pgFreelist_Pop(&pg_vector2_freelist, type);
+    }
+    if (vec == NULL) {
+        vec = (pgVector *)type->tp_alloc(type, 0);
+    }
 
     if (vec != NULL) {
         vec->dim = 2;
@@ -2745,7 +2785,14 @@ static PyTypeObject pgVector2_Type = {
 static PyObject *
 vector3_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 {
-    pgVector *vec = (pgVector *)type->tp_alloc(type, 0);
+    pgVector *vec = NULL;
+
+    if (type == &pgVector3_Type) {
+        vec = (pgVector *)pgFreelist_Pop(&pg_vector3_freelist, type);
+    }
+    if (vec == NULL) {
+        vec = (pgVector *)type->tp_alloc(type, 0);
+    }
 
     if (vec != NULL) {
         vec->dim = 3;
@@ -4314,6 +4361,796 @@ vector_elementwise(pgVector *vec, PyObject *_null)
     return (PyObject *)proxy;
 }
 
+/********************************
+ * Vector2Array and Vector3Array
+ ********************************/
+
+/* Runs the AVX2 or SSE2/NEON version of a vector array kernel when the CPU
+ * supports it and returns from the calling function if it did */
+#if !defined(__EMSCRIPTEN__)
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+#define VECTOR_ARRAY_SIMD(kernel, ...) \
+    if (_pg_math_has_avx2()) {         \
+        kernel##_avx2(__VA_ARGS__);    \
+        return;                        \
+    }                                  \
+    if (_pg_math_HasSSE_NEON()) {      \
+        kernel##_sse2(__VA_ARGS__);    \
+        return;                        \
+    }
+#else
+#define VECTOR_ARRAY_SIMD(kernel, ...) \
+    if (_pg_math_has_avx2()) {         \
+        kernel##_avx2(__VA_ARGS__);    \
+        return;                        \
+    }
+#endif /* __SSE2__ || PG_ENABLE_ARM_NEON */
+#else
+#define VECTOR_ARRAY_SIMD(kernel, ...)
+#endif /* !__EMSCRIPTEN__ */
+
+static void
+_vector_array_add(double *dst, const double *src, double value, double factor,
+                  Py_ssize_t n)
+{
+    Py_ssize_t i;
+
+    VECTOR_ARRAY_SIMD(vector_array_add, dst, src, value, factor, n);
+    for (i = 0; i < n; i++) {
+        dst[i] += src ? factor * src[i] : value;
+    }
+}
+
+static void
+_vector_array_mul(double *dst, const double *src, double value, Py_ssize_t n)
+{
+    Py_ssize_t i;
+
+    VECTOR_ARRAY_SIMD(vector_array_mul, dst, src, value, n);
+    for (i = 0; i < n; i++) {
+        dst[i] *= src ? src[i] : value;
+    }
+}
+
+static void
+_vector_array_lerp(double *dst, const double *src, double value, double t,
+                   Py_ssize_t n)
+{
+    Py_ssize_t i;
+
+    VECTOR_ARRAY_SIMD(vector_array_lerp, dst, src, value, t, n);
+    for (i = 0; i < n; i++) {
+        dst[i] = dst[i] * (1 - t) + (src ? src[i] : value) * t;
+    }
+}
+
+static void
+_vector_array_dot(const double *const *a, const double *const *b,
+                  Py_ssize_t dim, double *out, Py_ssize_t n)
+{
+    Py_ssize_t i, c;
+
+    VECTOR_ARRAY_SIMD(vector_array_dot, a, b, dim, out, n);
+    for (i = 0; i < n; i++) {
+        double product = 0;
+        for (c = 0; c < dim; c++) {
+            product += a[c][i] * b[c][i];
+        }
+        out[i] = product;
+    }
+}
+
+static void
+_vector_array_normalize(double *const *cols, Py_ssize_t dim,
+                        const double *length_sq, Py_ssize_t n)
+{
+    Py_ssize_t i, c;
+
+    VECTOR_ARRAY_SIMD(vector_array_normalize, cols, dim, length_sq, n);
+    for (i = 0; i < n; i++) {
+        double length = sqrt(length_sq[i]);
+        for (c = 0; c < dim; c++) {
+            cols[c][i] /= length;
+        }
+    }
+}
+
+static void
+_vector_array_clamp_magnitude(double *const *cols, Py_ssize_t dim,
+                              const double *length_sq, double min_length,
+                              double max_length, Py_ssize_t n)
+{
+    Py_ssize_t i;
+
+    VECTOR_ARRAY_SIMD(vector_array_clamp_magnitude, cols, dim, length_sq,
+                      min_length, max_length, n);
+    for (i = 0; i < n; i++) {
+        _pg_vector_array_clamp_magnitude1(cols, dim, length_sq[i], min_length,
+                                          max_length, i);
+    }
+}
+
+static void
+_vector_array_transform(double *const *cols, Py_ssize_t dim,
+                        const double *matrix, Py_ssize_t n)
+{
+    Py_ssize_t i;
+
+    VECTOR_ARRAY_SIMD(vector_array_transform, cols, dim, matrix, n);
+    for (i = 0; i < n; i++) {
+        _pg_vector_array_transform1(cols, dim, matrix, i);
+    }
+}
+
+static void
+_vector_array_columns(pgVectorArray *self, double **cols)
+{
+    Py_ssize_t c;
+
+    for (c = 0; c < self->dim; c++) {
+        cols[c] = self->data + c * self->length;
+    }
+}
+
+/* Returns the squared lengths of all vectors in a new PyMem buffer */
+static double *
+_vector_array_length_sq(pgVectorArray *self)
+{
+    double *cols[VECTOR_MAX_SIZE];
+    double *length_sq = PyMem_New(double, MAX(self->length, 1));
+
+    if (!length_sq) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    _vector_array_columns(self, cols);
+    _vector_array_dot((const double *const *)cols,
+                      (const double *const *)cols, self->dim, length_sq,
+                      self->length);
+    return length_sq;
+}
+
+/* Parses the "other" argument of the binary operations, either an array of
+ * the same type and length or a single vector applied to every element.
+ * Fills src with the columns of the array, or NULLs and coords for a single
+ * vector. */
+static int
+_vector_array_other(pgVectorArray *self, PyObject *other, double **src,
+                    double *coords)
+{
+    Py_ssize_t c;
+
+    if (Py_TYPE(other) == Py_TYPE(self)) {
+        pgVectorArray *array = (pgVectorArray *)other;
+        if (array->length != self->length) {
+            PyErr_Format(PyExc_ValueError,
+                         "arrays must have the same length (%zd != %zd)",
+                         array->length, self->length);
+            return 0;
+        }
+        _vector_array_columns(array, src);
+        return 1;
+    }
+    if (!pg_VectorCoordsFromObj(other, self->dim, coords)) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected a Vector%zdArray of the same length or a "
+                     "%zdD vector",
+                     self->dim, self->dim);
+        return 0;
+    }
+    for (c = 0; c < self->dim; c++) {
+        src[c] = NULL;
+    }
+    return 1;
+}
+
+static int
+_vector_array_init(pgVectorArray *self, PyObject *args, PyObject *kwds,
+                   Py_ssize_t dim)
+{
+    static char *keywords[] = {"size_or_iterable", NULL};
+    double coords[VECTOR_MAX_SIZE];
+    PyObject *arg, *seq = NULL;
+    Py_ssize_t length, i, c;
+    double *data;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", keywords, &arg)) {
+        return -1;
+    }
+
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError,
+                        "cannot reinitialize a vector array while its buffer "
+                        "is exported");
+        return -1;
+    }
+
+    if (PyIndex_Check(arg)) {
+        length = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+        if (length == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (length < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "vector array size must not be negative");
+            return -1;
+        }
+    }
+    else {
+        seq = PySequence_Fast(arg,
+                              "argument must be an int or an iterable of "
+                              "vectors");
+        if (!seq) {
+            return -1;
+        }
+        length = PySequence_Fast_GET_SIZE(seq);
+    }
+
+    if (length > PY_SSIZE_T_MAX / (Py_ssize_t)(dim * sizeof(double))) {
+        Py_XDECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    /* always allocate something so the buffer pointer is never NULL */
+    data = PyMem_Calloc(dim * MAX(length, 1), sizeof(double));
+    if (!data) {
+        Py_XDECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    if (seq) {
+        PyObject **items = PySequence_Fast_ITEMS(seq);
+
+        for (i = 0; i < length; i++) {
+            if (!pg_VectorCoordsFromObj(items[i], dim, coords)) {
+                PyErr_Format(PyExc_TypeError,
+                             "item %zd is not a %zdD vector", i, dim);
+                PyMem_Free(data);
+                Py_DECREF(seq);
+                return -1;
+            }
+            for (c = 0; c < dim; c++) {
+                data[c * length + i] = coords[c];
+            }
+        }
+        Py_DECREF(seq);
+    }
+
+    PyMem_Free(self->data);
+    self->data = data;
+    self->length = length;
+    self->dim = dim;
+    self->shape[0] = dim;
+    self->shape[1] = length;
+    self->strides[0] = length * (Py_ssize_t)sizeof(double);
+    self->strides[1] = sizeof(double);
+    return 0;
+}
+
+static int
+vector2_array_init(pgVectorArray *self, PyObject *args, PyObject *kwds)
+{
+    return _vector_array_init(self, args, kwds, 2);
+}
+
+static int
+vector3_array_init(pgVectorArray *self, PyObject *args, PyObject *kwds)
+{
+    return _vector_array_init(self, args, kwds, 3);
+}
+
+static void
+vector_array_dealloc(pgVectorArray *self)
+{
+    if (self->weakreflist) {
+        PyObject_ClearWeakRefs((PyObject *)self);
+    }
+    PyMem_Free(self->data);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *
+vector_array_repr(pgVectorArray *self)
+{
+    return PyUnicode_FromFormat("<Vector%zdArray(length=%zd)>", self->dim,
+                                self->length);
+}
+
+static Py_ssize_t
+vector_array_length(pgVectorArray *self)
+{
+    return self->length;
+}
+
+static PyObject *
+vector_array_item(pgVectorArray *self, Py_ssize_t i)
+{
+    pgVector *vec;
+    Py_ssize_t c;
+
+    if (i < 0 || i >= self->length) {
+        return RAISE(PyExc_IndexError, "vector array index out of range");
+    }
+    vec = (pgVector *)pgVector_NEW(self->dim);
+    if (vec) {
+        for (c = 0; c < self->dim; c++) {
+            vec->coords[c] = self->data[c * self->length + i];
+        }
+    }
+    return (PyObject *)vec;
+}
+
+static int
+vector_array_ass_item(pgVectorArray *self, Py_ssize_t i, PyObject *value)
+{
+    double coords[VECTOR_MAX_SIZE];
+    Py_ssize_t c;
+
+    if (!value) {
+        PyErr_SetString(PyExc_TypeError,
+                        "vector arrays do not support item deletion");
+        return -1;
+    }
+    if (i < 0 || i >= self->length) {
+        PyErr_SetString(PyExc_IndexError,
+                        "vector array assignment index out of range");
+        return -1;
+    }
+    if (!pg_VectorCoordsFromObj(value, self->dim, coords)) {
+        PyErr_Format(PyExc_TypeError, "expected a %zdD vector", self->dim);
+        return -1;
+    }
+    for (c = 0; c < self->dim; c++) {
+        self->data[c * self->length + i] = coords[c];
+    }
+    return 0;
+}
+
+static int
+vector_array_getbuffer(pgVectorArray *self, Py_buffer *view, int flags)
+{
+    view->buf = self->data;
+    view->obj = (PyObject *)self;
+    Py_INCREF(self);
+    view->len = self->dim * self->length * (Py_ssize_t)sizeof(double);
+    view->readonly = 0;
+    view->itemsize = sizeof(double);
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? "d" : NULL;
+    if ((flags & PyBUF_ND) == PyBUF_ND) {
+        view->ndim = 2;
+        view->shape = self->shape;
+    }
+    else {
+        /* simple requests get the coordinates as flat bytes */
+        view->ndim = 1;
+        view->shape = NULL;
+    }
+    view->strides =
+        (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    self->exports++;
+    return 0;
+}
+
+static void
+vector_array_releasebuffer(pgVectorArray *self, Py_buffer *view)
+{
+    self->exports--;
+}
+
+static PyObject *
+_vector_array_add_sub(pgVectorArray *self, PyObject *other, double factor)
+{
+    double *dst[VECTOR_MAX_SIZE], *src[VECTOR_MAX_SIZE];
+    double coords[VECTOR_MAX_SIZE];
+    Py_ssize_t c;
+
+    if (!_vector_array_other(self, other, src, coords)) {
+        return NULL;
+    }
+    _vector_array_columns(self, dst);
+    for (c = 0; c < self->dim; c++) {
+        _vector_array_add(dst[c], src[c], factor * coords[c], factor,
+                          self->length);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+vector_array_add_ip(pgVectorArray *self, PyObject *other)
+{
+    return _vector_array_add_sub(self, other, 1);
+}
+
+static PyObject *
+vector_array_sub_ip(pgVectorArray *self, PyObject *other)
+{
+    return _vector_array_add_sub(self, other, -1);
+}
+
+static PyObject *
+vector_array_scale_ip(pgVectorArray *self, PyObject *arg)
+{
+    double *dst[VECTOR_MAX_SIZE];
+    double factor = 0;
+    Py_buffer view;
+    const char *format;
+    Py_ssize_t c;
+
+    view.obj = NULL;
+    if (PyObject_CheckBuffer(arg)) {
+        if (PyObject_GetBuffer(arg, &view,
+                               PyBUF_C_CONTIGUOUS | PyBUF_FORMAT)) {
+            return NULL;
+        }
+        format = view.format ? view.format : "B";
+        if (format[0] == '@' || format[0] == '=') {
+            format++;
+        }
+        if (view.ndim != 1 || view.shape[0] != self->length ||
+            strcmp(format, "d") != 0) {
+            PyErr_Format(PyExc_ValueError,
+                         "buffer argument must be 1-D with %zd items of "
+                         "format 'd'",
+                         self->length);
+            PyBuffer_Release(&view);
+            return NULL;
+        }
+    }
+    else if (RealNumber_Check(arg)) {
+        factor = PyFloat_AsDouble(arg);
+    }
+    else {
+        return RAISE(PyExc_TypeError,
+                     "scale_ip() argument must be a number or a 1-D buffer");
+    }
+
+    _vector_array_columns(self, dst);
+    for (c = 0; c < self->dim; c++) {
+        _vector_array_mul(dst[c], view.obj ? (double *)view.buf : NULL,
+                          factor, self->length);
+    }
+    if (view.obj) {
+        PyBuffer_Release(&view);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+vector_array_dot(pgVectorArray *self, PyObject *other)
+{
+    double *a[VECTOR_MAX_SIZE], *b[VECTOR_MAX_SIZE];
+    double coords[VECTOR_MAX_SIZE];
+    double *products;
+    PyObject *ret, *num;
+    Py_ssize_t i, c;
+
+    if (!_vector_array_other(self, other, b, coords)) {
+        return NULL;
+    }
+    if (!(products = PyMem_New(double, MAX(self->length, 1)))) {
+        return PyErr_NoMemory();
+    }
+
+    _vector_array_columns(self, a);
+    if (b[0]) {
+        _vector_array_dot((const double *const *)a, (const double *const *)b,
+                          self->dim, products, self->length);
+    }
+    else {
+        /* one vector for all elements, sum the scaled columns */
+        for (i = 0; i < self->length; i++) {
+            products[i] = 0;
+        }
+        for (c = 0; c < self->dim; c++) {
+            _vector_array_add(products, a[c], 0, coords[c], self->length);
+        }
+    }
+
+    if (!(ret = PyList_New(self->length))) {
+        PyMem_Free(products);
+        return NULL;
+    }
+    for (i = 0; i < self->length; i++) {
+        if (!(num = PyFloat_FromDouble(products[i]))) {
+            Py_DECREF(ret);
+            PyMem_Free(products);
+            return NULL;
+        }
+        PyList_SET_ITEM(ret, i, num);
+    }
+    PyMem_Free(products);
+    return ret;
+}
+
+static PyObject *
+vector_array_normalize_ip(pgVectorArray *self, PyObject *_null)
+{
+    double *cols[VECTOR_MAX_SIZE];
+    double *length_sq;
+    Py_ssize_t i;
+
+    if (!(length_sq = _vector_array_length_sq(self))) {
+        return NULL;
+    }
+    /* check everything first so a failure leaves the array untouched */
+    for (i = 0; i < self->length; i++) {
+        if (length_sq[i] == 0) {
+            PyMem_Free(length_sq);
+            return PyErr_Format(PyExc_ValueError,
+                                "Can't normalize Vector of length zero "
+                                "(index %zd)",
+                                i);
+        }
+    }
+
+    _vector_array_columns(self, cols);
+    _vector_array_normalize(cols, self->dim, length_sq, self->length);
+    PyMem_Free(length_sq);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+vector_array_clamp_magnitude_ip(pgVectorArray *self, PyObject *const *args,
+                                Py_ssize_t nargs)
+{
+    double *cols[VECTOR_MAX_SIZE];
+    double max_length, min_length = 0;
+    double *length_sq;
+    Py_ssize_t i;
+
+    switch (nargs) {
+        case 2:
+            min_length = PyFloat_AsDouble(args[0]);
+            if (min_length == -1.0 && PyErr_Occurred()) {
+                return NULL;
+            }
+            /* Fall-through */
+        case 1:
+            max_length = PyFloat_AsDouble(args[nargs - 1]);
+            if (max_length == -1.0 && PyErr_Occurred()) {
+                return NULL;
+            }
+            break;
+        default:
+            return RAISE(PyExc_TypeError,
+                         "Vector clamp function must take one or two floats");
+    }
+
+    if (min_length > max_length) {
+        return RAISE(PyExc_ValueError,
+                     "Argument min_length cannot exceed max_length");
+    }
+    if (max_length < 0 || min_length < 0) {
+        return RAISE(PyExc_ValueError,
+                     "Arguments to Vector clamp must be non-negative");
+    }
+
+    if (!(length_sq = _vector_array_length_sq(self))) {
+        return NULL;
+    }
+    if (min_length > 0) {
+        for (i = 0; i < self->length; i++) {
+            if (length_sq[i] == 0) {
+                PyMem_Free(length_sq);
+                return PyErr_Format(PyExc_ValueError,
+                                    "Cannot clamp a vector with zero length "
+                                    "with a min_length greater than 0 "
+                                    "(index %zd)",
+                                    i);
+            }
+        }
+    }
+
+    _vector_array_columns(self, cols);
+    _vector_array_clamp_magnitude(cols, self->dim, length_sq, min_length,
+                                  max_length, self->length);
+    PyMem_Free(length_sq);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+vector_array_lerp_ip(pgVectorArray *self, PyObject *args)
+{
+    double *dst[VECTOR_MAX_SIZE], *src[VECTOR_MAX_SIZE];
+    double coords[VECTOR_MAX_SIZE];
+    PyObject *other;
+    Py_ssize_t c;
+    double t;
+
+    if (!PyArg_ParseTuple(args, "Od:lerp_ip", &other, &t)) {
+        return NULL;
+    }
+    if (!_vector_array_other(self, other, src, coords)) {
+        return NULL;
+    }
+    if (t < 0 || t > 1) {
+        return RAISE(PyExc_ValueError, "Argument 2 must be in range [0, 1]");
+    }
+
+    _vector_array_columns(self, dst);
+    for (c = 0; c < self->dim; c++) {
+        _vector_array_lerp(dst[c], src[c], coords[c], t, self->length);
+    }
+    Py_RETURN_NONE;
+}
+
+/* Rotations are linear, so the rotate helpers of the vector types are used
+ * on the unit vectors to get the matrix, which is then applied to all
+ * elements at once */
+static PyObject *
+_vector2_array_rotate(pgVectorArray *self, double angle)
+{
+    double *cols[VECTOR_MAX_SIZE];
+    const double unit_x[2] = {1, 0}, unit_y[2] = {0, 1};
+    double col_x[2], col_y[2], matrix[4];
+
+    if (!_vector2_rotate_helper(col_x, unit_x, angle, VECTOR_EPSILON) ||
+        !_vector2_rotate_helper(col_y, unit_y, angle, VECTOR_EPSILON)) {
+        return NULL;
+    }
+    matrix[0] = col_x[0];
+    matrix[1] = col_y[0];
+    matrix[2] = col_x[1];
+    matrix[3] = col_y[1];
+
+    _vector_array_columns(self, cols);
+    _vector_array_transform(cols, 2, matrix, self->length);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+vector2_array_rotate_ip(pgVectorArray *self, PyObject *angleObject)
+{
+    double angle = PyFloat_AsDouble(angleObject);
+
+    if (angle == -1.0 && PyErr_Occurred()) {
+        return NULL;
+    }
+    return _vector2_array_rotate(self, DEG2RAD(angle));
+}
+
+static PyObject *
+vector2_array_rotate_rad_ip(pgVectorArray *self, PyObject *angleObject)
+{
+    double angle = PyFloat_AsDouble(angleObject);
+
+    if (angle == -1.0 && PyErr_Occurred()) {
+        return NULL;
+    }
+    return _vector2_array_rotate(self, angle);
+}
+
+static PyObject *
+_vector3_array_rotate(pgVectorArray *self, double angle, PyObject *axis)
+{
+    double *cols[VECTOR_MAX_SIZE];
+    double axis_coords[3], unit[3], col[3], matrix[9];
+    int r, c;
+
+    if (!pg_VectorCoordsFromObj(axis, 3, axis_coords)) {
+        return RAISE(PyExc_TypeError,
+                     "Incompatible vector argument: Axis must be a 3D vector");
+    }
+    for (c = 0; c < 3; c++) {
+        unit[0] = unit[1] = unit[2] = 0;
+        unit[c] = 1;
+        if (!_vector3_rotate_helper(col, unit, axis_coords, angle,
+                                    VECTOR_EPSILON)) {
+            return NULL;
+        }
+        for (r = 0; r < 3; r++) {
+            matrix[r * 3 + c] = col[r];
+        }
+    }
+
+    _vector_array_columns(self, cols);
+    _vector_array_transform(cols, 3, matrix, self->length);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+vector3_array_rotate_ip(pgVectorArray *self, PyObject *args)
+{
+    PyObject *axis;
+    double angle;
+
+    if (!PyArg_ParseTuple(args, "dO:rotate_ip", &angle, &axis)) {
+        return NULL;
+    }
+    return _vector3_array_rotate(self, DEG2RAD(angle), axis);
+}
+
+static PyObject *
+vector3_array_rotate_rad_ip(pgVectorArray *self, PyObject *args)
+{
+    PyObject *axis;
+    double angle;
+
+    if (!PyArg_ParseTuple(args, "dO:rotate_rad_ip", &angle, &axis)) {
+        return NULL;
+    }
+    return _vector3_array_rotate(self, angle, axis);
+}
+
+#define VECTOR_ARRAY_COMMON_METHODS                                          \
+    {"add_ip", (PyCFunction)vector_array_add_ip, METH_O,                     \
+     DOC_MATH_VECTOR2ARRAY_ADDIP},                                           \
+        {"sub_ip", (PyCFunction)vector_array_sub_ip, METH_O,                 \
+         DOC_MATH_VECTOR2ARRAY_SUBIP},                                       \
+        {"scale_ip", (PyCFunction)vector_array_scale_ip, METH_O,             \
+         DOC_MATH_VECTOR2ARRAY_SCALEIP},                                     \
+        {"dot", (PyCFunction)vector_array_dot, METH_O,                       \
+         DOC_MATH_VECTOR2ARRAY_DOT},                                         \
+        {"normalize_ip", (PyCFunction)vector_array_normalize_ip,             \
+         METH_NOARGS, DOC_MATH_VECTOR2ARRAY_NORMALIZEIP},                    \
+        {"clamp_magnitude_ip", (PyCFunction)vector_array_clamp_magnitude_ip, \
+         METH_FASTCALL, DOC_MATH_VECTOR2ARRAY_CLAMPMAGNITUDEIP},             \
+        {"lerp_ip", (PyCFunction)vector_array_lerp_ip, METH_VARARGS,         \
+         DOC_MATH_VECTOR2ARRAY_LERPIP}
+
+static PyMethodDef vector2_array_methods[] = {
+    VECTOR_ARRAY_COMMON_METHODS,
+    {"rotate_ip", (PyCFunction)vector2_array_rotate_ip, METH_O,
+     DOC_MATH_VECTOR2ARRAY_ROTATEIP},
+    {"rotate_rad_ip", (PyCFunction)vector2_array_rotate_rad_ip, METH_O,
+     DOC_MATH_VECTOR2ARRAY_ROTATERADIP},
+    {NULL} /* Sentinel */
+};
+
+static PyMethodDef vector3_array_methods[] = {
+    VECTOR_ARRAY_COMMON_METHODS,
+    {"rotate_ip", (PyCFunction)vector3_array_rotate_ip, METH_VARARGS,
+     DOC_MATH_VECTOR2ARRAY_ROTATEIP},
+    {"rotate_rad_ip", (PyCFunction)vector3_array_rotate_rad_ip, METH_VARARGS,
+     DOC_MATH_VECTOR2ARRAY_ROTATERADIP},
+    {NULL} /* Sentinel */
+};
+
+static PySequenceMethods vector_array_as_sequence = {
+    .sq_length = (lenfunc)vector_array_length,
+    .sq_item = (ssizeargfunc)vector_array_item,
+    .sq_ass_item = (ssizeobjargproc)vector_array_ass_item,
+};
+
+static PyBufferProcs vector_array_as_buffer = {
+    .bf_getbuffer = (getbufferproc)vector_array_getbuffer,
+    .bf_releasebuffer = (releasebufferproc)vector_array_releasebuffer,
+};
+
+static PyTypeObject pgVector2Array_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.math.Vector2Array",
+    .tp_basicsize = sizeof(pgVectorArray),
+    .tp_dealloc = (destructor)vector_array_dealloc,
+    .tp_repr = (reprfunc)vector_array_repr,
+    .tp_as_sequence = &vector_array_as_sequence,
+    .tp_as_buffer = &vector_array_as_buffer,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_doc = DOC_MATH_VECTOR2ARRAY,
+    .tp_weaklistoffset = offsetof(pgVectorArray, weakreflist),
+    .tp_methods = vector2_array_methods,
+    .tp_init = (initproc)vector2_array_init,
+    .tp_new = PyType_GenericNew,
+};
+
+static PyTypeObject pgVector3Array_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.math.Vector3Array",
+    .tp_basicsize = sizeof(pgVectorArray),
+    .tp_dealloc = (destructor)vector_array_dealloc,
+    .tp_repr = (reprfunc)vector_array_repr,
+    .tp_as_sequence = &vector_array_as_sequence,
+    .tp_as_buffer = &vector_array_as_buffer,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_doc = DOC_MATH_VECTOR2ARRAY,
+    .tp_weaklistoffset = offsetof(pgVectorArray, weakreflist),
+    .tp_methods = vector3_array_methods,
+    .tp_init = (initproc)vector3_array_init,
+    .tp_new = PyType_GenericNew,
+};
+
 static inline double
 lerp(double a, double b, double v)
 {
@@ -4540,6 +5377,33 @@ math_disable_swizzling(pgVector *self, PyObject *_null)
     Py_RETURN_NONE;
 }
 
+/* Debug helper returning the hit and miss counters of the Vector2 and
+ * Vector3 free lists, optionally zeroing them afterwards */
+static PyObject *
+math_freelist_stats(PyObject *self, PyObject *args)
+{
+    int reset = 0;
+    PyObject *vector2_stats, *vector3_stats, *ret;
+
+    if (!PyArg_ParseTuple(args, "|p:_freelist_stats", &reset)) {
+        return NULL;
+    }
+    if (!(vector2_stats = pgFreelist_Stats(&pg_vector2_freelist))) {
+        return NULL;
+    }
+    if (!(vector3_stats = pgFreelist_Stats(&pg_vector3_freelist))) {
+        Py_DECREF(vector2_stats);
+        return NULL;
+    }
+    ret = Py_BuildValue("{s:N,s:N}", "Vector2", vector2_stats, "Vector3",
+                        vector3_stats);
+    if (ret && reset) {
+        pgFreelist_ResetStats(&pg_vector2_freelist);
+        pgFreelist_ResetStats(&pg_vector3_freelist);
+    }
+    return ret;
+}
+
 static PyMethodDef _math_methods[] = {
     {"clamp", (PyCFunction)math_clamp, METH_FASTCALL, DOC_MATH_CLAMP},
     {"lerp", (PyCFunction)math_lerp, METH_FASTCALL, DOC_MATH_LERP},
@@ -4551,6 +5415,7 @@ static PyMethodDef _math_methods[] = {
      "Deprecated, will be removed in a future version"},
     {"disable_swizzling", (PyCFunction)math_disable_swizzling, METH_NOARGS,
      "Deprecated, will be removed in a future version."},
+    {"_freelist_stats", (PyCFunction)math_freelist_stats, METH_VARARGS, NULL},
     {NULL, NULL, 0, NULL}};
 
 /****************************
@@ -4586,7 +5451,9 @@ MODINIT_DEFINE(math)
     if ((PyModule_AddType(module, &pgVector2_Type) < 0) ||
         (PyModule_AddType(module, &pgVector3_Type) < 0) ||
         (PyModule_AddType(module, &pgVectorElementwiseProxy_Type) < 0) ||
-        (PyModule_AddType(module, &pgVectorIter_Type) < 0)) {
+        (PyModule_AddType(module, &pgVectorIter_Type) < 0) ||
+        (PyModule_AddType(module, &pgVector2Array_Type) < 0) ||
+        (PyModule_AddType(module, &pgVector3Array_Type) < 0)) {
         Py_DECREF(module);
         return NULL;
     }
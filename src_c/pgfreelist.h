@@ -0,0 +1,119 @@
+/* Bounded free lists for small, short lived objects (internal)
+ *
+ * Dead instances of one exact, non-GC type are kept in a fixed size stack
+ * instead of being freed, and handed out again by the next tp_new of that
+ * type. Subclass instances are never stored, the caller checks the exact
+ * type on both ends.
+ *
+ * Free-threaded builds protect each list with its own mutex, everywhere
+ * else the GIL does.
+ */
+#ifndef PGFREELIST_INTERNAL_H
+#define PGFREELIST_INTERNAL_H
+
+#include <Python.h>
+#include <string.h>
+
+#include "pgplatform.h"
+
+typedef struct {
+    PyObject **items;
+    Py_ssize_t size;
+    Py_ssize_t limit;
+    /* debug counters, see pgFreelist_Stats */
+    Py_ssize_t hits;   /* allocations served by the list */
+    Py_ssize_t misses; /* allocations that found the list empty */
+#ifdef Py_GIL_DISABLED
+    PyMutex mutex;
+#endif
+} pgFreelist;
+
+/* Defines a static free list called name that holds up to limit objects */
+#define PG_FREELIST_DEFINE(name, limit)                 \
+    static PyObject *name##_items[limit];               \
+    static pgFreelist name = {name##_items, 0, (limit), 0, 0}
+
+#ifdef Py_GIL_DISABLED
+#define PG_FREELIST_LOCK(fl) PyMutex_Lock(&(fl)->mutex)
+#define PG_FREELIST_UNLOCK(fl) PyMutex_Unlock(&(fl)->mutex)
+#else
+#define PG_FREELIST_LOCK(fl)
+#define PG_FREELIST_UNLOCK(fl)
+#endif
+
+/* Returns a recycled instance of type with zeroed fields and a reference
+ * count of one, or NULL without an exception set when the list is empty */
+static PG_INLINE PyObject *
+pgFreelist_Pop(pgFreelist *fl, PyTypeObject *type)
+{
+    PyObject *obj = NULL;
+
+    PG_FREELIST_LOCK(fl);
+    if (fl->size > 0) {
+        obj = fl->items[--fl->size];
+        fl->hits++;
+    }
+    else {
+        fl->misses++;
+    }
+    PG_FREELIST_UNLOCK(fl);
+
+    if (obj) {
+        memset((char *)obj + sizeof(PyObject), 0,
+               type->tp_basicsize - sizeof(PyObject));
+#ifdef PYPY_VERSION
+        Py_INCREF(obj);
+        /* This is so that pypy garbage collector thinks it is a new obj
+           TODO: May be a hack. Is a hack.
+           See https://github.com/pygame/pygame/issues/430
+        */
+        obj->ob_pypy_link = 0;
+#else
+        PyObject_Init(obj, type);
+#endif
+    }
+    return obj;
+}
+
+/* Stores a dead object from its tp_dealloc. Returns 0 when the list is full
+ * and the caller has to free the object itself. */
+static PG_INLINE int
+pgFreelist_Push(pgFreelist *fl, PyObject *obj)
+{
+    int stored = 0;
+
+    PG_FREELIST_LOCK(fl);
+    if (fl->size < fl->limit) {
+        fl->items[fl->size++] = obj;
+        stored = 1;
+    }
+    PG_FREELIST_UNLOCK(fl);
+    return stored;
+}
+
+/* Returns the counters of a free list as a new dict */
+static PG_INLINE PyObject *
+pgFreelist_Stats(pgFreelist *fl)
+{
+    Py_ssize_t size, hits, misses;
+
+    PG_FREELIST_LOCK(fl);
+    size = fl->size;
+    hits = fl->hits;
+    misses = fl->misses;
+    PG_FREELIST_UNLOCK(fl);
+
+    return Py_BuildValue("{s:n,s:n,s:n,s:n}", "hits", hits, "misses", misses,
+                         "size", size, "limit", fl->limit);
+}
+
+/* Zeroes the hit and miss counters */
+static PG_INLINE void
+pgFreelist_ResetStats(pgFreelist *fl)
+{
+    PG_FREELIST_LOCK(fl);
+    fl->hits = fl->misses = 0;
+    PG_FREELIST_UNLOCK(fl);
+}
+
+#endif /* ~PGFREELIST_INTERNAL_H */
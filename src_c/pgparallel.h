@@ -0,0 +1,48 @@
+/* Fork/join helper for splitting C loops across SDL threads (internal)
+ *
+ * A job is any struct, the caller fills an array of them and hands it to
+ * pg_run_parallel() with a function that runs one job. Jobs must not touch
+ * Python objects, the GIL is released around the call.
+ */
+#ifndef PGPARALLEL_INTERNAL_H
+#define PGPARALLEL_INTERNAL_H
+
+#ifdef PG_SDL3
+#include <SDL3/SDL.h>
+#else
+#include <SDL.h>
+#endif
+
+#include "pgplatform.h"
+
+/* Upper bound on the number of threads a single call runs on */
+#define PG_PARALLEL_MAX_THREADS 64
+
+/* Runs count jobs, each job_size bytes into the jobs array. The first job
+ * runs on the calling thread and the others on their own SDL threads named
+ * name. If a thread can't be started its job runs on the calling thread
+ * instead, so every job is always done when this returns. Call with the GIL
+ * released. */
+static PG_INLINE void
+pg_run_parallel(SDL_ThreadFunction func, const char *name, void *jobs,
+                size_t job_size, int count)
+{
+    SDL_Thread *threads[PG_PARALLEL_MAX_THREADS];
+    int i;
+
+    for (i = 1; i < count; i++) {
+        threads[i] =
+            SDL_CreateThread(func, name, (Uint8 *)jobs + i * job_size);
+        if (!threads[i]) {
+            func((Uint8 *)jobs + i * job_size);
+        }
+    }
+    func(jobs);
+    for (i = 1; i < count; i++) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], NULL);
+        }
+    }
+}
+
+#endif /* ~PGPARALLEL_INTERNAL_H */
@@ -34,15 +34,52 @@
 
 #include "pgcompat_rect.h"
 
+#include "simd_rect.h"
+
+#include "pgfreelist.h"
+
 #include <limits.h>
 
 static PyTypeObject pgRect_Type;
 static PyTypeObject pgFRect_Type;
+
+/* Dead Rect and FRect objects are recycled, methods like move() and copy()
+ * create lots of short lived ones */
+#ifdef PYPY_VERSION
+#define PG_RECT_FREELIST_MAX 49152
+#else
+#define PG_RECT_FREELIST_MAX 256
+#endif
+PG_FREELIST_DEFINE(pg_rect_freelist, PG_RECT_FREELIST_MAX);
+PG_FREELIST_DEFINE(pg_frect_freelist, PG_RECT_FREELIST_MAX);
 #define pgRect_Check(x) (PyObject_IsInstance(x, (PyObject *)&pgRect_Type))
 #define pgRect_CheckExact(x) (Py_TYPE(x) == &pgRect_Type)
 #define pgFRect_Check(x) (PyObject_IsInstance(x, (PyObject *)&pgFRect_Type))
 #define pgFRect_CheckExact(x) (Py_TYPE(x) == &pgFRect_Type)
 
+/* RectArray and FRectArray keep their rects as four columns of `length`
+ * items each, x then y then w then h, in a single block of memory */
+typedef struct {
+    PyObject_HEAD int *data;
+    Py_ssize_t length;
+    Py_ssize_t exports;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+    PyObject *weakreflist;
+} pgRectArrayObject;
+
+typedef struct {
+    PyObject_HEAD float *data;
+    Py_ssize_t length;
+    Py_ssize_t exports;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+    PyObject *weakreflist;
+} pgFRectArrayObject;
+
+static PyTypeObject pgRectArray_Type;
+static PyTypeObject pgFRectArray_Type;
+
 static int
 four_ints_from_obj(PyObject *obj, int *val1, int *val2, int *val3, int *val4);
 static int
@@ -160,13 +197,8 @@ four_floats_from_obj(PyObject *obj, float *val1, float *val2, float *val3,
 #define RectImport_PythonNumberCheck PyLong_Check
 #define RectImport_PythonNumberAsPrimitiveType PyLong_AsLong
 #define RectImport_PrimitiveTypeAsPythonNumber PyLong_FromLong
-#ifdef PYPY_VERSION
 #define RectOptional_FREELIST
-#define RectOptional_FreelistlimitNumberName PG_RECT_FREELIST_MAX
-#define RectOptional_FreelistlimitNumber 49152
-#define RectOptional_FreelistFreelistName pg_rect_freelist
-#define RectOptional_Freelist_Num pg_rect_freelist_num
-#endif /* PYPY_VERSION */
+#define RectOptional_FreelistName pg_rect_freelist
 #include "rect_impl.h"
 
 #define RectExport_init pg_frect_init
@@ -280,15 +312,54 @@ four_floats_from_obj(PyObject *obj, float *val1, float *val2, float *val3,
 #define RectImport_PythonNumberCheck PyFloat_Check
 #define RectImport_PythonNumberAsPrimitiveType PyFloat_AsDouble
 #define RectImport_PrimitiveTypeAsPythonNumber pg_PyFloat_FromFloat
-#ifdef PYPY_VERSION
 #define RectOptional_FREELIST
-#define RectOptional_FreelistlimitNumberName PG_FRECT_FREELIST_MAX
-#define RectOptional_FreelistlimitNumber 49152
-#define RectOptional_FreelistFreelistName pg_frect_freelist
-#define RectOptional_Freelist_Num pg_frect_freelist_num
-#endif /* PYPY_VERSION */
+#define RectOptional_FreelistName pg_frect_freelist
 #include "rect_impl.h"
 
+#define RectArrayImport_primitiveType int
+#define RectArrayImport_innerRectStruct SDL_Rect
+#define RectArrayImport_ArrayObject pgRectArrayObject
+#define RectArrayImport_TypeObject pgRectArray_Type
+#define RectArrayImport_ObjectName "RectArray"
+#define RectArrayImport_BufferFormat "i"
+#define RectArrayImport_BufferFormatAlt "l"
+#define RectArrayImport_RectFromObject pgRect_FromObject
+#define RectArrayImport_RectFromFastcallArgs pgRect_FromFastcallArgs
+#define RectArrayImport_RectNew4 pgRect_New4
+#define RectArrayImport_PrimitiveFromObj pg_IntFromObj
+#define RectArrayImport_addAVX2 rect_array_add_i_avx2
+#define RectArrayImport_addSSE2 rect_array_add_i_sse2
+#define RectArrayImport_clampAVX2 rect_array_clamp_i_avx2
+#define RectArrayImport_clampSSE2 rect_array_clamp_i_sse2
+#define RectArrayImport_clampScalar _pg_rect_array_clamp_i
+#define RectArrayImport_collideAVX2 rect_array_collide_i_avx2
+#define RectArrayImport_collideSSE2 rect_array_collide_i_sse2
+#define RectArrayImport_collideScalar _pg_rect_array_collide_i
+#define RectArrayExport_prefix pg_rect_array
+#include "rect_array_impl.h"
+
+#define RectArrayImport_primitiveType float
+#define RectArrayImport_innerRectStruct SDL_FRect
+#define RectArrayImport_ArrayObject pgFRectArrayObject
+#define RectArrayImport_TypeObject pgFRectArray_Type
+#define RectArrayImport_ObjectName "FRectArray"
+#define RectArrayImport_BufferFormat "f"
+#define RectArrayImport_BufferFormatAlt "f"
+#define RectArrayImport_RectFromObject pgFRect_FromObject
+#define RectArrayImport_RectFromFastcallArgs pgFRect_FromFastcallArgs
+#define RectArrayImport_RectNew4 pgFRect_New4
+#define RectArrayImport_PrimitiveFromObj pg_FloatFromObj
+#define RectArrayImport_addAVX2 rect_array_add_f_avx2
+#define RectArrayImport_addSSE2 rect_array_add_f_sse2
+#define RectArrayImport_clampAVX2 rect_array_clamp_f_avx2
+#define RectArrayImport_clampSSE2 rect_array_clamp_f_sse2
+#define RectArrayImport_clampScalar _pg_rect_array_clamp_f
+#define RectArrayImport_collideAVX2 rect_array_collide_f_avx2
+#define RectArrayImport_collideSSE2 rect_array_collide_f_sse2
+#define RectArrayImport_collideScalar _pg_rect_array_collide_f
+#define RectArrayExport_prefix pg_frect_array
+#include "rect_array_impl.h"
+
 /* Helper method to extract 4 ints from an object.
  *
  * This sequence extraction supports the following formats:
@@ -762,7 +833,109 @@ static PyTypeObject pgFRect_Type = {
     .tp_getset = pg_frect_getsets, .tp_init = (initproc)pg_frect_init,
     .tp_new = pg_frect_new};
 
-static PyMethodDef _pg_module_methods[] = {{NULL, NULL, 0, NULL}};
+/* RectArray and FRectArray */
+
+static struct PyMethodDef pg_rect_array_methods[] = {
+    {"move_ip", (PyCFunction)pg_rect_array_move_ip, METH_FASTCALL,
+     DOC_RECT_RECTARRAY_MOVEIP},
+    {"clamp_ip", (PyCFunction)pg_rect_array_clamp_ip, METH_FASTCALL,
+     DOC_RECT_RECTARRAY_CLAMPIP},
+    {"colliderect", (PyCFunction)pg_rect_array_colliderect, METH_FASTCALL,
+     DOC_RECT_RECTARRAY_COLLIDERECT},
+    {"collidearray", (PyCFunction)pg_rect_array_collidearray, METH_O,
+     DOC_RECT_RECTARRAY_COLLIDEARRAY},
+    {NULL, NULL, 0, NULL}};
+
+static struct PyMethodDef pg_frect_array_methods[] = {
+    {"move_ip", (PyCFunction)pg_frect_array_move_ip, METH_FASTCALL,
+     DOC_RECT_RECTARRAY_MOVEIP},
+    {"clamp_ip", (PyCFunction)pg_frect_array_clamp_ip, METH_FASTCALL,
+     DOC_RECT_RECTARRAY_CLAMPIP},
+    {"colliderect", (PyCFunction)pg_frect_array_colliderect, METH_FASTCALL,
+     DOC_RECT_RECTARRAY_COLLIDERECT},
+    {"collidearray", (PyCFunction)pg_frect_array_collidearray, METH_O,
+     DOC_RECT_RECTARRAY_COLLIDEARRAY},
+    {NULL, NULL, 0, NULL}};
+
+static PySequenceMethods pg_rect_array_as_sequence = {
+    .sq_length = (lenfunc)pg_rect_array_length,
+    .sq_item = (ssizeargfunc)pg_rect_array_item,
+    .sq_ass_item = (ssizeobjargproc)pg_rect_array_ass_item,
+};
+
+static PySequenceMethods pg_frect_array_as_sequence = {
+    .sq_length = (lenfunc)pg_frect_array_length,
+    .sq_item = (ssizeargfunc)pg_frect_array_item,
+    .sq_ass_item = (ssizeobjargproc)pg_frect_array_ass_item,
+};
+
+static PyBufferProcs pg_rect_array_as_buffer = {
+    .bf_getbuffer = (getbufferproc)pg_rect_array_getbuffer,
+    .bf_releasebuffer = (releasebufferproc)pg_rect_array_releasebuffer,
+};
+
+static PyBufferProcs pg_frect_array_as_buffer = {
+    .bf_getbuffer = (getbufferproc)pg_frect_array_getbuffer,
+    .bf_releasebuffer = (releasebufferproc)pg_frect_array_releasebuffer,
+};
+
+static PyTypeObject pgRectArray_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.rect.RectArray",
+    .tp_basicsize = sizeof(pgRectArrayObject),
+    .tp_dealloc = (destructor)pg_rect_array_dealloc,
+    .tp_repr = (reprfunc)pg_rect_array_repr,
+    .tp_as_sequence = &pg_rect_array_as_sequence,
+    .tp_as_buffer = &pg_rect_array_as_buffer,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_doc = DOC_RECT_RECTARRAY,
+    .tp_weaklistoffset = offsetof(pgRectArrayObject, weakreflist),
+    .tp_methods = pg_rect_array_methods,
+    .tp_init = (initproc)pg_rect_array_init, .tp_new = PyType_GenericNew};
+
+static PyTypeObject pgFRectArray_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.rect.FRectArray",
+    .tp_basicsize = sizeof(pgFRectArrayObject),
+    .tp_dealloc = (destructor)pg_frect_array_dealloc,
+    .tp_repr = (reprfunc)pg_frect_array_repr,
+    .tp_as_sequence = &pg_frect_array_as_sequence,
+    .tp_as_buffer = &pg_frect_array_as_buffer,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .tp_doc = DOC_RECT_RECTARRAY,
+    .tp_weaklistoffset = offsetof(pgFRectArrayObject, weakreflist),
+    .tp_methods = pg_frect_array_methods,
+    .tp_init = (initproc)pg_frect_array_init, .tp_new = PyType_GenericNew};
+
+/* Debug helper returning the hit and miss counters of the Rect and FRect
+ * free lists, optionally zeroing them afterwards */
+static PyObject *
+pg_rect_freelist_stats(PyObject *self, PyObject *args)
+{
+    int reset = 0;
+    PyObject *rect_stats, *frect_stats, *ret;
+
+    if (!PyArg_ParseTuple(args, "|p:_freelist_stats", &reset)) {
+        return NULL;
+    }
+    if (!(rect_stats = pgFreelist_Stats(&pg_rect_freelist))) {
+        return NULL;
+    }
+    if (!(frect_stats = pgFreelist_Stats(&pg_frect_freelist))) {
+        Py_DECREF(rect_stats);
+        return NULL;
+    }
+    ret = Py_BuildValue("{s:N,s:N}", "Rect", rect_stats, "FRect",
+                        frect_stats);
+    if (ret && reset) {
+        pgFreelist_ResetStats(&pg_rect_freelist);
+        pgFreelist_ResetStats(&pg_frect_freelist);
+    }
+    return ret;
+}
+
+static PyMethodDef _pg_module_methods[] = {
+    {"_freelist_stats", (PyCFunction)pg_rect_freelist_stats, METH_VARARGS,
+     NULL},
+    {NULL, NULL, 0, NULL}};
 
 static char _pg_module_doc[] = "Module for the rectangle object\n";
 
@@ -790,7 +963,9 @@ MODINIT_DEFINE(rect)
     }
 
     /* Create the module and add the functions */
-    if (PyType_Ready(&pgRect_Type) < 0 || PyType_Ready(&pgFRect_Type) < 0) {
+    if (PyType_Ready(&pgRect_Type) < 0 || PyType_Ready(&pgFRect_Type) < 0 ||
+        PyType_Ready(&pgRectArray_Type) < 0 ||
+        PyType_Ready(&pgFRectArray_Type) < 0) {
         return NULL;
     }
 
@@ -816,6 +991,16 @@ MODINIT_DEFINE(rect)
         Py_DECREF(module);
         return NULL;
     }
+    if (PyModule_AddObjectRef(module, "RectArray",
+                              (PyObject *)&pgRectArray_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    if (PyModule_AddObjectRef(module, "FRectArray",
+                              (PyObject *)&pgFRectArray_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
 
     /* export the c api */
     c_api[0] = &pgRect_Type;
@@ -0,0 +1,603 @@
+/*
+  pygame-ce - Python Game Library
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Library General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Library General Public License for more details.
+
+  You should have received a copy of the GNU Library General Public
+  License along with this library; if not, write to the Free
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+/*
+ *  RectArray and FRectArray -- fixed size arrays of rects stored as four
+ *  contiguous columns (x, y, w and h). A template like file just like
+ *  rect_impl.h, rect.c includes it once per primitive type.
+ */
+
+// #region RectArrayImport
+#ifndef RectArrayImport_primitiveType
+#error RectArrayImport_primitiveType needs to be defined
+#endif
+#ifndef RectArrayImport_innerRectStruct
+#error RectArrayImport_innerRectStruct needs to be defined
+#endif
+#ifndef RectArrayImport_ArrayObject
+#error RectArrayImport_ArrayObject needs to be defined
+#endif
+#ifndef RectArrayImport_TypeObject
+#error RectArrayImport_TypeObject needs to be defined
+#endif
+#ifndef RectArrayImport_ObjectName
+#error RectArrayImport_ObjectName needs to be defined
+#endif
+#ifndef RectArrayImport_BufferFormat
+#error RectArrayImport_BufferFormat needs to be defined
+#endif
+#ifndef RectArrayImport_BufferFormatAlt
+#error RectArrayImport_BufferFormatAlt needs to be defined
+#endif
+#ifndef RectArrayImport_RectFromObject
+#error RectArrayImport_RectFromObject needs to be defined
+#endif
+#ifndef RectArrayImport_RectFromFastcallArgs
+#error RectArrayImport_RectFromFastcallArgs needs to be defined
+#endif
+#ifndef RectArrayImport_RectNew4
+#error RectArrayImport_RectNew4 needs to be defined
+#endif
+#ifndef RectArrayImport_PrimitiveFromObj
+#error RectArrayImport_PrimitiveFromObj needs to be defined
+#endif
+#ifndef RectArrayImport_addAVX2
+#error RectArrayImport_addAVX2 needs to be defined
+#endif
+#ifndef RectArrayImport_addSSE2
+#error RectArrayImport_addSSE2 needs to be defined
+#endif
+#ifndef RectArrayImport_clampAVX2
+#error RectArrayImport_clampAVX2 needs to be defined
+#endif
+#ifndef RectArrayImport_clampSSE2
+#error RectArrayImport_clampSSE2 needs to be defined
+#endif
+#ifndef RectArrayImport_clampScalar
+#error RectArrayImport_clampScalar needs to be defined
+#endif
+#ifndef RectArrayImport_collideAVX2
+#error RectArrayImport_collideAVX2 needs to be defined
+#endif
+#ifndef RectArrayImport_collideSSE2
+#error RectArrayImport_collideSSE2 needs to be defined
+#endif
+#ifndef RectArrayImport_collideScalar
+#error RectArrayImport_collideScalar needs to be defined
+#endif
+// #endregion
+
+// #region RectArrayExport
+#ifndef RectArrayExport_prefix
+#error RectArrayExport_prefix needs to be defined
+#endif
+// #endregion
+
+#define PrimitiveType RectArrayImport_primitiveType
+#define InnerRect RectArrayImport_innerRectStruct
+#define ArrayObject RectArrayImport_ArrayObject
+#define ObjectName RectArrayImport_ObjectName
+
+#define _PG_RA_PASTE2(prefix, name) prefix##_##name
+#define _PG_RA_PASTE(prefix, name) _PG_RA_PASTE2(prefix, name)
+#define RA(name) _PG_RA_PASTE(RectArrayExport_prefix, name)
+
+/* column accessors, the columns are always `length` items apart */
+#define RA_X(self) ((self)->data)
+#define RA_Y(self) ((self)->data + (self)->length)
+#define RA_W(self) ((self)->data + 2 * (self)->length)
+#define RA_H(self) ((self)->data + 3 * (self)->length)
+
+/* kernel dispatchers */
+
+static void
+RA(add)(PrimitiveType *dst, const PrimitiveType *src, PrimitiveType value,
+        Py_ssize_t n)
+{
+    Py_ssize_t i;
+
+#if !defined(__EMSCRIPTEN__)
+    if (_pg_rect_has_avx2()) {
+        RectArrayImport_addAVX2(dst, src, value, n);
+        return;
+    }
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+    if (_pg_rect_HasSSE_NEON()) {
+        RectArrayImport_addSSE2(dst, src, value, n);
+        return;
+    }
+#endif /* __SSE2__ || PG_ENABLE_ARM_NEON */
+#endif /* !__EMSCRIPTEN__ */
+
+    for (i = 0; i < n; i++) {
+        dst[i] += src ? src[i] : value;
+    }
+}
+
+static void
+RA(clamp)(PrimitiveType *pos, const PrimitiveType *size, Py_ssize_t n,
+          PrimitiveType lo, PrimitiveType span)
+{
+    Py_ssize_t i;
+
+#if !defined(__EMSCRIPTEN__)
+    if (_pg_rect_has_avx2()) {
+        RectArrayImport_clampAVX2(pos, size, n, lo, span);
+        return;
+    }
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+    if (_pg_rect_HasSSE_NEON()) {
+        RectArrayImport_clampSSE2(pos, size, n, lo, span);
+        return;
+    }
+#endif /* __SSE2__ || PG_ENABLE_ARM_NEON */
+#endif /* !__EMSCRIPTEN__ */
+
+    for (i = 0; i < n; i++) {
+        pos[i] = RectArrayImport_clampScalar(pos[i], size[i], lo, span);
+    }
+}
+
+static void
+RA(collide)(const PrimitiveType *xs, const PrimitiveType *ys,
+            const PrimitiveType *ws, const PrimitiveType *hs, Py_ssize_t n,
+            const PrimitiveType *edges, Uint8 *out)
+{
+    Py_ssize_t i;
+
+#if !defined(__EMSCRIPTEN__)
+    if (_pg_rect_has_avx2()) {
+        RectArrayImport_collideAVX2(xs, ys, ws, hs, n, edges, out);
+        return;
+    }
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+    if (_pg_rect_HasSSE_NEON()) {
+        RectArrayImport_collideSSE2(xs, ys, ws, hs, n, edges, out);
+        return;
+    }
+#endif /* __SSE2__ || PG_ENABLE_ARM_NEON */
+#endif /* !__EMSCRIPTEN__ */
+
+    for (i = 0; i < n; i++) {
+        out[i] =
+            RectArrayImport_collideScalar(xs[i], ys[i], ws[i], hs[i], edges);
+    }
+}
+
+/* Fills edges with the left, top, right and bottom of the rect. Returns 0
+ * for empty rects, which never collide with anything. */
+static int
+RA(edges)(PrimitiveType x, PrimitiveType y, PrimitiveType w, PrimitiveType h,
+          PrimitiveType *edges)
+{
+    if (w == 0 || h == 0) {
+        return 0;
+    }
+    edges[0] = MIN(x, x + w);
+    edges[1] = MIN(y, y + h);
+    edges[2] = MAX(x, x + w);
+    edges[3] = MAX(y, y + h);
+    return 1;
+}
+
+/* object lifetime */
+
+static int
+RA(init)(ArrayObject *self, PyObject *args, PyObject *kwds)
+{
+    static char *keywords[] = {"size_or_iterable", NULL};
+    PyObject *arg, *seq = NULL;
+    PrimitiveType *data;
+    Py_ssize_t length, i;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O", keywords, &arg)) {
+        return -1;
+    }
+
+    if (self->exports > 0) {
+        PyErr_SetString(PyExc_BufferError,
+                        "cannot reinitialize " ObjectName
+                        " while its buffer is exported");
+        return -1;
+    }
+
+    if (PyIndex_Check(arg)) {
+        length = PyNumber_AsSsize_t(arg, PyExc_OverflowError);
+        if (length == -1 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (length < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            ObjectName " size must not be negative");
+            return -1;
+        }
+    }
+    else {
+        seq = PySequence_Fast(arg, ObjectName
+                              "() argument must be an int or an iterable of "
+                              "rect style objects");
+        if (!seq) {
+            return -1;
+        }
+        length = PySequence_Fast_GET_SIZE(seq);
+    }
+
+    if (length > PY_SSIZE_T_MAX / (Py_ssize_t)(4 * sizeof(PrimitiveType))) {
+        Py_XDECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    /* always allocate something so the buffer pointer is never NULL */
+    data = PyMem_Calloc(4 * MAX(length, 1), sizeof(PrimitiveType));
+    if (!data) {
+        Py_XDECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    if (seq) {
+        PyObject **items = PySequence_Fast_ITEMS(seq);
+        InnerRect *rect, temp;
+
+        for (i = 0; i < length; i++) {
+            if (!(rect = RectArrayImport_RectFromObject(items[i], &temp))) {
+                PyErr_Format(PyExc_TypeError,
+                             "item %zd is not a rect style object", i);
+                PyMem_Free(data);
+                Py_DECREF(seq);
+                return -1;
+            }
+            data[i] = rect->x;
+            data[length + i] = rect->y;
+            data[2 * length + i] = rect->w;
+            data[3 * length + i] = rect->h;
+        }
+        Py_DECREF(seq);
+    }
+
+    PyMem_Free(self->data);
+    self->data = data;
+    self->length = length;
+    self->shape[0] = 4;
+    self->shape[1] = length;
+    self->strides[0] = length * (Py_ssize_t)sizeof(PrimitiveType);
+    self->strides[1] = sizeof(PrimitiveType);
+    return 0;
+}
+
+static void
+RA(dealloc)(ArrayObject *self)
+{
+    if (self->weakreflist) {
+        PyObject_ClearWeakRefs((PyObject *)self);
+    }
+    PyMem_Free(self->data);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *
+RA(repr)(ArrayObject *self)
+{
+    return PyUnicode_FromFormat("<" ObjectName "(length=%zd)>",
+                                self->length);
+}
+
+/* sequence protocol */
+
+static Py_ssize_t
+RA(length)(ArrayObject *self)
+{
+    return self->length;
+}
+
+static PyObject *
+RA(item)(ArrayObject *self, Py_ssize_t i)
+{
+    if (i < 0 || i >= self->length) {
+        return RAISE(PyExc_IndexError, ObjectName " index out of range");
+    }
+    return RectArrayImport_RectNew4(RA_X(self)[i], RA_Y(self)[i],
+                                    RA_W(self)[i], RA_H(self)[i]);
+}
+
+static int
+RA(ass_item)(ArrayObject *self, Py_ssize_t i, PyObject *v)
+{
+    InnerRect *rect, temp;
+
+    if (!v) {
+        PyErr_SetString(PyExc_TypeError,
+                        ObjectName " does not support item deletion");
+        return -1;
+    }
+    if (i < 0 || i >= self->length) {
+        PyErr_SetString(PyExc_IndexError,
+                        ObjectName " assignment index out of range");
+        return -1;
+    }
+    if (!(rect = RectArrayImport_RectFromObject(v, &temp))) {
+        PyErr_SetString(PyExc_TypeError, "Argument must be rect style object");
+        return -1;
+    }
+    RA_X(self)[i] = rect->x;
+    RA_Y(self)[i] = rect->y;
+    RA_W(self)[i] = rect->w;
+    RA_H(self)[i] = rect->h;
+    return 0;
+}
+
+/* buffer protocol, exports the 4 x length block of columns */
+
+static int
+RA(getbuffer)(ArrayObject *self, Py_buffer *view, int flags)
+{
+    view->buf = self->data;
+    view->obj = (PyObject *)self;
+    Py_INCREF(self);
+    view->len = 4 * self->length * (Py_ssize_t)sizeof(PrimitiveType);
+    view->readonly = 0;
+    view->itemsize = sizeof(PrimitiveType);
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT
+                       ? RectArrayImport_BufferFormat
+                       : NULL;
+    if ((flags & PyBUF_ND) == PyBUF_ND) {
+        view->ndim = 2;
+        view->shape = self->shape;
+    }
+    else {
+        /* simple requests get the block as flat bytes */
+        view->ndim = 1;
+        view->shape = NULL;
+    }
+    view->strides =
+        (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    self->exports++;
+    return 0;
+}
+
+static void
+RA(releasebuffer)(ArrayObject *self, Py_buffer *view)
+{
+    self->exports--;
+}
+
+/* Gets a per rect column argument. Numbers are stored in value and leave
+ * view->obj NULL, buffers must be 1-D, contiguous and have one item per
+ * rect of self. */
+static int
+RA(column_arg)(ArrayObject *self, PyObject *arg, PrimitiveType *value,
+               Py_buffer *view)
+{
+    const char *format;
+
+    view->obj = NULL;
+    if (!PyObject_CheckBuffer(arg)) {
+        if (!RectArrayImport_PrimitiveFromObj(arg, value)) {
+            PyErr_SetString(PyExc_TypeError,
+                            "arguments must be numbers or 1-D buffers");
+            return 0;
+        }
+        return 1;
+    }
+
+    if (PyObject_GetBuffer(arg, view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT)) {
+        return 0;
+    }
+    format = view->format ? view->format : "B";
+    if (format[0] == '@' || format[0] == '=') {
+        format++;
+    }
+    if (view->ndim != 1 || view->shape[0] != self->length ||
+        view->itemsize != sizeof(PrimitiveType) || format[1] != '\0' ||
+        (format[0] != RectArrayImport_BufferFormat[0] &&
+         format[0] != RectArrayImport_BufferFormatAlt[0])) {
+        PyErr_Format(PyExc_ValueError,
+                     "buffer arguments must be 1-D with %zd items of "
+                     "format '" RectArrayImport_BufferFormat "'",
+                     self->length);
+        PyBuffer_Release(view);
+        return 0;
+    }
+    return 1;
+}
+
+/* methods */
+
+static PyObject *
+RA(move_ip)(ArrayObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PrimitiveType dx = 0, dy = 0;
+    Py_buffer xview, yview;
+
+    if (nargs != 2) {
+        return RAISE(PyExc_TypeError, "move_ip() takes exactly 2 arguments");
+    }
+    if (!RA(column_arg)(self, args[0], &dx, &xview)) {
+        return NULL;
+    }
+    if (!RA(column_arg)(self, args[1], &dy, &yview)) {
+        if (xview.obj) {
+            PyBuffer_Release(&xview);
+        }
+        return NULL;
+    }
+
+    RA(add)(RA_X(self), xview.obj ? (PrimitiveType *)xview.buf : NULL, dx,
+            self->length);
+    RA(add)(RA_Y(self), yview.obj ? (PrimitiveType *)yview.buf : NULL, dy,
+            self->length);
+
+    if (xview.obj) {
+        PyBuffer_Release(&xview);
+    }
+    if (yview.obj) {
+        PyBuffer_Release(&yview);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+RA(clamp_ip)(ArrayObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    InnerRect *argrect, temp;
+
+    if (!(argrect =
+              RectArrayImport_RectFromFastcallArgs(args, nargs, &temp))) {
+        return RAISE(PyExc_TypeError, "Argument must be rect style object");
+    }
+
+    RA(clamp)(RA_X(self), RA_W(self), self->length, argrect->x, argrect->w);
+    RA(clamp)(RA_Y(self), RA_H(self), self->length, argrect->y, argrect->h);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+RA(colliderect)(ArrayObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    InnerRect *argrect, temp;
+    PrimitiveType edges[4];
+    PyObject *ret, *num;
+    Uint8 *hits;
+    Py_ssize_t i;
+
+    if (!(argrect =
+              RectArrayImport_RectFromFastcallArgs(args, nargs, &temp))) {
+        return RAISE(PyExc_TypeError, "Argument must be rect style object");
+    }
+
+    if (!(ret = PyList_New(0))) {
+        return NULL;
+    }
+    if (self->length == 0 ||
+        !RA(edges)(argrect->x, argrect->y, argrect->w, argrect->h, edges)) {
+        return ret;
+    }
+
+    if (!(hits = PyMem_Malloc(self->length))) {
+        Py_DECREF(ret);
+        return PyErr_NoMemory();
+    }
+    RA(collide)(RA_X(self), RA_Y(self), RA_W(self), RA_H(self), self->length,
+                edges, hits);
+
+    for (i = 0; i < self->length; i++) {
+        if (!hits[i]) {
+            continue;
+        }
+        if (!(num = PyLong_FromSsize_t(i)) || PyList_Append(ret, num)) {
+            Py_XDECREF(num);
+            Py_DECREF(ret);
+            PyMem_Free(hits);
+            return NULL;
+        }
+        Py_DECREF(num);
+    }
+
+    PyMem_Free(hits);
+    return ret;
+}
+
+static PyObject *
+RA(collidearray)(ArrayObject *self, PyObject *arg)
+{
+    ArrayObject *other = (ArrayObject *)arg;
+    PrimitiveType edges[4];
+    PyObject *ret, *pair;
+    Uint8 *hits;
+    Py_ssize_t i, j;
+
+    if (!PyObject_IsInstance(arg, (PyObject *)&RectArrayImport_TypeObject)) {
+        return RAISE(PyExc_TypeError,
+                     "Argument must be a " ObjectName " object");
+    }
+
+    if (!(ret = PyList_New(0))) {
+        return NULL;
+    }
+    if (self->length == 0 || other->length == 0) {
+        return ret;
+    }
+
+    if (!(hits = PyMem_Malloc(other->length))) {
+        Py_DECREF(ret);
+        return PyErr_NoMemory();
+    }
+
+    /* one vectorized pass over the other array per rect of self */
+    for (i = 0; i < self->length; i++) {
+        if (!RA(edges)(RA_X(self)[i], RA_Y(self)[i], RA_W(self)[i],
+                       RA_H(self)[i], edges)) {
+            continue;
+        }
+        RA(collide)(RA_X(other), RA_Y(other), RA_W(other), RA_H(other),
+                    other->length, edges, hits);
+
+        for (j = 0; j < other->length; j++) {
+            if (!hits[j]) {
+                continue;
+            }
+            if (!(pair = Py_BuildValue("(nn)", i, j)) ||
+                PyList_Append(ret, pair)) {
+                Py_XDECREF(pair);
+                Py_DECREF(ret);
+                PyMem_Free(hits);
+                return NULL;
+            }
+            Py_DECREF(pair);
+        }
+    }
+
+    PyMem_Free(hits);
+    return ret;
+}
+
+#undef PrimitiveType
+#undef InnerRect
+#undef ArrayObject
+#undef ObjectName
+#undef _PG_RA_PASTE2
+#undef _PG_RA_PASTE
+#undef RA
+#undef RA_X
+#undef RA_Y
+#undef RA_W
+#undef RA_H
+
+#undef RectArrayImport_primitiveType
+#undef RectArrayImport_innerRectStruct
+#undef RectArrayImport_ArrayObject
+#undef RectArrayImport_TypeObject
+#undef RectArrayImport_ObjectName
+#undef RectArrayImport_BufferFormat
+#undef RectArrayImport_BufferFormatAlt
+#undef RectArrayImport_RectFromObject
+#undef RectArrayImport_RectFromFastcallArgs
+#undef RectArrayImport_RectNew4
+#undef RectArrayImport_PrimitiveFromObj
+#undef RectArrayImport_addAVX2
+#undef RectArrayImport_addSSE2
+#undef RectArrayImport_clampAVX2
+#undef RectArrayImport_clampSSE2
+#undef RectArrayImport_clampScalar
+#undef RectArrayImport_collideAVX2
+#undef RectArrayImport_collideSSE2
+#undef RectArrayImport_collideScalar
+#undef RectArrayExport_prefix
@@ -375,20 +375,8 @@
 
 // #region RectOptional
 #ifdef RectOptional_FREELIST
-#ifndef PYPY_VERSION
-#error freelist is currently only supported for PyPy
-#endif
-#ifndef RectOptional_FreelistlimitNumberName
-#error RectOptional_FreelistlimitNumberName needs to be defined as RectOptional_FREELIST is defined
-#endif
-#ifndef RectOptional_FreelistlimitNumber
-#error RectOptional_FreelistlimitNumber needs to be defined as RectOptional_FREELIST is defined
-#endif
-#ifndef RectOptional_FreelistFreelistName
-#error RectOptional_FreelistFreelistName needs to be defined as RectOptional_FREELIST is defined
-#endif
-#ifndef RectOptional_Freelist_Num
-#error RectOptional_Freelist_Num needs to be defined as RectOptional_FREELIST is defined
+#ifndef RectOptional_FreelistName
+#error RectOptional_FreelistName needs to be defined as RectOptional_FREELIST is defined
 #endif
 #endif  // RectOptional_FREELIST
 // #endregion RectOptional
@@ -624,14 +612,6 @@ RectExport_setsize(RectObject *self, PyObject *value, void *closure);
 static PyObject *
 RectExport_iterator(RectObject *self);
 
-#ifdef RectOptional_FREELIST
-const int RectOptional_FreelistlimitNumberName =
-    RectOptional_FreelistlimitNumber;
-static RectObject
-    *RectOptional_FreelistFreelistName[RectOptional_FreelistlimitNumber];
-int RectOptional_Freelist_Num = -1;
-#endif
-
 static PG_INLINE InnerRect *
 RectExport_RectFromObject(PyObject *obj, InnerRect *temp)
 {
@@ -834,22 +814,13 @@ RectExport_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
 #ifdef RectOptional_FREELIST
     /* Only instances of the base pygame.Rect class are allowed in the
      * current freelist implementation (subclasses are not allowed) */
-    if (RectOptional_Freelist_Num > -1 && type == &RectImport_TypeObject) {
-        self = RectOptional_FreelistFreelistName[RectOptional_Freelist_Num];
-        Py_INCREF(self);
-        /* This is so that pypy garbage collector thinks it is a new obj
-           TODO: May be a hack. Is a hack.
-           See https://github.com/pygame/pygame/issues/430
-        */
-        ((PyObject *)(self))->ob_pypy_link = 0;
-        RectOptional_Freelist_Num--;
-    }
-    else {
-        self = (RectObject *)type->tp_alloc(type, 0);
+    if (type == &RectImport_TypeObject &&
+        (self = (RectObject *)pgFreelist_Pop(&RectOptional_FreelistName,
+                                             type))) {
+        return (PyObject *)self;
     }
-#else
-    self = (RectObject *)type->tp_alloc(type, 0);
 #endif
+    self = (RectObject *)type->tp_alloc(type, 0);
 
     if (self != NULL) {
         self->r.x = self->r.y = (PrimitiveType)0;
@@ -866,20 +837,15 @@ RectExport_dealloc(RectObject *self)
         PyObject_ClearWeakRefs((PyObject *)self);
     }
 
-#ifdef PYPY_VERSION
+#ifdef RectOptional_FREELIST
     /* Only instances of the base pygame.Rect class are allowed in the
      * current freelist implementation (subclasses are not allowed) */
-    if (RectOptional_Freelist_Num < RectOptional_FreelistlimitNumberName - 1 &&
-        RectImport_RectCheckExact(self)) {
-        RectOptional_Freelist_Num++;
-        RectOptional_FreelistFreelistName[RectOptional_Freelist_Num] = self;
+    if (RectImport_RectCheckExact(self) &&
+        pgFreelist_Push(&RectOptional_FreelistName, (PyObject *)self)) {
+        return;
     }
-    else {
-        Py_TYPE(self)->tp_free((PyObject *)self);
-    }
-#else
-    Py_TYPE(self)->tp_free((PyObject *)self);
 #endif
+    Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
 static int
@@ -3078,8 +3044,5 @@ RectExport_iterator(RectObject *self)
 
 #ifdef RectOptional_FREELIST
 #undef RectOptional_FREELIST
-#undef RectOptional_FreelistlimitNumberName
-#undef RectOptional_FreelistlimitNumber
-#undef RectOptional_FreelistFreelistName
-#undef RectOptional_Freelist_Num
+#undef RectOptional_FreelistName
 #endif /* RectOptional_FREELIST */
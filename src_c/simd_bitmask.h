@@ -0,0 +1,66 @@
+/* SIMD kernels for bitmask.c (internal)
+ *
+ * A bitmask keeps every column of BITMASK_W_LEN pixels as a strip of h
+ * consecutive words, so the inner loops of the overlap, draw and erase
+ * functions all walk n words of a few strips in step. Each kernel combines
+ * a[i] with the word b[i] of the other mask moved into place,
+ *
+ *     s = (b[i] << lshift) >> rshift      (one of the shifts is 0)
+ *
+ * overlap:  nonzero if any a[i] & s has a bit set
+ * count:    number of bits set in all the a[i] & s
+ * or:       a[i] |= s
+ * andnot:   a[i] &= ~s
+ * and:      c[i] = a[i] & s, or c[i] |= a[i] & s if accumulate is set
+ *
+ * This header only declares them, so bitmask.c stays free of SDL and Python.
+ */
+#ifndef SIMD_BITMASK_H
+#define SIMD_BITMASK_H
+
+#include "include/bitmask.h"
+
+int
+_pg_bitmask_has_avx2(void);
+
+/* This returns True if either SSE2 or NEON is present at runtime.
+ * Relevant because they use the same codepaths. Only the relevant runtime
+ * SDL cpu feature check is compiled in.*/
+int
+_pg_bitmask_HasSSE_NEON(void);
+
+// SSE2 functions
+int
+bitmask_strip_overlap_sse2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                           int lshift, int rshift);
+unsigned int
+bitmask_strip_count_sse2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                         int lshift, int rshift);
+void
+bitmask_strip_or_sse2(BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+                      int rshift);
+void
+bitmask_strip_andnot_sse2(BITMASK_W *a, const BITMASK_W *b, int n,
+                          int lshift, int rshift);
+void
+bitmask_strip_and_sse2(BITMASK_W *c, const BITMASK_W *a, const BITMASK_W *b,
+                       int n, int lshift, int rshift, int accumulate);
+
+// AVX2 functions
+int
+bitmask_strip_overlap_avx2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                           int lshift, int rshift);
+unsigned int
+bitmask_strip_count_avx2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                         int lshift, int rshift);
+void
+bitmask_strip_or_avx2(BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+                      int rshift);
+void
+bitmask_strip_andnot_avx2(BITMASK_W *a, const BITMASK_W *b, int n,
+                          int lshift, int rshift);
+void
+bitmask_strip_and_avx2(BITMASK_W *c, const BITMASK_W *a, const BITMASK_W *b,
+                       int n, int lshift, int rshift, int accumulate);
+
+#endif /* ~SIMD_BITMASK_H */
@@ -0,0 +1,386 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+#include "simd_level.h"
+#include "simd_bitmask.h"
+#include "simd_mask.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+#define BAD_AVX2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an AVX2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+/* helper function that does a runtime check for AVX2. It has the added
+ * functionality of also returning 0 if compile time support is missing */
+int
+_pg_bitmask_has_avx2(void)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    return pg_simd_level() >= PG_SIMD_LEVEL_AVX2 && SDL_HasAVX2();
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+
+/* BITMASK_W words per register */
+#define WORDS_PER_M256 ((int)(sizeof(__m256i) / sizeof(BITMASK_W)))
+
+#if BITMASK_W_LEN == 64
+#define _pg_sll_words _mm256_sll_epi64
+#define _pg_srl_words _mm256_srl_epi64
+#else
+#define _pg_sll_words _mm256_sll_epi32
+#define _pg_srl_words _mm256_srl_epi32
+#endif
+
+/* b[i] moved into place, see simd_bitmask.h */
+#define SHIFTED_M256(b, i, mm_l, mm_r)                                   \
+    _pg_srl_words(                                                       \
+        _pg_sll_words(_mm256_loadu_si256((const __m256i *)((b) + (i))),  \
+                      mm_l),                                             \
+        mm_r)
+
+static PG_FORCEINLINE unsigned int
+_pg_bitcount_word(BITMASK_W w)
+{
+    unsigned int count = 0;
+
+    while (w) {
+        w &= w - 1;
+        count++;
+    }
+    return count;
+}
+
+/* Bits set in each byte of v, through a lookup of each nibble, summed into
+ * its four 64 bit lanes */
+static PG_FORCEINLINE __m256i
+_pg_bitcount_m256(__m256i v)
+{
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3,
+                                         2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3,
+                                         1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i m4 = _mm256_set1_epi8(0x0F);
+    __m256i lo = _mm256_and_si256(v, m4);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), m4);
+
+    v = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo),
+                        _mm256_shuffle_epi8(lut, hi));
+    return _mm256_sad_epu8(v, _mm256_setzero_si256());
+}
+
+int
+bitmask_strip_overlap_avx2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                           int lshift, int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+    __m256i hits;
+
+    for (; i + WORDS_PER_M256 <= n; i += WORDS_PER_M256) {
+        hits = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(a + i)),
+                                SHIFTED_M256(b, i, mm_l, mm_r));
+        if (!_mm256_testz_si256(hits, hits)) {
+            return 1;
+        }
+    }
+    for (; i < n; i++) {
+        if (a[i] & ((b[i] << lshift) >> rshift)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+unsigned int
+bitmask_strip_count_avx2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                         int lshift, int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+    __m256i mm_count = _mm256_setzero_si256();
+    Uint64 lanes[4];
+    unsigned int count;
+
+    for (; i + WORDS_PER_M256 <= n; i += WORDS_PER_M256) {
+        mm_count = _mm256_add_epi64(
+            mm_count, _pg_bitcount_m256(_mm256_and_si256(
+                          _mm256_loadu_si256((const __m256i *)(a + i)),
+                          SHIFTED_M256(b, i, mm_l, mm_r))));
+    }
+    _mm256_storeu_si256((__m256i *)lanes, mm_count);
+    count = (unsigned int)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    for (; i < n; i++) {
+        count += _pg_bitcount_word(a[i] & ((b[i] << lshift) >> rshift));
+    }
+    return count;
+}
+
+void
+bitmask_strip_or_avx2(BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+                      int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+
+    for (; i + WORDS_PER_M256 <= n; i += WORDS_PER_M256) {
+        _mm256_storeu_si256(
+            (__m256i *)(a + i),
+            _mm256_or_si256(_mm256_loadu_si256((const __m256i *)(a + i)),
+                            SHIFTED_M256(b, i, mm_l, mm_r)));
+    }
+    for (; i < n; i++) {
+        a[i] |= (b[i] << lshift) >> rshift;
+    }
+}
+
+void
+bitmask_strip_andnot_avx2(BITMASK_W *a, const BITMASK_W *b, int n,
+                          int lshift, int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+
+    for (; i + WORDS_PER_M256 <= n; i += WORDS_PER_M256) {
+        _mm256_storeu_si256(
+            (__m256i *)(a + i),
+            _mm256_andnot_si256(
+                SHIFTED_M256(b, i, mm_l, mm_r),
+                _mm256_loadu_si256((const __m256i *)(a + i))));
+    }
+    for (; i < n; i++) {
+        a[i] &= ~((b[i] << lshift) >> rshift);
+    }
+}
+
+void
+bitmask_strip_and_avx2(BITMASK_W *c, const BITMASK_W *a, const BITMASK_W *b,
+                       int n, int lshift, int rshift, int accumulate)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+    __m256i mm_c;
+
+    for (; i + WORDS_PER_M256 <= n; i += WORDS_PER_M256) {
+        mm_c = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(a + i)),
+                                SHIFTED_M256(b, i, mm_l, mm_r));
+        if (accumulate) {
+            mm_c = _mm256_or_si256(
+                mm_c, _mm256_loadu_si256((const __m256i *)(c + i)));
+        }
+        _mm256_storeu_si256((__m256i *)(c + i), mm_c);
+    }
+    for (; i < n; i++) {
+        if (accumulate) {
+            c[i] |= a[i] & ((b[i] << lshift) >> rshift);
+        }
+        else {
+            c[i] = a[i] & ((b[i] << lshift) >> rshift);
+        }
+    }
+}
+
+/* The pixel tests of the row kernels, see simd_mask.h */
+#define ROW_ALPHA 0
+#define ROW_COLORKEY 1
+#define ROW_DISTANCE 2
+
+/* One pixel p against q, the colorkey, color or pixel of row2 */
+static PG_FORCEINLINE int
+_pg_pixel_passes(int test, Uint32 p, Uint32 q, int ashift, Uint32 threshold,
+                 Uint32 channels)
+{
+    int a, b, t, i;
+
+    switch (test) {
+        case ROW_ALPHA:
+            return ((p >> ashift) & 0xFF) > threshold;
+        case ROW_COLORKEY:
+            return p != q;
+        default:
+            for (i = 0; i < 32; i += 8) {
+                if (!((channels >> i) & 0xFF)) {
+                    continue;
+                }
+                a = (p >> i) & 0xFF;
+                b = (q >> i) & 0xFF;
+                t = (threshold >> i) & 0xFF;
+                if ((a > b ? a - b : b - a) >= t) {
+                    return 0;
+                }
+            }
+            return 1;
+    }
+}
+
+/* Eight pixels against q, one bit per pixel */
+static PG_FORCEINLINE int
+_pg_pixels_pass_m256(int test, __m256i p, __m256i q, __m128i mm_shift,
+                     __m256i mm_t, __m256i mm_c)
+{
+    __m256i mm_zero = _mm256_setzero_si256();
+    __m256i diff, fail;
+
+    switch (test) {
+        case ROW_ALPHA:
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(
+                _mm256_and_si256(_mm256_srl_epi32(p, mm_shift),
+                                 _mm256_set1_epi32(0xFF)),
+                mm_t)));
+        case ROW_COLORKEY:
+            return ~_mm256_movemask_ps(
+                       _mm256_castsi256_ps(_mm256_cmpeq_epi32(p, q))) &
+                   0xFF;
+        default:
+            /* |p - q| per byte, which passes where it's below the threshold
+             * byte, meaning the threshold minus it doesn't saturate to 0 */
+            diff = _mm256_or_si256(_mm256_subs_epu8(p, q),
+                                   _mm256_subs_epu8(q, p));
+            fail = _mm256_and_si256(
+                _mm256_cmpeq_epi8(_mm256_subs_epu8(mm_t, diff), mm_zero),
+                mm_c);
+            return _mm256_movemask_ps(
+                _mm256_castsi256_ps(_mm256_cmpeq_epi32(fail, mm_zero)));
+    }
+}
+
+/* The body of the row kernels, 8 pixels at a time */
+static PG_FORCEINLINE void
+_pg_row_to_bits_avx2(int test, BITMASK_W *bits, int stride,
+                     const Uint32 *row, const Uint32 *row2, int width,
+                     Uint32 key, int ashift, Uint32 threshold,
+                     Uint32 channels)
+{
+    __m128i mm_shift = _mm_cvtsi32_si128(ashift);
+    __m256i mm_t = _mm256_set1_epi32((int)threshold);
+    __m256i mm_c = _mm256_set1_epi32((int)channels);
+    __m256i q = _mm256_set1_epi32((int)key);
+    BITMASK_W word;
+    int x = 0, k, end, bit;
+
+    for (k = 0; x < width; k++) {
+        end = x + BITMASK_W_LEN < width ? x + BITMASK_W_LEN : width;
+        word = 0;
+        for (bit = 0; x + 8 <= end; x += 8, bit += 8) {
+            if (row2) {
+                q = _mm256_loadu_si256((const __m256i *)(row2 + x));
+            }
+            word |= (BITMASK_W)_pg_pixels_pass_m256(
+                        test, _mm256_loadu_si256((const __m256i *)(row + x)),
+                        q, mm_shift, mm_t, mm_c)
+                    << bit;
+        }
+        for (; x < end; x++, bit++) {
+            if (_pg_pixel_passes(test, row[x], row2 ? row2[x] : key, ashift,
+                                 threshold, channels)) {
+                word |= BITMASK_N(bit);
+            }
+        }
+        bits[(size_t)k * stride] = word;
+    }
+}
+
+void
+bitmask_row_alpha_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                       int width, int ashift, Uint8 threshold)
+{
+    _pg_row_to_bits_avx2(ROW_ALPHA, bits, stride, row, NULL, width, 0,
+                         ashift, threshold, 0);
+}
+
+void
+bitmask_row_colorkey_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          int width, Uint32 colorkey)
+{
+    _pg_row_to_bits_avx2(ROW_COLORKEY, bits, stride, row, NULL, width,
+                         colorkey, 0, 0, 0);
+}
+
+void
+bitmask_row_distance_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          const Uint32 *row2, int width, Uint32 color,
+                          Uint32 threshold, Uint32 channels)
+{
+    _pg_row_to_bits_avx2(ROW_DISTANCE, bits, stride, row, row2, width, color,
+                         0, threshold, channels);
+}
+
+#else
+
+int
+bitmask_strip_overlap_avx2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                           int lshift, int rshift)
+{
+    BAD_AVX2_FUNCTION_CALL;
+    return 0;
+}
+
+unsigned int
+bitmask_strip_count_avx2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                         int lshift, int rshift)
+{
+    BAD_AVX2_FUNCTION_CALL;
+    return 0;
+}
+
+void
+bitmask_strip_or_avx2(BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+                      int rshift)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+bitmask_strip_andnot_avx2(BITMASK_W *a, const BITMASK_W *b, int n,
+                          int lshift, int rshift)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+bitmask_strip_and_avx2(BITMASK_W *c, const BITMASK_W *a, const BITMASK_W *b,
+                       int n, int lshift, int rshift, int accumulate)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+bitmask_row_alpha_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                       int width, int ashift, Uint8 threshold)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+bitmask_row_colorkey_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          int width, Uint32 colorkey)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+bitmask_row_distance_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          const Uint32 *row2, int width, Uint32 color,
+                          Uint32 threshold, Uint32 channels)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
@@ -0,0 +1,388 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+#include "simd_level.h"
+#include "simd_bitmask.h"
+#include "simd_mask.h"
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+#define BAD_SSE2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an SSE2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+int
+_pg_bitmask_HasSSE_NEON(void)
+{
+#if defined(__SSE2__)
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasSSE2();
+#elif PG_ENABLE_ARM_NEON
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasNEON();
+#else
+    return 0;
+#endif
+}
+
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+
+/* BITMASK_W words per register */
+#define WORDS_PER_M128 ((int)(sizeof(__m128i) / sizeof(BITMASK_W)))
+
+#if BITMASK_W_LEN == 64
+#define _pg_sll_words _mm_sll_epi64
+#define _pg_srl_words _mm_srl_epi64
+#else
+#define _pg_sll_words _mm_sll_epi32
+#define _pg_srl_words _mm_srl_epi32
+#endif
+
+/* b[i] moved into place, see simd_bitmask.h */
+#define SHIFTED_M128(b, i, mm_l, mm_r)                                     \
+    _pg_srl_words(                                                         \
+        _pg_sll_words(_mm_loadu_si128((const __m128i *)((b) + (i))), mm_l), \
+        mm_r)
+
+static PG_FORCEINLINE unsigned int
+_pg_bitcount_word(BITMASK_W w)
+{
+    unsigned int count = 0;
+
+    while (w) {
+        w &= w - 1;
+        count++;
+    }
+    return count;
+}
+
+/* Bits set in each byte of v, summed into its two 64 bit lanes */
+static PG_FORCEINLINE __m128i
+_pg_bitcount_m128(__m128i v)
+{
+    const __m128i m1 = _mm_set1_epi8(0x55);
+    const __m128i m2 = _mm_set1_epi8(0x33);
+    const __m128i m4 = _mm_set1_epi8(0x0F);
+
+    v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+    v = _mm_add_epi8(_mm_and_si128(v, m2),
+                     _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+    v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+    return _mm_sad_epu8(v, _mm_setzero_si128());
+}
+
+int
+bitmask_strip_overlap_sse2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                           int lshift, int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+    __m128i mm_zero = _mm_setzero_si128();
+    __m128i hits;
+
+    for (; i + WORDS_PER_M128 <= n; i += WORDS_PER_M128) {
+        hits = _mm_and_si128(_mm_loadu_si128((const __m128i *)(a + i)),
+                             SHIFTED_M128(b, i, mm_l, mm_r));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(hits, mm_zero)) != 0xFFFF) {
+            return 1;
+        }
+    }
+    for (; i < n; i++) {
+        if (a[i] & ((b[i] << lshift) >> rshift)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+unsigned int
+bitmask_strip_count_sse2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                         int lshift, int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+    __m128i mm_count = _mm_setzero_si128();
+    Uint64 lanes[2];
+    unsigned int count;
+
+    for (; i + WORDS_PER_M128 <= n; i += WORDS_PER_M128) {
+        mm_count = _mm_add_epi64(
+            mm_count, _pg_bitcount_m128(_mm_and_si128(
+                          _mm_loadu_si128((const __m128i *)(a + i)),
+                          SHIFTED_M128(b, i, mm_l, mm_r))));
+    }
+    _mm_storeu_si128((__m128i *)lanes, mm_count);
+    count = (unsigned int)(lanes[0] + lanes[1]);
+    for (; i < n; i++) {
+        count += _pg_bitcount_word(a[i] & ((b[i] << lshift) >> rshift));
+    }
+    return count;
+}
+
+void
+bitmask_strip_or_sse2(BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+                      int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+
+    for (; i + WORDS_PER_M128 <= n; i += WORDS_PER_M128) {
+        _mm_storeu_si128(
+            (__m128i *)(a + i),
+            _mm_or_si128(_mm_loadu_si128((const __m128i *)(a + i)),
+                         SHIFTED_M128(b, i, mm_l, mm_r)));
+    }
+    for (; i < n; i++) {
+        a[i] |= (b[i] << lshift) >> rshift;
+    }
+}
+
+void
+bitmask_strip_andnot_sse2(BITMASK_W *a, const BITMASK_W *b, int n,
+                          int lshift, int rshift)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+
+    for (; i + WORDS_PER_M128 <= n; i += WORDS_PER_M128) {
+        _mm_storeu_si128(
+            (__m128i *)(a + i),
+            _mm_andnot_si128(SHIFTED_M128(b, i, mm_l, mm_r),
+                             _mm_loadu_si128((const __m128i *)(a + i))));
+    }
+    for (; i < n; i++) {
+        a[i] &= ~((b[i] << lshift) >> rshift);
+    }
+}
+
+void
+bitmask_strip_and_sse2(BITMASK_W *c, const BITMASK_W *a, const BITMASK_W *b,
+                       int n, int lshift, int rshift, int accumulate)
+{
+    int i = 0;
+    __m128i mm_l = _mm_cvtsi32_si128(lshift);
+    __m128i mm_r = _mm_cvtsi32_si128(rshift);
+    __m128i mm_c;
+
+    for (; i + WORDS_PER_M128 <= n; i += WORDS_PER_M128) {
+        mm_c = _mm_and_si128(_mm_loadu_si128((const __m128i *)(a + i)),
+                             SHIFTED_M128(b, i, mm_l, mm_r));
+        if (accumulate) {
+            mm_c = _mm_or_si128(mm_c,
+                                _mm_loadu_si128((const __m128i *)(c + i)));
+        }
+        _mm_storeu_si128((__m128i *)(c + i), mm_c);
+    }
+    for (; i < n; i++) {
+        if (accumulate) {
+            c[i] |= a[i] & ((b[i] << lshift) >> rshift);
+        }
+        else {
+            c[i] = a[i] & ((b[i] << lshift) >> rshift);
+        }
+    }
+}
+
+/* The pixel tests of the row kernels, see simd_mask.h */
+#define ROW_ALPHA 0
+#define ROW_COLORKEY 1
+#define ROW_DISTANCE 2
+
+/* One pixel p against q, the colorkey, color or pixel of row2 */
+static PG_FORCEINLINE int
+_pg_pixel_passes(int test, Uint32 p, Uint32 q, int ashift, Uint32 threshold,
+                 Uint32 channels)
+{
+    int a, b, t, i;
+
+    switch (test) {
+        case ROW_ALPHA:
+            return ((p >> ashift) & 0xFF) > threshold;
+        case ROW_COLORKEY:
+            return p != q;
+        default:
+            for (i = 0; i < 32; i += 8) {
+                if (!((channels >> i) & 0xFF)) {
+                    continue;
+                }
+                a = (p >> i) & 0xFF;
+                b = (q >> i) & 0xFF;
+                t = (threshold >> i) & 0xFF;
+                if ((a > b ? a - b : b - a) >= t) {
+                    return 0;
+                }
+            }
+            return 1;
+    }
+}
+
+/* Four pixels against q, one bit per pixel */
+static PG_FORCEINLINE int
+_pg_pixels_pass_m128(int test, __m128i p, __m128i q, __m128i mm_shift,
+                     __m128i mm_t, __m128i mm_c)
+{
+    __m128i mm_zero = _mm_setzero_si128();
+    __m128i diff, fail;
+
+    switch (test) {
+        case ROW_ALPHA:
+            return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(
+                _mm_and_si128(_mm_srl_epi32(p, mm_shift),
+                              _mm_set1_epi32(0xFF)),
+                mm_t)));
+        case ROW_COLORKEY:
+            return ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(p, q))) &
+                   0xF;
+        default:
+            /* |p - q| per byte, which passes where it's below the threshold
+             * byte, meaning the threshold minus it doesn't saturate to 0 */
+            diff = _mm_or_si128(_mm_subs_epu8(p, q), _mm_subs_epu8(q, p));
+            fail = _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_subs_epu8(mm_t, diff), mm_zero), mm_c);
+            return _mm_movemask_ps(
+                _mm_castsi128_ps(_mm_cmpeq_epi32(fail, mm_zero)));
+    }
+}
+
+/* The body of the row kernels, 8 pixels at a time */
+static PG_FORCEINLINE void
+_pg_row_to_bits_sse2(int test, BITMASK_W *bits, int stride,
+                     const Uint32 *row, const Uint32 *row2, int width,
+                     Uint32 key, int ashift, Uint32 threshold,
+                     Uint32 channels)
+{
+    __m128i mm_shift = _mm_cvtsi32_si128(ashift);
+    __m128i mm_t = _mm_set1_epi32((int)threshold);
+    __m128i mm_c = _mm_set1_epi32((int)channels);
+    __m128i q_lo = _mm_set1_epi32((int)key);
+    __m128i q_hi = q_lo;
+    BITMASK_W word;
+    int x = 0, k, end, bit, lo, hi;
+
+    for (k = 0; x < width; k++) {
+        end = x + BITMASK_W_LEN < width ? x + BITMASK_W_LEN : width;
+        word = 0;
+        for (bit = 0; x + 8 <= end; x += 8, bit += 8) {
+            if (row2) {
+                q_lo = _mm_loadu_si128((const __m128i *)(row2 + x));
+                q_hi = _mm_loadu_si128((const __m128i *)(row2 + x + 4));
+            }
+            lo = _pg_pixels_pass_m128(
+                test, _mm_loadu_si128((const __m128i *)(row + x)), q_lo,
+                mm_shift, mm_t, mm_c);
+            hi = _pg_pixels_pass_m128(
+                test, _mm_loadu_si128((const __m128i *)(row + x + 4)), q_hi,
+                mm_shift, mm_t, mm_c);
+            word |= (BITMASK_W)(lo | hi << 4) << bit;
+        }
+        for (; x < end; x++, bit++) {
+            if (_pg_pixel_passes(test, row[x], row2 ? row2[x] : key, ashift,
+                                 threshold, channels)) {
+                word |= BITMASK_N(bit);
+            }
+        }
+        bits[(size_t)k * stride] = word;
+    }
+}
+
+void
+bitmask_row_alpha_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                       int width, int ashift, Uint8 threshold)
+{
+    _pg_row_to_bits_sse2(ROW_ALPHA, bits, stride, row, NULL, width, 0,
+                         ashift, threshold, 0);
+}
+
+void
+bitmask_row_colorkey_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          int width, Uint32 colorkey)
+{
+    _pg_row_to_bits_sse2(ROW_COLORKEY, bits, stride, row, NULL, width,
+                         colorkey, 0, 0, 0);
+}
+
+void
+bitmask_row_distance_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          const Uint32 *row2, int width, Uint32 color,
+                          Uint32 threshold, Uint32 channels)
+{
+    _pg_row_to_bits_sse2(ROW_DISTANCE, bits, stride, row, row2, width, color,
+                         0, threshold, channels);
+}
+
+#else
+
+int
+bitmask_strip_overlap_sse2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                           int lshift, int rshift)
+{
+    BAD_SSE2_FUNCTION_CALL;
+    return 0;
+}
+
+unsigned int
+bitmask_strip_count_sse2(const BITMASK_W *a, const BITMASK_W *b, int n,
+                         int lshift, int rshift)
+{
+    BAD_SSE2_FUNCTION_CALL;
+    return 0;
+}
+
+void
+bitmask_strip_or_sse2(BITMASK_W *a, const BITMASK_W *b, int n, int lshift,
+                      int rshift)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+bitmask_strip_andnot_sse2(BITMASK_W *a, const BITMASK_W *b, int n,
+                          int lshift, int rshift)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+bitmask_strip_and_sse2(BITMASK_W *c, const BITMASK_W *a, const BITMASK_W *b,
+                       int n, int lshift, int rshift, int accumulate)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+bitmask_row_alpha_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                       int width, int ashift, Uint8 threshold)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+bitmask_row_colorkey_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          int width, Uint32 colorkey)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+bitmask_row_distance_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          const Uint32 *row2, int width, Uint32 color,
+                          Uint32 threshold, Uint32 channels)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+#endif /* defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON) */
@@ -0,0 +1,50 @@
+/* SIMD kernels for draw.c (internal)
+ *
+ * span_fill:  writes count pixels of bpp (2, 3 or 4) bytes, all set to the
+ *             mapped color, starting at dst. Pixels are stored the way
+ *             draw.c stores them one at a time, so for 3 bytes per pixel
+ *             the low 3 bytes of color (the high 3 on big endian systems).
+ *
+ * span_blend: blends the mapped color into count 4 byte pixels with the
+ *             ALPHA_BLEND equation of surface.h, alpha being the blend
+ *             factor. Every channel must be 8 bits wide and byte aligned.
+ *             amask is the alpha mask of the format (or 0) and keep the
+ *             union of all channel masks, unused bits are cleared the way
+ *             SDL_MapRGBA clears them.
+ *
+ * The repeating pattern of pixels is built once per span and then stored a
+ * whole register at a time, the tail of the span is copied from it.
+ */
+#ifndef SIMD_DRAW_H
+#define SIMD_DRAW_H
+
+#ifdef PG_SDL3
+#include <SDL3/SDL.h>
+#else
+#include <SDL.h>
+#endif
+
+int
+_pg_draw_has_avx2(void);
+
+/* This returns True if either SSE2 or NEON is present at runtime.
+ * Relevant because they use the same codepaths. Only the relevant runtime
+ * SDL cpu feature check is compiled in.*/
+int
+_pg_draw_HasSSE_NEON(void);
+
+// SSE2 functions
+void
+draw_span_fill_sse2(Uint8 *dst, int bpp, int count, Uint32 color);
+void
+draw_span_blend_sse2(Uint32 *dst, int count, Uint32 color, Uint8 alpha,
+                     Uint32 amask, Uint32 keep);
+
+// AVX2 functions
+void
+draw_span_fill_avx2(Uint8 *dst, int bpp, int count, Uint32 color);
+void
+draw_span_blend_avx2(Uint32 *dst, int count, Uint32 color, Uint8 alpha,
+                     Uint32 amask, Uint32 keep);
+
+#endif /* ~SIMD_DRAW_H */
@@ -0,0 +1,184 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+#include "simd_level.h"
+#include "simd_draw.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+#define BAD_AVX2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an AVX2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+/* helper function that does a runtime check for AVX2. It has the added
+ * functionality of also returning 0 if compile time support is missing */
+int
+_pg_draw_has_avx2(void)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    return pg_simd_level() >= PG_SIMD_LEVEL_AVX2 && SDL_HasAVX2();
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+
+/* Three registers hold a whole number of 2, 3 or 4 byte pixels */
+#define PATTERN_M256 (3 * (int)sizeof(__m256i))
+
+/* Fills pattern with size bytes of pixels, see simd_draw.h */
+static PG_FORCEINLINE void
+_pg_span_pattern(Uint8 *pattern, int size, int bpp, Uint32 color)
+{
+    Uint16 color16 = (Uint16)color;
+    int i;
+
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (bpp == 3) {
+        color <<= 8;
+    }
+#endif
+    for (i = 0; i < size; i += bpp) {
+        if (bpp == 2) {
+            memcpy(pattern + i, &color16, 2);
+        }
+        else {
+            memcpy(pattern + i, &color, bpp);
+        }
+    }
+}
+
+void
+draw_span_fill_avx2(Uint8 *dst, int bpp, int count, Uint32 color)
+{
+    Uint8 pattern[PATTERN_M256];
+    int n = count * bpp, i = 0;
+    __m256i mm_p0, mm_p1, mm_p2;
+
+    _pg_span_pattern(pattern, PATTERN_M256, bpp, color);
+    mm_p0 = _mm256_loadu_si256((const __m256i *)pattern);
+    mm_p1 = _mm256_loadu_si256((const __m256i *)(pattern + 32));
+    mm_p2 = _mm256_loadu_si256((const __m256i *)(pattern + 64));
+
+    for (; i + PATTERN_M256 <= n; i += PATTERN_M256) {
+        _mm256_storeu_si256((__m256i *)(dst + i), mm_p0);
+        _mm256_storeu_si256((__m256i *)(dst + i + 32), mm_p1);
+        _mm256_storeu_si256((__m256i *)(dst + i + 64), mm_p2);
+    }
+    if (i + 32 <= n) {
+        _mm256_storeu_si256((__m256i *)(dst + i), mm_p0);
+        i += 32;
+        if (i + 32 <= n) {
+            _mm256_storeu_si256((__m256i *)(dst + i), mm_p1);
+            i += 32;
+        }
+    }
+    /* Less than a register left, i % PATTERN_M256 is 0, 32 or 64 */
+    memcpy(dst + i, pattern + i % PATTERN_M256, n - i);
+}
+
+/* ALPHA_BLEND of surface.h on 4 pixels unpacked to 16 bit lanes, see
+ * _pg_blend_lanes in simd_draw_sse2.c for the equations. */
+static PG_FORCEINLINE __m256i
+_pg_blend_lanes(__m256i mm_dst, __m256i mm_inv_alpha, __m256i mm_src_term,
+                __m256i mm_alpha, __m256i mm_alpha_lanes, __m256i mm_one)
+{
+    __m256i mm_color = _mm256_srli_epi16(
+        _mm256_add_epi16(_mm256_mullo_epi16(mm_dst, mm_inv_alpha),
+                         mm_src_term),
+        8);
+    __m256i mm_prod = _mm256_mullo_epi16(mm_dst, mm_alpha);
+    __m256i mm_div = _mm256_srli_epi16(
+        _mm256_add_epi16(_mm256_add_epi16(mm_prod, mm_one),
+                         _mm256_srli_epi16(mm_prod, 8)),
+        8);
+    __m256i mm_a =
+        _mm256_sub_epi16(_mm256_add_epi16(mm_alpha, mm_dst), mm_div);
+
+    return _mm256_blendv_epi8(mm_color, mm_a, mm_alpha_lanes);
+}
+
+void
+draw_span_blend_avx2(Uint32 *dst, int count, Uint32 color, Uint8 alpha,
+                     Uint32 amask, Uint32 keep)
+{
+    Uint32 tail[8];
+    int i = 0, n;
+    __m256i mm_zero = _mm256_setzero_si256();
+    __m256i mm_color = _mm256_set1_epi32((int)color);
+    __m256i mm_amask = _mm256_set1_epi32((int)amask);
+    __m256i mm_has_alpha = _mm256_set1_epi32(amask ? -1 : 0);
+    __m256i mm_keep = _mm256_set1_epi32((int)keep);
+    __m256i mm_alpha = _mm256_set1_epi16(alpha);
+    __m256i mm_inv_alpha = _mm256_set1_epi16((short)(256 - alpha));
+    __m256i mm_one = _mm256_set1_epi16(1);
+    __m256i mm_src_term =
+        _mm256_mullo_epi16(_mm256_unpacklo_epi8(mm_color, mm_zero),
+                           _mm256_add_epi16(mm_alpha, mm_one));
+    __m256i mm_alpha_lanes = _mm256_cmpgt_epi16(
+        _mm256_unpacklo_epi8(mm_amask, mm_zero), mm_zero);
+    __m256i mm_dst, mm_lo, mm_hi, mm_res, mm_clear;
+
+    while (i < count) {
+        n = count - i;
+        if (n >= 8) {
+            mm_dst = _mm256_loadu_si256((const __m256i *)(dst + i));
+        }
+        else {
+            memcpy(tail, dst + i, n * sizeof(Uint32));
+            mm_dst = _mm256_loadu_si256((const __m256i *)tail);
+        }
+
+        mm_lo = _pg_blend_lanes(_mm256_unpacklo_epi8(mm_dst, mm_zero),
+                                mm_inv_alpha, mm_src_term, mm_alpha,
+                                mm_alpha_lanes, mm_one);
+        mm_hi = _pg_blend_lanes(_mm256_unpackhi_epi8(mm_dst, mm_zero),
+                                mm_inv_alpha, mm_src_term, mm_alpha,
+                                mm_alpha_lanes, mm_one);
+        mm_res = _mm256_packus_epi16(mm_lo, mm_hi);
+
+        /* Fully transparent pixels take the color as is */
+        mm_clear = _mm256_cmpeq_epi32(_mm256_and_si256(mm_dst, mm_amask),
+                                      mm_zero);
+        mm_clear = _mm256_and_si256(mm_clear, mm_has_alpha);
+        mm_res = _mm256_blendv_epi8(mm_res, mm_color, mm_clear);
+        mm_res = _mm256_and_si256(mm_res, mm_keep);
+
+        if (n >= 8) {
+            _mm256_storeu_si256((__m256i *)(dst + i), mm_res);
+            i += 8;
+        }
+        else {
+            _mm256_storeu_si256((__m256i *)tail, mm_res);
+            memcpy(dst + i, tail, n * sizeof(Uint32));
+            i = count;
+        }
+    }
+}
+
+#else
+
+void
+draw_span_fill_avx2(Uint8 *dst, int bpp, int count, Uint32 color)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+draw_span_blend_avx2(Uint32 *dst, int count, Uint32 color, Uint8 alpha,
+                     Uint32 amask, Uint32 keep)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
@@ -0,0 +1,187 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+#include "simd_level.h"
+#include "simd_draw.h"
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+#define BAD_SSE2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an SSE2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+int
+_pg_draw_HasSSE_NEON(void)
+{
+#if defined(__SSE2__)
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasSSE2();
+#elif PG_ENABLE_ARM_NEON
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasNEON();
+#else
+    return 0;
+#endif
+}
+
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+
+/* Three registers hold a whole number of 2, 3 or 4 byte pixels */
+#define PATTERN_M128 (3 * (int)sizeof(__m128i))
+
+/* Fills pattern with size bytes of pixels, see simd_draw.h */
+static PG_FORCEINLINE void
+_pg_span_pattern(Uint8 *pattern, int size, int bpp, Uint32 color)
+{
+    Uint16 color16 = (Uint16)color;
+    int i;
+
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (bpp == 3) {
+        color <<= 8;
+    }
+#endif
+    for (i = 0; i < size; i += bpp) {
+        if (bpp == 2) {
+            memcpy(pattern + i, &color16, 2);
+        }
+        else {
+            memcpy(pattern + i, &color, bpp);
+        }
+    }
+}
+
+void
+draw_span_fill_sse2(Uint8 *dst, int bpp, int count, Uint32 color)
+{
+    Uint8 pattern[PATTERN_M128];
+    int n = count * bpp, i = 0;
+    __m128i mm_p0, mm_p1, mm_p2;
+
+    _pg_span_pattern(pattern, PATTERN_M128, bpp, color);
+    mm_p0 = _mm_loadu_si128((const __m128i *)pattern);
+    mm_p1 = _mm_loadu_si128((const __m128i *)(pattern + 16));
+    mm_p2 = _mm_loadu_si128((const __m128i *)(pattern + 32));
+
+    for (; i + PATTERN_M128 <= n; i += PATTERN_M128) {
+        _mm_storeu_si128((__m128i *)(dst + i), mm_p0);
+        _mm_storeu_si128((__m128i *)(dst + i + 16), mm_p1);
+        _mm_storeu_si128((__m128i *)(dst + i + 32), mm_p2);
+    }
+    if (i + 16 <= n) {
+        _mm_storeu_si128((__m128i *)(dst + i), mm_p0);
+        i += 16;
+        if (i + 16 <= n) {
+            _mm_storeu_si128((__m128i *)(dst + i), mm_p1);
+            i += 16;
+        }
+    }
+    /* Less than a register left, i % PATTERN_M128 is 0, 16 or 32 */
+    memcpy(dst + i, pattern + i % PATTERN_M128, n - i);
+}
+
+/* ALPHA_BLEND of surface.h on 2 pixels unpacked to 16 bit lanes. Color
+ * channels are (dC * (256 - sA) + sC * (sA + 1)) >> 8, which is
+ * ALPHA_BLEND_COMP without negative terms, so it can't overflow. The alpha
+ * channel is sA + dA - sA * dA / 255, the division done as
+ * (x + 1 + (x >> 8)) >> 8 which is exact for x <= 255 * 255. */
+static PG_FORCEINLINE __m128i
+_pg_blend_lanes(__m128i mm_dst, __m128i mm_inv_alpha, __m128i mm_src_term,
+                __m128i mm_alpha, __m128i mm_alpha_lanes, __m128i mm_one)
+{
+    __m128i mm_color = _mm_srli_epi16(
+        _mm_add_epi16(_mm_mullo_epi16(mm_dst, mm_inv_alpha), mm_src_term), 8);
+    __m128i mm_prod = _mm_mullo_epi16(mm_dst, mm_alpha);
+    __m128i mm_div = _mm_srli_epi16(
+        _mm_add_epi16(_mm_add_epi16(mm_prod, mm_one),
+                      _mm_srli_epi16(mm_prod, 8)),
+        8);
+    __m128i mm_a = _mm_sub_epi16(_mm_add_epi16(mm_alpha, mm_dst), mm_div);
+
+    return _mm_or_si128(_mm_and_si128(mm_alpha_lanes, mm_a),
+                        _mm_andnot_si128(mm_alpha_lanes, mm_color));
+}
+
+void
+draw_span_blend_sse2(Uint32 *dst, int count, Uint32 color, Uint8 alpha,
+                     Uint32 amask, Uint32 keep)
+{
+    Uint32 tail[4];
+    int i = 0, n;
+    __m128i mm_zero = _mm_setzero_si128();
+    __m128i mm_color = _mm_set1_epi32((int)color);
+    __m128i mm_amask = _mm_set1_epi32((int)amask);
+    __m128i mm_has_alpha = _mm_set1_epi32(amask ? -1 : 0);
+    __m128i mm_keep = _mm_set1_epi32((int)keep);
+    __m128i mm_alpha = _mm_set1_epi16(alpha);
+    __m128i mm_inv_alpha = _mm_set1_epi16((short)(256 - alpha));
+    __m128i mm_one = _mm_set1_epi16(1);
+    __m128i mm_src_term = _mm_mullo_epi16(
+        _mm_unpacklo_epi8(mm_color, mm_zero), _mm_add_epi16(mm_alpha, mm_one));
+    __m128i mm_alpha_lanes = _mm_cmpgt_epi16(
+        _mm_unpacklo_epi8(mm_amask, mm_zero), mm_zero);
+    __m128i mm_dst, mm_lo, mm_hi, mm_res, mm_clear;
+
+    while (i < count) {
+        n = count - i;
+        if (n >= 4) {
+            mm_dst = _mm_loadu_si128((const __m128i *)(dst + i));
+        }
+        else {
+            memcpy(tail, dst + i, n * sizeof(Uint32));
+            mm_dst = _mm_loadu_si128((const __m128i *)tail);
+        }
+
+        mm_lo = _pg_blend_lanes(_mm_unpacklo_epi8(mm_dst, mm_zero),
+                                mm_inv_alpha, mm_src_term, mm_alpha,
+                                mm_alpha_lanes, mm_one);
+        mm_hi = _pg_blend_lanes(_mm_unpackhi_epi8(mm_dst, mm_zero),
+                                mm_inv_alpha, mm_src_term, mm_alpha,
+                                mm_alpha_lanes, mm_one);
+        mm_res = _mm_packus_epi16(mm_lo, mm_hi);
+
+        /* Fully transparent pixels take the color as is */
+        mm_clear = _mm_cmpeq_epi32(_mm_and_si128(mm_dst, mm_amask), mm_zero);
+        mm_clear = _mm_and_si128(mm_clear, mm_has_alpha);
+        mm_res = _mm_or_si128(_mm_and_si128(mm_clear, mm_color),
+                              _mm_andnot_si128(mm_clear, mm_res));
+        mm_res = _mm_and_si128(mm_res, mm_keep);
+
+        if (n >= 4) {
+            _mm_storeu_si128((__m128i *)(dst + i), mm_res);
+            i += 4;
+        }
+        else {
+            _mm_storeu_si128((__m128i *)tail, mm_res);
+            memcpy(dst + i, tail, n * sizeof(Uint32));
+            i = count;
+        }
+    }
+}
+
+#else
+
+void
+draw_span_fill_sse2(Uint8 *dst, int bpp, int count, Uint32 color)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+draw_span_blend_sse2(Uint32 *dst, int count, Uint32 color, Uint8 alpha,
+                     Uint32 amask, Uint32 keep)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+#endif /* defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON) */
@@ -0,0 +1,42 @@
+/* Runtime cap on the SIMD code paths (internal)
+ *
+ * The PYGAME_SIMD environment variable limits which SIMD kernels the runtime
+ * CPU checks hand out, so the fallbacks can be tested and benchmarked on a
+ * machine that supports more:
+ *
+ *   "avx2" or unset  every kernel the CPU supports
+ *   "sse2"/"neon"    SSE2/NEON kernels at most, no AVX2
+ *   "none"           only the non-SIMD code
+ *
+ * It is read once, the first time a check runs in a module.
+ */
+#ifndef SIMD_LEVEL_H
+#define SIMD_LEVEL_H
+
+#define PG_SIMD_LEVEL_NONE 0
+#define PG_SIMD_LEVEL_SSE2 1
+#define PG_SIMD_LEVEL_AVX2 2
+
+static PG_INLINE int
+pg_simd_level(void)
+{
+    static int level = -1;
+
+    if (level < 0) {
+        const char *env = SDL_getenv("PYGAME_SIMD");
+
+        if (env && SDL_strcasecmp(env, "none") == 0) {
+            level = PG_SIMD_LEVEL_NONE;
+        }
+        else if (env && (SDL_strcasecmp(env, "sse2") == 0 ||
+                         SDL_strcasecmp(env, "neon") == 0)) {
+            level = PG_SIMD_LEVEL_SSE2;
+        }
+        else {
+            level = PG_SIMD_LEVEL_AVX2;
+        }
+    }
+    return level;
+}
+
+#endif /* ~SIMD_LEVEL_H */
@@ -0,0 +1,52 @@
+/* SIMD kernels for mask.c (internal)
+ *
+ * Each kernel turns one row of width 32 bit pixels into bitmask words. The
+ * bits of the pixels k * BITMASK_W_LEN up to (k + 1) * BITMASK_W_LEN go to
+ * bits[k * stride], which is overwritten. Passing the address of the first
+ * word of row y of a bitmask and its height as the stride fills that row.
+ *
+ * alpha:     set where the alpha byte, (p >> ashift) & 0xFF, > threshold
+ * colorkey:  set where p != colorkey
+ * distance:  set where every byte selected by the channels mask differs
+ *            from the same byte of color, or of row2 if it isn't NULL, by
+ *            less than the same byte of threshold
+ *
+ * They live in simd_bitmask_sse2.c and simd_bitmask_avx2.c, next to the
+ * bitmask.c kernels, and share their runtime checks (see simd_bitmask.h).
+ */
+#ifndef SIMD_MASK_H
+#define SIMD_MASK_H
+
+#ifdef PG_SDL3
+#include <SDL3/SDL.h>
+#else
+#include <SDL.h>
+#endif
+
+#include "simd_bitmask.h"
+
+// SSE2 functions
+void
+bitmask_row_alpha_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                       int width, int ashift, Uint8 threshold);
+void
+bitmask_row_colorkey_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          int width, Uint32 colorkey);
+void
+bitmask_row_distance_sse2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          const Uint32 *row2, int width, Uint32 color,
+                          Uint32 threshold, Uint32 channels);
+
+// AVX2 functions
+void
+bitmask_row_alpha_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                       int width, int ashift, Uint8 threshold);
+void
+bitmask_row_colorkey_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          int width, Uint32 colorkey);
+void
+bitmask_row_distance_avx2(BITMASK_W *bits, int stride, const Uint32 *row,
+                          const Uint32 *row2, int width, Uint32 color,
+                          Uint32 threshold, Uint32 channels);
+
+#endif /* ~SIMD_MASK_H */
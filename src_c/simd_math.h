@@ -0,0 +1,131 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+#include "simd_level.h"
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#if defined(__SSE2__)
+#define PG_ENABLE_SSE_NEON 1
+#elif PG_ENABLE_ARM_NEON
+#define PG_ENABLE_SSE_NEON 1
+#else
+#define PG_ENABLE_SSE_NEON 0
+#endif
+
+/* Kernels for Vector2Array and Vector3Array. The arrays keep each component
+ * in its own column of doubles, cols[0] holding all x values and so on.
+ * Every kernel does the same floating point operations in the same order as
+ * the matching Vector method, so results are identical to the scalar code.
+ *
+ * add:             dst[i] += src ? factor * src[i] : value
+ * mul:             dst[i] *= src ? src[i] : value
+ * lerp:            dst[i] = dst[i] * (1 - t) + (src ? src[i] : value) * t
+ * dot:             out[i] = sum of a[c][i] * b[c][i] over the components
+ * normalize:       divides vector i by sqrt(length_sq[i])
+ * clamp_magnitude: what Vector.clamp_magnitude_ip does, length_sq[i] being
+ *                  the squared length of vector i
+ * transform:       multiplies every vector by a dim x dim row major matrix
+ */
+
+int
+_pg_math_has_avx2();
+
+/* This returns True if either SSE2 or NEON is present at runtime.
+ * Relevant because they use the same codepaths. Only the relevant runtime
+ * SDL cpu feature check is compiled in.*/
+int
+_pg_math_HasSSE_NEON();
+
+/* scalar versions of the per vector kernels, used for the leftovers of the
+ * SIMD loops and when no SIMD backend is available */
+static PG_FORCEINLINE void
+_pg_vector_array_clamp_magnitude1(double *const *cols, Py_ssize_t dim,
+                                  double length_sq, double min_length,
+                                  double max_length, Py_ssize_t i)
+{
+    double fraction = 1;
+    Py_ssize_t c;
+
+    if (length_sq > max_length * max_length) {
+        fraction = max_length / sqrt(length_sq);
+    }
+    if (length_sq < min_length * min_length) {
+        fraction = min_length / sqrt(length_sq);
+    }
+    for (c = 0; c < dim; c++) {
+        cols[c][i] *= fraction;
+    }
+}
+
+static PG_FORCEINLINE void
+_pg_vector_array_transform1(double *const *cols, Py_ssize_t dim,
+                            const double *matrix, Py_ssize_t i)
+{
+    double src[3], dst[3];
+    Py_ssize_t r, c;
+
+    for (c = 0; c < dim; c++) {
+        src[c] = cols[c][i];
+    }
+    for (r = 0; r < dim; r++) {
+        dst[r] = src[0] * matrix[r * dim];
+        for (c = 1; c < dim; c++) {
+            dst[r] += src[c] * matrix[r * dim + c];
+        }
+    }
+    for (c = 0; c < dim; c++) {
+        cols[c][i] = dst[c];
+    }
+}
+
+// SSE2 functions
+void
+vector_array_add_sse2(double *dst, const double *src, double value,
+                      double factor, Py_ssize_t n);
+void
+vector_array_mul_sse2(double *dst, const double *src, double value,
+                      Py_ssize_t n);
+void
+vector_array_lerp_sse2(double *dst, const double *src, double value, double t,
+                       Py_ssize_t n);
+void
+vector_array_dot_sse2(const double *const *a, const double *const *b,
+                      Py_ssize_t dim, double *out, Py_ssize_t n);
+void
+vector_array_normalize_sse2(double *const *cols, Py_ssize_t dim,
+                            const double *length_sq, Py_ssize_t n);
+void
+vector_array_clamp_magnitude_sse2(double *const *cols, Py_ssize_t dim,
+                                  const double *length_sq, double min_length,
+                                  double max_length, Py_ssize_t n);
+void
+vector_array_transform_sse2(double *const *cols, Py_ssize_t dim,
+                            const double *matrix, Py_ssize_t n);
+
+// AVX2 functions
+void
+vector_array_add_avx2(double *dst, const double *src, double value,
+                      double factor, Py_ssize_t n);
+void
+vector_array_mul_avx2(double *dst, const double *src, double value,
+                      Py_ssize_t n);
+void
+vector_array_lerp_avx2(double *dst, const double *src, double value, double t,
+                       Py_ssize_t n);
+void
+vector_array_dot_avx2(const double *const *a, const double *const *b,
+                      Py_ssize_t dim, double *out, Py_ssize_t n);
+void
+vector_array_normalize_avx2(double *const *cols, Py_ssize_t dim,
+                            const double *length_sq, Py_ssize_t n);
+void
+vector_array_clamp_magnitude_avx2(double *const *cols, Py_ssize_t dim,
+                                  const double *length_sq, double min_length,
+                                  double max_length, Py_ssize_t n);
+void
+vector_array_transform_avx2(double *const *cols, Py_ssize_t dim,
+                            const double *matrix, Py_ssize_t n);
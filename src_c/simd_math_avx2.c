@@ -0,0 +1,266 @@
+#include "simd_math.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+#define BAD_AVX2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an AVX2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+/* helper function that does a runtime check for AVX2. It has the added
+ * functionality of also returning 0 if compile time support is missing */
+int
+_pg_math_has_avx2()
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    return pg_simd_level() >= PG_SIMD_LEVEL_AVX2 && SDL_HasAVX2();
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+
+void
+vector_array_add_avx2(double *dst, const double *src, double value,
+                      double factor, Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m256d mm_value = _mm256_set1_pd(value);
+    __m256d mm_factor = _mm256_set1_pd(factor);
+    __m256d mm_dst, mm_src;
+
+    if (src) {
+        for (; i + 4 <= n; i += 4) {
+            mm_dst = _mm256_loadu_pd(dst + i);
+            mm_src = _mm256_mul_pd(mm_factor, _mm256_loadu_pd(src + i));
+            _mm256_storeu_pd(dst + i, _mm256_add_pd(mm_dst, mm_src));
+        }
+        for (; i < n; i++) {
+            dst[i] += factor * src[i];
+        }
+        return;
+    }
+    for (; i + 4 <= n; i += 4) {
+        mm_dst = _mm256_loadu_pd(dst + i);
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(mm_dst, mm_value));
+    }
+    for (; i < n; i++) {
+        dst[i] += value;
+    }
+}
+
+void
+vector_array_mul_avx2(double *dst, const double *src, double value,
+                      Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m256d mm_value = _mm256_set1_pd(value);
+    __m256d mm_dst, mm_src;
+
+    for (; i + 4 <= n; i += 4) {
+        mm_dst = _mm256_loadu_pd(dst + i);
+        mm_src = src ? _mm256_loadu_pd(src + i) : mm_value;
+        _mm256_storeu_pd(dst + i, _mm256_mul_pd(mm_dst, mm_src));
+    }
+    for (; i < n; i++) {
+        dst[i] *= src ? src[i] : value;
+    }
+}
+
+void
+vector_array_lerp_avx2(double *dst, const double *src, double value, double t,
+                       Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m256d mm_value = _mm256_set1_pd(value);
+    __m256d mm_t = _mm256_set1_pd(t);
+    __m256d mm_one_minus_t = _mm256_set1_pd(1 - t);
+    __m256d mm_dst, mm_src;
+
+    for (; i + 4 <= n; i += 4) {
+        mm_dst = _mm256_mul_pd(_mm256_loadu_pd(dst + i), mm_one_minus_t);
+        mm_src = src ? _mm256_loadu_pd(src + i) : mm_value;
+        mm_src = _mm256_mul_pd(mm_src, mm_t);
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(mm_dst, mm_src));
+    }
+    for (; i < n; i++) {
+        dst[i] = dst[i] * (1 - t) + (src ? src[i] : value) * t;
+    }
+}
+
+void
+vector_array_dot_avx2(const double *const *a, const double *const *b,
+                      Py_ssize_t dim, double *out, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, c;
+    __m256d acc, mm_a, mm_b;
+
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_setzero_pd();
+        for (c = 0; c < dim; c++) {
+            mm_a = _mm256_loadu_pd(a[c] + i);
+            mm_b = _mm256_loadu_pd(b[c] + i);
+            acc = _mm256_add_pd(acc, _mm256_mul_pd(mm_a, mm_b));
+        }
+        _mm256_storeu_pd(out + i, acc);
+    }
+    for (; i < n; i++) {
+        double product = 0;
+        for (c = 0; c < dim; c++) {
+            product += a[c][i] * b[c][i];
+        }
+        out[i] = product;
+    }
+}
+
+void
+vector_array_normalize_avx2(double *const *cols, Py_ssize_t dim,
+                            const double *length_sq, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, c;
+    __m256d length, mm_col;
+
+    for (; i + 4 <= n; i += 4) {
+        length = _mm256_sqrt_pd(_mm256_loadu_pd(length_sq + i));
+        for (c = 0; c < dim; c++) {
+            mm_col = _mm256_loadu_pd(cols[c] + i);
+            _mm256_storeu_pd(cols[c] + i, _mm256_div_pd(mm_col, length));
+        }
+    }
+    for (; i < n; i++) {
+        double len = sqrt(length_sq[i]);
+        for (c = 0; c < dim; c++) {
+            cols[c][i] /= len;
+        }
+    }
+}
+
+void
+vector_array_clamp_magnitude_avx2(double *const *cols, Py_ssize_t dim,
+                                  const double *length_sq, double min_length,
+                                  double max_length, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, c;
+    __m256d mm_min = _mm256_set1_pd(min_length);
+    __m256d mm_max = _mm256_set1_pd(max_length);
+    __m256d mm_min_sq = _mm256_set1_pd(min_length * min_length);
+    __m256d mm_max_sq = _mm256_set1_pd(max_length * max_length);
+    __m256d mm_one = _mm256_set1_pd(1);
+    __m256d lsq, length, fraction, scaled, mask, mm_col;
+
+    for (; i + 4 <= n; i += 4) {
+        lsq = _mm256_loadu_pd(length_sq + i);
+        length = _mm256_sqrt_pd(lsq);
+        fraction = mm_one;
+
+        /* same order as the scalar code, the min_length check wins */
+        mask = _mm256_cmp_pd(lsq, mm_max_sq, _CMP_GT_OQ);
+        scaled = _mm256_div_pd(mm_max, length);
+        fraction = _mm256_blendv_pd(fraction, scaled, mask);
+        mask = _mm256_cmp_pd(lsq, mm_min_sq, _CMP_LT_OQ);
+        scaled = _mm256_div_pd(mm_min, length);
+        fraction = _mm256_blendv_pd(fraction, scaled, mask);
+
+        for (c = 0; c < dim; c++) {
+            mm_col = _mm256_loadu_pd(cols[c] + i);
+            _mm256_storeu_pd(cols[c] + i, _mm256_mul_pd(mm_col, fraction));
+        }
+    }
+    for (; i < n; i++) {
+        _pg_vector_array_clamp_magnitude1(cols, dim, length_sq[i], min_length,
+                                          max_length, i);
+    }
+}
+
+void
+vector_array_transform_avx2(double *const *cols, Py_ssize_t dim,
+                            const double *matrix, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, r, c;
+    __m256d src[3], dst[3], factor;
+
+    for (; i + 4 <= n; i += 4) {
+        for (c = 0; c < dim; c++) {
+            src[c] = _mm256_loadu_pd(cols[c] + i);
+        }
+        /* same evaluation order as the scalar rotate helpers */
+        for (r = 0; r < dim; r++) {
+            factor = _mm256_set1_pd(matrix[r * dim]);
+            dst[r] = _mm256_mul_pd(src[0], factor);
+            for (c = 1; c < dim; c++) {
+                factor = _mm256_set1_pd(matrix[r * dim + c]);
+                dst[r] = _mm256_add_pd(dst[r], _mm256_mul_pd(src[c], factor));
+            }
+        }
+        for (c = 0; c < dim; c++) {
+            _mm256_storeu_pd(cols[c] + i, dst[c]);
+        }
+    }
+    for (; i < n; i++) {
+        _pg_vector_array_transform1(cols, dim, matrix, i);
+    }
+}
+
+#else
+
+void
+vector_array_add_avx2(double *dst, const double *src, double value,
+                      double factor, Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+vector_array_mul_avx2(double *dst, const double *src, double value,
+                      Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+vector_array_lerp_avx2(double *dst, const double *src, double value, double t,
+                       Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+vector_array_dot_avx2(const double *const *a, const double *const *b,
+                      Py_ssize_t dim, double *out, Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+vector_array_normalize_avx2(double *const *cols, Py_ssize_t dim,
+                            const double *length_sq, Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+vector_array_clamp_magnitude_avx2(double *const *cols, Py_ssize_t dim,
+                                  const double *length_sq, double min_length,
+                                  double max_length, Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+vector_array_transform_avx2(double *const *cols, Py_ssize_t dim,
+                            const double *matrix, Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
@@ -0,0 +1,265 @@
+#include "simd_math.h"
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+#define BAD_SSE2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an SSE2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+int
+_pg_math_HasSSE_NEON()
+{
+#if defined(__SSE2__)
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasSSE2();
+#elif PG_ENABLE_ARM_NEON
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasNEON();
+#else
+    return 0;
+#endif
+}
+
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+
+void
+vector_array_add_sse2(double *dst, const double *src, double value,
+                      double factor, Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m128d mm_value = _mm_set1_pd(value);
+    __m128d mm_factor = _mm_set1_pd(factor);
+    __m128d mm_dst, mm_src;
+
+    if (src) {
+        for (; i + 2 <= n; i += 2) {
+            mm_dst = _mm_loadu_pd(dst + i);
+            mm_src = _mm_mul_pd(mm_factor, _mm_loadu_pd(src + i));
+            _mm_storeu_pd(dst + i, _mm_add_pd(mm_dst, mm_src));
+        }
+        for (; i < n; i++) {
+            dst[i] += factor * src[i];
+        }
+        return;
+    }
+    for (; i + 2 <= n; i += 2) {
+        mm_dst = _mm_loadu_pd(dst + i);
+        _mm_storeu_pd(dst + i, _mm_add_pd(mm_dst, mm_value));
+    }
+    for (; i < n; i++) {
+        dst[i] += value;
+    }
+}
+
+void
+vector_array_mul_sse2(double *dst, const double *src, double value,
+                      Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m128d mm_value = _mm_set1_pd(value);
+    __m128d mm_dst, mm_src;
+
+    for (; i + 2 <= n; i += 2) {
+        mm_dst = _mm_loadu_pd(dst + i);
+        mm_src = src ? _mm_loadu_pd(src + i) : mm_value;
+        _mm_storeu_pd(dst + i, _mm_mul_pd(mm_dst, mm_src));
+    }
+    for (; i < n; i++) {
+        dst[i] *= src ? src[i] : value;
+    }
+}
+
+void
+vector_array_lerp_sse2(double *dst, const double *src, double value, double t,
+                       Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m128d mm_value = _mm_set1_pd(value);
+    __m128d mm_t = _mm_set1_pd(t);
+    __m128d mm_one_minus_t = _mm_set1_pd(1 - t);
+    __m128d mm_dst, mm_src;
+
+    for (; i + 2 <= n; i += 2) {
+        mm_dst = _mm_mul_pd(_mm_loadu_pd(dst + i), mm_one_minus_t);
+        mm_src = src ? _mm_loadu_pd(src + i) : mm_value;
+        mm_src = _mm_mul_pd(mm_src, mm_t);
+        _mm_storeu_pd(dst + i, _mm_add_pd(mm_dst, mm_src));
+    }
+    for (; i < n; i++) {
+        dst[i] = dst[i] * (1 - t) + (src ? src[i] : value) * t;
+    }
+}
+
+void
+vector_array_dot_sse2(const double *const *a, const double *const *b,
+                      Py_ssize_t dim, double *out, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, c;
+    __m128d acc, mm_a, mm_b;
+
+    for (; i + 2 <= n; i += 2) {
+        acc = _mm_setzero_pd();
+        for (c = 0; c < dim; c++) {
+            mm_a = _mm_loadu_pd(a[c] + i);
+            mm_b = _mm_loadu_pd(b[c] + i);
+            acc = _mm_add_pd(acc, _mm_mul_pd(mm_a, mm_b));
+        }
+        _mm_storeu_pd(out + i, acc);
+    }
+    for (; i < n; i++) {
+        double product = 0;
+        for (c = 0; c < dim; c++) {
+            product += a[c][i] * b[c][i];
+        }
+        out[i] = product;
+    }
+}
+
+void
+vector_array_normalize_sse2(double *const *cols, Py_ssize_t dim,
+                            const double *length_sq, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, c;
+    __m128d length, mm_col;
+
+    for (; i + 2 <= n; i += 2) {
+        length = _mm_sqrt_pd(_mm_loadu_pd(length_sq + i));
+        for (c = 0; c < dim; c++) {
+            mm_col = _mm_loadu_pd(cols[c] + i);
+            _mm_storeu_pd(cols[c] + i, _mm_div_pd(mm_col, length));
+        }
+    }
+    for (; i < n; i++) {
+        double len = sqrt(length_sq[i]);
+        for (c = 0; c < dim; c++) {
+            cols[c][i] /= len;
+        }
+    }
+}
+
+void
+vector_array_clamp_magnitude_sse2(double *const *cols, Py_ssize_t dim,
+                                  const double *length_sq, double min_length,
+                                  double max_length, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, c;
+    __m128d mm_min = _mm_set1_pd(min_length);
+    __m128d mm_max = _mm_set1_pd(max_length);
+    __m128d mm_min_sq = _mm_set1_pd(min_length * min_length);
+    __m128d mm_max_sq = _mm_set1_pd(max_length * max_length);
+    __m128d mm_one = _mm_set1_pd(1);
+    __m128d lsq, length, fraction, scaled, mask, mm_col;
+
+    for (; i + 2 <= n; i += 2) {
+        lsq = _mm_loadu_pd(length_sq + i);
+        length = _mm_sqrt_pd(lsq);
+        fraction = mm_one;
+
+        /* same order as the scalar code, the min_length check wins */
+        mask = _mm_cmpgt_pd(lsq, mm_max_sq);
+        scaled = _mm_div_pd(mm_max, length);
+        fraction = _mm_or_pd(_mm_and_pd(mask, scaled),
+                             _mm_andnot_pd(mask, fraction));
+        mask = _mm_cmplt_pd(lsq, mm_min_sq);
+        scaled = _mm_div_pd(mm_min, length);
+        fraction = _mm_or_pd(_mm_and_pd(mask, scaled),
+                             _mm_andnot_pd(mask, fraction));
+
+        for (c = 0; c < dim; c++) {
+            mm_col = _mm_loadu_pd(cols[c] + i);
+            _mm_storeu_pd(cols[c] + i, _mm_mul_pd(mm_col, fraction));
+        }
+    }
+    for (; i < n; i++) {
+        _pg_vector_array_clamp_magnitude1(cols, dim, length_sq[i], min_length,
+                                          max_length, i);
+    }
+}
+
+void
+vector_array_transform_sse2(double *const *cols, Py_ssize_t dim,
+                            const double *matrix, Py_ssize_t n)
+{
+    Py_ssize_t i = 0, r, c;
+    __m128d src[3], dst[3], factor;
+
+    for (; i + 2 <= n; i += 2) {
+        for (c = 0; c < dim; c++) {
+            src[c] = _mm_loadu_pd(cols[c] + i);
+        }
+        /* same evaluation order as the scalar rotate helpers */
+        for (r = 0; r < dim; r++) {
+            factor = _mm_set1_pd(matrix[r * dim]);
+            dst[r] = _mm_mul_pd(src[0], factor);
+            for (c = 1; c < dim; c++) {
+                factor = _mm_set1_pd(matrix[r * dim + c]);
+                dst[r] = _mm_add_pd(dst[r], _mm_mul_pd(src[c], factor));
+            }
+        }
+        for (c = 0; c < dim; c++) {
+            _mm_storeu_pd(cols[c] + i, dst[c]);
+        }
+    }
+    for (; i < n; i++) {
+        _pg_vector_array_transform1(cols, dim, matrix, i);
+    }
+}
+
+#else
+
+void
+vector_array_add_sse2(double *dst, const double *src, double value,
+                      double factor, Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+vector_array_mul_sse2(double *dst, const double *src, double value,
+                      Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+vector_array_lerp_sse2(double *dst, const double *src, double value, double t,
+                       Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+vector_array_dot_sse2(const double *const *a, const double *const *b,
+                      Py_ssize_t dim, double *out, Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+vector_array_normalize_sse2(double *const *cols, Py_ssize_t dim,
+                            const double *length_sq, Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+vector_array_clamp_magnitude_sse2(double *const *cols, Py_ssize_t dim,
+                                  const double *length_sq, double min_length,
+                                  double max_length, Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+vector_array_transform_sse2(double *const *cols, Py_ssize_t dim,
+                            const double *matrix, Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+#endif /* defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON) */
@@ -0,0 +1,131 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+#include "simd_level.h"
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#if defined(__SSE2__)
+#define PG_ENABLE_SSE_NEON 1
+#elif PG_ENABLE_ARM_NEON
+#define PG_ENABLE_SSE_NEON 1
+#else
+#define PG_ENABLE_SSE_NEON 0
+#endif
+
+/* Kernels for RectArray and FRectArray. The arrays keep every attribute in
+ * its own column, so each kernel works on plain int or float columns.
+ *
+ * add:     dst[i] += src ? src[i] : value
+ * clamp:   moves pos[i] like Rect.clamp does along one axis, lo and span
+ *          being the position and size of the rect to clamp into
+ * collide: out[i] is 1 when rect i collides with the given rect, which must
+ *          be passed as its normalized left, top, right and bottom edges and
+ *          must not be empty. Same rules as Rect.colliderect. */
+
+int
+_pg_rect_has_avx2();
+
+/* This returns True if either SSE2 or NEON is present at runtime.
+ * Relevant because they use the same codepaths. Only the relevant runtime
+ * SDL cpu feature check is compiled in.*/
+int
+_pg_rect_HasSSE_NEON();
+
+/* scalar versions, used for the leftovers of the SIMD loops and when no
+ * SIMD backend is available */
+static PG_FORCEINLINE int
+_pg_rect_array_clamp_i(int pos, int size, int lo, int span)
+{
+    if (size >= span) {
+        return lo + span / 2 - size / 2;
+    }
+    if (pos < lo) {
+        return lo;
+    }
+    if (pos + size > lo + span) {
+        return lo + span - size;
+    }
+    return pos;
+}
+
+static PG_FORCEINLINE float
+_pg_rect_array_clamp_f(float pos, float size, float lo, float span)
+{
+    if (size >= span) {
+        return lo + span / 2 - size / 2;
+    }
+    if (pos < lo) {
+        return lo;
+    }
+    if (pos + size > lo + span) {
+        return lo + span - size;
+    }
+    return pos;
+}
+
+static PG_FORCEINLINE Uint8
+_pg_rect_array_collide_i(int x, int y, int w, int h, const int *edges)
+{
+    if (w == 0 || h == 0) {
+        return 0;
+    }
+    return MIN(x, x + w) < edges[2] && MIN(y, y + h) < edges[3] &&
+           MAX(x, x + w) > edges[0] && MAX(y, y + h) > edges[1];
+}
+
+static PG_FORCEINLINE Uint8
+_pg_rect_array_collide_f(float x, float y, float w, float h,
+                         const float *edges)
+{
+    if (w == 0 || h == 0) {
+        return 0;
+    }
+    return MIN(x, x + w) < edges[2] && MIN(y, y + h) < edges[3] &&
+           MAX(x, x + w) > edges[0] && MAX(y, y + h) > edges[1];
+}
+
+// SSE2 functions
+void
+rect_array_add_i_sse2(int *dst, const int *src, int value, Py_ssize_t n);
+void
+rect_array_add_f_sse2(float *dst, const float *src, float value,
+                      Py_ssize_t n);
+void
+rect_array_clamp_i_sse2(int *pos, const int *size, Py_ssize_t n, int lo,
+                        int span);
+void
+rect_array_clamp_f_sse2(float *pos, const float *size, Py_ssize_t n, float lo,
+                        float span);
+void
+rect_array_collide_i_sse2(const int *xs, const int *ys, const int *ws,
+                          const int *hs, Py_ssize_t n, const int *edges,
+                          Uint8 *out);
+void
+rect_array_collide_f_sse2(const float *xs, const float *ys, const float *ws,
+                          const float *hs, Py_ssize_t n, const float *edges,
+                          Uint8 *out);
+
+// AVX2 functions
+void
+rect_array_add_i_avx2(int *dst, const int *src, int value, Py_ssize_t n);
+void
+rect_array_add_f_avx2(float *dst, const float *src, float value,
+                      Py_ssize_t n);
+void
+rect_array_clamp_i_avx2(int *pos, const int *size, Py_ssize_t n, int lo,
+                        int span);
+void
+rect_array_clamp_f_avx2(float *pos, const float *size, Py_ssize_t n, float lo,
+                        float span);
+void
+rect_array_collide_i_avx2(const int *xs, const int *ys, const int *ws,
+                          const int *hs, Py_ssize_t n, const int *edges,
+                          Uint8 *out);
+void
+rect_array_collide_f_avx2(const float *xs, const float *ys, const float *ws,
+                          const float *hs, Py_ssize_t n, const float *edges,
+                          Uint8 *out);
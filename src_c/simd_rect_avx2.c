@@ -0,0 +1,259 @@
+#include "simd_rect.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+#define BAD_AVX2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an AVX2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+/* helper function that does a runtime check for AVX2. It has the added
+ * functionality of also returning 0 if compile time support is missing */
+int
+_pg_rect_has_avx2()
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    return pg_simd_level() >= PG_SIMD_LEVEL_AVX2 && SDL_HasAVX2();
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+
+static PG_FORCEINLINE void
+_pg_store_mask8(Uint8 *out, int bits)
+{
+    int k;
+    for (k = 0; k < 8; k++) {
+        out[k] = (bits >> k) & 1;
+    }
+}
+
+void
+rect_array_add_i_avx2(int *dst, const int *src, int value, Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m256i mm_value = _mm256_set1_epi32(value);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i mm_dst = _mm256_loadu_si256((__m256i *)(dst + i));
+        __m256i mm_add =
+            src ? _mm256_loadu_si256((const __m256i *)(src + i)) : mm_value;
+        _mm256_storeu_si256((__m256i *)(dst + i),
+                            _mm256_add_epi32(mm_dst, mm_add));
+    }
+    for (; i < n; i++) {
+        dst[i] += src ? src[i] : value;
+    }
+}
+
+void
+rect_array_add_f_avx2(float *dst, const float *src, float value, Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m256 mm_value = _mm256_set1_ps(value);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 mm_add = src ? _mm256_loadu_ps(src + i) : mm_value;
+        _mm256_storeu_ps(dst + i,
+                         _mm256_add_ps(_mm256_loadu_ps(dst + i), mm_add));
+    }
+    for (; i < n; i++) {
+        dst[i] += src ? src[i] : value;
+    }
+}
+
+void
+rect_array_clamp_i_avx2(int *pos, const int *size, Py_ssize_t n, int lo,
+                        int span)
+{
+    Py_ssize_t i = 0;
+    __m256i mm_lo = _mm256_set1_epi32(lo);
+    __m256i mm_span = _mm256_set1_epi32(span);
+    __m256i mm_hi = _mm256_set1_epi32(lo + span);
+    __m256i mm_mid = _mm256_set1_epi32(lo + span / 2);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i mm_pos = _mm256_loadu_si256((__m256i *)(pos + i));
+        __m256i mm_size = _mm256_loadu_si256((const __m256i *)(size + i));
+        /* size / 2 rounded towards zero, like C integer division */
+        __m256i mm_half = _mm256_srai_epi32(
+            _mm256_add_epi32(mm_size, _mm256_srli_epi32(mm_size, 31)), 1);
+        __m256i result = mm_pos;
+
+        /* same priorities as the scalar version, the last blend wins */
+        result = _mm256_blendv_epi8(
+            result, _mm256_sub_epi32(mm_hi, mm_size),
+            _mm256_cmpgt_epi32(_mm256_add_epi32(mm_pos, mm_size), mm_hi));
+        result = _mm256_blendv_epi8(result, mm_lo,
+                                    _mm256_cmpgt_epi32(mm_lo, mm_pos));
+        result = _mm256_blendv_epi8(_mm256_sub_epi32(mm_mid, mm_half), result,
+                                    _mm256_cmpgt_epi32(mm_span, mm_size));
+        _mm256_storeu_si256((__m256i *)(pos + i), result);
+    }
+    for (; i < n; i++) {
+        pos[i] = _pg_rect_array_clamp_i(pos[i], size[i], lo, span);
+    }
+}
+
+void
+rect_array_clamp_f_avx2(float *pos, const float *size, Py_ssize_t n, float lo,
+                        float span)
+{
+    Py_ssize_t i = 0;
+    __m256 mm_lo = _mm256_set1_ps(lo);
+    __m256 mm_span = _mm256_set1_ps(span);
+    __m256 mm_hi = _mm256_set1_ps(lo + span);
+    __m256 mm_mid = _mm256_set1_ps(lo + span / 2);
+    __m256 mm_half = _mm256_set1_ps(0.5f);
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 mm_pos = _mm256_loadu_ps(pos + i);
+        __m256 mm_size = _mm256_loadu_ps(size + i);
+        __m256 result = mm_pos;
+
+        result = _mm256_blendv_ps(
+            result, _mm256_sub_ps(mm_hi, mm_size),
+            _mm256_cmp_ps(_mm256_add_ps(mm_pos, mm_size), mm_hi, _CMP_GT_OQ));
+        result = _mm256_blendv_ps(result, mm_lo,
+                                  _mm256_cmp_ps(mm_pos, mm_lo, _CMP_LT_OQ));
+        result = _mm256_blendv_ps(
+            result, _mm256_sub_ps(mm_mid, _mm256_mul_ps(mm_size, mm_half)),
+            _mm256_cmp_ps(mm_size, mm_span, _CMP_GE_OQ));
+        _mm256_storeu_ps(pos + i, result);
+    }
+    for (; i < n; i++) {
+        pos[i] = _pg_rect_array_clamp_f(pos[i], size[i], lo, span);
+    }
+}
+
+void
+rect_array_collide_i_avx2(const int *xs, const int *ys, const int *ws,
+                          const int *hs, Py_ssize_t n, const int *edges,
+                          Uint8 *out)
+{
+    Py_ssize_t i = 0;
+    __m256i mm_left = _mm256_set1_epi32(edges[0]);
+    __m256i mm_top = _mm256_set1_epi32(edges[1]);
+    __m256i mm_right = _mm256_set1_epi32(edges[2]);
+    __m256i mm_bottom = _mm256_set1_epi32(edges[3]);
+    __m256i mm_zero = _mm256_setzero_si256();
+
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(xs + i));
+        __m256i y = _mm256_loadu_si256((const __m256i *)(ys + i));
+        __m256i w = _mm256_loadu_si256((const __m256i *)(ws + i));
+        __m256i h = _mm256_loadu_si256((const __m256i *)(hs + i));
+        __m256i x2 = _mm256_add_epi32(x, w), y2 = _mm256_add_epi32(y, h);
+        __m256i hit, empty;
+
+        empty = _mm256_or_si256(_mm256_cmpeq_epi32(w, mm_zero),
+                                _mm256_cmpeq_epi32(h, mm_zero));
+        hit = _mm256_and_si256(
+            _mm256_cmpgt_epi32(mm_right, _mm256_min_epi32(x, x2)),
+            _mm256_cmpgt_epi32(mm_bottom, _mm256_min_epi32(y, y2)));
+        hit = _mm256_and_si256(
+            hit, _mm256_cmpgt_epi32(_mm256_max_epi32(x, x2), mm_left));
+        hit = _mm256_and_si256(
+            hit, _mm256_cmpgt_epi32(_mm256_max_epi32(y, y2), mm_top));
+        hit = _mm256_andnot_si256(empty, hit);
+        _pg_store_mask8(out + i,
+                        _mm256_movemask_ps(_mm256_castsi256_ps(hit)));
+    }
+    for (; i < n; i++) {
+        out[i] = _pg_rect_array_collide_i(xs[i], ys[i], ws[i], hs[i], edges);
+    }
+}
+
+void
+rect_array_collide_f_avx2(const float *xs, const float *ys, const float *ws,
+                          const float *hs, Py_ssize_t n, const float *edges,
+                          Uint8 *out)
+{
+    Py_ssize_t i = 0;
+    __m256 mm_left = _mm256_set1_ps(edges[0]);
+    __m256 mm_top = _mm256_set1_ps(edges[1]);
+    __m256 mm_right = _mm256_set1_ps(edges[2]);
+    __m256 mm_bottom = _mm256_set1_ps(edges[3]);
+    __m256 mm_zero = _mm256_setzero_ps();
+
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(xs + i), y = _mm256_loadu_ps(ys + i);
+        __m256 w = _mm256_loadu_ps(ws + i), h = _mm256_loadu_ps(hs + i);
+        __m256 x2 = _mm256_add_ps(x, w), y2 = _mm256_add_ps(y, h);
+        __m256 hit;
+
+        /* unordered compare so NaN sizes count as non-empty, like the
+         * scalar w == 0 || h == 0 check */
+        hit = _mm256_and_ps(_mm256_cmp_ps(w, mm_zero, _CMP_NEQ_UQ),
+                            _mm256_cmp_ps(h, mm_zero, _CMP_NEQ_UQ));
+        hit = _mm256_and_ps(hit, _mm256_cmp_ps(_mm256_min_ps(x, x2),
+                                               mm_right, _CMP_LT_OQ));
+        hit = _mm256_and_ps(hit, _mm256_cmp_ps(_mm256_min_ps(y, y2),
+                                               mm_bottom, _CMP_LT_OQ));
+        hit = _mm256_and_ps(hit, _mm256_cmp_ps(_mm256_max_ps(x, x2),
+                                               mm_left, _CMP_GT_OQ));
+        hit = _mm256_and_ps(hit, _mm256_cmp_ps(_mm256_max_ps(y, y2), mm_top,
+                                               _CMP_GT_OQ));
+        _pg_store_mask8(out + i, _mm256_movemask_ps(hit));
+    }
+    for (; i < n; i++) {
+        out[i] = _pg_rect_array_collide_f(xs[i], ys[i], ws[i], hs[i], edges);
+    }
+}
+
+#else
+
+void
+rect_array_add_i_avx2(int *dst, const int *src, int value, Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+rect_array_add_f_avx2(float *dst, const float *src, float value, Py_ssize_t n)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+rect_array_clamp_i_avx2(int *pos, const int *size, Py_ssize_t n, int lo,
+                        int span)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+rect_array_clamp_f_avx2(float *pos, const float *size, Py_ssize_t n, float lo,
+                        float span)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+rect_array_collide_i_avx2(const int *xs, const int *ys, const int *ws,
+                          const int *hs, Py_ssize_t n, const int *edges,
+                          Uint8 *out)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+void
+rect_array_collide_f_avx2(const float *xs, const float *ys, const float *ws,
+                          const float *hs, Py_ssize_t n, const float *edges,
+                          Uint8 *out)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
@@ -0,0 +1,274 @@
+#include "simd_rect.h"
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+#define BAD_SSE2_FUNCTION_CALL                                               \
+    printf(                                                                  \
+        "Fatal Error: Attempted calling an SSE2 function when both compile " \
+        "time and runtime support is missing. If you are seeing this "       \
+        "message, you have stumbled across a pygame bug, please report it "  \
+        "to the devs!");                                                     \
+    PG_EXIT(1)
+
+int
+_pg_rect_HasSSE_NEON()
+{
+#if defined(__SSE2__)
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasSSE2();
+#elif PG_ENABLE_ARM_NEON
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasNEON();
+#else
+    return 0;
+#endif
+}
+
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+
+/* SSE2 has no 32 bit integer min, max or blend, build them from compares */
+static PG_FORCEINLINE __m128i
+_pg_select_si128(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static PG_FORCEINLINE __m128i
+_pg_min_epi32(__m128i a, __m128i b)
+{
+    return _pg_select_si128(_mm_cmpgt_epi32(a, b), b, a);
+}
+
+static PG_FORCEINLINE __m128i
+_pg_max_epi32(__m128i a, __m128i b)
+{
+    return _pg_select_si128(_mm_cmpgt_epi32(a, b), a, b);
+}
+
+/* v / 2 rounded towards zero, like C integer division */
+static PG_FORCEINLINE __m128i
+_pg_half_epi32(__m128i v)
+{
+    return _mm_srai_epi32(_mm_add_epi32(v, _mm_srli_epi32(v, 31)), 1);
+}
+
+static PG_FORCEINLINE void
+_pg_store_mask4(Uint8 *out, int bits)
+{
+    out[0] = bits & 1;
+    out[1] = (bits >> 1) & 1;
+    out[2] = (bits >> 2) & 1;
+    out[3] = (bits >> 3) & 1;
+}
+
+void
+rect_array_add_i_sse2(int *dst, const int *src, int value, Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m128i mm_value = _mm_set1_epi32(value);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i mm_dst = _mm_loadu_si128((__m128i *)(dst + i));
+        __m128i mm_add =
+            src ? _mm_loadu_si128((const __m128i *)(src + i)) : mm_value;
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_add_epi32(mm_dst, mm_add));
+    }
+    for (; i < n; i++) {
+        dst[i] += src ? src[i] : value;
+    }
+}
+
+void
+rect_array_add_f_sse2(float *dst, const float *src, float value, Py_ssize_t n)
+{
+    Py_ssize_t i = 0;
+    __m128 mm_value = _mm_set1_ps(value);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 mm_add = src ? _mm_loadu_ps(src + i) : mm_value;
+        _mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), mm_add));
+    }
+    for (; i < n; i++) {
+        dst[i] += src ? src[i] : value;
+    }
+}
+
+void
+rect_array_clamp_i_sse2(int *pos, const int *size, Py_ssize_t n, int lo,
+                        int span)
+{
+    Py_ssize_t i = 0;
+    __m128i mm_lo = _mm_set1_epi32(lo);
+    __m128i mm_span = _mm_set1_epi32(span);
+    __m128i mm_hi = _mm_set1_epi32(lo + span);
+    __m128i mm_mid = _mm_set1_epi32(lo + span / 2);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i mm_pos = _mm_loadu_si128((__m128i *)(pos + i));
+        __m128i mm_size = _mm_loadu_si128((const __m128i *)(size + i));
+        __m128i result = mm_pos;
+
+        /* same priorities as the scalar version, the last select wins */
+        result = _pg_select_si128(
+            _mm_cmpgt_epi32(_mm_add_epi32(mm_pos, mm_size), mm_hi),
+            _mm_sub_epi32(mm_hi, mm_size), result);
+        result =
+            _pg_select_si128(_mm_cmplt_epi32(mm_pos, mm_lo), mm_lo, result);
+        result = _pg_select_si128(
+            _mm_cmpgt_epi32(mm_span, mm_size), result,
+            _mm_sub_epi32(mm_mid, _pg_half_epi32(mm_size)));
+        _mm_storeu_si128((__m128i *)(pos + i), result);
+    }
+    for (; i < n; i++) {
+        pos[i] = _pg_rect_array_clamp_i(pos[i], size[i], lo, span);
+    }
+}
+
+void
+rect_array_clamp_f_sse2(float *pos, const float *size, Py_ssize_t n, float lo,
+                        float span)
+{
+    Py_ssize_t i = 0;
+    __m128 mm_lo = _mm_set1_ps(lo);
+    __m128 mm_span = _mm_set1_ps(span);
+    __m128 mm_hi = _mm_set1_ps(lo + span);
+    __m128 mm_mid = _mm_set1_ps(lo + span / 2);
+    __m128 mm_half = _mm_set1_ps(0.5f);
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 mm_pos = _mm_loadu_ps(pos + i);
+        __m128 mm_size = _mm_loadu_ps(size + i);
+        __m128 result = mm_pos, mask;
+
+        mask = _mm_cmpgt_ps(_mm_add_ps(mm_pos, mm_size), mm_hi);
+        result = _mm_or_ps(_mm_and_ps(mask, _mm_sub_ps(mm_hi, mm_size)),
+                           _mm_andnot_ps(mask, result));
+        mask = _mm_cmplt_ps(mm_pos, mm_lo);
+        result = _mm_or_ps(_mm_and_ps(mask, mm_lo),
+                           _mm_andnot_ps(mask, result));
+        mask = _mm_cmpge_ps(mm_size, mm_span);
+        result = _mm_or_ps(
+            _mm_and_ps(mask,
+                       _mm_sub_ps(mm_mid, _mm_mul_ps(mm_size, mm_half))),
+            _mm_andnot_ps(mask, result));
+        _mm_storeu_ps(pos + i, result);
+    }
+    for (; i < n; i++) {
+        pos[i] = _pg_rect_array_clamp_f(pos[i], size[i], lo, span);
+    }
+}
+
+void
+rect_array_collide_i_sse2(const int *xs, const int *ys, const int *ws,
+                          const int *hs, Py_ssize_t n, const int *edges,
+                          Uint8 *out)
+{
+    Py_ssize_t i = 0;
+    __m128i mm_left = _mm_set1_epi32(edges[0]);
+    __m128i mm_top = _mm_set1_epi32(edges[1]);
+    __m128i mm_right = _mm_set1_epi32(edges[2]);
+    __m128i mm_bottom = _mm_set1_epi32(edges[3]);
+    __m128i mm_zero = _mm_setzero_si128();
+
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(xs + i));
+        __m128i y = _mm_loadu_si128((const __m128i *)(ys + i));
+        __m128i w = _mm_loadu_si128((const __m128i *)(ws + i));
+        __m128i h = _mm_loadu_si128((const __m128i *)(hs + i));
+        __m128i x2 = _mm_add_epi32(x, w), y2 = _mm_add_epi32(y, h);
+        __m128i hit, empty;
+
+        empty = _mm_or_si128(_mm_cmpeq_epi32(w, mm_zero),
+                             _mm_cmpeq_epi32(h, mm_zero));
+        hit = _mm_and_si128(
+            _mm_cmplt_epi32(_pg_min_epi32(x, x2), mm_right),
+            _mm_cmplt_epi32(_pg_min_epi32(y, y2), mm_bottom));
+        hit = _mm_and_si128(
+            hit, _mm_cmpgt_epi32(_pg_max_epi32(x, x2), mm_left));
+        hit = _mm_and_si128(
+            hit, _mm_cmpgt_epi32(_pg_max_epi32(y, y2), mm_top));
+        hit = _mm_andnot_si128(empty, hit);
+        _pg_store_mask4(out + i, _mm_movemask_ps(_mm_castsi128_ps(hit)));
+    }
+    for (; i < n; i++) {
+        out[i] = _pg_rect_array_collide_i(xs[i], ys[i], ws[i], hs[i], edges);
+    }
+}
+
+void
+rect_array_collide_f_sse2(const float *xs, const float *ys, const float *ws,
+                          const float *hs, Py_ssize_t n, const float *edges,
+                          Uint8 *out)
+{
+    Py_ssize_t i = 0;
+    __m128 mm_left = _mm_set1_ps(edges[0]);
+    __m128 mm_top = _mm_set1_ps(edges[1]);
+    __m128 mm_right = _mm_set1_ps(edges[2]);
+    __m128 mm_bottom = _mm_set1_ps(edges[3]);
+    __m128 mm_zero = _mm_setzero_ps();
+
+    for (; i + 4 <= n; i += 4) {
+        __m128 x = _mm_loadu_ps(xs + i), y = _mm_loadu_ps(ys + i);
+        __m128 w = _mm_loadu_ps(ws + i), h = _mm_loadu_ps(hs + i);
+        __m128 x2 = _mm_add_ps(x, w), y2 = _mm_add_ps(y, h);
+        __m128 hit;
+
+        hit = _mm_and_ps(_mm_cmpneq_ps(w, mm_zero),
+                         _mm_cmpneq_ps(h, mm_zero));
+        hit = _mm_and_ps(hit, _mm_cmplt_ps(_mm_min_ps(x, x2), mm_right));
+        hit = _mm_and_ps(hit, _mm_cmplt_ps(_mm_min_ps(y, y2), mm_bottom));
+        hit = _mm_and_ps(hit, _mm_cmpgt_ps(_mm_max_ps(x, x2), mm_left));
+        hit = _mm_and_ps(hit, _mm_cmpgt_ps(_mm_max_ps(y, y2), mm_top));
+        _pg_store_mask4(out + i, _mm_movemask_ps(hit));
+    }
+    for (; i < n; i++) {
+        out[i] = _pg_rect_array_collide_f(xs[i], ys[i], ws[i], hs[i], edges);
+    }
+}
+
+#else
+
+void
+rect_array_add_i_sse2(int *dst, const int *src, int value, Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+rect_array_add_f_sse2(float *dst, const float *src, float value, Py_ssize_t n)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+rect_array_clamp_i_sse2(int *pos, const int *size, Py_ssize_t n, int lo,
+                        int span)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+rect_array_clamp_f_sse2(float *pos, const float *size, Py_ssize_t n, float lo,
+                        float span)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+rect_array_collide_i_sse2(const int *xs, const int *ys, const int *ws,
+                          const int *hs, Py_ssize_t n, const int *edges,
+                          Uint8 *out)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+void
+rect_array_collide_f_sse2(const float *xs, const float *ys, const float *ws,
+                          const float *hs, Py_ssize_t n, const float *edges,
+                          Uint8 *out)
+{
+    BAD_SSE2_FUNCTION_CALL;
+}
+
+#endif /* defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON) */
@@ -3,6 +3,7 @@
 #define SIMD_SHARED_H
 
 #include "_surface.h"
+#include "simd_level.h"
 
 int
 pg_sse2_at_runtime_but_uncompiled();
@@ -52,9 +53,9 @@ int
 pg_HasSSE_NEON()
 {
 #if defined(__SSE2__)
-    return SDL_HasSSE2();
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasSSE2();
 #elif PG_ENABLE_ARM_NEON
-    return SDL_HasNEON();
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasNEON();
 #else
     return 0;
 #endif
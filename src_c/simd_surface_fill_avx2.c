@@ -19,7 +19,7 @@ _pg_has_avx2()
 {
 #if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
     !defined(SDL_DISABLE_IMMINTRIN_H)
-    return SDL_HasAVX2();
+    return pg_simd_level() >= PG_SIMD_LEVEL_AVX2 && SDL_HasAVX2();
 #else
     return 0;
 #endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
@@ -17,9 +17,9 @@ int
 _pg_HasSSE_NEON()
 {
 #if defined(__SSE2__)
-    return SDL_HasSSE2();
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasSSE2();
 #elif PG_ENABLE_ARM_NEON
-    return SDL_HasNEON();
+    return pg_simd_level() >= PG_SIMD_LEVEL_SSE2 && SDL_HasNEON();
 #else
     return 0;
 #endif
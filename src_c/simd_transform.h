@@ -1,5 +1,6 @@
 #define NO_PYGAME_C_API
 #include "_surface.h"
+#include "simd_level.h"
 
 /**
  * MACRO borrowed from SSE2NEON - useful for making the shuffling family of
@@ -43,6 +44,12 @@ filter_expand_Y_SSE2(Uint8 *srcpix, Uint8 *dstpix, int width, int srcpitch,
                      int dstpitch, int srcheight, int dstheight);
 void
 invert_sse2(SDL_Surface *src, PG_PixelFormat *src_fmt, SDL_Surface *newsurf);
+// blur filters, 4 bytes per pixel only
+int
+box_blur_sse2(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat);
+int
+gaussian_blur_sse2(SDL_Surface *src, SDL_Surface *dst, const float *lut,
+                   int kernel_radius, SDL_bool repeat);
 
 #endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
 
@@ -52,3 +59,22 @@ grayscale_avx2(SDL_Surface *src, PG_PixelFormat *src_fmt,
                SDL_Surface *newsurf);
 void
 invert_avx2(SDL_Surface *src, PG_PixelFormat *src_fmt, SDL_Surface *newsurf);
+// smoothscale filters
+void
+filter_shrink_X_AVX2(Uint8 *srcpix, Uint8 *dstpix, int height, int srcpitch,
+                     int dstpitch, int srcwidth, int dstwidth);
+void
+filter_shrink_Y_AVX2(Uint8 *srcpix, Uint8 *dstpix, int width, int srcpitch,
+                     int dstpitch, int srcheight, int dstheight);
+void
+filter_expand_X_AVX2(Uint8 *srcpix, Uint8 *dstpix, int height, int srcpitch,
+                     int dstpitch, int srcwidth, int dstwidth);
+void
+filter_expand_Y_AVX2(Uint8 *srcpix, Uint8 *dstpix, int width, int srcpitch,
+                     int dstpitch, int srcheight, int dstheight);
+// blur filters, 4 bytes per pixel only
+int
+box_blur_avx2(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat);
+int
+gaussian_blur_avx2(SDL_Surface *src, SDL_Surface *dst, const float *lut,
+                   int kernel_radius, SDL_bool repeat);
@@ -19,7 +19,7 @@ pg_has_avx2()
 {
 #if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
     !defined(SDL_DISABLE_IMMINTRIN_H)
-    return SDL_HasAVX2();
+    return pg_simd_level() >= PG_SIMD_LEVEL_AVX2 && SDL_HasAVX2();
 #else
     return 0;
 #endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
@@ -297,6 +297,630 @@ invert_avx2(SDL_Surface *src, PG_PixelFormat *src_fmt, SDL_Surface *newsurf)
         srcp256 = (__m256i *)srcp;
     }
 }
+
+/* The smoothscale filters below use the same fixed point representations as
+ * the SSE2 filters in simd_transform_sse2.c (0x4000 for the shrink filters,
+ * 0x100 for the expand filters), so every backend produces identical output.
+ * The AVX2 versions just run twice as many lanes per instruction. */
+
+#define _pg_avx2_loadu_si32(p) _mm_cvtsi32_si128(*(int const *)(p))
+#define _pg_avx2_loadu_si64(p) _mm_loadl_epi64((__m128i const *)(p))
+#define _pg_avx2_storeu_si32(p, a) (void)(*(int *)(p) = _mm_cvtsi128_si32((a)))
+#define _pg_avx2_storeu_si64(p, a) (_mm_storel_epi64((__m128i *)(p), (a)))
+
+/* Packs the sixteen 16 bit lanes of a 256 bit register down into sixteen
+ * 8 bit lanes of a 128 bit register, keeping them in order. */
+static PG_FORCEINLINE __m128i
+_pg_avx2_pack_epi16(__m256i in)
+{
+    return _mm_packus_epi16(_mm256_castsi256_si128(in),
+                            _mm256_extracti128_si256(in, 1));
+}
+
+void
+filter_shrink_X_AVX2(Uint8 *srcpix, Uint8 *dstpix, int height, int srcpitch,
+                     int dstpitch, int srcwidth, int dstwidth)
+{
+    // Like filter_shrink_X_SSE2 this runs several rows at once, since the
+    // accumulate/write cycle is identical for every row. With 256 bit
+    // registers four rows fit: each row holds one RGBA pixel in 16 bit lanes.
+    int x, y, i;
+    Uint8 *srcrows[4];
+    Uint8 *dstrows[4];
+    __m256i src, dst, accumulate, mm_xcounter, mm_xfrac;
+    __m128i packed;
+
+    int xspace = 0x04000 * srcwidth / dstwidth; /* must be > 1 */
+    __m256i xrecip = _mm256_set1_epi16((Uint16)(0x40000000 / xspace));
+
+    for (y = 0; y < height; y += 4) {
+        accumulate = _mm256_setzero_si256();
+        int xcounter = xspace;
+
+        // When height is not a multiple of four, the surplus lanes redo the
+        // final row so nothing outside the surface is read or written.
+        for (i = 0; i < 4; i++) {
+            int row = (y + i < height) ? y + i : height - 1;
+            srcrows[i] = srcpix + row * srcpitch;
+            dstrows[i] = dstpix + row * dstpitch;
+        }
+
+        for (x = 0; x < srcwidth; x++) {
+            // Load one pixel from each of the four rows, and unpack RGBA into
+            // 16 bit lanes. Lanes [63:0] track row 0, [127:64] row 1 etc.
+            packed = _mm_unpacklo_epi64(
+                _mm_unpacklo_epi32(_pg_avx2_loadu_si32(srcrows[0]),
+                                   _pg_avx2_loadu_si32(srcrows[1])),
+                _mm_unpacklo_epi32(_pg_avx2_loadu_si32(srcrows[2]),
+                                   _pg_avx2_loadu_si32(srcrows[3])));
+            src = _mm256_cvtepu8_epi16(packed);
+            for (i = 0; i < 4; i++) {
+                srcrows[i] += 4;
+            }
+
+            if (xcounter > 0x04000) {
+                accumulate = _mm256_add_epi16(accumulate, src);
+                xcounter -= 0x04000;
+            }
+            /* write out a destination pixel */
+            else {
+                int xfrac = 0x04000 - xcounter;
+
+                mm_xcounter = _mm256_set1_epi16(xcounter);
+                mm_xfrac = _mm256_set1_epi16(xfrac);
+
+                // See filter_shrink_X_SSE2 for this operation.
+                src = _mm256_slli_epi16(src, 2);
+                dst = _mm256_mulhi_epu16(src, mm_xcounter);
+                dst = _mm256_add_epi16(dst, accumulate);
+                accumulate = _mm256_mulhi_epu16(src, mm_xfrac);
+
+                dst = _mm256_mulhi_epu16(dst, xrecip);
+
+                // Once packed, each 32 bits holds the result of one row.
+                packed = _pg_avx2_pack_epi16(dst);
+                for (i = 0; i < 4; i++) {
+                    _pg_avx2_storeu_si32(dstrows[i], packed);
+                    packed = _mm_srli_si128(packed, 4);
+                    dstrows[i] += 4;
+                }
+                xcounter = xspace - xfrac;
+            }
+        }
+    }
+}
+
+void
+filter_shrink_Y_AVX2(Uint8 *srcpix, Uint8 *dstpix, int width, int srcpitch,
+                     int dstpitch, int srcheight, int dstheight)
+{
+    // Every pixel in a row is independent here, so this runs four pixels
+    // (sixteen 16 bit lanes) at a time, with an SSE tail for the remainder.
+    int srcdiff = srcpitch - (width * 4);
+    int dstdiff = dstpitch - (width * 4);
+    int x, y;
+    __m256i src, dst, mm_acc, mm_yfrac, mm_ycounter;
+    __m128i src128, dst128, acc128;
+
+    int during_4_width = width / 4;
+    int post_4_width = width % 4;
+
+    int yspace = 0x04000 * srcheight / dstheight; /* must be > 1 */
+    __m256i yrecip = _mm256_set1_epi16(0x40000000 / yspace);
+    int ycounter = yspace;
+
+    Uint16 *templine;
+    /* allocate a clear memory area for storing the accumulator line */
+    templine = (Uint16 *)calloc(dstpitch, 2);
+    if (templine == NULL) {
+        return;
+    }
+
+    for (y = 0; y < srcheight; y++) {
+        Uint16 *accumulate = templine;
+        if (ycounter > 0x04000) {
+            for (x = 0; x < during_4_width; x++) {
+                src = _mm256_cvtepu8_epi16(
+                    _mm_loadu_si128((const __m128i *)srcpix));
+                _mm256_storeu_si256(
+                    (__m256i *)accumulate,
+                    _mm256_add_epi16(
+                        _mm256_loadu_si256((const __m256i *)accumulate), src));
+                accumulate += 16;  // 16 Uint16s, so 32 bytes
+                srcpix += 16;      // 16 Uint8s, so 16 bytes (4 pixels)
+            }
+            for (x = 0; x < post_4_width; x++) {
+                src128 = _mm_cvtepu8_epi16(_pg_avx2_loadu_si32(srcpix));
+                _pg_avx2_storeu_si64(
+                    accumulate,
+                    _mm_add_epi16(_pg_avx2_loadu_si64(accumulate), src128));
+                accumulate += 4;
+                srcpix += 4;
+            }
+            ycounter -= 0x04000;
+        }
+        else {
+            int yfrac = 0x04000 - ycounter;
+            mm_yfrac = _mm256_set1_epi16(yfrac);
+            mm_ycounter = _mm256_set1_epi16(ycounter);
+
+            /* write out a destination line */
+            for (x = 0; x < during_4_width; x++) {
+                src = _mm256_cvtepu8_epi16(
+                    _mm_loadu_si128((const __m128i *)srcpix));
+                srcpix += 16;
+                mm_acc = _mm256_loadu_si256((const __m256i *)accumulate);
+
+                src = _mm256_slli_epi16(src, 2);
+                dst = _mm256_mulhi_epu16(src, mm_yfrac);
+                src = _mm256_mulhi_epu16(src, mm_ycounter);
+
+                _mm256_storeu_si256((__m256i *)accumulate, dst);
+                accumulate += 16;
+
+                dst = _mm256_add_epi16(src, mm_acc);
+                dst = _mm256_mulhi_epu16(dst, yrecip);
+                _mm_storeu_si128((__m128i *)dstpix, _pg_avx2_pack_epi16(dst));
+                dstpix += 16;
+            }
+            for (x = 0; x < post_4_width; x++) {
+                src128 = _mm_cvtepu8_epi16(_pg_avx2_loadu_si32(srcpix));
+                srcpix += 4;
+                acc128 = _pg_avx2_loadu_si64(accumulate);
+
+                src128 = _mm_slli_epi16(src128, 2);
+                dst128 = _mm_mulhi_epu16(src128,
+                                         _mm256_castsi256_si128(mm_yfrac));
+                src128 = _mm_mulhi_epu16(src128,
+                                         _mm256_castsi256_si128(mm_ycounter));
+
+                _pg_avx2_storeu_si64(accumulate, dst128);
+                accumulate += 4;
+
+                dst128 = _mm_add_epi16(src128, acc128);
+                dst128 =
+                    _mm_mulhi_epu16(dst128, _mm256_castsi256_si128(yrecip));
+                dst128 = _mm_packus_epi16(dst128, _mm_setzero_si128());
+                _pg_avx2_storeu_si32(dstpix, dst128);
+                dstpix += 4;
+            }
+            dstpix += dstdiff;
+            ycounter = yspace - yfrac;
+        }
+        srcpix += srcdiff;
+    }
+
+    /* free the temporary memory */
+    free(templine);
+}
+
+void
+filter_expand_X_AVX2(Uint8 *srcpix, Uint8 *dstpix, int height, int srcpitch,
+                     int dstpitch, int srcwidth, int dstwidth)
+{
+    int dstdiff = dstpitch - (dstwidth * 4);
+    int *xidx0, *xmult_combined;
+    int x, y;
+    const int factorwidth = 8;
+
+    int during_2_width = dstwidth / 2;
+    int post_2_width = dstwidth % 2;
+
+    /* Allocate memory for factors */
+    xidx0 = malloc(dstwidth * 4);
+    if (xidx0 == 0) {
+        return;
+    }
+    xmult_combined = (int *)malloc(dstwidth * factorwidth);
+    if (xmult_combined == 0) {
+        free(xidx0);
+        return;
+    }
+
+    /* Create multiplier factors and starting indices and put them in arrays */
+    for (x = 0; x < dstwidth; x++) {
+        int xm1 = 0x100 * ((x * (srcwidth - 1)) % dstwidth) / dstwidth;
+        int xm0 = 0x100 - xm1;
+        xidx0[x] = x * (srcwidth - 1) / dstwidth;
+
+        xmult_combined[x * 2] = xm0 | (xm0 << 16);
+        xmult_combined[x * 2 + 1] = xm1 | (xm1 << 16);
+    }
+
+    __m256i src, multcombined, dst;
+    __m128i src128, mult128, dst128;
+    // Spreads [xm0, xm1, xm0', xm1'] out to [xm0, xm0, xm1, xm1, ...] so each
+    // multiplier covers the four 16 bit channels of its source pixel.
+    const __m256i mult_spread = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+
+    /* Do the scaling in raster order so we don't trash the cache */
+    for (y = 0; y < height; y++) {
+        Uint8 *srcrow0 = srcpix + y * srcpitch;
+        for (x = 0; x < during_2_width * 2; x += 2) {
+            // Each 128 bit lane gets the two source pixels of one
+            // destination pixel.
+            src = _mm256_cvtepu8_epi16(
+                _mm_unpacklo_epi64(_pg_avx2_loadu_si64(srcrow0 + xidx0[x] * 4),
+                                   _pg_avx2_loadu_si64(srcrow0 +
+                                                       xidx0[x + 1] * 4)));
+
+            multcombined = _mm256_permutevar8x32_epi32(
+                _mm256_castsi128_si256(_mm_loadu_si128(
+                    (const __m128i *)(xmult_combined + x * 2))),
+                mult_spread);
+            src = _mm256_mullo_epi16(src, multcombined);
+
+            // add the weighted pixel pairs within each lane
+            dst = _mm256_add_epi16(src, _mm256_bsrli_epi128(src, 8));
+            dst = _mm256_srli_epi16(dst, 8);
+
+            dst128 = _mm_unpacklo_epi64(_mm256_castsi256_si128(dst),
+                                        _mm256_extracti128_si256(dst, 1));
+            dst128 = _mm_packus_epi16(dst128, _mm_setzero_si128());
+            _pg_avx2_storeu_si64(dstpix, dst128);
+
+            dstpix += 8;
+        }
+        if (post_2_width) {
+            x = dstwidth - 1;
+            src128 = _mm_cvtepu8_epi16(
+                _pg_avx2_loadu_si64(srcrow0 + xidx0[x] * 4));
+            mult128 = _mm_shuffle_epi32(
+                _pg_avx2_loadu_si64(xmult_combined + x * 2), 0b01010000);
+            src128 = _mm_mullo_epi16(src128, mult128);
+            dst128 = _mm_add_epi16(src128, _mm_bsrli_si128(src128, 8));
+            dst128 = _mm_packus_epi16(_mm_srli_epi16(dst128, 8),
+                                      _mm_setzero_si128());
+            _pg_avx2_storeu_si32(dstpix, dst128);
+
+            dstpix += 4;
+        }
+        dstpix += dstdiff;
+    }
+
+    /* free memory */
+    free(xidx0);
+    free(xmult_combined);
+}
+
+void
+filter_expand_Y_AVX2(Uint8 *srcpix, Uint8 *dstpix, int width, int srcpitch,
+                     int dstpitch, int srcheight, int dstheight)
+{
+    // Runs through each row four pixels at a time, with an SSE tail for the
+    // remainder.
+    int x, y;
+    __m256i src0, src1, dst, ymult0_mm, ymult1_mm;
+    __m128i src0_128, src1_128, dst128;
+
+    int dstdiff = dstpitch - (width * 4);
+
+    int during_4_width = width / 4;
+    int post_4_width = width % 4;
+
+    for (y = 0; y < dstheight; y++) {
+        int yidx0 = y * (srcheight - 1) / dstheight;
+        Uint8 *srcrow0 = srcpix + yidx0 * srcpitch;
+        Uint8 *srcrow1 = srcrow0 + srcpitch;
+        int ymult1 = 0x0100 * ((y * (srcheight - 1)) % dstheight) / dstheight;
+        int ymult0 = 0x0100 - ymult1;
+
+        ymult0_mm = _mm256_set1_epi16(ymult0);
+        ymult1_mm = _mm256_set1_epi16(ymult1);
+
+        for (x = 0; x < during_4_width; x++) {
+            src0 = _mm256_cvtepu8_epi16(
+                _mm_loadu_si128((const __m128i *)srcrow0));
+            src1 = _mm256_cvtepu8_epi16(
+                _mm_loadu_si128((const __m128i *)srcrow1));
+
+            src0 = _mm256_mullo_epi16(src0, ymult0_mm);
+            src1 = _mm256_mullo_epi16(src1, ymult1_mm);
+            dst = _mm256_add_epi16(src0, src1);
+            dst = _mm256_srli_epi16(dst, 8);
+
+            _mm_storeu_si128((__m128i *)dstpix, _pg_avx2_pack_epi16(dst));
+
+            srcrow0 += 16;  // 16 bytes (4 pixels)
+            srcrow1 += 16;
+            dstpix += 16;
+        }
+        for (x = 0; x < post_4_width; x++) {
+            src0_128 = _mm_cvtepu8_epi16(_pg_avx2_loadu_si32(srcrow0));
+            src1_128 = _mm_cvtepu8_epi16(_pg_avx2_loadu_si32(srcrow1));
+
+            src0_128 =
+                _mm_mullo_epi16(src0_128, _mm256_castsi256_si128(ymult0_mm));
+            src1_128 =
+                _mm_mullo_epi16(src1_128, _mm256_castsi256_si128(ymult1_mm));
+            dst128 = _mm_add_epi16(src0_128, src1_128);
+            dst128 = _mm_srli_epi16(dst128, 8);
+
+            dst128 = _mm_packus_epi16(dst128, _mm_setzero_si128());
+            _pg_avx2_storeu_si32(dstpix, dst128);
+
+            srcrow0 += 4;  // 4 bytes (1 pixel)
+            srcrow1 += 4;
+            dstpix += 4;
+        }
+        dstpix += dstdiff;
+    }
+}
+
+int
+box_blur_avx2(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat)
+{
+    // See the SSE2 version for an overview. The vertical sums are updated 32
+    // channels at a time here, the horizontal pass stays one pixel at a time.
+    Uint8 *srcpx = (Uint8 *)src->pixels;
+    Uint8 *dstpx = (Uint8 *)dst->pixels;
+    int w = dst->w, h = dst->h;
+    int dst_pitch = dst->pitch;
+    int src_pitch = src->pitch;
+    int row_len = w * 4;
+    int vec_len = row_len & ~31;
+    int i, k, x, y;
+    __m256 divisor = _mm256_set1_ps((float)(radius * 2 + 1));
+    __m128 divisor128 = _mm256_castps256_ps128(divisor);
+    __m256i mm_sum[4];
+    __m128i sum_h;
+    Uint32 sum_first[4];
+
+    // Allocate bytes for buf and sum_v at once to reduce allocations.
+    Uint32 *overall_buf = malloc(sizeof(Uint32) * row_len * 2);
+    Uint32 *buf = overall_buf;
+    Uint32 *sum_v = overall_buf + row_len;
+
+    if (overall_buf == NULL) {
+        return -1;
+    }
+
+    memset(sum_v, 0, row_len * sizeof(Uint32));
+    for (y = 0; y <= radius; y++) {  // y-pre
+        for (i = 0; i < row_len; i++) {
+            sum_v[i] += srcpx[src_pitch * y + i];
+        }
+    }
+    if (repeat) {
+        for (i = 0; i < row_len; i++) {
+            sum_v[i] += srcpx[i] * radius;
+        }
+    }
+
+    for (y = 0; y < h; y++) {  // y
+        Uint8 *sub_row = NULL, *add_row = NULL;
+
+        if (y - radius >= 0) {
+            sub_row = srcpx + src_pitch * (y - radius);
+        }
+        else if (repeat) {
+            sub_row = srcpx;
+        }
+        if (y + radius + 1 < h) {
+            add_row = srcpx + src_pitch * (y + radius + 1);
+        }
+        else if (repeat) {
+            add_row = srcpx + src_pitch * (h - 1);
+        }
+
+        for (i = 0; i < vec_len; i += 32) {
+            for (k = 0; k < 4; k++) {
+                mm_sum[k] =
+                    _mm256_loadu_si256((__m256i *)(sum_v + i + k * 8));
+                _mm256_storeu_si256(
+                    (__m256i *)(buf + i + k * 8),
+                    _mm256_cvttps_epi32(_mm256_div_ps(
+                        _mm256_cvtepi32_ps(mm_sum[k]), divisor)));
+            }
+            // update vertical sum
+            if (sub_row) {
+                for (k = 0; k < 4; k++) {
+                    mm_sum[k] = _mm256_sub_epi32(
+                        mm_sum[k], _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                                       (__m128i *)(sub_row + i + k * 8))));
+                }
+            }
+            if (add_row) {
+                for (k = 0; k < 4; k++) {
+                    mm_sum[k] = _mm256_add_epi32(
+                        mm_sum[k], _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                                       (__m128i *)(add_row + i + k * 8))));
+                }
+            }
+            for (k = 0; k < 4; k++) {
+                _mm256_storeu_si256((__m256i *)(sum_v + i + k * 8),
+                                    mm_sum[k]);
+            }
+        }
+        for (; i < row_len; i++) {
+            buf[i] = sum_v[i] / (radius * 2 + 1);
+            if (sub_row) {
+                sum_v[i] -= sub_row[i];
+            }
+            if (add_row) {
+                sum_v[i] += add_row[i];
+            }
+        }
+
+        sum_h = _mm_setzero_si128();
+        for (x = 0; x <= radius; x++) {  // x-pre
+            sum_h = _mm_add_epi32(sum_h,
+                                  _mm_loadu_si128((__m128i *)(buf + x * 4)));
+        }
+        if (repeat) {
+            for (i = 0; i < 4; i++) {
+                sum_first[i] = buf[i] * radius;
+            }
+            sum_h =
+                _mm_add_epi32(sum_h, _mm_loadu_si128((__m128i *)sum_first));
+        }
+        for (x = 0; x < w; x++) {  // x
+            __m128i mm_dst = _mm_cvttps_epi32(
+                _mm_div_ps(_mm_cvtepi32_ps(sum_h), divisor128));
+
+            mm_dst = _mm_packs_epi32(mm_dst, mm_dst);
+            mm_dst = _mm_packus_epi16(mm_dst, mm_dst);
+            _pg_avx2_storeu_si32(dstpx + dst_pitch * y + x * 4, mm_dst);
+
+            // update horizontal sum
+            if (x - radius >= 0) {
+                sum_h = _mm_sub_epi32(
+                    sum_h,
+                    _mm_loadu_si128((__m128i *)(buf + (x - radius) * 4)));
+            }
+            else if (repeat) {
+                sum_h = _mm_sub_epi32(sum_h, _mm_loadu_si128((__m128i *)buf));
+            }
+            if (x + radius + 1 < w) {
+                sum_h = _mm_add_epi32(
+                    sum_h,
+                    _mm_loadu_si128((__m128i *)(buf + (x + radius + 1) * 4)));
+            }
+            else if (repeat) {
+                sum_h = _mm_add_epi32(
+                    sum_h, _mm_loadu_si128((__m128i *)(buf + (w - 1) * 4)));
+            }
+        }
+    }
+
+    free(overall_buf);
+    return 0;
+}
+
+int
+gaussian_blur_avx2(SDL_Surface *src, SDL_Surface *dst, const float *lut,
+                   int kernel_radius, SDL_bool repeat)
+{
+    // See the SSE2 version for an overview. Both passes work on 32 channels
+    // (8 pixels) at a time, with 128 bit loads for the pixels near the edges.
+    Uint8 *srcpx = (Uint8 *)src->pixels;
+    Uint8 *dstpx = (Uint8 *)dst->pixels;
+    int w = dst->w, h = dst->h;
+    int dst_pitch = dst->pitch;
+    int src_pitch = src->pitch;
+    int row_len = w * 4;
+    int vec_len = row_len & ~31;
+    int taps = kernel_radius * 2 + 1;
+    int i, j, k, x, y;
+    __m256 mm_acc[4], mm_lut;
+    __m128i mm_packed[4];
+
+    float *buf = malloc(sizeof(float) * row_len);
+    Uint8 **rows = malloc(sizeof(Uint8 *) * taps);
+
+    if (buf == NULL || rows == NULL) {
+        free(buf);
+        free(rows);
+        return -1;
+    }
+
+    for (y = 0; y < h; y++) {
+        for (j = -kernel_radius; j <= kernel_radius; j++) {
+            Uint8 **row = rows + j + kernel_radius;
+
+            if (y + j >= 0 && y + j < h) {
+                *row = srcpx + src_pitch * (y + j);
+            }
+            else if (repeat) {
+                *row = (y + j < 0) ? srcpx : srcpx + src_pitch * (h - 1);
+            }
+            else {
+                *row = NULL;
+            }
+        }
+
+        for (i = 0; i < vec_len; i += 32) {
+            for (k = 0; k < 4; k++) {
+                mm_acc[k] = _mm256_setzero_ps();
+            }
+            for (j = 0; j < taps; j++) {
+                if (!rows[j]) {
+                    continue;
+                }
+                mm_lut = _mm256_set1_ps(lut[abs(j - kernel_radius)]);
+                for (k = 0; k < 4; k++) {
+                    __m256 mm_src = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(
+                        _mm_loadl_epi64((__m128i *)(rows[j] + i + k * 8))));
+
+                    mm_acc[k] = _mm256_add_ps(mm_acc[k],
+                                              _mm256_mul_ps(mm_src, mm_lut));
+                }
+            }
+            for (k = 0; k < 4; k++) {
+                _mm256_storeu_ps(buf + i + k * 8, mm_acc[k]);
+            }
+        }
+        for (; i < row_len; i++) {
+            buf[i] = 0.0f;
+            for (j = 0; j < taps; j++) {
+                if (rows[j]) {
+                    buf[i] += (float)rows[j][i] * lut[abs(j - kernel_radius)];
+                }
+            }
+        }
+
+        for (x = 0; x < w; x++) {
+            __m128 mm_acc128;
+            __m128i mm_dst;
+
+            if (x >= kernel_radius && x + kernel_radius + 7 < w) {
+                // Eight pixels with all of their taps inside the row.
+                for (k = 0; k < 4; k++) {
+                    mm_acc[k] = _mm256_setzero_ps();
+                }
+                for (j = -kernel_radius; j <= kernel_radius; j++) {
+                    float *tap = buf + (x + j) * 4;
+
+                    mm_lut = _mm256_set1_ps(lut[abs(j)]);
+                    for (k = 0; k < 4; k++) {
+                        mm_acc[k] = _mm256_add_ps(
+                            mm_acc[k],
+                            _mm256_mul_ps(_mm256_loadu_ps(tap + k * 8),
+                                          mm_lut));
+                    }
+                }
+                for (k = 0; k < 4; k++) {
+                    __m256i mm_int = _mm256_cvttps_epi32(mm_acc[k]);
+
+                    mm_packed[k] =
+                        _mm_packs_epi32(_mm256_castsi256_si128(mm_int),
+                                        _mm256_extracti128_si256(mm_int, 1));
+                }
+                _mm_storeu_si128(
+                    (__m128i *)(dstpx + dst_pitch * y + x * 4),
+                    _mm_packus_epi16(mm_packed[0], mm_packed[1]));
+                _mm_storeu_si128(
+                    (__m128i *)(dstpx + dst_pitch * y + x * 4 + 16),
+                    _mm_packus_epi16(mm_packed[2], mm_packed[3]));
+                x += 7;
+                continue;
+            }
+
+            mm_acc128 = _mm_setzero_ps();
+            for (j = -kernel_radius; j <= kernel_radius; j++) {
+                int tap = x + j;
+
+                if (tap < 0 || tap >= w) {
+                    if (!repeat) {
+                        continue;
+                    }
+                    tap = (tap < 0) ? 0 : w - 1;
+                }
+                mm_acc128 = _mm_add_ps(
+                    mm_acc128, _mm_mul_ps(_mm_loadu_ps(buf + tap * 4),
+                                          _mm_set1_ps(lut[abs(j)])));
+            }
+            mm_dst = _mm_cvttps_epi32(mm_acc128);
+            mm_dst = _mm_packs_epi32(mm_dst, mm_dst);
+            mm_dst = _mm_packus_epi16(mm_dst, mm_dst);
+            _pg_avx2_storeu_si32(dstpx + dst_pitch * y + x * 4, mm_dst);
+        }
+    }
+
+    free(buf);
+    free(rows);
+    return 0;
+}
 #else
 void
 grayscale_avx2(SDL_Surface *src, PG_PixelFormat *src_fmt, SDL_Surface *newsurf)
@@ -308,5 +932,42 @@ invert_avx2(SDL_Surface *src, PG_PixelFormat *src_fmt, SDL_Surface *newsurf)
 {
     BAD_AVX2_FUNCTION_CALL;
 }
+void
+filter_shrink_X_AVX2(Uint8 *srcpix, Uint8 *dstpix, int height, int srcpitch,
+                     int dstpitch, int srcwidth, int dstwidth)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+void
+filter_shrink_Y_AVX2(Uint8 *srcpix, Uint8 *dstpix, int width, int srcpitch,
+                     int dstpitch, int srcheight, int dstheight)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+void
+filter_expand_X_AVX2(Uint8 *srcpix, Uint8 *dstpix, int height, int srcpitch,
+                     int dstpitch, int srcwidth, int dstwidth)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+void
+filter_expand_Y_AVX2(Uint8 *srcpix, Uint8 *dstpix, int width, int srcpitch,
+                     int dstpitch, int srcheight, int dstheight)
+{
+    BAD_AVX2_FUNCTION_CALL;
+}
+int
+box_blur_avx2(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat)
+{
+    BAD_AVX2_FUNCTION_CALL;
+    return -1;
+}
+int
+gaussian_blur_avx2(SDL_Surface *src, SDL_Surface *dst, const float *lut,
+                   int kernel_radius, SDL_bool repeat)
+{
+    BAD_AVX2_FUNCTION_CALL;
+    return -1;
+}
 #endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
           !defined(SDL_DISABLE_IMMINTRIN_H) */
@@ -686,4 +686,299 @@ invert_sse2(SDL_Surface *src, PG_PixelFormat *src_fmt, SDL_Surface *newsurf)
     }
 }
 
+/* Widens 16 bytes into four vectors of 32 bit lanes. */
+static PG_FORCEINLINE void
+_pg_unpack_epu8_epi32(__m128i src, __m128i *out)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_unpacklo_epi8(src, zero);
+    __m128i hi = _mm_unpackhi_epi8(src, zero);
+
+    out[0] = _mm_unpacklo_epi16(lo, zero);
+    out[1] = _mm_unpackhi_epi16(lo, zero);
+    out[2] = _mm_unpacklo_epi16(hi, zero);
+    out[3] = _mm_unpackhi_epi16(hi, zero);
+}
+
+/* Divides sums below 2^24 by divisor, rounding down. The quotient is
+ * corrected afterwards because 32 bit NEON only estimates _mm_div_ps. */
+static PG_FORCEINLINE __m128i
+_pg_box_divide(__m128i sum, __m128 divisor)
+{
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 sumf = _mm_cvtepi32_ps(sum);
+    __m128 quot =
+        _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(sumf, divisor)));
+    __m128 rem = _mm_sub_ps(sumf, _mm_mul_ps(quot, divisor));
+
+    quot = _mm_add_ps(quot, _mm_and_ps(_mm_cmpge_ps(rem, divisor), one));
+    quot =
+        _mm_sub_ps(quot, _mm_and_ps(_mm_cmplt_ps(rem, _mm_setzero_ps()), one));
+    return _mm_cvttps_epi32(quot);
+}
+
+int
+box_blur_sse2(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat)
+{
+    // Same running sums as the generic box blur, so the cost per pixel does
+    // not depend on the radius. The vertical sums are updated 16 channels at
+    // a time, the horizontal sums one pixel (4 channels) at a time.
+    Uint8 *srcpx = (Uint8 *)src->pixels;
+    Uint8 *dstpx = (Uint8 *)dst->pixels;
+    int w = dst->w, h = dst->h;
+    int dst_pitch = dst->pitch;
+    int src_pitch = src->pitch;
+    int row_len = w * 4;
+    int vec_len = row_len & ~15;
+    int i, x, y;
+    __m128 divisor = _mm_set1_ps((float)(radius * 2 + 1));
+    __m128i sum_h, mm_src[4], mm_sum[4];
+    Uint32 sum_first[4];
+
+    // Allocate bytes for buf and sum_v at once to reduce allocations.
+    Uint32 *overall_buf = malloc(sizeof(Uint32) * row_len * 2);
+    Uint32 *buf = overall_buf;
+    Uint32 *sum_v = overall_buf + row_len;
+
+    if (overall_buf == NULL) {
+        return -1;
+    }
+
+    memset(sum_v, 0, row_len * sizeof(Uint32));
+    for (y = 0; y <= radius; y++) {  // y-pre
+        for (i = 0; i < row_len; i++) {
+            sum_v[i] += srcpx[src_pitch * y + i];
+        }
+    }
+    if (repeat) {
+        for (i = 0; i < row_len; i++) {
+            sum_v[i] += srcpx[i] * radius;
+        }
+    }
+
+    for (y = 0; y < h; y++) {  // y
+        Uint8 *sub_row = NULL, *add_row = NULL;
+
+        if (y - radius >= 0) {
+            sub_row = srcpx + src_pitch * (y - radius);
+        }
+        else if (repeat) {
+            sub_row = srcpx;
+        }
+        if (y + radius + 1 < h) {
+            add_row = srcpx + src_pitch * (y + radius + 1);
+        }
+        else if (repeat) {
+            add_row = srcpx + src_pitch * (h - 1);
+        }
+
+        for (i = 0; i < vec_len; i += 16) {
+            int k;
+
+            for (k = 0; k < 4; k++) {
+                mm_sum[k] = _mm_loadu_si128((__m128i *)(sum_v + i + k * 4));
+                _mm_storeu_si128((__m128i *)(buf + i + k * 4),
+                                 _pg_box_divide(mm_sum[k], divisor));
+            }
+            // update vertical sum
+            if (sub_row) {
+                _pg_unpack_epu8_epi32(
+                    _mm_loadu_si128((__m128i *)(sub_row + i)), mm_src);
+                for (k = 0; k < 4; k++) {
+                    mm_sum[k] = _mm_sub_epi32(mm_sum[k], mm_src[k]);
+                }
+            }
+            if (add_row) {
+                _pg_unpack_epu8_epi32(
+                    _mm_loadu_si128((__m128i *)(add_row + i)), mm_src);
+                for (k = 0; k < 4; k++) {
+                    mm_sum[k] = _mm_add_epi32(mm_sum[k], mm_src[k]);
+                }
+            }
+            for (k = 0; k < 4; k++) {
+                _mm_storeu_si128((__m128i *)(sum_v + i + k * 4), mm_sum[k]);
+            }
+        }
+        for (; i < row_len; i++) {
+            buf[i] = sum_v[i] / (radius * 2 + 1);
+            if (sub_row) {
+                sum_v[i] -= sub_row[i];
+            }
+            if (add_row) {
+                sum_v[i] += add_row[i];
+            }
+        }
+
+        sum_h = _mm_setzero_si128();
+        for (x = 0; x <= radius; x++) {  // x-pre
+            sum_h = _mm_add_epi32(sum_h,
+                                  _mm_loadu_si128((__m128i *)(buf + x * 4)));
+        }
+        if (repeat) {
+            for (i = 0; i < 4; i++) {
+                sum_first[i] = buf[i] * radius;
+            }
+            sum_h =
+                _mm_add_epi32(sum_h, _mm_loadu_si128((__m128i *)sum_first));
+        }
+        for (x = 0; x < w; x++) {  // x
+            __m128i mm_dst = _pg_box_divide(sum_h, divisor);
+
+            mm_dst = _mm_packs_epi32(mm_dst, mm_dst);
+            mm_dst = _mm_packus_epi16(mm_dst, mm_dst);
+            _pg_storeu_si32(dstpx + dst_pitch * y + x * 4, mm_dst);
+
+            // update horizontal sum
+            if (x - radius >= 0) {
+                sum_h = _mm_sub_epi32(
+                    sum_h,
+                    _mm_loadu_si128((__m128i *)(buf + (x - radius) * 4)));
+            }
+            else if (repeat) {
+                sum_h = _mm_sub_epi32(sum_h, _mm_loadu_si128((__m128i *)buf));
+            }
+            if (x + radius + 1 < w) {
+                sum_h = _mm_add_epi32(
+                    sum_h,
+                    _mm_loadu_si128((__m128i *)(buf + (x + radius + 1) * 4)));
+            }
+            else if (repeat) {
+                sum_h = _mm_add_epi32(
+                    sum_h, _mm_loadu_si128((__m128i *)(buf + (w - 1) * 4)));
+            }
+        }
+    }
+
+    free(overall_buf);
+    return 0;
+}
+
+int
+gaussian_blur_sse2(SDL_Surface *src, SDL_Surface *dst, const float *lut,
+                   int kernel_radius, SDL_bool repeat)
+{
+    // Every lane accumulates its taps in the same order as the generic
+    // version, so the results match it exactly. Source rows for the vertical
+    // pass are looked up once per row, with NULL marking skipped taps.
+    Uint8 *srcpx = (Uint8 *)src->pixels;
+    Uint8 *dstpx = (Uint8 *)dst->pixels;
+    int w = dst->w, h = dst->h;
+    int dst_pitch = dst->pitch;
+    int src_pitch = src->pitch;
+    int row_len = w * 4;
+    int vec_len = row_len & ~15;
+    int taps = kernel_radius * 2 + 1;
+    int i, j, k, x, y;
+    __m128i mm_src[4];
+    __m128 mm_acc[4], mm_lut;
+
+    float *buf = malloc(sizeof(float) * row_len);
+    Uint8 **rows = malloc(sizeof(Uint8 *) * taps);
+
+    if (buf == NULL || rows == NULL) {
+        free(buf);
+        free(rows);
+        return -1;
+    }
+
+    for (y = 0; y < h; y++) {
+        for (j = -kernel_radius; j <= kernel_radius; j++) {
+            Uint8 **row = rows + j + kernel_radius;
+
+            if (y + j >= 0 && y + j < h) {
+                *row = srcpx + src_pitch * (y + j);
+            }
+            else if (repeat) {
+                *row = (y + j < 0) ? srcpx : srcpx + src_pitch * (h - 1);
+            }
+            else {
+                *row = NULL;
+            }
+        }
+
+        for (i = 0; i < vec_len; i += 16) {
+            for (k = 0; k < 4; k++) {
+                mm_acc[k] = _mm_setzero_ps();
+            }
+            for (j = 0; j < taps; j++) {
+                if (!rows[j]) {
+                    continue;
+                }
+                mm_lut = _mm_set1_ps(lut[abs(j - kernel_radius)]);
+                _pg_unpack_epu8_epi32(
+                    _mm_loadu_si128((__m128i *)(rows[j] + i)), mm_src);
+                for (k = 0; k < 4; k++) {
+                    mm_acc[k] = _mm_add_ps(
+                        mm_acc[k],
+                        _mm_mul_ps(_mm_cvtepi32_ps(mm_src[k]), mm_lut));
+                }
+            }
+            for (k = 0; k < 4; k++) {
+                _mm_storeu_ps(buf + i + k * 4, mm_acc[k]);
+            }
+        }
+        for (; i < row_len; i++) {
+            buf[i] = 0.0f;
+            for (j = 0; j < taps; j++) {
+                if (rows[j]) {
+                    buf[i] += (float)rows[j][i] * lut[abs(j - kernel_radius)];
+                }
+            }
+        }
+
+        for (x = 0; x < w; x++) {
+            __m128i mm_dst;
+
+            if (x >= kernel_radius && x + kernel_radius + 3 < w) {
+                // Four pixels with all of their taps inside the row.
+                for (k = 0; k < 4; k++) {
+                    mm_acc[k] = _mm_setzero_ps();
+                }
+                for (j = -kernel_radius; j <= kernel_radius; j++) {
+                    float *tap = buf + (x + j) * 4;
+
+                    mm_lut = _mm_set1_ps(lut[abs(j)]);
+                    for (k = 0; k < 4; k++) {
+                        mm_acc[k] = _mm_add_ps(
+                            mm_acc[k],
+                            _mm_mul_ps(_mm_loadu_ps(tap + k * 4), mm_lut));
+                    }
+                }
+                mm_dst = _mm_packs_epi32(_mm_cvttps_epi32(mm_acc[0]),
+                                         _mm_cvttps_epi32(mm_acc[1]));
+                mm_dst = _mm_packus_epi16(
+                    mm_dst, _mm_packs_epi32(_mm_cvttps_epi32(mm_acc[2]),
+                                            _mm_cvttps_epi32(mm_acc[3])));
+                _mm_storeu_si128((__m128i *)(dstpx + dst_pitch * y + x * 4),
+                                 mm_dst);
+                x += 3;
+                continue;
+            }
+
+            mm_acc[0] = _mm_setzero_ps();
+            for (j = -kernel_radius; j <= kernel_radius; j++) {
+                int tap = x + j;
+
+                if (tap < 0 || tap >= w) {
+                    if (!repeat) {
+                        continue;
+                    }
+                    tap = (tap < 0) ? 0 : w - 1;
+                }
+                mm_acc[0] = _mm_add_ps(
+                    mm_acc[0], _mm_mul_ps(_mm_loadu_ps(buf + tap * 4),
+                                          _mm_set1_ps(lut[abs(j)])));
+            }
+            mm_dst = _mm_cvttps_epi32(mm_acc[0]);
+            mm_dst = _mm_packs_epi32(mm_dst, mm_dst);
+            mm_dst = _mm_packus_epi16(mm_dst, mm_dst);
+            _pg_storeu_si32(dstpx + dst_pitch * y + x * 4, mm_dst);
+        }
+    }
+
+    free(buf);
+    free(rows);
+    return 0;
+}
+
 #endif /* __SSE2__ || PG_ENABLE_ARM_NEON*/
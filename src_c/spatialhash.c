@@ -0,0 +1,788 @@
+#include "doc/geometry_doc.h"
+#include "geometry_common.h"
+
+/* Entries covering more cells than this are kept in a list that every query
+ * scans, instead of being linked into each of their cells. */
+#define PG_SPATIAL_MAX_CELLS 64
+
+/* Cell coordinates are clamped so they can be packed and iterated over
+ * without overflowing. */
+#define PG_SPATIAL_CELL_LIMIT (1 << 28)
+
+#define PG_SPATIAL_PACK(cx, cy) \
+    ((Sint64)(((Uint64)(Uint32)(cx) << 32) | (Uint32)(cy)))
+
+static int
+_pg_spatial_bucket_add(pgSpatialBucket *bucket, int value)
+{
+    if (bucket->count == bucket->capacity) {
+        int capacity = bucket->capacity ? bucket->capacity * 2 : 4;
+        int *items = PyMem_Realloc(bucket->items, sizeof(int) * capacity);
+
+        if (!items) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        bucket->items = items;
+        bucket->capacity = capacity;
+    }
+    bucket->items[bucket->count++] = value;
+    return 0;
+}
+
+static void
+_pg_spatial_bucket_remove(pgSpatialBucket *bucket, int value)
+{
+    int i;
+
+    for (i = 0; i < bucket->count; i++) {
+        if (bucket->items[i] == value) {
+            bucket->items[i] = bucket->items[--bucket->count];
+            return;
+        }
+    }
+}
+
+static int
+_pg_spatial_cell_coord(double value, double cell_size)
+{
+    double cell = floor(value / cell_size);
+
+    /* written this way so NaN clamps too */
+    if (!(cell > -PG_SPATIAL_CELL_LIMIT)) {
+        return -PG_SPATIAL_CELL_LIMIT;
+    }
+    if (!(cell < PG_SPATIAL_CELL_LIMIT)) {
+        return PG_SPATIAL_CELL_LIMIT;
+    }
+    return (int)cell;
+}
+
+static size_t
+_pg_spatial_hash(Sint64 coords)
+{
+    Uint64 h = (Uint64)coords * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h ^ (h >> 29));
+}
+
+static pgSpatialCell *
+_pg_spatial_find_cell(pgSpatialHashObject *self, int cx, int cy)
+{
+    Sint64 coords = PG_SPATIAL_PACK(cx, cy);
+    size_t mask, i;
+
+    if (!self->cells_capacity) {
+        return NULL;
+    }
+    mask = (size_t)self->cells_capacity - 1;
+    for (i = _pg_spatial_hash(coords) & mask; self->cells[i].used;
+         i = (i + 1) & mask) {
+        if (self->cells[i].coords == coords) {
+            return &self->cells[i];
+        }
+    }
+    return NULL;
+}
+
+/* Rebuilds the cell table, dropping cells that no longer hold any entry. */
+static int
+_pg_spatial_rehash(pgSpatialHashObject *self)
+{
+    pgSpatialCell *old_cells = self->cells, *cells;
+    int old_capacity = self->cells_capacity;
+    int i, in_use = 0, capacity = 64;
+    size_t mask, j;
+
+    for (i = 0; i < old_capacity; i++) {
+        if (old_cells[i].used && old_cells[i].bucket.count) {
+            in_use++;
+        }
+    }
+    while (capacity < in_use * 4) {
+        capacity *= 2;
+    }
+
+    cells = PyMem_Calloc(capacity, sizeof(pgSpatialCell));
+    if (!cells) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    mask = (size_t)capacity - 1;
+    for (i = 0; i < old_capacity; i++) {
+        if (!old_cells[i].used) {
+            continue;
+        }
+        if (!old_cells[i].bucket.count) {
+            PyMem_Free(old_cells[i].bucket.items);
+            continue;
+        }
+        j = _pg_spatial_hash(old_cells[i].coords) & mask;
+        while (cells[j].used) {
+            j = (j + 1) & mask;
+        }
+        cells[j] = old_cells[i];
+    }
+
+    PyMem_Free(old_cells);
+    self->cells = cells;
+    self->cells_capacity = capacity;
+    self->cells_used = in_use;
+    return 0;
+}
+
+static pgSpatialCell *
+_pg_spatial_get_cell(pgSpatialHashObject *self, int cx, int cy)
+{
+    Sint64 coords = PG_SPATIAL_PACK(cx, cy);
+    pgSpatialCell *cell;
+    size_t mask, i;
+
+    if ((self->cells_used + 1) * 2 > self->cells_capacity &&
+        _pg_spatial_rehash(self)) {
+        return NULL;
+    }
+    mask = (size_t)self->cells_capacity - 1;
+    for (i = _pg_spatial_hash(coords) & mask; self->cells[i].used;
+         i = (i + 1) & mask) {
+        if (self->cells[i].coords == coords) {
+            return &self->cells[i];
+        }
+    }
+    cell = &self->cells[i];
+    cell->used = 1;
+    cell->coords = coords;
+    self->cells_used++;
+    return cell;
+}
+
+static void
+_pg_spatial_unlink(pgSpatialHashObject *self, int slot)
+{
+    pgSpatialEntry *entry = &self->entries[slot];
+    pgSpatialCell *cell;
+    int cx, cy;
+
+    if (entry->large) {
+        _pg_spatial_bucket_remove(&self->large, slot);
+        return;
+    }
+    for (cy = entry->cy0; cy <= entry->cy1; cy++) {
+        for (cx = entry->cx0; cx <= entry->cx1; cx++) {
+            if ((cell = _pg_spatial_find_cell(self, cx, cy))) {
+                _pg_spatial_bucket_remove(&cell->bucket, slot);
+            }
+        }
+    }
+}
+
+static int
+_pg_spatial_link(pgSpatialHashObject *self, int slot)
+{
+    pgSpatialEntry *entry = &self->entries[slot];
+    pgSpatialCell *cell;
+    int cx, cy;
+
+    if (entry->large) {
+        return _pg_spatial_bucket_add(&self->large, slot);
+    }
+    for (cy = entry->cy0; cy <= entry->cy1; cy++) {
+        for (cx = entry->cx0; cx <= entry->cx1; cx++) {
+            if (!(cell = _pg_spatial_get_cell(self, cx, cy)) ||
+                _pg_spatial_bucket_add(&cell->bucket, slot)) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* Fills the bounds and cell range of out from a rect style object. */
+static int
+_pg_spatial_bounds_from_obj(pgSpatialHashObject *self, PyObject *obj,
+                            pgSpatialEntry *out)
+{
+    double x, y, w, h;
+    SDL_FRect *frect, temp;
+
+    if (pgRect_Check(obj)) {
+        SDL_Rect *rect = &pgRect_AsRect(obj);
+        x = rect->x;
+        y = rect->y;
+        w = rect->w;
+        h = rect->h;
+    }
+    else if ((frect = pgFRect_FromObject(obj, &temp))) {
+        x = frect->x;
+        y = frect->y;
+        w = frect->w;
+        h = frect->h;
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError,
+                        "Invalid rect, expected a rect style object");
+        return 0;
+    }
+
+    out->x0 = MIN(x, x + w);
+    out->y0 = MIN(y, y + h);
+    out->x1 = MAX(x, x + w);
+    out->y1 = MAX(y, y + h);
+    out->cx0 = _pg_spatial_cell_coord(out->x0, self->cell_size);
+    out->cy0 = _pg_spatial_cell_coord(out->y0, self->cell_size);
+    out->cx1 = _pg_spatial_cell_coord(out->x1, self->cell_size);
+    out->cy1 = _pg_spatial_cell_coord(out->y1, self->cell_size);
+    out->large = ((Sint64)(out->cx1 - out->cx0 + 1) *
+                      (out->cy1 - out->cy0 + 1) >
+                  PG_SPATIAL_MAX_CELLS);
+    return 1;
+}
+
+/* Same rules as Rect.colliderect, zero sized rects collide with nothing. */
+static PG_FORCEINLINE int
+_pg_spatial_overlap(pgSpatialEntry *a, pgSpatialEntry *b)
+{
+    return a->x0 != a->x1 && a->y0 != a->y1 && b->x0 != b->x1 &&
+           b->y0 != b->y1 && a->x0 < b->x1 && a->x1 > b->x0 &&
+           a->y0 < b->y1 && a->y1 > b->y0;
+}
+
+static Uint32
+_pg_spatial_next_stamp(pgSpatialHashObject *self)
+{
+    int i;
+
+    if (++self->stamp == 0) {
+        for (i = 0; i < self->entries_len; i++) {
+            self->entries[i].stamp = 0;
+        }
+        self->stamp = 1;
+    }
+    return self->stamp;
+}
+
+static int
+_pg_spatial_compare_ints(const void *a, const void *b)
+{
+    int ia = *(const int *)a, ib = *(const int *)b;
+    return (ia > ib) - (ia < ib);
+}
+
+static int
+_pg_spatial_compare_pairs(const void *a, const void *b)
+{
+    const int *pa = (const int *)a, *pb = (const int *)b;
+    if (pa[0] != pb[0]) {
+        return (pa[0] > pb[0]) - (pa[0] < pb[0]);
+    }
+    return (pa[1] > pb[1]) - (pa[1] < pb[1]);
+}
+
+/* Turns a bucket of entry slots into a list of keys, in slot order. Frees the
+ * bucket. */
+static PyObject *
+_pg_spatial_keys_from_slots(pgSpatialHashObject *self, pgSpatialBucket *found)
+{
+    PyObject *ret;
+    int i;
+
+    if (found->count > 1) {
+        qsort(found->items, found->count, sizeof(int),
+              _pg_spatial_compare_ints);
+    }
+    if ((ret = PyList_New(found->count))) {
+        for (i = 0; i < found->count; i++) {
+            PyList_SET_ITEM(ret, i,
+                            Py_NewRef(self->entries[found->items[i]].key));
+        }
+    }
+    PyMem_Free(found->items);
+    return ret;
+}
+
+static int
+_pg_spatial_collect(pgSpatialHashObject *self, pgSpatialEntry *query,
+                    pgSpatialBucket *found)
+{
+    Uint32 stamp = _pg_spatial_next_stamp(self);
+    pgSpatialEntry *entry;
+    pgSpatialCell *cell;
+    Sint64 query_cells;
+    int i, cx, cy;
+
+    if (query->x0 == query->x1 || query->y0 == query->y1) {
+        return 0;
+    }
+
+    query_cells = (Sint64)(query->cx1 - query->cx0 + 1) *
+                  (query->cy1 - query->cy0 + 1);
+    if (query_cells > self->entries_len) {
+        /* cheaper to look at every entry than at every cell */
+        for (i = 0; i < self->entries_len; i++) {
+            entry = &self->entries[i];
+            if (entry->key && _pg_spatial_overlap(entry, query) &&
+                _pg_spatial_bucket_add(found, i)) {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    for (cy = query->cy0; cy <= query->cy1; cy++) {
+        for (cx = query->cx0; cx <= query->cx1; cx++) {
+            if (!(cell = _pg_spatial_find_cell(self, cx, cy))) {
+                continue;
+            }
+            for (i = 0; i < cell->bucket.count; i++) {
+                entry = &self->entries[cell->bucket.items[i]];
+                if (entry->stamp == stamp) {
+                    continue;
+                }
+                entry->stamp = stamp;
+                if (_pg_spatial_overlap(entry, query) &&
+                    _pg_spatial_bucket_add(found, cell->bucket.items[i])) {
+                    return -1;
+                }
+            }
+        }
+    }
+    for (i = 0; i < self->large.count; i++) {
+        if (_pg_spatial_overlap(&self->entries[self->large.items[i]],
+                                query) &&
+            _pg_spatial_bucket_add(found, self->large.items[i])) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Frees the cell table and forgets every entry. Does not touch the dict. */
+static void
+_pg_spatial_reset(pgSpatialHashObject *self)
+{
+    int i;
+
+    for (i = 0; i < self->cells_capacity; i++) {
+        PyMem_Free(self->cells[i].bucket.items);
+    }
+    PyMem_Free(self->cells);
+    self->cells = NULL;
+    self->cells_capacity = self->cells_used = 0;
+    self->large.count = 0;
+    self->entries_len = 0;
+    self->free_head = -1;
+}
+
+/* Drops an entry after a failed update, keeping any exception that is set. */
+static void
+_pg_spatial_discard(pgSpatialHashObject *self, int slot)
+{
+    PyObject *type, *value, *traceback;
+    PyObject *key = self->entries[slot].key;
+
+    PyErr_Fetch(&type, &value, &traceback);
+    _pg_spatial_unlink(self, slot);
+    self->entries[slot].key = NULL;
+    self->entries[slot].cx0 = self->free_head;
+    self->free_head = slot;
+    Py_INCREF(key);
+    if (PyDict_DelItem(self->index, key)) {
+        PyErr_Clear();
+    }
+    Py_DECREF(key);
+    PyErr_Restore(type, value, traceback);
+}
+
+static int
+_pg_spatial_new_slot(pgSpatialHashObject *self)
+{
+    int slot;
+
+    if (self->free_head >= 0) {
+        slot = self->free_head;
+        self->free_head = self->entries[slot].cx0;
+        return slot;
+    }
+    if (self->entries_len == self->entries_capacity) {
+        int capacity =
+            self->entries_capacity ? self->entries_capacity * 2 : 64;
+        pgSpatialEntry *entries =
+            PyMem_Realloc(self->entries, sizeof(pgSpatialEntry) * capacity);
+
+        if (!entries) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        self->entries = entries;
+        self->entries_capacity = capacity;
+    }
+    return self->entries_len++;
+}
+
+static PyObject *
+pg_spatialhash_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    pgSpatialHashObject *self = (pgSpatialHashObject *)type->tp_alloc(type, 0);
+
+    if (self != NULL) {
+        self->cell_size = 64.0;
+        self->free_head = -1;
+        if (!(self->index = PyDict_New())) {
+            Py_DECREF(self);
+            return NULL;
+        }
+    }
+    return (PyObject *)self;
+}
+
+static int
+pg_spatialhash_init(pgSpatialHashObject *self, PyObject *args, PyObject *kwds)
+{
+    double cell_size = 64.0;
+    static char *kwlist[] = {"cell_size", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|d", kwlist, &cell_size)) {
+        return -1;
+    }
+    if (!(cell_size > 0.0) || !isfinite(cell_size)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "cell_size must be a positive number");
+        return -1;
+    }
+
+    PyDict_Clear(self->index);
+    _pg_spatial_reset(self);
+    self->cell_size = cell_size;
+    return 0;
+}
+
+static int
+pg_spatialhash_traverse(pgSpatialHashObject *self, visitproc visit, void *arg)
+{
+    Py_VISIT(self->index);
+    return 0;
+}
+
+static int
+pg_spatialhash_clear_refs(pgSpatialHashObject *self)
+{
+    _pg_spatial_reset(self);
+    Py_CLEAR(self->index);
+    return 0;
+}
+
+static void
+pg_spatialhash_dealloc(pgSpatialHashObject *self)
+{
+    PyObject_GC_UnTrack(self);
+    if (self->weakreflist != NULL) {
+        PyObject_ClearWeakRefs((PyObject *)self);
+    }
+    pg_spatialhash_clear_refs(self);
+    PyMem_Free(self->entries);
+    PyMem_Free(self->large.items);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *
+pg_spatialhash_repr(pgSpatialHashObject *self)
+{
+    PyObject *cell_size, *result;
+
+    if (!(cell_size = PyFloat_FromDouble(self->cell_size))) {
+        return NULL;
+    }
+    result = PyUnicode_FromFormat("<SpatialHash(cell_size=%R)>", cell_size);
+    Py_DECREF(cell_size);
+    return result;
+}
+
+static PyObject *
+pg_spatialhash_insert(pgSpatialHashObject *self, PyObject *args,
+                      PyObject *kwargs)
+{
+    PyObject *key, *rectobj = NULL, *slotobj;
+    pgSpatialEntry bounds, *entry;
+    int slot;
+    static char *kwlist[] = {"key", "rect", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", kwlist, &key,
+                                     &rectobj)) {
+        return NULL;
+    }
+    if (!_pg_spatial_bounds_from_obj(self, rectobj ? rectobj : key,
+                                     &bounds)) {
+        return NULL;
+    }
+
+    if ((slotobj = PyDict_GetItemWithError(self->index, key))) {
+        /* moving an entry only touches the cells that changed */
+        slot = (int)PyLong_AsLong(slotobj);
+        entry = &self->entries[slot];
+        if (entry->large == bounds.large && entry->cx0 == bounds.cx0 &&
+            entry->cy0 == bounds.cy0 && entry->cx1 == bounds.cx1 &&
+            entry->cy1 == bounds.cy1) {
+            entry->x0 = bounds.x0;
+            entry->y0 = bounds.y0;
+            entry->x1 = bounds.x1;
+            entry->y1 = bounds.y1;
+            Py_RETURN_NONE;
+        }
+        _pg_spatial_unlink(self, slot);
+    }
+    else if (PyErr_Occurred()) {
+        return NULL;
+    }
+    else {
+        if ((slot = _pg_spatial_new_slot(self)) < 0) {
+            return NULL;
+        }
+        if (!(slotobj = PyLong_FromLong(slot)) ||
+            PyDict_SetItem(self->index, key, slotobj)) {
+            Py_XDECREF(slotobj);
+            self->entries[slot].cx0 = self->free_head;
+            self->free_head = slot;
+            return NULL;
+        }
+        Py_DECREF(slotobj);
+    }
+
+    entry = &self->entries[slot];
+    bounds.key = key;
+    bounds.stamp = 0;
+    *entry = bounds;
+    if (_pg_spatial_link(self, slot)) {
+        _pg_spatial_discard(self, slot);
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_spatialhash_remove(pgSpatialHashObject *self, PyObject *key)
+{
+    PyObject *slotobj = PyDict_GetItemWithError(self->index, key);
+    int slot;
+
+    if (!slotobj) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetObject(PyExc_KeyError, key);
+        }
+        return NULL;
+    }
+    slot = (int)PyLong_AsLong(slotobj);
+    _pg_spatial_unlink(self, slot);
+    self->entries[slot].key = NULL;
+    self->entries[slot].cx0 = self->free_head;
+    self->free_head = slot;
+    if (PyDict_DelItem(self->index, key)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_spatialhash_clear(pgSpatialHashObject *self, PyObject *_null)
+{
+    PyDict_Clear(self->index);
+    _pg_spatial_reset(self);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_spatialhash_query(pgSpatialHashObject *self, PyObject *arg)
+{
+    pgSpatialEntry query;
+    pgSpatialBucket found = {NULL, 0, 0};
+
+    if (!_pg_spatial_bounds_from_obj(self, arg, &query)) {
+        return NULL;
+    }
+    if (_pg_spatial_collect(self, &query, &found)) {
+        PyMem_Free(found.items);
+        return NULL;
+    }
+    return _pg_spatial_keys_from_slots(self, &found);
+}
+
+static PyObject *
+pg_spatialhash_query_point(pgSpatialHashObject *self, PyObject *const *args,
+                           Py_ssize_t nargs)
+{
+    pgSpatialBucket found = {NULL, 0, 0};
+    pgSpatialCell *cell;
+    pgSpatialEntry *entry;
+    double x, y;
+    int i;
+
+    if (!pg_TwoDoublesFromFastcallArgs(args, nargs, &x, &y)) {
+        return RAISE(PyExc_TypeError,
+                     "SpatialHash.query_point requires a point or PointLike "
+                     "object");
+    }
+
+    /* Same rules as Rect.collidepoint, the right and bottom edges are not
+     * part of the rect. A point is in a single cell, so no entry can be seen
+     * twice. */
+    cell =
+        _pg_spatial_find_cell(self, _pg_spatial_cell_coord(x, self->cell_size),
+                              _pg_spatial_cell_coord(y, self->cell_size));
+    for (i = 0; cell && i < cell->bucket.count; i++) {
+        entry = &self->entries[cell->bucket.items[i]];
+        if (x >= entry->x0 && x < entry->x1 && y >= entry->y0 &&
+            y < entry->y1 &&
+            _pg_spatial_bucket_add(&found, cell->bucket.items[i])) {
+            goto error;
+        }
+    }
+    for (i = 0; i < self->large.count; i++) {
+        entry = &self->entries[self->large.items[i]];
+        if (x >= entry->x0 && x < entry->x1 && y >= entry->y0 &&
+            y < entry->y1 &&
+            _pg_spatial_bucket_add(&found, self->large.items[i])) {
+            goto error;
+        }
+    }
+    return _pg_spatial_keys_from_slots(self, &found);
+
+error:
+    PyMem_Free(found.items);
+    return NULL;
+}
+
+static int
+_pg_spatial_add_pair(pgSpatialBucket *pairs, int a, int b)
+{
+    return _pg_spatial_bucket_add(pairs, MIN(a, b)) ||
+           _pg_spatial_bucket_add(pairs, MAX(a, b));
+}
+
+static PyObject *
+pg_spatialhash_pairs(pgSpatialHashObject *self, PyObject *_null)
+{
+    pgSpatialBucket pairs = {NULL, 0, 0};
+    pgSpatialEntry *a, *b;
+    PyObject *ret = NULL, *pair;
+    int c, i, j;
+
+    for (c = 0; c < self->cells_capacity; c++) {
+        pgSpatialCell *cell = &self->cells[c];
+        int cx = (Sint32)((Uint64)cell->coords >> 32);
+        int cy = (Sint32)((Uint64)cell->coords & 0xFFFFFFFF);
+
+        if (!cell->used) {
+            continue;
+        }
+        for (i = 0; i < cell->bucket.count; i++) {
+            a = &self->entries[cell->bucket.items[i]];
+            for (j = i + 1; j < cell->bucket.count; j++) {
+                b = &self->entries[cell->bucket.items[j]];
+                /* Overlapping entries share every cell of their overlap,
+                 * only report them from the cell holding its top left. */
+                if (_pg_spatial_overlap(a, b) &&
+                    _pg_spatial_cell_coord(MAX(a->x0, b->x0),
+                                           self->cell_size) == cx &&
+                    _pg_spatial_cell_coord(MAX(a->y0, b->y0),
+                                           self->cell_size) == cy &&
+                    _pg_spatial_add_pair(&pairs, cell->bucket.items[i],
+                                         cell->bucket.items[j])) {
+                    goto end;
+                }
+            }
+        }
+    }
+    for (i = 0; i < self->large.count; i++) {
+        a = &self->entries[self->large.items[i]];
+        for (j = 0; j < self->entries_len; j++) {
+            b = &self->entries[j];
+            /* large pairs are reported once, by the lower slot */
+            if (!b->key || (b->large && j <= self->large.items[i])) {
+                continue;
+            }
+            if (_pg_spatial_overlap(a, b) &&
+                _pg_spatial_add_pair(&pairs, self->large.items[i], j)) {
+                goto end;
+            }
+        }
+    }
+
+    if (pairs.count > 2) {
+        qsort(pairs.items, pairs.count / 2, sizeof(int) * 2,
+              _pg_spatial_compare_pairs);
+    }
+    if (!(ret = PyList_New(pairs.count / 2))) {
+        goto end;
+    }
+    for (i = 0; i < pairs.count / 2; i++) {
+        pair = PyTuple_Pack(2, self->entries[pairs.items[i * 2]].key,
+                            self->entries[pairs.items[i * 2 + 1]].key);
+        if (!pair) {
+            Py_CLEAR(ret);
+            goto end;
+        }
+        PyList_SET_ITEM(ret, i, pair);
+    }
+
+end:
+    PyMem_Free(pairs.items);
+    return ret;
+}
+
+static PyObject *
+pg_spatialhash_get_cell_size(pgSpatialHashObject *self, void *closure)
+{
+    return PyFloat_FromDouble(self->cell_size);
+}
+
+static Py_ssize_t
+pg_spatialhash_length(pgSpatialHashObject *self)
+{
+    return PyDict_Size(self->index);
+}
+
+static int
+pg_spatialhash_contains(pgSpatialHashObject *self, PyObject *key)
+{
+    return PyDict_Contains(self->index, key);
+}
+
+static struct PyMethodDef pg_spatialhash_methods[] = {
+    {"insert", (PyCFunction)pg_spatialhash_insert,
+     METH_VARARGS | METH_KEYWORDS, DOC_SPATIALHASH_INSERT},
+    {"remove", (PyCFunction)pg_spatialhash_remove, METH_O,
+     DOC_SPATIALHASH_REMOVE},
+    {"clear", (PyCFunction)pg_spatialhash_clear, METH_NOARGS,
+     DOC_SPATIALHASH_CLEAR},
+    {"query", (PyCFunction)pg_spatialhash_query, METH_O,
+     DOC_SPATIALHASH_QUERY},
+    {"query_point", (PyCFunction)pg_spatialhash_query_point, METH_FASTCALL,
+     DOC_SPATIALHASH_QUERYPOINT},
+    {"pairs", (PyCFunction)pg_spatialhash_pairs, METH_NOARGS,
+     DOC_SPATIALHASH_PAIRS},
+    {NULL, NULL, 0, NULL}};
+
+static PyGetSetDef pg_spatialhash_getsets[] = {
+    {"cell_size", (getter)pg_spatialhash_get_cell_size, NULL,
+     DOC_SPATIALHASH_CELLSIZE, NULL},
+    {NULL, 0, NULL, NULL, NULL}};
+
+static PySequenceMethods pg_spatialhash_as_sequence = {
+    .sq_length = (lenfunc)pg_spatialhash_length,
+    .sq_contains = (objobjproc)pg_spatialhash_contains,
+};
+
+static PyTypeObject pgSpatialHash_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.geometry.SpatialHash",
+    .tp_basicsize = sizeof(pgSpatialHashObject),
+    .tp_dealloc = (destructor)pg_spatialhash_dealloc,
+    .tp_repr = (reprfunc)pg_spatialhash_repr,
+    .tp_as_sequence = &pg_spatialhash_as_sequence,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC,
+    .tp_doc = DOC_SPATIALHASH,
+    .tp_traverse = (traverseproc)pg_spatialhash_traverse,
+    .tp_clear = (inquiry)pg_spatialhash_clear_refs,
+    .tp_weaklistoffset = offsetof(pgSpatialHashObject, weakreflist),
+    .tp_methods = pg_spatialhash_methods,
+    .tp_getset = pg_spatialhash_getsets,
+    .tp_init = (initproc)pg_spatialhash_init,
+    .tp_new = pg_spatialhash_new,
+};
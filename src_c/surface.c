@@ -2669,6 +2669,177 @@ on_error:
     return RAISE(PyExc_TypeError, "Unknown error");
 }
 
+static PyObject *_sprite_image_str = NULL;
+static PyObject *_sprite_rect_str = NULL;
+
+static int
+_blit_sprite(pgSurfaceObject *self, SDL_Rect *clip, PyObject *sprite,
+             int blend_flags, SDL_Rect *dest_rect)
+{
+    PyObject *image = NULL, *rect = NULL;
+    SDL_Surface *src;
+    SDL_Rect *rect_ptr, temp;
+    int result = -1;
+
+    if (!(image = PyObject_GetAttr(sprite, _sprite_image_str)) ||
+        !(rect = PyObject_GetAttr(sprite, _sprite_rect_str))) {
+        goto end;
+    }
+    if (!pgSurface_Check(image)) {
+        PyErr_SetString(PyExc_TypeError, "Source objects must be a Surface");
+        goto end;
+    }
+    if (!(src = pgSurface_AsSurface(image))) {
+        PyErr_SetString(pgExc_SDLError, "display Surface quit");
+        goto end;
+    }
+
+    if ((rect_ptr = pgRect_FromObject(rect, &temp))) {
+        dest_rect->x = rect_ptr->x;
+        dest_rect->y = rect_ptr->y;
+    }
+    else if (!pg_TwoIntsFromObj(rect, &dest_rect->x, &dest_rect->y)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "invalid destination position for blit");
+        goto end;
+    }
+    dest_rect->w = src->w;
+    dest_rect->h = src->h;
+
+    if (dest_rect->w > 0 && dest_rect->h > 0 &&
+        dest_rect->x < clip->x + clip->w &&
+        dest_rect->x + dest_rect->w > clip->x &&
+        dest_rect->y < clip->y + clip->h &&
+        dest_rect->y + dest_rect->h > clip->y) {
+        if (pgSurface_Blit(self, (pgSurfaceObject *)image, dest_rect, NULL,
+                           blend_flags)) {
+            goto end;
+        }
+    }
+    else {
+        /* Nothing to draw, give back the rect a clipped blit would */
+        dest_rect->x = MAX(dest_rect->x, clip->x);
+        dest_rect->y = MAX(dest_rect->y, clip->y);
+        dest_rect->w = dest_rect->h = 0;
+    }
+    result = 0;
+
+end:
+    Py_XDECREF(image);
+    Py_XDECREF(rect);
+    return result;
+}
+
+/* Appends the area a sprite covered before and after this draw to dirty,
+ * merging both rects when they overlap (like Rect.colliderect/union). */
+static int
+_append_sprite_dirty(PyObject *dirty, PyObject *newrect, SDL_Rect *new_r,
+                     PyObject *oldrect, PyObject *init_rect)
+{
+    SDL_Rect *old_r, temp, merged;
+
+    if (oldrect == init_rect) {
+        return PyList_Append(dirty, newrect);
+    }
+    if (!(old_r = pgRect_FromObject(oldrect, &temp))) {
+        PyErr_SetString(PyExc_TypeError, "Invalid rectstyle argument");
+        return -1;
+    }
+    if (new_r->w != 0 && new_r->h != 0 && old_r->w != 0 && old_r->h != 0 &&
+        new_r->x < MAX(old_r->x, old_r->x + old_r->w) &&
+        new_r->y < MAX(old_r->y, old_r->y + old_r->h) &&
+        new_r->x + new_r->w > MIN(old_r->x, old_r->x + old_r->w) &&
+        new_r->y + new_r->h > MIN(old_r->y, old_r->y + old_r->h)) {
+        PyObject *union_rect;
+        int result;
+
+        merged.x = MIN(new_r->x, old_r->x);
+        merged.y = MIN(new_r->y, old_r->y);
+        merged.w = MAX(new_r->x + new_r->w, old_r->x + old_r->w) - merged.x;
+        merged.h = MAX(new_r->y + new_r->h, old_r->y + old_r->h) - merged.y;
+        if (!(union_rect = pgRect_New(&merged))) {
+            return -1;
+        }
+        result = PyList_Append(dirty, union_rect);
+        Py_DECREF(union_rect);
+        return result;
+    }
+    if (PyList_Append(dirty, newrect) || PyList_Append(dirty, oldrect)) {
+        return -1;
+    }
+    return 0;
+}
+
+/* Native path for pygame.sprite group drawing. Blits sprite.image at
+ * sprite.rect for every sprite of the list and stores the resulting rect in
+ * spritedict, without building any intermediate blit tuples. Sprites fully
+ * outside the clip rect are skipped. If dirty is a list, the changed areas
+ * are appended to it the way LayeredUpdates.draw tracks them, init_rect
+ * being the placeholder rect of sprites that were never drawn. */
+static PyObject *
+surf_blit_sprites(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    pgSurfaceObject *surfobj;
+    PyObject *sprites, *spritedict, *sprite = NULL, *newrect = NULL;
+    PyObject *dirty = Py_None, *init_rect = Py_None, *oldrect;
+    SDL_Surface *dest;
+    SDL_Rect clip, dest_rect;
+    int blend_flags = 0;
+    Py_ssize_t i;
+
+    static char *kwids[] = {"surface",    "sprites", "special_flags",
+                            "spritedict", "dirty",   "init_rect",
+                            NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O!O!iO!|OO", kwids,
+                                     &pgSurface_Type, &surfobj, &PyList_Type,
+                                     &sprites, &blend_flags, &PyDict_Type,
+                                     &spritedict, &dirty, &init_rect)) {
+        return NULL;
+    }
+    if (dirty != Py_None && !PyList_Check(dirty)) {
+        return RAISE(PyExc_TypeError, "dirty must be a list or None");
+    }
+
+    dest = pgSurface_AsSurface(surfobj);
+    SURF_INIT_CHECK(dest)
+    if (!PG_GetSurfaceClipRect(dest, &clip)) {
+        return RAISE(pgExc_SDLError, SDL_GetError());
+    }
+
+    for (i = 0; i < PyList_GET_SIZE(sprites); i++) {
+        sprite = Py_NewRef(PyList_GET_ITEM(sprites, i));
+
+        if (_blit_sprite(surfobj, &clip, sprite, blend_flags, &dest_rect) ||
+            !(newrect = pgRect_New(&dest_rect))) {
+            goto error;
+        }
+        if (dirty != Py_None) {
+            if (!(oldrect = PyDict_GetItemWithError(spritedict, sprite))) {
+                if (!PyErr_Occurred()) {
+                    PyErr_SetObject(PyExc_KeyError, sprite);
+                }
+                goto error;
+            }
+            if (_append_sprite_dirty(dirty, newrect, &dest_rect, oldrect,
+                                     init_rect)) {
+                goto error;
+            }
+        }
+        if (PyDict_SetItem(spritedict, sprite, newrect)) {
+            goto error;
+        }
+        Py_CLEAR(newrect);
+        Py_CLEAR(sprite);
+    }
+
+    Py_RETURN_NONE;
+
+error:
+    Py_XDECREF(newrect);
+    Py_XDECREF(sprite);
+    return NULL;
+}
+
 static int
 scroll_repeat(int h, int dx, int dy, int pitch, int span, int xoffset,
               Uint8 *startsrc, Uint8 *endsrc, Uint8 *linesrc)
@@ -4625,7 +4796,11 @@ pgSurface_Blit(pgSurfaceObject *dstobj, pgSurfaceObject *srcobj,
     return result != 0;
 }
 
-static PyMethodDef _surface_methods[] = {{NULL, NULL, 0, NULL}};
+static PyMethodDef _surface_methods[] = {
+    {"_blit_sprites", (PyCFunction)surf_blit_sprites,
+     METH_VARARGS | METH_KEYWORDS,
+     "internal helper of pygame.sprite, subject to change"},
+    {NULL, NULL, 0, NULL}};
 
 int
 exec_surface(PyObject *module)
@@ -4659,6 +4834,15 @@ exec_surface(PyObject *module)
         return -1;
     }
 
+    if (!_sprite_image_str &&
+        !(_sprite_image_str = PyUnicode_InternFromString("image"))) {
+        return -1;
+    }
+    if (!_sprite_rect_str &&
+        !(_sprite_rect_str = PyUnicode_InternFromString("rect"))) {
+        return -1;
+    }
+
     PyObject *apiobj;
     static void *c_api[PYGAMEAPI_SURFACE_NUMSLOTS];
 #ifndef BUILD_STATIC
@@ -34,6 +34,7 @@
 #include <string.h>
 #include <limits.h>
 
+#include "pgparallel.h"
 #include "simd_shared.h"
 #include "simd_transform.h"
 #include "scale.h"
@@ -46,8 +47,14 @@ struct _module_state {
     SMOOTHSCALE_FILTER_P filter_shrink_Y;
     SMOOTHSCALE_FILTER_P filter_expand_X;
     SMOOTHSCALE_FILTER_P filter_expand_Y;
+    int num_threads;
 };
 
+/* Upper bound on the number of threads a single transform call runs on */
+#define PG_TRANSFORM_MAX_THREADS PG_PARALLEL_MAX_THREADS
+/* Bands with fewer rows (or columns) than this are not worth a thread */
+#define PG_TRANSFORM_MIN_BAND 16
+
 #define GETSTATE(m) ((struct _module_state *)PyModule_GetState(m))
 
 void
@@ -439,10 +446,140 @@ rotate(SDL_Surface *src, SDL_Surface *dst, Uint32 bgcolor, double sangle,
     }
 }
 
+/* Returns how many bands length rows (or columns) should be split into */
+static int
+_get_band_count(int num_threads, int length)
+{
+    int bands = length / PG_TRANSFORM_MIN_BAND;
+
+    if (bands > num_threads) {
+        bands = num_threads;
+    }
+    if (bands > PG_TRANSFORM_MAX_THREADS) {
+        bands = PG_TRANSFORM_MAX_THREADS;
+    }
+    return bands < 1 ? 1 : bands;
+}
+
+typedef struct {
+    const Uint8 *srcpix;
+    Uint8 *dstpix;
+    const Uint32 *x_offset;
+    int srcpitch;
+    int dstpitch;
+    int dstwidth;
+    int rows;
+    int bpp;
+    Uint32 posy;
+    Uint32 incy;
+} _scale_nearest_job;
+
+static int
+_scale_nearest_job_run(void *data)
+{
+    _scale_nearest_job *job = (_scale_nearest_job *)data;
+    const Uint32 *x_offset = job->x_offset;
+    Uint32 posy = job->posy;
+    int x, y;
+
+    for (y = 0; y < job->rows; y++) {
+        const Uint8 *srcrow =
+            job->srcpix + (size_t)(posy >> 16) * job->srcpitch;
+        Uint8 *dstrow = job->dstpix + (size_t)y * job->dstpitch;
+        posy += job->incy;
+
+        switch (job->bpp) {
+            case 1:
+                for (x = 0; x < job->dstwidth; x++) {
+                    dstrow[x] = srcrow[x_offset[x]];
+                }
+                break;
+            case 2:
+                for (x = 0; x < job->dstwidth; x++) {
+                    ((Uint16 *)dstrow)[x] =
+                        *(const Uint16 *)(srcrow + x_offset[x]);
+                }
+                break;
+            case 3:
+                for (x = 0; x < job->dstwidth; x++) {
+                    memcpy(dstrow + x * 3, srcrow + x_offset[x], 3);
+                }
+                break;
+            default:
+                for (x = 0; x < job->dstwidth; x++) {
+                    ((Uint32 *)dstrow)[x] =
+                        *(const Uint32 *)(srcrow + x_offset[x]);
+                }
+                break;
+        }
+    }
+    return 0;
+}
+
+/* Nearest neighbour scaling of horizontal bands of dst on up to num_threads
+ * threads. The 16.16 fixed point stepping is the same as SDL's own nearest
+ * scaler, so the result matches PG_SoftStretchNearest exactly.
+ * Returns 0 if the surfaces were scaled, 1 if they can't be scaled here and
+ * the caller should fall back to PG_SoftStretchNearest, -1 on error. */
+static int
+_scale_nearest_threaded(SDL_Surface *src, SDL_Surface *dst, int num_threads)
+{
+    _scale_nearest_job jobs[PG_TRANSFORM_MAX_THREADS];
+    Uint32 *x_offset;
+    Uint32 posx, posy, incx, incy;
+    int bpp = PG_SURF_BytesPerPixel(dst);
+    int bands = _get_band_count(num_threads, dst->h);
+    int i, start = 0;
+
+    /* keep clear of the fixed point overflow limits */
+    if (bands < 2 || src->w > 0x7FFF || src->h > 0x7FFF || dst->w > 0x7FFF ||
+        dst->h > 0x7FFF) {
+        return 1;
+    }
+
+    x_offset = (Uint32 *)malloc(sizeof(Uint32) * dst->w);
+    if (!x_offset) {
+        SDL_SetError("Out of memory");
+        return -1;
+    }
+
+    incx = ((Uint32)src->w << 16) / dst->w;
+    incy = ((Uint32)src->h << 16) / dst->h;
+    posx = incx / 2;
+    for (i = 0; i < dst->w; i++) {
+        x_offset[i] = (Uint32)bpp * (posx >> 16);
+        posx += incx;
+    }
+
+    posy = incy / 2;
+    for (i = 0; i < bands; i++) {
+        int end = (int)((Sint64)dst->h * (i + 1) / bands);
+        jobs[i].srcpix = (const Uint8 *)src->pixels;
+        jobs[i].dstpix = (Uint8 *)dst->pixels + (size_t)start * dst->pitch;
+        jobs[i].x_offset = x_offset;
+        jobs[i].srcpitch = src->pitch;
+        jobs[i].dstpitch = dst->pitch;
+        jobs[i].dstwidth = dst->w;
+        jobs[i].rows = end - start;
+        jobs[i].bpp = bpp;
+        jobs[i].posy = posy;
+        jobs[i].incy = incy;
+        posy += incy * (Uint32)(end - start);
+        start = end;
+    }
+
+    pg_run_parallel(_scale_nearest_job_run, "pg_transform", jobs,
+                    sizeof(_scale_nearest_job), bands);
+
+    free(x_offset);
+    return 0;
+}
+
 static SDL_Surface *
-scale_to(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj, int width,
-         int height)
+scale_to(PyObject *self, pgSurfaceObject *srcobj, pgSurfaceObject *dstobj,
+         int width, int height)
 {
+    struct _module_state *st = GETSTATE(self);
     SDL_Surface *src = NULL;
     SDL_Surface *retsurf = NULL;
     SDL_Surface *modsurf = NULL;
@@ -504,7 +641,16 @@ scale_to(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj, int width,
         pgSurface_Lock(srcobj);
         Py_BEGIN_ALLOW_THREADS;
 
-        stretch_result_num = PG_SoftStretchNearest(src, NULL, modsurf, NULL);
+        stretch_result_num = 1;
+        if (st->num_threads > 1 && SDL_LockSurface(modsurf) == 0) {
+            stretch_result_num =
+                _scale_nearest_threaded(src, modsurf, st->num_threads);
+            SDL_UnlockSurface(modsurf);
+        }
+        if (stretch_result_num > 0) {
+            stretch_result_num =
+                PG_SoftStretchNearest(src, NULL, modsurf, NULL);
+        }
 
         Py_END_ALLOW_THREADS;
         pgSurface_Unlock(srcobj);
@@ -544,7 +690,7 @@ surf_scale(PyObject *self, PyObject *args, PyObject *kwargs)
         return RAISE(PyExc_TypeError, "size must be two numbers");
     }
 
-    newsurf = scale_to(surfobj, surfobj2, width, height);
+    newsurf = scale_to(self, surfobj, surfobj2, width, height);
     if (!newsurf) {
         return NULL;
     }
@@ -580,7 +726,7 @@ surf_scale_by(PyObject *self, PyObject *args, PyObject *kwargs)
     surf = pgSurface_AsSurface(surfobj);
     SURF_INIT_CHECK(surf)
 
-    newsurf = scale_to(surfobj, surfobj2, (int)(surf->w * scalex),
+    newsurf = scale_to(self, surfobj, surfobj2, (int)(surf->w * scalex),
                        (int)(surf->h * scaley));
     if (!newsurf) {
         return NULL;
@@ -1303,8 +1449,16 @@ smoothscale_init(struct _module_state *st)
     }
 
 #if !defined(__EMSCRIPTEN__)
+    if (pg_has_avx2()) {
+        st->filter_type = "AVX2";
+        st->filter_shrink_X = filter_shrink_X_AVX2;
+        st->filter_shrink_Y = filter_shrink_Y_AVX2;
+        st->filter_expand_X = filter_expand_X_AVX2;
+        st->filter_expand_Y = filter_expand_Y_AVX2;
+        return;
+    }
 #if PG_ENABLE_SSE_NEON
-    if (SDL_HasSSE2()) {
+    if (pg_HasSSE_NEON() && SDL_HasSSE2()) {
         st->filter_type = "SSE2";
         st->filter_shrink_X = filter_shrink_X_SSE2;
         st->filter_shrink_Y = filter_shrink_Y_SSE2;
@@ -1312,7 +1466,7 @@ smoothscale_init(struct _module_state *st)
         st->filter_expand_Y = filter_expand_Y_SSE2;
         return;
     }
-    if (SDL_HasNEON()) {
+    if (pg_HasSSE_NEON() && SDL_HasNEON()) {
         st->filter_type = "NEON";
         st->filter_shrink_X = filter_shrink_X_SSE2;
         st->filter_shrink_Y = filter_shrink_Y_SSE2;
@@ -1389,6 +1543,95 @@ convert_32_24(Uint8 *srcpix, int srcpitch, Uint8 *dstpix, int dstpitch,
     }
 }
 
+typedef struct {
+    SMOOTHSCALE_FILTER_P filter;
+    Uint8 *srcpix;
+    Uint8 *dstpix;
+    int length;
+    int srcpitch;
+    int dstpitch;
+    int srcsize;
+    int dstsize;
+} _smoothscale_job;
+
+static int
+_smoothscale_job_run(void *data)
+{
+    _smoothscale_job *job = (_smoothscale_job *)data;
+    job->filter(job->srcpix, job->dstpix, job->length, job->srcpitch,
+                job->dstpitch, job->srcsize, job->dstsize);
+    return 0;
+}
+
+/* The X filters treat every row on its own, so they are run over
+ * horizontal bands of rows, one band per thread. */
+static void
+filter_X_banded(SMOOTHSCALE_FILTER_P filter, Uint8 *srcpix, Uint8 *dstpix,
+                int height, int srcpitch, int dstpitch, int srcwidth,
+                int dstwidth, int num_threads)
+{
+    _smoothscale_job jobs[PG_TRANSFORM_MAX_THREADS];
+    int bands = _get_band_count(num_threads, height);
+    int i, start = 0;
+
+    if (bands == 1) {
+        filter(srcpix, dstpix, height, srcpitch, dstpitch, srcwidth,
+               dstwidth);
+        return;
+    }
+
+    for (i = 0; i < bands; i++) {
+        int end = (int)((Sint64)height * (i + 1) / bands);
+        jobs[i].filter = filter;
+        jobs[i].srcpix = srcpix + (size_t)start * srcpitch;
+        jobs[i].dstpix = dstpix + (size_t)start * dstpitch;
+        jobs[i].length = end - start;
+        jobs[i].srcpitch = srcpitch;
+        jobs[i].dstpitch = dstpitch;
+        jobs[i].srcsize = srcwidth;
+        jobs[i].dstsize = dstwidth;
+        start = end;
+    }
+    pg_run_parallel(_smoothscale_job_run, "pg_transform", jobs,
+                    sizeof(_smoothscale_job), bands);
+}
+
+/* The Y filters treat every column on its own but carry state from row to
+ * row, so they are run over vertical strips instead. Strips are kept a
+ * multiple of 4 pixels wide so the SIMD filters stay on their fast path. */
+static void
+filter_Y_banded(SMOOTHSCALE_FILTER_P filter, Uint8 *srcpix, Uint8 *dstpix,
+                int width, int srcpitch, int dstpitch, int srcheight,
+                int dstheight, int num_threads)
+{
+    _smoothscale_job jobs[PG_TRANSFORM_MAX_THREADS];
+    int bands = _get_band_count(num_threads, width);
+    int i, start = 0;
+
+    if (bands == 1) {
+        filter(srcpix, dstpix, width, srcpitch, dstpitch, srcheight,
+               dstheight);
+        return;
+    }
+
+    for (i = 0; i < bands; i++) {
+        int end = (i == bands - 1)
+                      ? width
+                      : (int)((Sint64)width * (i + 1) / bands) & ~3;
+        jobs[i].filter = filter;
+        jobs[i].srcpix = srcpix + (size_t)start * 4;
+        jobs[i].dstpix = dstpix + (size_t)start * 4;
+        jobs[i].length = end - start;
+        jobs[i].srcpitch = srcpitch;
+        jobs[i].dstpitch = dstpitch;
+        jobs[i].srcsize = srcheight;
+        jobs[i].dstsize = dstheight;
+        start = end;
+    }
+    pg_run_parallel(_smoothscale_job_run, "pg_transform", jobs,
+                    sizeof(_smoothscale_job), bands);
+}
+
 static void
 scalesmooth(SDL_Surface *src, SDL_Surface *dst, struct _module_state *st)
 {
@@ -1447,46 +1690,54 @@ scalesmooth(SDL_Surface *src, SDL_Surface *dst, struct _module_state *st)
     if (dstwidth < srcwidth) /* shrink */
     {
         if (srcheight != dstheight) {
-            st->filter_shrink_X(srcpix, temppix, srcheight, srcpitch,
-                                temppitch, srcwidth, dstwidth);
+            filter_X_banded(st->filter_shrink_X, srcpix, temppix, srcheight,
+                            srcpitch, temppitch, srcwidth, dstwidth,
+                            st->num_threads);
         }
         else {
-            st->filter_shrink_X(srcpix, dstpix, srcheight, srcpitch, dstpitch,
-                                srcwidth, dstwidth);
+            filter_X_banded(st->filter_shrink_X, srcpix, dstpix, srcheight,
+                            srcpitch, dstpitch, srcwidth, dstwidth,
+                            st->num_threads);
         }
     }
     else if (dstwidth > srcwidth) /* expand */
     {
         if (srcheight != dstheight) {
-            st->filter_expand_X(srcpix, temppix, srcheight, srcpitch,
-                                temppitch, srcwidth, dstwidth);
+            filter_X_banded(st->filter_expand_X, srcpix, temppix, srcheight,
+                            srcpitch, temppitch, srcwidth, dstwidth,
+                            st->num_threads);
         }
         else {
-            st->filter_expand_X(srcpix, dstpix, srcheight, srcpitch, dstpitch,
-                                srcwidth, dstwidth);
+            filter_X_banded(st->filter_expand_X, srcpix, dstpix, srcheight,
+                            srcpitch, dstpitch, srcwidth, dstwidth,
+                            st->num_threads);
         }
     }
     /* Now do the Y scale */
     if (dstheight < srcheight) /* shrink */
     {
         if (srcwidth != dstwidth) {
-            st->filter_shrink_Y(temppix, dstpix, tempwidth, temppitch,
-                                dstpitch, srcheight, dstheight);
+            filter_Y_banded(st->filter_shrink_Y, temppix, dstpix, tempwidth,
+                            temppitch, dstpitch, srcheight, dstheight,
+                            st->num_threads);
         }
         else {
-            st->filter_shrink_Y(srcpix, dstpix, srcwidth, srcpitch, dstpitch,
-                                srcheight, dstheight);
+            filter_Y_banded(st->filter_shrink_Y, srcpix, dstpix, srcwidth,
+                            srcpitch, dstpitch, srcheight, dstheight,
+                            st->num_threads);
         }
     }
     else if (dstheight > srcheight) /* expand */
     {
         if (srcwidth != dstwidth) {
-            st->filter_expand_Y(temppix, dstpix, tempwidth, temppitch,
-                                dstpitch, srcheight, dstheight);
+            filter_Y_banded(st->filter_expand_Y, temppix, dstpix, tempwidth,
+                            temppitch, dstpitch, srcheight, dstheight,
+                            st->num_threads);
         }
         else {
-            st->filter_expand_Y(srcpix, dstpix, srcwidth, srcpitch, dstpitch,
-                                srcheight, dstheight);
+            filter_Y_banded(st->filter_expand_Y, srcpix, dstpix, srcwidth,
+                            srcpitch, dstpitch, srcheight, dstheight,
+                            st->num_threads);
         }
     }
 
@@ -1748,6 +1999,17 @@ surf_set_smoothscale_backend(PyObject *self, PyObject *args, PyObject *kwargs)
         st->filter_expand_Y = filter_expand_Y_SSE2;
     }
 #endif /* PG_ENABLE_SSE_NEON */
+    else if (strcmp(type, "AVX2") == 0) {
+        if (!pg_has_avx2()) {
+            return RAISE(PyExc_ValueError,
+                         "AVX2 not supported on this machine");
+        }
+        st->filter_type = "AVX2";
+        st->filter_shrink_X = filter_shrink_X_AVX2;
+        st->filter_shrink_Y = filter_shrink_Y_AVX2;
+        st->filter_expand_X = filter_expand_X_AVX2;
+        st->filter_expand_Y = filter_expand_Y_AVX2;
+    }
 #endif /* !__EMSCRIPTEN__ */
     else {
         return PyErr_Format(PyExc_ValueError, "Unknown backend type %s", type);
@@ -1755,6 +2017,36 @@ surf_set_smoothscale_backend(PyObject *self, PyObject *args, PyObject *kwargs)
     Py_RETURN_NONE;
 }
 
+static PyObject *
+surf_get_num_threads(PyObject *self, PyObject *_null)
+{
+    return PyLong_FromLong(GETSTATE(self)->num_threads);
+}
+
+static PyObject *
+surf_set_num_threads(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    struct _module_state *st = GETSTATE(self);
+    static char *keywords[] = {"count", NULL};
+    int count;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i", keywords, &count)) {
+        return NULL;
+    }
+
+    if (count < 0) {
+        return RAISE(PyExc_ValueError, "count must not be negative");
+    }
+    if (count == 0) {
+        count = SDL_GetCPUCount();
+    }
+    if (count > PG_TRANSFORM_MAX_THREADS) {
+        count = PG_TRANSFORM_MAX_THREADS;
+    }
+    st->num_threads = count < 1 ? 1 : count;
+    Py_RETURN_NONE;
+}
+
 /* _get_color_move_pixels is for iterating over pixels in a Surface.
 
     bpp - bytes per pixel
@@ -3726,7 +4018,8 @@ surf_average_color(PyObject *self, PyObject *args, PyObject *kwargs)
 }
 
 static int
-box_blur(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat)
+box_blur_non_simd(SDL_Surface *src, SDL_Surface *dst, int radius,
+                  SDL_bool repeat)
 {
     // Reference : https://blog.csdn.net/blogshinelee/article/details/80997324
 
@@ -3816,7 +4109,8 @@ box_blur(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat)
 }
 
 static int
-gaussian_blur(SDL_Surface *src, SDL_Surface *dst, int sigma, SDL_bool repeat)
+gaussian_blur_non_simd(SDL_Surface *src, SDL_Surface *dst, const float *lut,
+                       int kernel_radius, SDL_bool repeat)
 {
     Uint8 *srcpx = (Uint8 *)src->pixels;
     Uint8 *dstpx = (Uint8 *)dst->pixels;
@@ -3825,31 +4119,16 @@ gaussian_blur(SDL_Surface *src, SDL_Surface *dst, int sigma, SDL_bool repeat)
     int dst_pitch = dst->pitch;
     int src_pitch = src->pitch;
     int i, j, x, y, color;
-    int kernel_radius = sigma * 2;
-    float lut_sum = 0.0;
 
-    // Allocate bytes for buf, buf2, and lut at once to reduce allocations.
-    float *overall_buf =
-        malloc(sizeof(float) * (dst_pitch * 2 + kernel_radius + 1));
+    // Allocate bytes for buf and buf2 at once to reduce allocations.
+    float *overall_buf = malloc(sizeof(float) * dst_pitch * 2);
     float *buf = overall_buf;
     float *buf2 = overall_buf + dst_pitch;
-    float *lut = overall_buf + dst_pitch * 2;
 
     if (overall_buf == NULL) {
         return -1;
     }
 
-    for (i = 0; i <= kernel_radius; i++) {  // init gaussian lut
-        // Gaussian function
-        lut[i] =
-            expf(-powf((float)i, 2.0f) / (2.0f * powf((float)sigma, 2.0f)));
-        lut_sum += lut[i] * 2;
-    }
-    lut_sum -= lut[0];
-    for (i = 0; i <= kernel_radius; i++) {
-        lut[i] /= lut_sum;
-    }
-
     for (i = 0; i < dst_pitch; i++) {
         buf[i] = 0.0;
         buf2[i] = 0.0;
@@ -3904,6 +4183,74 @@ gaussian_blur(SDL_Surface *src, SDL_Surface *dst, int sigma, SDL_bool repeat)
     return 0;
 }
 
+/* The SIMD blur filters handle 4 byte pixels, and keep their running box sums
+ * below 2^24 so they can be divided in single precision. */
+#if !defined(__EMSCRIPTEN__)
+#define BLUR_SIMD_OK(surf, radius) \
+    (PG_SURF_BytesPerPixel(surf) == 4 && (radius) < 0x7FFF)
+#endif /* !defined(__EMSCRIPTEN__) */
+
+static int
+box_blur(SDL_Surface *src, SDL_Surface *dst, int radius, SDL_bool repeat)
+{
+#if !defined(__EMSCRIPTEN__)
+    if (BLUR_SIMD_OK(src, radius)) {
+        if (pg_has_avx2()) {
+            return box_blur_avx2(src, dst, radius, repeat);
+        }
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+        if (pg_HasSSE_NEON()) {
+            return box_blur_sse2(src, dst, radius, repeat);
+        }
+#endif  // defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+    }
+#endif  // !defined(__EMSCRIPTEN__)
+    return box_blur_non_simd(src, dst, radius, repeat);
+}
+
+static int
+gaussian_blur(SDL_Surface *src, SDL_Surface *dst, int sigma, SDL_bool repeat)
+{
+    int i, result;
+    int kernel_radius = sigma * 2;
+    float lut_sum = 0.0;
+    float *lut = malloc(sizeof(float) * (kernel_radius + 1));
+
+    if (lut == NULL) {
+        return -1;
+    }
+
+    for (i = 0; i <= kernel_radius; i++) {  // init gaussian lut
+        // Gaussian function
+        lut[i] =
+            expf(-powf((float)i, 2.0f) / (2.0f * powf((float)sigma, 2.0f)));
+        lut_sum += lut[i] * 2;
+    }
+    lut_sum -= lut[0];
+    for (i = 0; i <= kernel_radius; i++) {
+        lut[i] /= lut_sum;
+    }
+
+#if !defined(__EMSCRIPTEN__)
+    if (BLUR_SIMD_OK(src, kernel_radius) && pg_has_avx2()) {
+        result = gaussian_blur_avx2(src, dst, lut, kernel_radius, repeat);
+    }
+#if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+    else if (BLUR_SIMD_OK(src, kernel_radius) && pg_HasSSE_NEON()) {
+        result = gaussian_blur_sse2(src, dst, lut, kernel_radius, repeat);
+    }
+#endif  // defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
+    else {
+        result = gaussian_blur_non_simd(src, dst, lut, kernel_radius, repeat);
+    }
+#else   // defined(__EMSCRIPTEN__)
+    result = gaussian_blur_non_simd(src, dst, lut, kernel_radius, repeat);
+#endif  // !defined(__EMSCRIPTEN__)
+
+    free(lut);
+    return result;
+}
+
 static SDL_Surface *
 blur(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj, int radius,
      SDL_bool repeat, char algorithm)
@@ -3961,7 +4308,7 @@ blur(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj, int radius,
             "Source and destination surfaces need the same format."));
     }
 
-    if (radius > MIN(src->w, src->h)) {
+    if (radius >= MIN(src->w, src->h)) {
         radius = MIN(src->w, src->h) - 1;
     }
 
@@ -4203,7 +4550,7 @@ surf_pixelate(PyObject *self, PyObject *args, PyObject *kwargs)
         height = 1;
     }
 
-    SDL_Surface *temp = scale_to(src, NULL, width, height);
+    SDL_Surface *temp = scale_to(self, src, NULL, width, height);
     if (!temp) {
         return NULL; /* Exception already set in scale_to */
     }
@@ -4213,7 +4560,8 @@ surf_pixelate(PyObject *self, PyObject *args, PyObject *kwargs)
         return NULL; /* Exception already set in scale_to */
     }
 
-    new_surf = scale_to(intermediate, dst, src_surf->w, src_surf->h);
+    new_surf =
+        scale_to(self, intermediate, dst, src_surf->w, src_surf->h);
     Py_DECREF(intermediate);
 
     if (new_surf == NULL) {
@@ -4250,6 +4598,10 @@ static PyMethodDef _transform_methods[] = {
      DOC_TRANSFORM_GETSMOOTHSCALEBACKEND},
     {"set_smoothscale_backend", (PyCFunction)surf_set_smoothscale_backend,
      METH_VARARGS | METH_KEYWORDS, DOC_TRANSFORM_SETSMOOTHSCALEBACKEND},
+    {"get_num_threads", surf_get_num_threads, METH_NOARGS,
+     DOC_TRANSFORM_GETNUMTHREADS},
+    {"set_num_threads", (PyCFunction)surf_set_num_threads,
+     METH_VARARGS | METH_KEYWORDS, DOC_TRANSFORM_SETNUMTHREADS},
     {"threshold", (PyCFunction)surf_threshold, METH_VARARGS | METH_KEYWORDS,
      DOC_TRANSFORM_THRESHOLD},
     {"laplacian", (PyCFunction)surf_laplacian, METH_VARARGS | METH_KEYWORDS,
@@ -4320,5 +4672,8 @@ MODINIT_DEFINE(transform)
     if (st->filter_type == 0) {
         smoothscale_init(st);
     }
+    if (st->num_threads == 0) {
+        st->num_threads = 1;
+    }
     return module;
 }
@@ -88,8 +88,10 @@ import types
 from warnings import warn
 
 import pygame
+from pygame.display import DirtyRegion
 from pygame.mask import from_surface
 from pygame.rect import Rect
+from pygame.surface import Surface, _blit_sprites
 from pygame.time import get_ticks
 
 
@@ -563,7 +565,10 @@ class AbstractGroup:
 
         """
         sprites = self.sprites()
-        if hasattr(surface, "blits"):
+        if type(surface) is Surface:
+            # native fast path, blits every sprite and fills spritedict in C
+            _blit_sprites(surface, sprites, special_flags, self.spritedict)
+        elif hasattr(surface, "blits"):
             self.spritedict.update(
                 zip(
                     sprites,
@@ -867,11 +872,18 @@ class LayeredUpdates(AbstractGroup):
 
         """
         spritedict = self.spritedict
-        surface_blit = surface.blit
         dirty = self.lostsprites
         self.lostsprites = []
-        dirty_append = dirty.append
         init_rect = self._init_rect
+        if type(surface) is Surface:
+            # native fast path, same dirty rect tracking as the loop below
+            _blit_sprites(
+                surface, self.sprites(), special_flags, spritedict, dirty, init_rect
+            )
+            return dirty
+
+        surface_blit = surface.blit
+        dirty_append = dirty.append
         for spr in self.sprites():
             rec = spritedict[spr]
             newrect = surface_blit(spr.image, spr.rect, None, special_flags)
@@ -1174,11 +1186,8 @@ class LayeredDirty(LayeredUpdates):
                 rect_type,
                 local_sprites,
                 local_update,
-                local_update.append,
                 self._init_rect,
             )
-            # can it be done better? because that is an O(n**2) algorithm in
-            # worst case
 
             # clear using background
             if local_bgd is not None:
@@ -1269,36 +1278,22 @@ class LayeredDirty(LayeredUpdates):
                     spr.dirty = 0
 
     @staticmethod
-    def _find_dirty_area(
-        _clip, _old_rect, _rect, _sprites, _update, _update_append, init_rect
-    ):
+    def _find_dirty_area(_clip, _old_rect, _rect, _sprites, _update, init_rect):
+        # merging happens in C, DirtyRegion keeps the rects disjoint so no
+        # area gets cleared or drawn twice
+        region = DirtyRegion(clip=_clip)
+        region.extend(_update)
         for spr in _sprites:
             if spr.dirty > 0:
                 # chose the right rect
                 if spr.source_rect:
-                    _union_rect = _rect(spr.rect.topleft, spr.source_rect.size)
+                    region.add(_rect(spr.rect.topleft, spr.source_rect.size))
                 else:
-                    _union_rect = _rect(spr.rect)
-
-                _union_rect_collidelist = _union_rect.collidelist
-                _union_rect_union_ip = _union_rect.union_ip
-                i = _union_rect_collidelist(_update)
-                while i > -1:
-                    _union_rect_union_ip(_update[i])
-                    del _update[i]
-                    i = _union_rect_collidelist(_update)
-                _update_append(_union_rect.clip(_clip))
+                    region.add(_rect(spr.rect))
 
                 if _old_rect[spr] is not init_rect:
-                    _union_rect = _rect(_old_rect[spr])
-                    _union_rect_collidelist = _union_rect.collidelist
-                    _union_rect_union_ip = _union_rect.union_ip
-                    i = _union_rect_collidelist(_update)
-                    while i > -1:
-                        _union_rect_union_ip(_update[i])
-                        del _update[i]
-                        i = _union_rect_collidelist(_update)
-                    _update_append(_union_rect.clip(_clip))
+                    region.add(_old_rect[spr])
+        _update[:] = region.get_rects()
 
     def clear(self, surface, bgd):
         """use to set background
@@ -1686,10 +1681,11 @@ def collide_mask(left, right):
     return leftmask.overlap(rightmask, (xoffset, yoffset))
 
 
-def spritecollide(sprite, group, dokill, collided=None):
+def spritecollide(sprite, group, dokill, collided=None, index=None):
     """find Sprites in a Group that intersect another Sprite
 
-    pygame.sprite.spritecollide(sprite, group, dokill, collided=None):
+    pygame.sprite.spritecollide(sprite, group, dokill, collided=None,
+                                index=None):
         return Sprite_list
 
     Return a list containing all Sprites in a Group that intersect with another
@@ -1705,7 +1701,18 @@ def spritecollide(sprite, group, dokill, collided=None):
     sprites must have a "rect" value, which is a rectangle of the sprite area,
     which will be used to calculate the collision.
 
+    The index argument is an optional pygame.geometry.SpatialHash holding the
+    sprites of the group. Only the sprites it finds overlapping sprite.rect
+    are checked, so the callback must only accept sprites whose rects
+    overlap. The returned list is then in the order of the index.
+
     """
+    if index is not None:
+        group = [
+            group_sprite
+            for group_sprite in index.query(sprite.rect)
+            if group.has_internal(group_sprite)
+        ]
     if collided is not None:
         collided_sprites = [
             group_sprite for group_sprite in group if collided(sprite, group_sprite)
@@ -1723,7 +1730,7 @@ def spritecollide(sprite, group, dokill, collided=None):
     return collided_sprites
 
 
-def groupcollide(groupa, groupb, dokilla, dokillb, collided=None):
+def groupcollide(groupa, groupb, dokilla, dokillb, collided=None, index=None):
     """detect collision between a group and another group
 
     pygame.sprite.groupcollide(groupa, groupb, dokilla, dokillb):
@@ -1740,13 +1747,18 @@ def groupcollide(groupa, groupb, dokilla, dokillb, collided=None):
     sprites must have a "rect" value, which is a rectangle of the sprite area
     that will be used to calculate the collision.
 
+    The index argument is an optional pygame.geometry.SpatialHash holding the
+    sprites of groupb, see spritecollide.
+
     """
     collided_sprites = {}
     # pull the collision function in as a local variable outside
     # the loop as this makes the loop run faster
     sprite_collide_func = spritecollide
     for group_a_sprite in groupa:
-        collisions = sprite_collide_func(group_a_sprite, groupb, dokillb, collided)
+        collisions = sprite_collide_func(
+            group_a_sprite, groupb, dokillb, collided, index
+        )
         if collisions:
             collided_sprites[group_a_sprite] = collisions
     if dokilla:
@@ -1755,7 +1767,7 @@ def groupcollide(groupa, groupb, dokilla, dokillb, collided=None):
     return collided_sprites
 
 
-def spritecollideany(sprite, group, collided=None):
+def spritecollideany(sprite, group, collided=None, index=None):
     """finds any sprites in a group that collide with the given sprite
 
     pygame.sprite.spritecollideany(sprite, group): return sprite
@@ -1773,7 +1785,16 @@ def spritecollideany(sprite, group, collided=None):
     sprites must have a "rect" value, which is a rectangle of the sprite area,
     which will be used to calculate the collision.
 
+    The index argument is an optional pygame.geometry.SpatialHash holding the
+    sprites of the group, see spritecollide.
+
     """
+    if index is not None:
+        group = [
+            group_sprite
+            for group_sprite in index.query(sprite.rect)
+            if group.has_internal(group_sprite)
+        ]
     if collided is not None:
         for group_sprite in group:
             if collided(sprite, group_sprite):
@@ -794,6 +794,28 @@ class DisplayUpdateTest(unittest.TestCase):
 
         self.question(f"Is the screen green in {rects}?")
 
+    def test_update_dirty_region(self):
+        """updates the merged rects of a DirtyRegion."""
+        self.screen.fill("green")
+        region = pygame.display.DirtyRegion()
+        region.extend(
+            [
+                pygame.Rect(0, 0, 100, 100),
+                pygame.Rect(50, 50, 100, 100),
+                pygame.Rect(300, 300, 100, 100),
+                pygame.Rect(450, 450, 100, 100),
+            ]
+        )
+        pygame.display.update(region)
+        pygame.event.pump()  # so mac updates
+
+        # the region is not consumed by the update
+        self.assertEqual(len(region), 3)
+        for random_point in ((50, 50), (120, 120), (350, 350), (470, 470)):
+            self.assertEqual(self.screen.get_at(random_point), (0, 255, 0))
+
+        self.question(f"Is the screen green in {region.get_rects()}?")
+
     def test_update_none_skipped(self):
         """None is skipped inside sequences."""
         self.screen.fill("green")
@@ -859,6 +881,89 @@ class DisplayUpdateTest(unittest.TestCase):
             pygame.display.update()
 
 
+class DirtyRegionTest(unittest.TestCase):
+    def test_construction(self):
+        region = pygame.display.DirtyRegion()
+        self.assertEqual(region.tolerance, 0.25)
+        self.assertEqual(len(region), 0)
+        self.assertEqual(region.area, 0)
+        self.assertEqual(region.get_rects(), [])
+
+        self.assertEqual(pygame.display.DirtyRegion(0).tolerance, 0.0)
+        with self.assertRaises(ValueError):
+            pygame.display.DirtyRegion(-0.5)
+        with self.assertRaises(TypeError):
+            pygame.display.DirtyRegion(clip="abc")
+
+    def test_add_invalid(self):
+        region = pygame.display.DirtyRegion()
+        with self.assertRaises(TypeError):
+            region.add("abc")
+        with self.assertRaises(TypeError):
+            region.extend([(0, 0, 1, 1), "abc"])
+        with self.assertRaises(TypeError):
+            region.extend(5)
+
+    def test_overlapping_rects_merge(self):
+        region = pygame.display.DirtyRegion(tolerance=0)
+        region.add((0, 0, 10, 10))
+        region.add(pygame.Rect(5, 5, 10, 10))
+        region.add((100, 100, 10, 10))
+        self.assertEqual(
+            sorted(region.get_rects()), [pygame.Rect(0, 0, 15, 15), (100, 100, 10, 10)]
+        )
+        self.assertEqual(region.area, 15 * 15 + 100)
+
+        # a merge can make the result overlap rects added earlier
+        region.add((14, 14, 90, 90))
+        self.assertEqual(region.get_rects(), [pygame.Rect(0, 0, 110, 110)])
+
+    def test_tolerance(self):
+        rects = [(0, 0, 10, 10), (10, 0, 10, 10), (25, 0, 10, 10)]
+
+        region = pygame.display.DirtyRegion(tolerance=0)
+        region.extend(rects)
+        # side by side rects line up exactly, the gap costs 50 extra pixels
+        self.assertEqual(
+            sorted(region.get_rects()),
+            [pygame.Rect(0, 0, 20, 10), pygame.Rect(25, 0, 10, 10)],
+        )
+
+        region = pygame.display.DirtyRegion(tolerance=0.25)
+        region.extend(rects)
+        self.assertEqual(region.get_rects(), [pygame.Rect(0, 0, 35, 10)])
+
+    def test_disjoint(self):
+        rects = [
+            pygame.Rect((i * 37) % 300, (i * 53) % 300, 5 + i % 30, 5 + (i * 7) % 30)
+            for i in range(200)
+        ]
+        for tolerance in (0, 0.25, 1):
+            region = pygame.display.DirtyRegion(tolerance)
+            region.extend(rects)
+            merged = region.get_rects()
+            self.assertEqual(len(region), len(merged))
+            self.assertEqual(region.area, sum(r.w * r.h for r in merged))
+            for i, rect in enumerate(merged):
+                self.assertEqual(rect.collidelist(merged[i + 1 :]), -1)
+            for rect in rects:
+                covered = sum(rect.clip(r).w * rect.clip(r).h for r in merged)
+                self.assertEqual(covered, rect.w * rect.h)
+
+    def test_clip_and_empty_rects(self):
+        region = pygame.display.DirtyRegion(clip=(0, 0, 100, 100))
+        region.extend([None, (90, 90, 20, 20), (200, 200, 10, 10), (5, 5, 0, 10)])
+        region.add((20, 20, -10, -10))
+        self.assertEqual(
+            sorted(region.get_rects()),
+            [pygame.Rect(10, 10, 10, 10), pygame.Rect(90, 90, 10, 10)],
+        )
+
+        region.clear()
+        self.assertEqual(len(region), 0)
+        self.assertEqual(region.get_rects(), [])
+
+
 class DisplayUpdateInteractiveTest(DisplayUpdateTest):
     """Because we want these tests to run as interactive and not interactive."""
 
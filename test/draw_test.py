@@ -1,3 +1,4 @@
+import array
 import itertools
 import math
 import sys
@@ -2428,6 +2429,64 @@ class DrawLinesTest(LinesMixin, DrawTestCase):
     to add any draw.lines specific tests to.
     """
 
+    def test_lines__joint_square(self):
+        """Ensures thick closed lines with miter joints have square corners."""
+        line_color = pygame.Color("white")
+        surface = pygame.Surface((40, 40))
+        points = ((10, 10), (30, 10), (30, 30), (10, 30))
+
+        bounding_rect = self.draw_lines(
+            surface, line_color, True, points, 3, joint="miter"
+        )
+
+        self.assertEqual(bounding_rect, pygame.Rect(9, 9, 23, 23))
+        for x, y in itertools.product(range(40), range(40)):
+            inside = 9 <= x <= 31 and 9 <= y <= 31
+            hollow = 12 <= x <= 28 and 12 <= y <= 28
+            expected_color = line_color if inside and not hollow else (0, 0, 0)
+            self.assertEqual(surface.get_at((x, y)), expected_color, (x, y))
+
+    def test_lines__joints(self):
+        """Ensures a bevel joint is within a round one, within a miter one."""
+        line_color = pygame.Color("white")
+        points = ((5, 30), (20, 5), (35, 30))
+        drawn = {}
+
+        for joint in ("miter", "round", "bevel"):
+            surface = pygame.Surface((40, 40))
+            self.draw_lines(surface, line_color, False, points, 7, joint=joint)
+            drawn[joint] = get_color_points(surface, line_color)
+
+        self.assertLess(set(drawn["bevel"]), set(drawn["round"]))
+        self.assertLess(set(drawn["round"]), set(drawn["miter"]))
+
+    def test_lines__joint_blend(self):
+        """Ensures joined lines blend overlapping parts of the path once."""
+        surface = pygame.Surface((40, 40), 0, 32)
+        points = ((5, 5), (35, 20), (5, 35), (35, 35), (20, 2))
+
+        for joint in ("miter", "round", "bevel"):
+            surface.fill((0, 0, 0))
+            self.draw_lines(
+                surface, (255, 0, 0, 128), False, points, 5, blend=True, joint=joint
+            )
+
+            reds = {
+                surface.get_at(pt).r for pt in itertools.product(range(40), range(40))
+            }
+            self.assertEqual(max(reds), 128, joint)
+
+    def test_lines__invalid_joint(self):
+        """Ensures draw lines rejects unknown joints."""
+        surface = pygame.Surface((10, 10))
+
+        with self.assertRaises(ValueError):
+            self.draw_lines(
+                surface, (255, 0, 0), False, ((1, 1), (5, 5)), joint="sharp"
+            )
+        with self.assertRaises(TypeError):
+            self.draw_lines(surface, (255, 0, 0), False, ((1, 1), (5, 5)), joint=1)
+
 
 ### AALine Testing ############################################################
 
@@ -3766,6 +3825,33 @@ class DrawAALinesTest(AALinesMixin, DrawTestCase):
     class to add any draw.aalines specific tests to.
     """
 
+    def test_aalines__joint_square(self):
+        """Ensures thick closed aalines with miter joints cover whole pixels
+        when the lines fall on pixel edges."""
+        line_color = pygame.Color("white")
+        surface = pygame.Surface((40, 40))
+        points = ((10, 10), (30, 10), (30, 30), (10, 30))
+
+        bounding_rect = self.draw_aalines(
+            surface, line_color, True, points, width=3, joint="miter"
+        )
+
+        self.assertEqual(bounding_rect, pygame.Rect(9, 9, 23, 23))
+        for x, y in itertools.product(range(40), range(40)):
+            inside = 9 <= x <= 31 and 9 <= y <= 31
+            hollow = 12 <= x <= 28 and 12 <= y <= 28
+            expected_color = line_color if inside and not hollow else (0, 0, 0)
+            self.assertEqual(surface.get_at((x, y)), expected_color, (x, y))
+
+    def test_aalines__invalid_joint(self):
+        """Ensures draw aalines rejects unknown joints."""
+        surface = pygame.Surface((10, 10))
+
+        with self.assertRaises(ValueError):
+            self.draw_aalines(
+                surface, (255, 0, 0), False, ((1, 1), (5, 5)), joint="sharp"
+            )
+
     def test_aalines__overlap(self):
         """Ensures that two adjacent antialiased lines are not overlapping.
 
@@ -4439,6 +4525,38 @@ class DrawPolygonMixin:
         for x, y in key_polygon_points:
             self.assertEqual(self.surface.get_at((x, y)), GREEN, msg=str((x, y)))
 
+    def test_polygon__span_lengths(self):
+        """Ensures filled polygons color whole rows of every length and
+        bit depth, short and long spans are filled in different ways.
+        """
+        surf_color = pygame.Color("black")
+        polygon_color = pygame.Color(10, 200, 30)
+        surfw, surfh = 80, 5
+
+        for depth in (8, 16, 24, 32):
+            surface = pygame.Surface((surfw, surfh), 0, depth)
+            expected_color = surface.unmap_rgb(surface.map_rgb(polygon_color))
+
+            for right in range(3, surfw - 1):
+                surface.fill(surf_color)
+                # A rectangle from x=3 to x=right with a point on its top.
+                vertices = (
+                    (3, 1),
+                    ((3 + right) // 2, 1),
+                    (right, 1),
+                    (right, 3),
+                    (3, 3),
+                )
+                self.draw_polygon(surface, polygon_color, vertices, 0)
+
+                for pt in ((x, y) for x in range(surfw) for y in range(surfh)):
+                    if 3 <= pt[0] <= right and 1 <= pt[1] <= 3:
+                        color = expected_color
+                    else:
+                        color = surf_color
+
+                    self.assertEqual(surface.get_at(pt), color, (depth, pt))
+
 
 class DrawPolygonTest(DrawPolygonMixin, DrawTestCase):
     """Test draw module function polygon.
@@ -7419,6 +7537,348 @@ class DrawFloodFillTest(unittest.TestCase):
         for pt in itertools.product(range(100), range(100)):
             self.assertEqual(surf.get_at(pt), surf2.get_at(pt))
 
+    def test_flood_fill__tolerance(self):
+        """Ensures flood fill spreads over colors within the tolerance."""
+        surf = pygame.Surface((30, 10), 0, 32)
+        surf.fill((100, 100, 100))
+        surf.fill((110, 95, 100), (10, 0, 10, 10))
+        surf.fill((130, 100, 100), (20, 0, 10, 10))
+        fill_color = pygame.Color(0, 0, 255)
+
+        for tolerance, expected_rect in ((0, (0, 0, 10, 10)), (10, (0, 0, 20, 10))):
+            test_surf = surf.copy()
+            bounding_rect = pygame.draw.flood_fill(
+                test_surf, fill_color, (0, 0), tolerance=tolerance
+            )
+
+            self.assertEqual(bounding_rect, expected_rect)
+            for pt in itertools.product(range(30), range(10)):
+                if pygame.Rect(expected_rect).collidepoint(pt):
+                    self.assertEqual(test_surf.get_at(pt), fill_color, pt)
+                else:
+                    self.assertEqual(test_surf.get_at(pt), surf.get_at(pt), pt)
+
+    def test_flood_fill__tolerance_with_matching_color(self):
+        """Ensures a fill color within the tolerance still ends the fill."""
+        surf = pygame.Surface((20, 20), 0, 32)
+        surf.fill((50, 50, 50))
+        pygame.draw.rect(surf, (255, 255, 255), (5, 5, 10, 10), 1)
+
+        bounding_rect = pygame.draw.flood_fill(
+            surf, (52, 48, 50), (10, 10), tolerance=5
+        )
+
+        self.assertEqual(bounding_rect, (6, 6, 8, 8))
+        self.assertEqual(surf.get_at((0, 0)), (50, 50, 50))
+
+    def test_flood_fill__mask(self):
+        """Ensures the filled pixels are set in the mask."""
+        surf = pygame.Surface((100, 100))
+        surf.fill((0, 0, 0))
+        pygame.draw.circle(surf, (255, 0, 255), (50, 50), 40, 1)
+        mask = pygame.mask.Mask((100, 100))
+        mask.set_at((0, 0))
+
+        pygame.draw.flood_fill(surf, (255, 0, 0), (50, 50), mask=mask)
+
+        self.assertEqual(mask.get_at((0, 0)), 1)
+        filled_count = sum(
+            surf.get_at(pt) == (255, 0, 0)
+            for pt in itertools.product(range(100), range(100))
+        )
+        self.assertEqual(mask.count(), filled_count + 1)
+        for pt in ((50, 50), (20, 50), (50, 79)):
+            self.assertEqual(mask.get_at(pt), 1, pt)
+        for pt in ((5, 5), (10, 50), (50, 90)):
+            self.assertEqual(mask.get_at(pt), 0, pt)
+
+    def test_flood_fill__mask_overlap(self):
+        """Ensures overlap tests of the mask see the bits set by the fill."""
+        surf = pygame.Surface((256, 256))
+        surf.fill((0, 0, 0))
+        pygame.draw.rect(surf, (255, 255, 255), (200, 200, 20, 20))
+        mask = pygame.mask.Mask((256, 256))
+        other = pygame.mask.Mask((256, 256))
+        other.draw(pygame.mask.Mask((10, 10), fill=True), (205, 205))
+        self.assertEqual(mask.overlap_area(other, (0, 0)), 0)
+
+        pygame.draw.flood_fill(surf, (255, 0, 0), (210, 210), mask=mask)
+
+        self.assertEqual(mask.overlap_area(other, (0, 0)), 100)
+
+    def test_flood_fill__invalid_args(self):
+        """Ensures invalid tolerances and masks are rejected."""
+        surf = pygame.Surface((20, 20))
+
+        for tolerance in (-1, 256):
+            with self.assertRaises(ValueError):
+                pygame.draw.flood_fill(surf, (255, 0, 0), (0, 0), tolerance=tolerance)
+
+        with self.assertRaises(ValueError):
+            pygame.draw.flood_fill(
+                surf, (255, 0, 0), (0, 0), mask=pygame.mask.Mask((20, 21))
+            )
+
+        with self.assertRaises(TypeError):
+            pygame.draw.flood_fill(surf, (255, 0, 0), (0, 0), mask=surf)
+
+
+class DrawManyTest(unittest.TestCase):
+    """Tests for drawing many shapes in one call."""
+
+    def _check_same_as_single_calls(self, kind, params, single, width=None):
+        surf_color = pygame.Color("black")
+        shape_color = pygame.Color("yellow")
+        kwargs = {} if width is None else {"width": width}
+        surface = pygame.Surface((40, 40), 0, 32)
+        expected_surface = surface.copy()
+        surface.fill(surf_color)
+        expected_surface.fill(surf_color)
+        surface.set_clip((2, 3, 30, 30))
+        expected_surface.set_clip((2, 3, 30, 30))
+
+        bounding_rect = draw.many(surface, kind, shape_color, params, **kwargs)
+
+        expected_rects = [
+            single(expected_surface, shape_color, shape, **kwargs)
+            for shape in zip(*[iter(params)] * (3 if kind == "circle" else 4))
+        ]
+        expected_rect = expected_rects[0].unionall(expected_rects[1:])
+
+        self.assertEqual(bounding_rect, expected_rect, kind)
+        for pt in itertools.product(range(40), range(40)):
+            self.assertEqual(surface.get_at(pt), expected_surface.get_at(pt), pt)
+
+    def test_many__line(self):
+        """Ensures many lines are drawn the same as with draw.line()."""
+        params = array.array("i", [1, 1, 30, 20, 35, 0, 5, 39, -5, 10, 50, 12])
+
+        for width in (None, 1, 4):
+            self._check_same_as_single_calls(
+                "line",
+                params,
+                lambda surf, color, p, **kw: draw.line(surf, color, p[:2], p[2:], **kw),
+                width,
+            )
+
+    def test_many__aaline(self):
+        """Ensures many aalines are drawn the same as with draw.aaline()."""
+        params = array.array("d", [1.5, 1.25, 30, 20.5, 35, 0, 5.75, 39])
+
+        for width in (None, 3):
+            self._check_same_as_single_calls(
+                "aaline",
+                params,
+                lambda surf, color, p, **kw: draw.aaline(
+                    surf, color, p[:2], p[2:], **kw
+                ),
+                width,
+            )
+
+    def test_many__rect(self):
+        """Ensures many rects are drawn the same as with draw.rect()."""
+        params = array.array("h", [0, 0, 10, 10, 20, 5, 15, 30, 25, 25, 30, 2])
+
+        for width in (None, 0, 1, 3):
+            self._check_same_as_single_calls("rect", params, draw.rect, width)
+
+    def test_many__circle(self):
+        """Ensures many circles are drawn the same as with draw.circle()."""
+        params = array.array("f", [10, 10, 8, 30.5, 20, 12, 2, 35, 5])
+
+        for width in (None, 0, 1, 3):
+            self._check_same_as_single_calls(
+                "circle",
+                params,
+                lambda surf, color, p, **kw: draw.circle(
+                    surf, color, p[:2], int(p[2]), **kw
+                ),
+                width,
+            )
+
+    def test_many__colors(self):
+        """Ensures each shape can have its own color."""
+        surface = pygame.Surface((10, 2), 0, 32)
+        colors = [pygame.Color("red"), (0, 255, 0), "blue"]
+        params = array.array("i", [0, 0, 1, 1, 2, 0, 1, 1, 4, 0, 1, 1])
+
+        bounding_rect = draw.many(surface, "rect", colors, params)
+
+        self.assertEqual(bounding_rect, pygame.Rect(0, 0, 5, 1))
+        for i, color in enumerate(colors):
+            self.assertEqual(surface.get_at((i * 2, 0)), pygame.Color(color))
+            self.assertEqual(surface.get_at((i * 2 + 1, 0)), (0, 0, 0))
+
+    def test_many__nothing_drawn(self):
+        """Ensures the bounding rect of nothing drawn is positioned at the
+        first shape, or at (0, 0) without any shape.
+        """
+        surface = pygame.Surface((10, 10))
+
+        self.assertEqual(
+            draw.many(surface, "circle", "red", array.array("i", [50, 60, 2])),
+            pygame.Rect(50, 60, 0, 0),
+        )
+        self.assertEqual(
+            draw.many(surface, "line", "red", array.array("i")),
+            pygame.Rect(0, 0, 0, 0),
+        )
+
+    def test_many__invalid_args(self):
+        """Ensures many() rejects invalid kinds, params and colors."""
+        surface = pygame.Surface((10, 10))
+        params = array.array("i", [1, 2, 3])
+
+        with self.assertRaises(ValueError):
+            draw.many(surface, "triangle", "red", params)
+        with self.assertRaises(TypeError):
+            draw.many(surface, "circle", "red", [1, 2, 3])
+        with self.assertRaises(ValueError):
+            draw.many(surface, "line", "red", params)
+        with self.assertRaises(ValueError):
+            draw.many(surface, "circle", "red", array.array("B", [1, 2, 3]))
+        with self.assertRaises(TypeError):
+            draw.many(surface, "circle", ["red", "blue"], params)
+
+    def test_many__standard_size_format(self):
+        """Ensures many() reads params of '=' formats, whose items have the
+        standard sizes, when those are the sizes of the C types."""
+        surface = pygame.Surface((40, 40))
+        expected_surface = surface.copy()
+        params = array.array("i", [10, 12, 8])
+        byteorder = "<" if sys.byteorder == "little" else ">"
+        proxy = pygame.BufferProxy(
+            {
+                "shape": (3,),
+                "typestr": f"{byteorder}i{params.itemsize}",
+                "data": (params.buffer_info()[0], False),
+            }
+        )
+        self.assertEqual(memoryview(proxy).format, "=i")
+
+        bounding_rect = draw.many(surface, "circle", "red", proxy)
+
+        expected_rect = draw.circle(expected_surface, "red", (10, 12), 8)
+        self.assertEqual(bounding_rect, expected_rect)
+        for pt in itertools.product(range(40), range(40)):
+            self.assertEqual(surface.get_at(pt), expected_surface.get_at(pt), pt)
+
+
+class DrawBlendTest(unittest.TestCase):
+    """Tests for drawing shapes with blend=True."""
+
+    def test_blend__opaque_rect(self):
+        """Ensures an opaque rect is drawn without partial pixels."""
+        surface = pygame.Surface((30, 30), 0, 32)
+        expected_surface = surface.copy()
+        color = pygame.Color("yellow")
+
+        for rect_args in (((3, 4, 20, 10),), ((3, 4, 20, 10), 2)):
+            surface.fill((0, 0, 0))
+            expected_surface.fill((0, 0, 0))
+
+            bounding_rect = draw.rect(surface, color, *rect_args, blend=True)
+            expected_rect = draw.rect(expected_surface, color, *rect_args)
+
+            self.assertEqual(bounding_rect, expected_rect)
+            for pt in itertools.product(range(30), range(30)):
+                self.assertEqual(surface.get_at(pt), expected_surface.get_at(pt), pt)
+
+    def test_blend__translucent_color(self):
+        """Ensures the color's alpha is blended like a blit of the color."""
+        surf_color = pygame.Color(20, 40, 255)
+        color = pygame.Color(255, 100, 0, 100)
+
+        for flags, depth in ((0, 24), (0, 32), (pygame.SRCALPHA, 32)):
+            surface = pygame.Surface((20, 20), flags, depth)
+            surface.fill(surf_color)
+            expected_surface = surface.copy()
+            patch = pygame.Surface((10, 10), pygame.SRCALPHA, 32)
+            patch.fill(color)
+            expected_surface.blit(patch, (5, 5))
+
+            draw.rect(surface, color, (5, 5, 10, 10), blend=True)
+
+            for pt in itertools.product(range(20), range(20)):
+                for drawn, expected in zip(
+                    surface.get_at(pt), expected_surface.get_at(pt)
+                ):
+                    self.assertAlmostEqual(drawn, expected, delta=1, msg=pt)
+
+    def test_blend__transparent_surface(self):
+        """Ensures shapes drawn on transparent pixels keep the color's alpha."""
+        surface = pygame.Surface((20, 20), pygame.SRCALPHA, 32)
+        color = pygame.Color(10, 200, 30, 120)
+
+        draw.rect(surface, color, (2, 2, 16, 16), blend=True)
+
+        self.assertEqual(surface.get_at((10, 10)), color)
+        self.assertEqual(surface.get_at((1, 1)), (0, 0, 0, 0))
+
+    def test_blend__antialiased_edges(self):
+        """Ensures the edges of shapes are partially covered pixels."""
+        color = pygame.Color("white")
+        shapes = (
+            lambda surf: draw.circle(surf, color, (20, 20), 15, blend=True),
+            lambda surf: draw.circle(surf, color, (20, 20), 15, 4, blend=True),
+            lambda surf: draw.polygon(
+                surf, color, [(3, 3), (35, 10), (10, 36)], blend=True
+            ),
+            lambda surf: draw.line(surf, color, (3, 5), (36, 30), 5, blend=True),
+            lambda surf: draw.rect(
+                surf, color, (3, 3, 34, 34), 3, border_radius=8, blend=True
+            ),
+        )
+
+        for shape in shapes:
+            surface = pygame.Surface((40, 40), 0, 32)
+            surface.fill((0, 0, 0))
+
+            bounding_rect = shape(surface)
+
+            levels = set()
+            for pt in itertools.product(range(40), range(40)):
+                level = surface.get_at(pt).r
+                levels.add(level)
+                if not bounding_rect.collidepoint(pt):
+                    self.assertEqual(level, 0, pt)
+            self.assertIn(255, levels)
+            self.assertTrue(levels - {0, 255})
+
+    def test_blend__overlap_drawn_once(self):
+        """Ensures overlapping parts of one shape are only blended once."""
+        surface = pygame.Surface((40, 20), 0, 32)
+        surface.fill((0, 0, 0))
+        color = pygame.Color(255, 0, 0, 128)
+        points = [(2, 10), (37, 10), (2, 10), (37, 10)]
+
+        draw.lines(surface, color, False, points, 5, blend=True)
+
+        self.assertEqual(surface.get_at((20, 10)), (128, 0, 0, 255))
+
+    def test_blend__clip(self):
+        """Ensures nothing is blended outside of the clip area."""
+        surface = pygame.Surface((30, 30), 0, 32)
+        surface.fill((0, 0, 0))
+        clip = pygame.Rect(5, 6, 15, 12)
+        surface.set_clip(clip)
+
+        bounding_rect = draw.circle(
+            surface, (255, 255, 255, 200), (10, 10), 12, blend=True
+        )
+
+        self.assertTrue(clip.contains(bounding_rect))
+        for pt in itertools.product(range(30), range(30)):
+            if not clip.collidepoint(pt):
+                self.assertEqual(surface.get_at(pt), (0, 0, 0, 255), pt)
+
+    def test_blend__keyword_only(self):
+        """Ensures blend can only be passed by keyword."""
+        surface = pygame.Surface((10, 10))
+
+        with self.assertRaises(TypeError):
+            draw.line(surface, (255, 0, 0), (0, 0), (5, 5), 1, True)
+
 
 ### Draw Module Testing #######################################################
 
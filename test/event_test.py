@@ -1,5 +1,8 @@
 import collections
+import inspect
 import os
+import struct
+import sys
 import time
 import unittest
 
@@ -642,6 +645,82 @@ class EventModuleTest(unittest.TestCase):
         pygame.event.get()  # should clear the queue completely by getting all events
         self.assertEqual(pygame.event.get(), [])
 
+    def test_get_array(self):
+        """Ensure get_array() takes the events off the queue as records."""
+        pygame.event.get()
+        posted = [
+            pygame.event.Event(pygame.USEREVENT, a=1),
+            pygame.event.Event(pygame.KEYDOWN, key=pygame.K_a),
+            pygame.event.Event(pygame.USEREVENT, a=2),
+        ]
+        for event in posted:
+            pygame.event.post(event)
+
+        events = pygame.event.get_array()
+
+        self.assertIsInstance(events, pygame.event.EventArray)
+        self.assertEqual(len(events), len(posted))
+        self.assertEqual(pygame.event.get(), [])
+        self.assertEqual(list(events), posted)
+        self.assertIs(events[-1], events[2])
+        self.assertEqual(events.field("type").tolist(), [e.type for e in posted])
+
+        view = memoryview(events)
+        self.assertTrue(view.readonly)
+        self.assertEqual(view.shape, (len(posted),))
+        self.assertEqual(view.nbytes, len(posted) * view.itemsize)
+        view.release()
+        # Writing needs a writable buffer, which must be refused.
+        with self.assertRaises(TypeError):
+            struct.pack_into("B", events, 0, 0)
+        with self.assertRaises(TypeError):
+            struct.pack_into("B", events.field("type"), 0, 0)
+        if sys.version_info >= (3, 12):
+            with self.assertRaises(BufferError):
+                events.__buffer__(inspect.BufferFlags.WRITABLE)
+
+        with self.assertRaises(IndexError):
+            events[len(posted)]
+        with self.assertRaises(KeyError):
+            events.field("unknown")
+
+    def test_get_array__filters(self):
+        """Ensure get_array() takes the same arguments as get()."""
+        pygame.event.get()
+        pygame.event.post(pygame.event.Event(pygame.USEREVENT))
+        pygame.event.post(pygame.event.Event(pygame.KEYDOWN))
+        pygame.event.post(pygame.event.Event(pygame.KEYUP))
+
+        events = pygame.event.get_array(pygame.KEYDOWN)
+        self.assertEqual(events.field("type").tolist(), [pygame.KEYDOWN])
+
+        events = pygame.event.get_array(exclude=pygame.KEYUP)
+        self.assertEqual(events.field("type").tolist(), [pygame.USEREVENT])
+
+        self.assertEqual(len(pygame.event.get_array()), 1)
+        self.assertRaises(
+            pygame.error,
+            pygame.event.get_array,
+            pygame.KEYDOWN,
+            False,
+            pygame.KEYUP,
+        )
+
+    def test_get_array__reuse(self):
+        """Ensure an array still held is not reused by the next call."""
+        pygame.event.get()
+        pygame.event.post(pygame.event.Event(pygame.USEREVENT, a=1))
+        first = pygame.event.get_array()
+        types = first.field("type")
+
+        pygame.event.post(pygame.event.Event(pygame.KEYDOWN))
+        second = pygame.event.get_array()
+
+        self.assertIsNot(first, second)
+        self.assertEqual(types.tolist(), [pygame.USEREVENT])
+        self.assertEqual(first[0].a, 1)
+        self.assertEqual(second[0].type, pygame.KEYDOWN)
+
     def test_clear(self):
         """Ensure clear() removes all the events on the queue."""
         for e in EVENT_TYPES:
@@ -908,6 +987,34 @@ class EventModuleTest(unittest.TestCase):
 
         self.assertTrue(blocked)
 
+    def test_set_coalescing__and_get_symmetric(self):
+        """Ensure the coalescing state can be set and retrieved."""
+        self.assertFalse(pygame.event.get_coalescing())
+
+        for coalesce in (True, False, 1, 0):
+            pygame.event.set_coalescing(coalesce)
+
+            self.assertEqual(pygame.event.get_coalescing(), bool(coalesce))
+
+    def test_set_coalescing__posted_events(self):
+        """Ensure posted events are neither merged nor reordered."""
+        pygame.event.set_coalescing(True)
+        events = [
+            pygame.event.Event(pygame.MOUSEMOTION, pos=(1, 1), rel=(1, 1)),
+            pygame.event.Event(pygame.MOUSEMOTION, pos=(2, 2), rel=(1, 1)),
+            pygame.event.Event(pygame.MOUSEBUTTONDOWN, pos=(2, 2), button=1),
+            pygame.event.Event(pygame.MOUSEMOTION, pos=(3, 3), rel=(1, 1)),
+        ]
+
+        for e in events:
+            pygame.event.post(e)
+
+        got = pygame.event.get()
+        pygame.event.set_coalescing(False)
+
+        self.assertEqual([e.type for e in got], [e.type for e in events])
+        self.assertEqual([e.pos for e in got], [e.pos for e in events])
+
     @unittest.skipIf(
         os.environ.get("SDL_VIDEODRIVER") == pygame.NULL_VIDEODRIVER,
         "requires the SDL_VIDEODRIVER to be a non-null value",
@@ -517,6 +517,70 @@ class FontTypeTest(unittest.TestCase):
             ucs_4 = "\U00010000"
             s = f.render(ucs_4, False, [0, 0, 0], [255, 255, 255])
 
+    def test_render_cache(self):
+        f = pygame_font.Font(None, 20)
+        self.assertEqual(
+            f.get_render_cache_stats(),
+            {"hits": 0, "misses": 0, "evictions": 0, "size": 0, "limit": 0},
+        )
+        f.set_render_cache(2)
+
+        s1 = f.render("foo", True, "white")
+        s2 = f.render("foo", True, "white")
+        self.assertIsNot(s1, s2)
+        self.assertTrue(equal_images(s1, s2))
+        # copies by default, drawing on one must not change the next hit
+        s1.fill("red")
+        self.assertTrue(equal_images(f.render("foo", True, "white"), s2))
+
+        # every argument is part of the key
+        f.render("foo", False, "white")
+        f.render("foo", True, "white", "black")
+        stats = f.get_render_cache_stats()
+        self.assertEqual(stats["hits"], 2)
+        self.assertEqual(stats["misses"], 3)
+        self.assertEqual(stats["evictions"], 1)
+        self.assertEqual(stats["size"], 2)
+        self.assertEqual(stats["limit"], 2)
+
+        f.get_render_cache_stats(reset=True)
+        self.assertEqual(f.get_render_cache_stats()["hits"], 0)
+
+        self.assertRaises(ValueError, f.set_render_cache, -1)
+
+    def test_render_cache_shared(self):
+        f = pygame_font.Font(None, 20)
+        f.set_render_cache(8, shared=True)
+        s = f.render("foo", True, "white")
+        self.assertIs(f.render("foo", True, "white"), s)
+
+        f.set_render_cache(0)
+        self.assertIsNot(f.render("foo", True, "white"), s)
+        self.assertEqual(f.get_render_cache_stats()["size"], 0)
+
+    def test_render_cache_invalidation(self):
+        f = pygame_font.Font(None, 20)
+        f.set_render_cache(8)
+        plain = f.render("foo", True, "white")
+
+        f.bold = True
+        self.assertEqual(f.get_render_cache_stats()["size"], 0)
+        bold = f.render("foo", True, "white")
+        self.assertNotEqual(bold.get_size(), plain.get_size())
+        f.bold = False
+
+        for change in (
+            lambda: f.set_italic(True),
+            lambda: f.set_underline(True),
+            lambda: setattr(f, "strikethrough", True),
+            lambda: setattr(f, "point_size", 30),
+            lambda: f.set_point_size(25),
+            lambda: setattr(f, "outline", 1),
+        ):
+            f.render("foo", True, "white")
+            change()
+            self.assertEqual(f.get_render_cache_stats()["size"], 0)
+
     def test_set_bold(self):
         f = pygame_font.Font(None, 20)
         self.assertFalse(f.get_bold())
@@ -1107,6 +1107,143 @@ class FreeTypeFontTest(unittest.TestCase):
                 TypeError, font.render_raw_to, surf_buf, text, dest, size=24
             )
 
+    def test_freetype_Font_render_atlas(self):
+        font = self._TEST_FONTS["sans"]
+        text = "abcab"
+        color = pygame.Color("red")
+
+        atlas, quads = font.render_atlas(text, color, size=24)
+        self.assertIsInstance(atlas, pygame.Surface)
+        self.assertEqual(len(quads), len(text))
+        # repeated glyphs share their spot in the atlas
+        self.assertEqual(quads[0][0], quads[3][0])
+        self.assertEqual(quads[1][0], quads[4][0])
+        self.assertNotEqual(quads[0][0], quads[1][0])
+
+        # nothing new to pack, same atlas and quads
+        atlas2, quads2 = font.render_atlas(text, color, size=24)
+        self.assertIs(atlas2, atlas)
+        self.assertEqual(quads2, quads)
+
+        # the quads put together look like render() output
+        surf, rect = font.render(text, color, size=24)
+        expected = pygame.Surface(rect.size)
+        expected.fill("white")
+        expected.blit(surf, (0, 0))
+        result = pygame.Surface(rect.size)
+        result.fill("white")
+        result.blits([(atlas, pos, area) for area, pos in quads])
+        for x in range(rect.width):
+            for y in range(rect.height):
+                for a, b in zip(result.get_at((x, y)), expected.get_at((x, y))):
+                    self.assertAlmostEqual(a, b, delta=3)
+
+        # nothing to draw
+        atlas, quads = font.render_atlas("", color, size=24)
+        self.assertEqual(quads, [])
+
+        # unaliased (mono) glyphs
+        font.antialiased = False
+        try:
+            atlas, quads = font.render_atlas(text, color, size=24)
+            self.assertEqual(len(quads), len(text))
+        finally:
+            font.antialiased = True
+
+        self.assertRaises(
+            ValueError, font.render_atlas, text, color, ft.STYLE_UNDERLINE, size=24
+        )
+        self.assertRaises(RuntimeError, nullfont().render_atlas, "a", size=24)
+
+    def test_freetype_Font_render_atlas_to(self):
+        font = self._TEST_FONTS["sans"]
+        text = "Damage 1234"
+        color = pygame.Color(0, 0, 255)
+
+        expected = pygame.Surface((200, 50))
+        expected.fill("white")
+        erect = font.render_to(expected, (10, 5), text, color, size=24)
+
+        surf = pygame.Surface((200, 50))
+        surf.fill("white")
+        rrect = font.render_atlas_to(surf, (10, 5), text, color, size=24)
+        self.assertEqual(rrect, erect)
+        for x in range(erect.left, erect.right):
+            for y in range(erect.top, erect.bottom):
+                for a, b in zip(surf.get_at((x, y)), expected.get_at((x, y))):
+                    self.assertAlmostEqual(a, b, delta=3)
+
+        self.assertRaises(
+            TypeError, font.render_atlas_to, None, (0, 0), text, color, size=24
+        )
+
+    def test_freetype_Font_cache_budget(self):
+        font = ft.Font(self._sans_path)
+        self.assertEqual(font.cache_budget, 4 * 1024 * 1024)
+        font.cache_budget = 0
+        self.assertEqual(font.cache_budget, 0)
+        font.cache_budget = 12345
+        self.assertEqual(font.cache_budget, 12345)
+        self.assertRaises(ValueError, setattr, font, "cache_budget", -1)
+        self.assertRaises(TypeError, setattr, font, "cache_budget", "big")
+
+    def test_freetype_Font_preload(self):
+        font = ft.Font(self._sans_path)
+        text = "The quick brown fox"
+        unique = len(set(text))
+
+        count = font.preload(text, size=24)
+        self.assertEqual(count, len(text))
+        stats = font.get_cache_stats()
+        self.assertEqual(stats["misses"], unique)
+        self.assertEqual(stats["glyphs"], unique)
+        self.assertGreater(stats["resident_bytes"], 0)
+
+        # everything rendered afterwards comes from the cache
+        font.render(text, size=24)
+        stats = font.get_cache_stats(reset=True)
+        self.assertEqual(stats["misses"], unique)
+        self.assertEqual(stats["hits"], len(text) - unique + len(text))
+        stats = font.get_cache_stats()
+        self.assertEqual((stats["hits"], stats["misses"]), (0, 0))
+        self.assertEqual(stats["glyphs"], unique)
+
+        # other sizes and styles are different glyphs
+        font.preload("T", size=30)
+        font.preload("T", style=ft.STYLE_STRONG, size=24)
+        self.assertEqual(font.get_cache_stats()["misses"], 2)
+
+        self.assertRaises(TypeError, font.preload, 42)
+
+    def test_freetype_Font_cache_eviction(self):
+        font = ft.Font(self._sans_path)
+        font.preload("ABCDEFGHIJ", size=24)
+        resident = font.get_cache_stats()["resident_bytes"]
+
+        # shrinking the budget evicts right away
+        font.cache_budget = resident // 2
+        stats = font.get_cache_stats()
+        self.assertGreater(stats["evictions"], 0)
+        self.assertLessEqual(stats["resident_bytes"], resident // 2)
+        self.assertEqual(stats["budget"], resident // 2)
+
+        # the most recently used glyphs are kept
+        font.get_cache_stats(reset=True)
+        font.preload("J", size=24)
+        self.assertEqual(font.get_cache_stats()["hits"], 1)
+        font.preload("A", size=24)
+        self.assertEqual(font.get_cache_stats()["misses"], 1)
+
+        # reusing the last text with text=None survives evicted glyphs
+        surf, rect = font.render("pygame", size=24)
+        font.cache_budget = 1
+        self.assertEqual(font.get_cache_stats()["glyphs"], 0)
+        surf2, rect2 = font.render(None, size=24)
+        self.assertEqual(rect2, rect)
+        for x in range(rect.width):
+            for y in range(rect.height):
+                self.assertEqual(surf2.get_at((x, y)), surf.get_at((x, y)))
+
     def test_freetype_Font_text_is_None_with_arr(self):
         f = ft.Font(self._sans_path, 36)
         f.style = ft.STYLE_NORMAL
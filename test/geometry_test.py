@@ -3,7 +3,7 @@ import unittest
 from math import sqrt
 
 from pygame import FRect, Rect, Vector2, Vector3
-from pygame.geometry import Circle, Line
+from pygame.geometry import Circle, Line, SpatialHash
 
 
 def float_range(a, b, step):
@@ -2249,5 +2249,120 @@ class LineTypeTest(unittest.TestCase):
         self.assertEqual(line.__repr__(), l_repr)
 
 
+class SpatialHashTypeTest(unittest.TestCase):
+    def test_construction(self):
+        self.assertEqual(SpatialHash().cell_size, 64.0)
+        self.assertEqual(SpatialHash(10).cell_size, 10.0)
+        self.assertEqual(SpatialHash(cell_size=2.5).cell_size, 2.5)
+        self.assertEqual(len(SpatialHash()), 0)
+
+        for value in (0, -1, float("nan"), float("inf")):
+            with self.assertRaises(ValueError):
+                SpatialHash(value)
+        with self.assertRaises(TypeError):
+            SpatialHash("1")
+        with self.assertRaises(AttributeError):
+            SpatialHash().cell_size = 3
+
+    def test_insert_remove(self):
+        index = SpatialHash(16)
+        index.insert("a", Rect(0, 0, 10, 10))
+        index.insert("b", (5.5, 5.5, 10, 10))
+        index.insert("c", FRect(100, 100, -20, -20))
+        self.assertEqual(len(index), 3)
+        self.assertIn("b", index)
+
+        index.remove("b")
+        self.assertEqual(len(index), 2)
+        self.assertNotIn("b", index)
+        with self.assertRaises(KeyError):
+            index.remove("b")
+        with self.assertRaises(TypeError):
+            index.insert("d", "not a rect")
+        with self.assertRaises(TypeError):
+            index.insert([], Rect(0, 0, 1, 1))
+        self.assertEqual(len(index), 2)
+
+        index.clear()
+        self.assertEqual(len(index), 0)
+        self.assertEqual(index.query((0, 0, 1000, 1000)), [])
+
+    def test_insert_rect_attribute(self):
+        class Thing:
+            def __init__(self, rect):
+                self.rect = rect
+
+        thing = Thing(Rect(10, 10, 5, 5))
+        index = SpatialHash(8)
+        index.insert(thing)
+        self.assertEqual(index.query((12, 12, 1, 1)), [thing])
+
+        # the rect is copied, moving needs another insert
+        thing.rect.topleft = (200, 200)
+        self.assertEqual(index.query((200, 200, 5, 5)), [])
+        index.insert(thing)
+        self.assertEqual(index.query((200, 200, 5, 5)), [thing])
+        self.assertEqual(index.query((12, 12, 1, 1)), [])
+        self.assertEqual(len(index), 1)
+
+    def test_query(self):
+        index = SpatialHash(10)
+        index.insert(1, (0, 0, 10, 10))
+        index.insert(2, (10, 0, 10, 10))
+        index.insert(3, (-1000, -1000, 5000, 5000))
+        index.insert(4, (3, 3, 0, 5))
+
+        # touching edges do not collide, like Rect.colliderect
+        self.assertEqual(index.query((0, 0, 10, 10)), [1, 3])
+        self.assertEqual(index.query((5, 5, 10, 1)), [1, 2, 3])
+        self.assertEqual(index.query((5, 5, 0, 0)), [])
+        self.assertEqual(index.query(Rect(25, 5, -10, 1)), [2, 3])
+        self.assertEqual(index.query((5000, 5000, 1, 1)), [])
+
+    def test_query_matches_colliderect(self):
+        rects = [
+            Rect((i * 37) % 500, (i * 91) % 500, (i * 13) % 60, (i * 7) % 60)
+            for i in range(300)
+        ]
+        index = SpatialHash(32)
+        for i, rect in enumerate(rects):
+            index.insert(i, rect)
+
+        for query in (Rect(0, 0, 50, 50), Rect(100, 250, 300, 20), rects[5]):
+            expected = [i for i, rect in enumerate(rects) if query.colliderect(rect)]
+            self.assertEqual(index.query(query), expected)
+
+        expected = [
+            (a, b)
+            for a in range(len(rects))
+            for b in range(a + 1, len(rects))
+            if rects[a].colliderect(rects[b])
+        ]
+        self.assertEqual(index.pairs(), expected)
+
+    def test_query_point(self):
+        index = SpatialHash(10)
+        index.insert("a", (0, 0, 10, 10))
+        index.insert("b", (5, 5, 10, 10))
+
+        self.assertEqual(index.query_point(7, 7), ["a", "b"])
+        self.assertEqual(index.query_point((0, 0)), ["a"])
+        self.assertEqual(index.query_point(Vector2(10, 10)), ["b"])
+        self.assertEqual(index.query_point(15, 15), [])
+        with self.assertRaises(TypeError):
+            index.query_point("a")
+
+    def test_pairs(self):
+        index = SpatialHash(4)
+        index.insert("a", (0, 0, 100, 100))
+        index.insert("b", (10, 10, 10, 10))
+        index.insert("c", (15, 15, 10, 10))
+        index.insert("d", (100, 0, 10, 10))
+        self.assertEqual(index.pairs(), [("a", "b"), ("a", "c"), ("b", "c")])
+
+    def test__repr__(self):
+        self.assertEqual(repr(SpatialHash(8)), "<SpatialHash(cell_size=8.0)>")
+
+
 if __name__ == "__main__":
     unittest.main()
@@ -1487,6 +1487,74 @@ class ImageModuleTest(unittest.TestCase):
     def test_load_gif_threads(self):
         self.threads_load(glob.glob(example_path("data/*.gif")))
 
+    def test_load_async(self):
+        """Ensure load_async() loads the same images as load()."""
+        files = glob.glob(example_path("data/*.png")) + [
+            pathlib.Path(example_path("data/asprite.bmp"))
+        ]
+        pending = pygame.image.load_async(files, convert=False)
+        self.assertIsInstance(pending, pygame.image.AsyncLoad)
+
+        surfs = pending.result()
+
+        self.assertTrue(pending.done())
+        self.assertIs(pending.result(), surfs)
+        self.assertEqual(len(surfs), len(files))
+        for file, surf in zip(files, surfs):
+            expected = pygame.image.load(file)
+            self.assertIsInstance(surf, pygame.Surface)
+            self.assertEqual(surf.size, expected.size)
+            self.assertEqual(surf.get_at((0, 0)), expected.get_at((0, 0)))
+
+    def test_load_async__colorkey(self):
+        """Ensure load_async() loads paletted images with a colorkey like
+        load(), with the key's palette entry opaque."""
+        file = example_path("data/alien1.gif")
+
+        (surf,) = pygame.image.load_async([file], convert=False).result()
+
+        expected = pygame.image.load(file)
+        self.assertEqual(expected.get_bitsize(), 8)
+        self.assertIsNotNone(expected.get_colorkey())
+        self.assertEqual(surf.get_palette(), expected.get_palette())
+        self._assertSurfaceEqual(surf, expected, file)
+
+    def test_load_async__convert(self):
+        """Ensure load_async() converts to the display format."""
+        pygame.display.init()
+        try:
+            screen = pygame.display.set_mode((1, 1))
+            files = [
+                example_path("data/asprite.bmp"),
+                example_path("data/alien1.png"),
+            ]
+
+            bmp, png = pygame.image.load_async(files).result()
+
+            expected = pygame.image.load(files[0]).convert()
+            self.assertEqual(bmp.get_bitsize(), expected.get_bitsize())
+            self.assertEqual(bmp.get_masks(), expected.get_masks())
+            expected = pygame.image.load(files[1]).convert_alpha()
+            self.assertEqual(png.get_masks(), expected.get_masks())
+            self.assertEqual(png.get_at((0, 0)), expected.get_at((0, 0)))
+        finally:
+            pygame.display.quit()
+
+    def test_load_async__errors(self):
+        """Ensure load_async() reports files it can't load."""
+        self.assertEqual(pygame.image.load_async([]).result(), [])
+
+        pending = pygame.image.load_async(
+            [example_path("data/asprite.bmp"), "not_a_file.bmp"]
+        )
+        with self.assertRaises(pygame.error):
+            pending.result()
+
+        with self.assertRaises(TypeError):
+            pygame.image.load_async([io.BytesIO(b"")])
+        with self.assertRaises(TypeError):
+            pygame.image.load_async(1)
+
     def test_from_to_bytes_exists(self):
         getattr(pygame.image, "frombytes")
         getattr(pygame.image, "tobytes")
@@ -140,6 +140,47 @@ def assertMaskEqual(testcase, m1, m2, msg=None):
     ##        testcase.assertEqual(m1.get_at((i, j)), m2.get_at((i, j)))
 
 
+def mask_points(mask):
+    """Returns the set of the positions of the set bits of the mask."""
+    width, height = mask.get_size()
+    return {(x, y) for y in range(height) for x in range(width) if mask.get_at((x, y))}
+
+
+def strip_cases():
+    """Yields (mask, other, offset) to test the mask operations that work on
+    strips of words with.
+
+    The masks are tall enough for the SIMD strip kernels to be used, and the
+    x offsets are not multiples of the word size, some of them negative.
+    """
+    rng = random.Random(2024)
+    sizes = ((150, 40), (100, 33))
+    offsets = [(x, y) for x in (-70, -33, -5, 0, 3, 37, 65, 101) for y in (-7, 0, 9)]
+
+    for density in (0.5, 0.002):
+        masks = []
+        for size in sizes:
+            mask = pygame.mask.Mask(size)
+            for pos in ((x, y) for y in range(size[1]) for x in range(size[0])):
+                if rng.random() < density:
+                    mask.set_at(pos)
+            masks.append(mask)
+
+        for mask, other in (masks, masks[::-1]):
+            for offset in offsets:
+                yield mask, other, offset
+
+
+def offset_points(points, offset, size):
+    """Returns the points moved by offset that are within size."""
+    width, height = size
+    return {
+        (x + offset[0], y + offset[1])
+        for x, y in points
+        if 0 <= x + offset[0] < width and 0 <= y + offset[1] < height
+    }
+
+
 # @unittest.skipIf(IS_PYPY, "pypy has lots of mask failures")  # TODO
 class MaskTypeTest(unittest.TestCase):
     ORIGIN_OFFSETS = (
@@ -1134,6 +1175,50 @@ class MaskTypeTest(unittest.TestCase):
         with self.assertRaises(TypeError):
             overlap_mask = mask1.overlap_mask(mask2, offset)
 
+    def test_overlap__large_masks_after_changes(self):
+        """Ensure the overlap queries of large masks see every change made
+        to them, whichever method made it.
+        """
+        terrain = pygame.mask.Mask((512, 512))
+        laser = pygame.mask.Mask((300, 40))
+        laser.draw(pygame.mask.Mask((300, 1), fill=True), (0, 1))
+        offset = (100, 200)
+
+        def check(expected_pos):
+            expected_area = 0 if expected_pos is None else 1
+            self.assertEqual(terrain.overlap(laser, offset), expected_pos)
+            self.assertEqual(terrain.overlap_area(laser, offset), expected_area)
+            self.assertEqual(terrain.overlap_mask(laser, offset).count(), expected_area)
+
+        check(None)
+
+        terrain.set_at((250, 201))
+        check((250, 201))
+
+        terrain.set_at((250, 201), 0)
+        check(None)
+
+        terrain.draw(pygame.mask.Mask((1, 1), fill=True), (399, 201))
+        check((399, 201))
+
+        terrain.erase(pygame.mask.Mask((1, 1), fill=True), (399, 201))
+        check(None)
+
+        terrain.fill()
+        self.assertEqual(terrain.overlap_area(laser, offset), 300)
+        terrain.clear()
+        check(None)
+
+        terrain.invert()
+        self.assertEqual(terrain.overlap_area(laser, offset), 300)
+        terrain.invert()
+        check(None)
+
+        terrain.set_at((511, 511))
+        check(None)
+        laser.set_at((299, 31))
+        self.assertEqual(terrain.overlap(laser, (212, 480)), (511, 511))
+
     def test_mask_access(self):
         """do the set_at, and get_at parts work correctly?"""
         m = pygame.Mask((10, 10))
@@ -1790,6 +1875,111 @@ class MaskTypeTest(unittest.TestCase):
         self.assertEqual(count, expected_count)
         self.assertEqual(mask.get_size(), expected_size)
 
+    def test_overlap__strips(self):
+        """Ensures overlap finds a common bit of tall masks at unaligned
+        offsets, or returns None if there is none."""
+        for mask, other, offset in strip_cases():
+            expected_points = mask_points(mask) & offset_points(
+                mask_points(other), offset, mask.get_size()
+            )
+            msg = f"size={mask.get_size()} offset={offset}"
+
+            overlap_pos = mask.overlap(other, offset)
+
+            if expected_points:
+                self.assertIn(overlap_pos, expected_points, msg)
+            else:
+                self.assertIsNone(overlap_pos, msg)
+
+    def test_overlap_area__strips(self):
+        """Ensures overlap_area counts the common bits of tall masks at
+        unaligned offsets."""
+        for mask, other, offset in strip_cases():
+            expected_points = mask_points(mask) & offset_points(
+                mask_points(other), offset, mask.get_size()
+            )
+            msg = f"size={mask.get_size()} offset={offset}"
+
+            self.assertEqual(
+                mask.overlap_area(other, offset), len(expected_points), msg
+            )
+
+    def test_overlap_mask__strips(self):
+        """Ensures overlap_mask sets the common bits of tall masks at
+        unaligned offsets."""
+        for mask, other, offset in strip_cases():
+            expected_points = mask_points(mask) & offset_points(
+                mask_points(other), offset, mask.get_size()
+            )
+            msg = f"size={mask.get_size()} offset={offset}"
+
+            overlap_mask = mask.overlap_mask(other, offset)
+
+            self.assertEqual(mask_points(overlap_mask), expected_points, msg)
+
+    def test_draw__strips(self):
+        """Ensures draw sets the bits of a tall mask at unaligned offsets."""
+        for mask, other, offset in strip_cases():
+            expected_points = mask_points(mask) | offset_points(
+                mask_points(other), offset, mask.get_size()
+            )
+            msg = f"size={mask.get_size()} offset={offset}"
+            mask = mask.copy()
+
+            mask.draw(other, offset)
+
+            self.assertEqual(mask_points(mask), expected_points, msg)
+
+    def test_erase__strips(self):
+        """Ensures erase clears the bits of a tall mask at unaligned
+        offsets."""
+        for mask, other, offset in strip_cases():
+            expected_points = mask_points(mask) - offset_points(
+                mask_points(other), offset, mask.get_size()
+            )
+            msg = f"size={mask.get_size()} offset={offset}"
+            mask = mask.copy()
+
+            mask.erase(other, offset)
+
+            self.assertEqual(mask_points(mask), expected_points, msg)
+
+    def test_draw__self(self):
+        """Ensures drawing a mask onto itself is the same as drawing a copy
+        of it."""
+        for mask, _, offset in strip_cases():
+            msg = f"size={mask.get_size()} offset={offset}"
+            expected_mask = mask.copy()
+            expected_mask.draw(mask, offset)
+            mask = mask.copy()
+
+            mask.draw(mask, offset)
+
+            self.assertEqual(mask_points(mask), mask_points(expected_mask), msg)
+
+    def test_erase__self(self):
+        """Ensures erasing a mask from itself is the same as erasing a copy
+        of it."""
+        for mask, _, offset in strip_cases():
+            msg = f"size={mask.get_size()} offset={offset}"
+            expected_mask = mask.copy()
+            expected_mask.erase(mask, offset)
+            mask = mask.copy()
+
+            mask.erase(mask, offset)
+
+            self.assertEqual(mask_points(mask), mask_points(expected_mask), msg)
+
+    def test_count__strips(self):
+        """Ensures the set bits of tall masks, and of tall masks drawn at
+        unaligned offsets, are counted correctly."""
+        for mask, other, offset in strip_cases():
+            msg = f"size={mask.get_size()} offset={offset}"
+            mask = mask.copy()
+            mask.draw(other, offset)
+
+            self.assertEqual(mask.count(), len(mask_points(mask)), msg)
+
     def test_centroid(self):
         """Ensure a filled mask's centroid is correctly calculated."""
         mask = pygame.mask.Mask((5, 7), fill=True)
@@ -2566,6 +2756,55 @@ class MaskTypeTest(unittest.TestCase):
                 f"size={size}",
             )
 
+    def test_connected_component_stats(self):
+        """Ensures connected_component_stats matches the component masks."""
+        mask = pygame.mask.Mask((70, 50))
+        for x, y in ((0, 0), (1, 1), (2, 0), (69, 49), (68, 49)):
+            mask.set_at((x, y))
+        mask.draw(pygame.mask.Mask((20, 10), fill=True), (30, 20))
+        mask.draw(pygame.mask.Mask((1, 15), fill=True), (10, 30))
+
+        for minimum in (0, 3, 16, 1000):
+            msg = f"minimum={minimum}"
+            components = mask.connected_components(minimum)
+            stats = mask.connected_component_stats(minimum)
+
+            self.assertEqual(len(stats), len(components), msg)
+            for (area, rect, centroid), component in zip(stats, components):
+                self.assertEqual(area, component.count(), msg)
+                self.assertIsInstance(rect, pygame.Rect, msg)
+                self.assertEqual(rect, component.get_bounding_rects()[0], msg)
+                self.assertEqual(centroid, component.centroid(), msg)
+
+        self.assertListEqual(pygame.mask.Mask((5, 5)).connected_component_stats(), [])
+
+    def test_connected_components__threads(self):
+        """Ensures the connected component methods give the same results
+        whatever the number of threads.
+        """
+        mask = pygame.mask.Mask((300, 600))
+        for y in range(0, 600, 7):
+            mask.draw(pygame.mask.Mask((1 + y % 290, 3), fill=True), (y % 13, y))
+        # A diagonal chain that crosses every strip boundary.
+        for i in range(600):
+            mask.set_at((i // 2, i))
+
+        original_count = pygame.mask.get_num_threads()
+        results = {}
+        try:
+            for count in (1, 5):
+                pygame.mask.set_num_threads(count)
+                results[count] = (
+                    mask.connected_component_stats(),
+                    mask.get_bounding_rects(),
+                    [comp.count() for comp in mask.connected_components()],
+                    mask.connected_component().count(),
+                )
+        finally:
+            pygame.mask.set_num_threads(original_count)
+
+        self.assertEqual(results[5], results[1])
+
     @unittest.skipIf(IS_PYPY, "Segfaults on pypy")
     def test_to_surface(self):
         """Ensures empty and full masks can be drawn onto surfaces."""
@@ -6324,6 +6563,23 @@ class MaskSubclassTest(unittest.TestCase):
 
 @unittest.skipIf(IS_PYPY, "pypy has lots of mask failures")  # TODO
 class MaskModuleTest(unittest.TestCase):
+    def test_set_num_threads(self):
+        original_count = pygame.mask.get_num_threads()
+        try:
+            pygame.mask.set_num_threads(3)
+            self.assertEqual(pygame.mask.get_num_threads(), 3)
+            pygame.mask.set_num_threads(count=1)
+            self.assertEqual(pygame.mask.get_num_threads(), 1)
+            pygame.mask.set_num_threads(1000)
+            self.assertEqual(pygame.mask.get_num_threads(), 64)
+            pygame.mask.set_num_threads(0)
+            self.assertGreaterEqual(pygame.mask.get_num_threads(), 1)
+
+            self.assertRaises(ValueError, pygame.mask.set_num_threads, -1)
+            self.assertRaises(TypeError, pygame.mask.set_num_threads, "2")
+        finally:
+            pygame.mask.set_num_threads(original_count)
+
     def test_from_surface(self):
         """Ensures from_surface creates a mask with the correct bits set.
 
@@ -6623,6 +6879,56 @@ class MaskModuleTest(unittest.TestCase):
             surf = pygame.surface.Surface((10, 10))
             pygame.mask.from_threshold(surf, color, color)
 
+    def test_from_surface_and_threshold__32bit_widths(self):
+        """Ensures the masks made from 32 bit surfaces have the right bits
+        set for widths that aren't a multiple of 8 or of the mask word size.
+        """
+        key = (50, 60, 70)
+        color = (100, 50, 200)
+        threshold = (10, 20, 30, 255)
+
+        def pixel(x, y):
+            # A few pixels of each kind: the key, near color, and others.
+            n = (x * 7 + y * 13) % 5
+            if n == 0:
+                return key + (255 if x % 2 else x * 3 % 256,)
+            if n == 1:
+                return (105, 40, 175, 255 - x % 256)
+            return ((x * 31) % 256, (y * 17) % 256, (x + y) % 256, n * 60)
+
+        def within(c1, c2):
+            return all(abs(c1[i] - c2[i]) < threshold[i] for i in range(3))
+
+        for width in (1, 7, 8, 9, 31, 33, 63, 65, 129, 200):
+            size = (width, 3)
+            surface = pygame.Surface(size, SRCALPHA, 32)
+            other = pygame.Surface(size, SRCALPHA, 32)
+            for x in range(width):
+                for y in range(3):
+                    surface.set_at((x, y), pixel(x, y))
+                    other.set_at((x, y), pixel(x + 1, y))
+
+            masks = {
+                "alpha": pygame.mask.from_surface(surface, 100),
+                "color": pygame.mask.from_threshold(surface, color, threshold),
+                "other": pygame.mask.from_threshold(surface, color, threshold, other),
+            }
+            surface.set_colorkey(key)
+            masks["colorkey"] = pygame.mask.from_surface(surface)
+
+            for x in range(width):
+                for y in range(3):
+                    c = surface.get_at((x, y))
+                    expected = {
+                        "alpha": c.a > 100,
+                        "color": within(c, color),
+                        "other": within(c, other.get_at((x, y))),
+                        "colorkey": c != key + (255,),
+                    }
+                    for name, mask in masks.items():
+                        msg = f"{name} width={width} pos={(x, y)}"
+                        self.assertEqual(mask.get_at((x, y)), expected[name], msg)
+
     def test_zero_size_from_surface(self):
         """Ensures from_surface can create masks from zero sized surfaces."""
         for size in ((100, 0), (0, 100), (0, 0)):
@@ -1,10 +1,12 @@
+import array
 import math
 import platform
+import sys
 import unittest
 from collections.abc import Collection, Sequence
 
 import pygame.math
-from pygame.math import Vector2, Vector3
+from pygame.math import Vector2, Vector2Array, Vector3, Vector3Array
 
 try:
     import numpy
@@ -205,6 +207,25 @@ class MathModuleTest(unittest.TestCase):
         b = 10.0
         self.assertEqual(pygame.math.smoothstep(a, b, 0.5), 0.0)
 
+    def test_freelist_recycling(self):
+        """Ensures vector temporaries are recycled and come back zeroed."""
+        pygame.math._freelist_stats(True)
+        a = Vector2(1, 2)
+        for _ in range(10):
+            b = a + a - a * 2
+        self.assertEqual(b, Vector2(0, 0))
+        c = Vector3(1, 2, 3).cross((0, 0, 1))
+        self.assertEqual(c, Vector3(2, -1, 0))
+
+        stats = pygame.math._freelist_stats()
+        self.assertGreater(stats["Vector2"]["hits"], 0)
+        self.assertLessEqual(stats["Vector2"]["size"], stats["Vector2"]["limit"])
+        self.assertEqual(Vector2(), (0, 0))
+        self.assertEqual(Vector3().epsilon, Vector2().epsilon)
+
+        pygame.math._freelist_stats(True)
+        self.assertEqual(pygame.math._freelist_stats()["Vector3"]["misses"], 0)
+
 
 class Vector2TypeTest(unittest.TestCase):
     def setUp(self):
@@ -3339,5 +3360,174 @@ class Vector3TypeTest(unittest.TestCase):
         self.assertEqual(str(exception), "Cannot delete the z attribute")
 
 
+class Vector2ArrayTypeTest(unittest.TestCase):
+    def setUp(self):
+        # more than one SIMD register worth of vectors plus a remainder
+        self.vectors = [Vector2(i * 1.5 - 7, 3 - i * 0.25) for i in range(11)]
+        self.other = [Vector2(2 - i, i * 0.75 + 1) for i in range(11)]
+
+    def assertArrayEqual(self, vec_array, vectors):
+        self.assertEqual(list(vec_array), vectors)
+
+    def test_construction(self):
+        self.assertEqual(len(Vector2Array(5)), 5)
+        self.assertArrayEqual(Vector2Array(3), [Vector2()] * 3)
+        self.assertArrayEqual(Vector2Array(self.vectors), self.vectors)
+        self.assertArrayEqual(Vector2Array([(1, 2), [3, 4]]), [(1, 2), (3, 4)])
+        self.assertEqual(repr(Vector2Array(2)), "<Vector2Array(length=2)>")
+        self.assertRaises(ValueError, Vector2Array, -1)
+        self.assertRaises(TypeError, Vector2Array, [(1, 2, 3)])
+
+    def test_item_access(self):
+        vec_array = Vector2Array(2)
+        vec_array[1] = (3, 4)
+        self.assertEqual(vec_array[1], Vector2(3, 4))
+        self.assertIsInstance(vec_array[1], Vector2)
+        vec_array[1].x = 10
+        self.assertEqual(vec_array[1], Vector2(3, 4))
+        self.assertRaises(IndexError, lambda: vec_array[2])
+        self.assertRaises(TypeError, vec_array.__setitem__, 0, "x")
+
+    def test_add_sub_ip(self):
+        vec_array = Vector2Array(self.vectors)
+        vec_array.add_ip(Vector2Array(self.other))
+        self.assertArrayEqual(
+            vec_array, [v + w for v, w in zip(self.vectors, self.other)]
+        )
+        vec_array.sub_ip(Vector2Array(self.other))
+        vec_array.sub_ip((1, 2))
+        self.assertArrayEqual(vec_array, [v - (1, 2) for v in self.vectors])
+        self.assertRaises(ValueError, vec_array.add_ip, Vector2Array(3))
+        self.assertRaises(TypeError, vec_array.add_ip, Vector3Array(11))
+
+    def test_scale_ip(self):
+        vec_array = Vector2Array(self.vectors)
+        vec_array.scale_ip(2.5)
+        self.assertArrayEqual(vec_array, [v * 2.5 for v in self.vectors])
+
+        factors = array.array("d", range(11))
+        vec_array = Vector2Array(self.vectors)
+        vec_array.scale_ip(factors)
+        self.assertArrayEqual(vec_array, [v * f for v, f in zip(self.vectors, factors)])
+        self.assertRaises(ValueError, vec_array.scale_ip, array.array("d", [1]))
+        self.assertRaises(ValueError, vec_array.scale_ip, array.array("f", factors))
+
+    def test_dot(self):
+        vec_array = Vector2Array(self.vectors)
+        self.assertEqual(
+            vec_array.dot(Vector2Array(self.other)),
+            [v.dot(w) for v, w in zip(self.vectors, self.other)],
+        )
+        self.assertEqual(vec_array.dot((0, 1)), [v.y for v in self.vectors])
+
+    def test_normalize_ip(self):
+        vec_array = Vector2Array(self.vectors)
+        vec_array.normalize_ip()
+        self.assertArrayEqual(vec_array, [v.normalize() for v in self.vectors])
+
+        vec_array = Vector2Array([(1, 1), (0, 0)])
+        self.assertRaises(ValueError, vec_array.normalize_ip)
+        self.assertArrayEqual(vec_array, [(1, 1), (0, 0)])
+
+    def test_clamp_magnitude_ip(self):
+        vec_array = Vector2Array(self.vectors)
+        vec_array.clamp_magnitude_ip(2, 5)
+        self.assertArrayEqual(
+            vec_array, [v.clamp_magnitude(2, 5) for v in self.vectors]
+        )
+        vec_array.clamp_magnitude_ip(3)
+        self.assertArrayEqual(
+            vec_array,
+            [v.clamp_magnitude(2, 5).clamp_magnitude(3) for v in self.vectors],
+        )
+        self.assertRaises(ValueError, vec_array.clamp_magnitude_ip, 5, 2)
+        self.assertRaises(ValueError, vec_array.clamp_magnitude_ip, -1)
+        self.assertRaises(ValueError, Vector2Array([(0, 0)]).clamp_magnitude_ip, 1, 2)
+
+    def test_lerp_ip(self):
+        vec_array = Vector2Array(self.vectors)
+        vec_array.lerp_ip(Vector2Array(self.other), 0.25)
+        self.assertArrayEqual(
+            vec_array, [v.lerp(w, 0.25) for v, w in zip(self.vectors, self.other)]
+        )
+        self.assertRaises(ValueError, vec_array.lerp_ip, (0, 0), 1.5)
+
+    def test_rotate_ip(self):
+        vec_array = Vector2Array(self.vectors)
+        vec_array.rotate_ip(30)
+        for vec, expected in zip(vec_array, self.vectors):
+            self.assertAlmostEqual(vec.x, expected.rotate(30).x)
+            self.assertAlmostEqual(vec.y, expected.rotate(30).y)
+
+        vec_array = Vector2Array(self.vectors)
+        vec_array.rotate_rad_ip(math.pi / 2)
+        self.assertArrayEqual(
+            vec_array, [v.rotate_rad(math.pi / 2) for v in self.vectors]
+        )
+
+    def test_buffer(self):
+        vec_array = Vector2Array([(1, 2), (3, 4), (5, 6)])
+        view = memoryview(vec_array)
+        self.assertEqual(view.shape, (2, 3))
+        self.assertEqual(view.format, "d")
+        self.assertEqual(view.tolist(), [[1, 3, 5], [2, 4, 6]])
+        view[1, 2] = 10
+        self.assertEqual(vec_array[2], Vector2(5, 10))
+        # simple requests see the same memory as flat bytes
+        self.assertEqual(b"" + vec_array, view.tobytes())
+        if sys.version_info >= (3, 12):
+            with vec_array.__buffer__(0) as flat:
+                self.assertEqual(flat.ndim, 1)
+                self.assertEqual(flat.nbytes, view.nbytes)
+        self.assertRaises(BufferError, vec_array.__init__, 2)
+        view.release()
+        vec_array.__init__(2)
+        self.assertEqual(len(vec_array), 2)
+
+
+class Vector3ArrayTypeTest(unittest.TestCase):
+    def setUp(self):
+        self.vectors = [Vector3(i - 5, 2 - i * 0.5, i * 0.25 + 1) for i in range(7)]
+        self.other = [Vector3(1, i, -i) for i in range(7)]
+
+    def test_construction(self):
+        self.assertEqual(list(Vector3Array(2)), [Vector3()] * 2)
+        self.assertEqual(list(Vector3Array(self.vectors)), self.vectors)
+        self.assertEqual(repr(Vector3Array(2)), "<Vector3Array(length=2)>")
+        self.assertRaises(TypeError, Vector3Array, [(1, 2)])
+
+    def test_bulk_math(self):
+        vec_array = Vector3Array(self.vectors)
+        vec_array.add_ip(Vector3Array(self.other))
+        vec_array.scale_ip(0.5)
+        vec_array.lerp_ip((1, 2, 3), 0.5)
+        expected = [
+            ((v + w) * 0.5).lerp((1, 2, 3), 0.5)
+            for v, w in zip(self.vectors, self.other)
+        ]
+        self.assertEqual(list(vec_array), expected)
+        self.assertEqual(
+            vec_array.dot(Vector3Array(self.other)),
+            [v.dot(w) for v, w in zip(expected, self.other)],
+        )
+        vec_array.normalize_ip()
+        self.assertEqual(list(vec_array), [v.normalize() for v in expected])
+
+    def test_rotate_ip(self):
+        vec_array = Vector3Array(self.vectors)
+        vec_array.rotate_ip(40, (1, 2, 3))
+        for vec, expected in zip(vec_array, self.vectors):
+            expected = expected.rotate(40, (1, 2, 3))
+            for i in range(3):
+                self.assertAlmostEqual(vec[i], expected[i])
+        self.assertRaises(ValueError, vec_array.rotate_rad_ip, 1, (0, 0, 0))
+        self.assertRaises(TypeError, vec_array.rotate_ip, 1)
+
+    def test_buffer(self):
+        view = memoryview(Vector3Array(self.vectors))
+        self.assertEqual(view.shape, (3, 7))
+        self.assertEqual(view.tolist()[2], [v.z for v in self.vectors])
+
+
 if __name__ == "__main__":
     unittest.main()
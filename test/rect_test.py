@@ -1,8 +1,12 @@
+import array
 import math
+import sys
 import unittest
 from collections.abc import Collection, Sequence
 
+import pygame.rect
 from pygame import FRect, Rect as IRect, Vector2
+from pygame.rect import FRectArray, RectArray
 from pygame.tests import test_utils
 
 Rect = IRect
@@ -2978,6 +2982,22 @@ class RectTypeTest(unittest.TestCase):
         self.assertEqual(r.w, 0)
         self.assertEqual(r.h, 0)
 
+    def test_freelist_recycling(self):
+        """Ensures temporaries are recycled and come back as fresh rects."""
+        pygame.rect._freelist_stats(True)
+        r = Rect(1, 2, 3, 4)
+        for _ in range(10):
+            moved = r.move(1, 1).copy()
+        self.assertEqual(moved, (2, 3, 3, 4))
+
+        stats = pygame.rect._freelist_stats()[Rect.__name__]
+        self.assertGreater(stats["hits"], 0)
+        self.assertLessEqual(stats["size"], stats["limit"])
+        self.assertEqual(Rect(), (0, 0, 0, 0))
+
+        pygame.rect._freelist_stats(True)
+        self.assertEqual(pygame.rect._freelist_stats()[Rect.__name__]["hits"], 0)
+
 
 class FRectTypeTest(RectTypeTest):
     def setUp(self):
@@ -3480,6 +3500,142 @@ class FRectTypeTest(RectTypeTest):
         self.assertEqual(r.h, 0.0)
 
 
+class RectArrayTypeTest(unittest.TestCase):
+    array_type = RectArray
+    rect_type = IRect
+    buffer_format = "i"
+
+    def _rects(self):
+        # more rects than a SIMD register holds, so the leftover path is hit
+        return [
+            self.rect_type(i * 7 - 30, i * 3 - 10, i % 5 - 1, i % 4 + 1)
+            for i in range(21)
+        ]
+
+    def test_construction(self):
+        rects = self._rects()
+        arr = self.array_type(rects)
+
+        self.assertEqual(len(arr), len(rects))
+        self.assertEqual(list(arr), rects)
+        self.assertIsInstance(arr[0], self.rect_type)
+        self.assertEqual(arr[-1], rects[-1])
+
+        zeros = self.array_type(3)
+        self.assertEqual(list(zeros), [self.rect_type(0, 0, 0, 0)] * 3)
+        self.assertEqual(len(self.array_type(0)), 0)
+
+        self.assertRaises(ValueError, self.array_type, -1)
+        self.assertRaises(TypeError, self.array_type, [1, 2])
+        self.assertRaises(TypeError, self.array_type, 1.5)
+
+    def test_item_assignment(self):
+        arr = self.array_type(2)
+        arr[1] = (1, 2, 3, 4)
+        arr[0] = self.rect_type(5, 6, 7, 8)
+
+        self.assertEqual(list(arr), [(5, 6, 7, 8), (1, 2, 3, 4)])
+        with self.assertRaises(IndexError):
+            arr[2] = (0, 0, 1, 1)
+        with self.assertRaises(IndexError):
+            arr[2]
+        with self.assertRaises(TypeError):
+            arr[0] = "rect"
+        with self.assertRaises(TypeError):
+            del arr[0]
+
+    def test_buffer(self):
+        rects = self._rects()
+        arr = self.array_type(rects)
+
+        with memoryview(arr) as view:
+            self.assertEqual(view.shape, (4, len(rects)))
+            self.assertEqual(view.format, self.buffer_format)
+            self.assertFalse(view.readonly)
+            self.assertEqual(view.tolist()[0], [r.x for r in rects])
+            self.assertEqual(view.tolist()[3], [r.h for r in rects])
+
+            view[1, 2] = 99
+            self.assertEqual(arr[2].y, 99)
+
+            # simple requests see the same memory as flat bytes
+            self.assertEqual(b"" + arr, view.tobytes())
+            if sys.version_info >= (3, 12):
+                with arr.__buffer__(0) as flat:
+                    self.assertEqual(flat.ndim, 1)
+                    self.assertEqual(flat.nbytes, view.nbytes)
+
+            # the memory can not go away while it is exported
+            self.assertRaises(BufferError, arr.__init__, 1)
+
+        arr.__init__(1)
+        self.assertEqual(len(arr), 1)
+
+    def test_move_ip(self):
+        rects = self._rects()
+        arr = self.array_type(rects)
+        dy = array.array(self.buffer_format, [i % 4 - 2 for i in range(len(rects))])
+
+        arr.move_ip(3, dy)
+        for r, y in zip(rects, dy):
+            r.move_ip(3, y)
+        self.assertEqual(list(arr), rects)
+
+        self.assertRaises(ValueError, arr.move_ip, dy[:2], 0)
+        self.assertRaises(TypeError, arr.move_ip, "x", 0)
+        self.assertRaises(TypeError, arr.move_ip, 1)
+
+    def test_clamp_ip(self):
+        rects = self._rects()
+        rects.append(self.rect_type(0, 0, 100, 100))
+        arr = self.array_type(rects)
+        area = self.rect_type(-20, -5, 60, 40)
+
+        arr.clamp_ip(area)
+        for r in rects:
+            r.clamp_ip(area)
+        self.assertEqual(list(arr), rects)
+
+        arr.clamp_ip(0, 0, 10, 10)
+        self.assertRaises(TypeError, arr.clamp_ip, "rect")
+
+    def test_colliderect(self):
+        rects = self._rects()
+        arr = self.array_type(rects)
+
+        for other in (
+            self.rect_type(-10, 0, 50, 20),
+            self.rect_type(40, 30, -50, -20),
+            self.rect_type(0, 0, 0, 10),
+        ):
+            expected = [i for i, r in enumerate(rects) if r.colliderect(other)]
+            self.assertEqual(arr.colliderect(other), expected)
+
+        self.assertEqual(self.array_type(0).colliderect((0, 0, 5, 5)), [])
+        self.assertRaises(TypeError, arr.colliderect, "rect")
+
+    def test_collidearray(self):
+        rects = self._rects()
+        others = [self.rect_type(i * 11 - 30, 0, 12, 40) for i in range(9)]
+        arr = self.array_type(rects)
+
+        expected = [
+            (i, j)
+            for i, r in enumerate(rects)
+            for j, o in enumerate(others)
+            if r.colliderect(o)
+        ]
+        self.assertEqual(arr.collidearray(self.array_type(others)), expected)
+        self.assertEqual(arr.collidearray(self.array_type(0)), [])
+        self.assertRaises(TypeError, arr.collidearray, rects)
+
+
+class FRectArrayTypeTest(RectArrayTypeTest):
+    array_type = FRectArray
+    rect_type = FRect
+    buffer_format = "f"
+
+
 class SubclassTest(unittest.TestCase):
     class MyRect(Rect):
         def __init__(self, *args, **kwds):
@@ -7,6 +7,7 @@ import unittest
 
 import pygame
 from pygame import sprite
+from pygame.geometry import SpatialHash
 
 ################################# MODULE LEVEL #################################
 
@@ -56,6 +57,38 @@ class SpriteCollideTest(unittest.TestCase):
             sprite.spritecollide(self.s1, self.ag2, dokill=False), [self.s2]
         )
 
+    def test_spritecollide__index(self):
+        # With an index only the sprites it finds are checked, sprites it
+        # holds that are not in the group are ignored.
+        index = SpatialHash(16)
+        for spr in (self.s1, self.s2, self.s3):
+            index.insert(spr)
+
+        self.assertEqual(
+            sprite.spritecollide(self.s1, self.ag2, False, index=index), [self.s2]
+        )
+        self.assertEqual(
+            sprite.spritecollideany(self.s1, self.ag2, index=index), self.s2
+        )
+        self.assertEqual(
+            sprite.groupcollide(self.ag, self.ag2, False, False, index=index),
+            {self.s1: [self.s2]},
+        )
+        self.assertEqual(
+            sprite.spritecollide(
+                self.s1, self.ag2, False, sprite.collide_circle, index
+            ),
+            sprite.spritecollide(self.s1, self.ag2, False, sprite.collide_circle),
+        )
+
+        self.s3.rect.topleft = (0, 0)
+        index.insert(self.s3)
+        self.assertEqual(
+            sorted(sprite.spritecollide(self.s1, self.ag2, True, index=index), key=id),
+            sorted([self.s2, self.s3], key=id),
+        )
+        self.assertEqual(len(self.ag2), 0)
+
     def test_spritecollide__collided_must_be_a_callable(self):
         # Need to pass a callable.
         self.assertRaises(
@@ -585,6 +618,29 @@ class AbstractGroupTypeTest(unittest.TestCase):
         self.assertEqual(self.ag.spritedict[self.s1], pygame.Rect(0, 0, 10, 10))
         self.assertEqual(self.ag.spritedict[self.s2], pygame.Rect(10, 0, 10, 10))
 
+    def test_draw_clipped(self):
+        """Ensures group drawing matches blit for sprites outside the clip."""
+        clip = pygame.Rect(2, 3, 14, 12)
+        expected_scr = self.scr.copy()
+        expected_scr.set_clip(clip)
+        self.scr.set_clip(clip)
+
+        group = sprite.Group()
+        for pos in ((-15, 5), (25, 5), (5, -30), (12, 10), (-5, -5), (4, 14)):
+            spr = sprite.Sprite(group)
+            spr.image = pygame.Surface((10, 10))
+            spr.image.fill((pos[0] * 7 % 256, pos[1] * 5 % 256, 100))
+            spr.rect = spr.image.get_rect(topleft=pos)
+
+        group.draw(self.scr)
+
+        for spr in group:
+            expected_rect = expected_scr.blit(spr.image, spr.rect)
+            self.assertEqual(group.spritedict[spr], expected_rect)
+        for x in range(20):
+            for y in range(20):
+                self.assertEqual(self.scr.get_at((x, y)), expected_scr.get_at((x, y)))
+
     def test_empty(self):
         self.ag.empty()
         self.assertFalse(self.s1 in self.ag)
@@ -1093,6 +1149,34 @@ class LayeredUpdatesTypeTest__SpriteTest(LayeredGroupBase, unittest.TestCase):
     def setUp(self):
         self.LG = sprite.LayeredUpdates()
 
+    def test_draw_dirty_rects(self):
+        screen = pygame.Surface((40, 40))
+        spr1 = self.sprite()
+        spr1.image = pygame.Surface((10, 10))
+        spr1.rect = pygame.Rect(0, 0, 10, 10)
+        spr2 = self.sprite()
+        spr2.image = pygame.Surface((10, 10))
+        spr2.rect = pygame.Rect(30, 30, 10, 10)
+        self.LG.add(spr1, spr2)
+
+        dirty = self.LG.draw(screen)
+        self.assertEqual(
+            dirty, [pygame.Rect(0, 0, 10, 10), pygame.Rect(30, 30, 10, 10)]
+        )
+
+        spr1.rect.topleft = (5, 5)
+        spr2.rect.topleft = (-20, 0)  # fully outside the surface
+        dirty = self.LG.draw(screen)
+        self.assertEqual(
+            dirty,
+            [
+                pygame.Rect(0, 0, 15, 15),
+                pygame.Rect(0, 0, 0, 0),
+                pygame.Rect(30, 30, 10, 10),
+            ],
+        )
+        self.assertEqual(self.LG.spritedict[spr2], pygame.Rect(0, 0, 0, 0))
+
 
 class LayeredUpdatesTypeTest__DirtySprite(LayeredGroupBase, unittest.TestCase):
     sprite = sprite.DirtySprite
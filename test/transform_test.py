@@ -1659,7 +1659,9 @@ class TransformModuleTest(unittest.TestCase):
 
     def test_get_smoothscale_backend(self):
         filter_type = pygame.transform.get_smoothscale_backend()
-        self.assertTrue(filter_type in ["GENERIC", "MMX", "SSE", "SSE2", "NEON"])
+        self.assertTrue(
+            filter_type in ["GENERIC", "MMX", "SSE", "SSE2", "AVX2", "NEON"]
+        )
         # It would be nice to test if a non-generic type corresponds to an x86
         # processor. But there is no simple test for this. platform.machine()
         # returns process version specific information, like 'i686'.
@@ -1711,6 +1713,82 @@ class TransformModuleTest(unittest.TestCase):
         except ValueError:
             pass  # Backends not supported on this CPU, also valid
 
+    def test_smoothscale_backends_match(self):
+        """Ensures every available smoothscale backend gives the same result."""
+        original_type = pygame.transform.get_smoothscale_backend()
+        src = pygame.Surface((37, 23), pygame.SRCALPHA, 32)
+        for pt in test_utils.rect_area_pts(src.get_rect()):
+            x, y = pt
+            src.set_at(pt, ((x * 7) % 256, (y * 11) % 256, (x * y) % 256, 200))
+
+        results = {}
+        try:
+            for backend in ("GENERIC", "SSE2", "AVX2", "NEON"):
+                try:
+                    pygame.transform.set_smoothscale_backend(backend)
+                except ValueError:
+                    continue  # not supported on this machine
+                results[backend] = [
+                    pygame.transform.smoothscale(src, size)
+                    for size in ((16, 9), (80, 61), (16, 61), (80, 9), (37, 5))
+                ]
+        finally:
+            pygame.transform.set_smoothscale_backend(original_type)
+
+        simd_backends = [b for b in results if b != "GENERIC"]
+        for backend in simd_backends[1:]:
+            for expected, result in zip(results[simd_backends[0]], results[backend]):
+                for pt in test_utils.rect_area_pts(expected.get_rect()):
+                    self.assertEqual(result.get_at(pt), expected.get_at(pt))
+
+    def test_set_num_threads(self):
+        original_count = pygame.transform.get_num_threads()
+        try:
+            pygame.transform.set_num_threads(3)
+            self.assertEqual(pygame.transform.get_num_threads(), 3)
+            pygame.transform.set_num_threads(count=1)
+            self.assertEqual(pygame.transform.get_num_threads(), 1)
+            pygame.transform.set_num_threads(1000)
+            self.assertEqual(pygame.transform.get_num_threads(), 64)
+            pygame.transform.set_num_threads(0)
+            self.assertGreaterEqual(pygame.transform.get_num_threads(), 1)
+
+            self.assertRaises(ValueError, pygame.transform.set_num_threads, -1)
+            self.assertRaises(TypeError, pygame.transform.set_num_threads, "2")
+        finally:
+            pygame.transform.set_num_threads(original_count)
+
+    def test_threaded_scale_matches(self):
+        """Ensures scaling with several threads gives the same result as one."""
+        original_count = pygame.transform.get_num_threads()
+        sizes = ((419, 307), (64, 48), (200, 480), (640, 33))
+
+        for depth in (24, 32):
+            src = pygame.Surface((200, 150), 0, depth)
+            for pt in test_utils.rect_area_pts(src.get_rect()):
+                x, y = pt
+                src.set_at(pt, ((x * 7) % 256, (y * 13) % 256, (x ^ y) % 256))
+
+            results = {}
+            try:
+                for count in (1, 4):
+                    pygame.transform.set_num_threads(count)
+                    results[count] = [
+                        func(src, size)
+                        for func in (
+                            pygame.transform.scale,
+                            pygame.transform.smoothscale,
+                        )
+                        for size in sizes
+                    ]
+            finally:
+                pygame.transform.set_num_threads(original_count)
+
+            for expected, result in zip(results[1], results[4]):
+                self.assertEqual(result.get_size(), expected.get_size())
+                for pt in test_utils.rect_area_pts(expected.get_rect()):
+                    self.assertEqual(result.get_at(pt), expected.get_at(pt))
+
     def test_chop(self):
         original_surface = pygame.Surface((20, 20))
         pygame.draw.rect(original_surface, (255, 0, 0), (0, 0, 10, 10))
@@ -2129,6 +2207,22 @@ class TransformDisplayModuleTest(unittest.TestCase):
         for pos in data2:
             self.assertTrue(sf_b2.get_at(pos) == data2[pos])
 
+    def test_blur_simd_matches_generic(self):
+        """Ensures 32 bit blurs (SIMD when available) match 24 bit ones."""
+        sf32 = pygame.Surface((67, 41), 0, 32)
+        for pt in test_utils.rect_area_pts(sf32.get_rect()):
+            x, y = pt
+            sf32.set_at(pt, ((x * 29) % 256, (y * 17) % 256, (x * y) % 256))
+        sf24 = sf32.convert(24)
+
+        for blur in (pygame.transform.box_blur, pygame.transform.gaussian_blur):
+            for radius in (0, 1, 5, 13, 40):
+                for repeat in (True, False):
+                    expected = blur(sf24, radius, repeat)
+                    result = blur(sf32, radius, repeat)
+                    for pt in test_utils.rect_area_pts(expected.get_rect()):
+                        self.assertEqual(result.get_at(pt)[:3], expected.get_at(pt)[:3])
+
     def test_blur_zero_size_surface(self):
         surface = pygame.Surface((0, 0))
         self.assertEqual(pygame.transform.box_blur(surface, 3).get_size(), (0, 0))